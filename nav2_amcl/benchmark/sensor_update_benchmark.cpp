@@ -0,0 +1,152 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <random>
+
+#include "nav2_amcl/map/map.hpp"
+#include "nav2_amcl/pf/pf.hpp"
+#include "nav2_amcl/sensors/laser/laser.hpp"
+#include "nav2_util/thread_pool.hpp"
+
+// 40m x 40m building at 5cm resolution, with walls, doorways and pillars
+constexpr int kSize = 800;
+constexpr double kResolution = 0.05;
+constexpr int kScanBeams = 720;
+constexpr double kRangeMax = 12.0;
+// Pose the scan is recorded from
+constexpr double kScanX = 3.2;
+constexpr double kScanY = -1.7;
+constexpr double kScanYaw = 0.4;
+
+enum class Model { LikelihoodField, LikelihoodFieldProb, Beam };
+
+map_t * makeMap()
+{
+  map_t * map = map_alloc();
+  map->size_x = kSize;
+  map->size_y = kSize;
+  map->scale = kResolution;
+  map->origin_x = 0.0;
+  map->origin_y = 0.0;
+  map->cells = reinterpret_cast<map_cell_t *>(malloc(sizeof(map_cell_t) * kSize * kSize));
+
+  for (int j = 0; j < kSize; j++) {
+    for (int i = 0; i < kSize; i++) {
+      const bool border = i == 0 || j == 0 || i == kSize - 1 || j == kSize - 1;
+      // Rooms of 10m, with 1.5m doorways in their walls
+      const bool wall = (i % 200 == 0 || j % 200 == 0) && (i % 200 > 30 || j % 200 > 30) &&
+        ((i + 100) % 200 > 15 && (j + 100) % 200 > 15);
+      // 40cm pillars every 5m
+      const bool pillar = (i + 50) % 100 < 8 && (j + 50) % 100 < 8;
+      map->cells[MAP_INDEX(map, i, j)].occ_state = (border || wall || pillar) ? +1 : -1;
+    }
+  }
+  return map;
+}
+
+// Replay a scan ray cast from the scan pose, with range noise and a few invalid readings
+void recordScan(map_t * map, nav2_amcl::LaserData & data)
+{
+  std::mt19937 generator(42);
+  std::normal_distribution<double> noise(0.0, 0.02);
+
+  data.range_count = kScanBeams;
+  data.range_max = kRangeMax;
+  data.ranges = new double[kScanBeams][2];
+  for (int i = 0; i < kScanBeams; i++) {
+    const double bearing = -M_PI + i * 2.0 * M_PI / kScanBeams;
+    const double range = map_calc_range(map, kScanX, kScanY, kScanYaw + bearing, kRangeMax);
+    data.ranges[i][0] = i % 101 == 0 ? NAN : std::min(range + noise(generator), kRangeMax);
+    data.ranges[i][1] = bearing;
+  }
+}
+
+// Particles spread around the scan pose, as after a few updates from an initial pose
+void sampleParticles(pf_t * pf, int particles)
+{
+  std::mt19937 generator(7);
+  std::normal_distribution<double> position(0.0, 0.5);
+  std::normal_distribution<double> heading(0.0, 0.2);
+
+  pf_sample_set_t * set = pf->sets + pf->current_set;
+  set->sample_count = particles;
+  for (int j = 0; j < particles; j++) {
+    set->samples[j].pose.v[0] = kScanX + position(generator);
+    set->samples[j].pose.v[1] = kScanY + position(generator);
+    set->samples[j].pose.v[2] = kScanYaw + heading(generator);
+    set->samples[j].weight = 1.0 / particles;
+  }
+}
+
+static void BM_SensorUpdate(benchmark::State & state, Model model)
+{
+  const int particles = state.range(0);
+  const unsigned int threads = state.range(1);
+
+  map_t * map = makeMap();
+  std::unique_ptr<nav2_amcl::Laser> laser;
+  switch (model) {
+    case Model::LikelihoodField:
+      laser = std::make_unique<nav2_amcl::LikelihoodFieldModel>(0.5, 0.5, 0.2, 2.0, 60, map);
+      break;
+    case Model::LikelihoodFieldProb:
+      laser = std::make_unique<nav2_amcl::LikelihoodFieldModelProb>(
+        0.5, 0.5, 0.2, 2.0, true, 0.5, 0.3, 0.9, 60, map);
+      break;
+    case Model::Beam:
+      laser = std::make_unique<nav2_amcl::BeamModel>(
+        0.5, 0.05, 0.05, 0.5, 0.2, 0.1, 0.0, 60, map);
+      break;
+  }
+
+  nav2_util::ThreadPool thread_pool(threads);
+  if (threads != 1) {
+    laser->setThreadPool(&thread_pool);
+  }
+  pf_vector_t laser_pose = pf_vector_zero();
+  laser->SetLaserPose(laser_pose);
+
+  nav2_amcl::LaserData data;
+  data.laser = laser.get();
+  recordScan(map, data);
+
+  pf_t * pf = pf_alloc(particles, particles, 0.001, 0.1, nullptr);
+  pf->sets[pf->current_set].converged = 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    sampleParticles(pf, particles);
+    state.ResumeTiming();
+    laser->sensorUpdate(pf, &data);
+  }
+
+  pf_free(pf);
+  laser.reset();
+  map_free(map);
+}
+
+BENCHMARK_CAPTURE(BM_SensorUpdate, likelihood_field, Model::LikelihoodField)
+->ArgsProduct({{2000, 5000}, {1, 2, 4, 8}})->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_SensorUpdate, likelihood_field_prob, Model::LikelihoodFieldProb)
+->ArgsProduct({{2000, 5000}, {1, 2, 4, 8}})->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_CAPTURE(BM_SensorUpdate, beam, Model::Beam)
+->ArgsProduct({{2000, 5000}, {1, 2, 4, 8}})->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -35,6 +35,7 @@
 #include "nav2_ros_common/lifecycle_node.hpp"
 #include "nav2_amcl/motion_model/motion_model.hpp"
 #include "nav2_amcl/sensors/laser/laser.hpp"
+#include "nav2_util/thread_pool.hpp"
 #include "nav2_msgs/msg/particle.hpp"
 #include "nav2_msgs/msg/particle_cloud.hpp"
 #include "nav2_msgs/srv/set_initial_pose.hpp"
@@ -145,6 +146,11 @@ protected:
    * @return pointer to map for AMCL to use
    */
   map_t * convertMap(const nav_msgs::msg::OccupancyGrid & map_msg);
+  /*
+   * @brief Compute the likelihood field of the map for the likelihood field laser models,
+   * or load it from the cache if enabled
+   */
+  void updateLikelihoodField();
   bool first_map_only_{true};
   std::atomic<bool> first_map_received_{false};
   amcl_hyp_t * initial_pose_hyp_;
@@ -287,6 +293,8 @@ protected:
    */
   nav2_amcl::Laser * createLaserObject();
   int scan_error_count_{0};
+  // Pool the laser models evaluate particle likelihoods on, if sensor_update_threads != 1
+  std::unique_ptr<nav2_util::ThreadPool> sensor_thread_pool_;
   std::vector<nav2_amcl::Laser *> lasers_;
   std::vector<bool> lasers_update_;
   std::map<std::string, int> frame_to_laser_;
@@ -399,6 +407,8 @@ protected:
   std::string scan_topic_{"scan"};
   std::string map_topic_{"map"};
   bool freespace_downsampling_ = false;
+  int sensor_update_threads_{1};
+  std::string likelihood_field_cache_dir_;
 };
 
 }  // namespace nav2_amcl
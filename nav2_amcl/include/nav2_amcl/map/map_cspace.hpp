@@ -0,0 +1,65 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_AMCL__MAP__MAP_CSPACE_HPP_
+#define NAV2_AMCL__MAP__MAP_CSPACE_HPP_
+
+#include <cstdint>
+#include <string>
+
+#include "nav2_amcl/map/map.hpp"
+#include "nav2_util/thread_pool.hpp"
+
+namespace nav2_amcl
+{
+
+/*
+ * @brief Update the cspace distances of a map, the distance of each cell to the closest
+ * occupied cell up to max_occ_dist, with an exact linear time Euclidean distance transform
+ * ("Distance Transforms of Sampled Functions", Felzenszwalb & Huttenlocher, 2012)
+ * @param map Map to update
+ * @param max_occ_dist Maximum distance for occupancy interest
+ * @param thread_pool Thread pool to compute the transform on, or NULL for the calling thread
+ */
+void updateCSpace(map_t * map, double max_occ_dist, nav2_util::ThreadPool * thread_pool = NULL);
+
+/*
+ * @brief Hash the geometry and occupancy of a map, with the maximum distance of its
+ * cspace, to key the cspace cache with
+ * @param map Map to hash
+ * @param max_occ_dist Maximum distance for occupancy interest
+ * @return Hash of the map
+ */
+uint64_t hashCSpace(const map_t * map, double max_occ_dist);
+
+/*
+ * @brief Load the cspace distances of a map from the cache, if cached
+ * @param map Map to load the cspace of
+ * @param max_occ_dist Maximum distance for occupancy interest
+ * @param cache_dir Directory of the cache
+ * @return If the cspace was loaded
+ */
+bool loadCSpace(map_t * map, double max_occ_dist, const std::string & cache_dir);
+
+/*
+ * @brief Save the cspace distances of a map to the cache
+ * @param map Map to save the cspace of
+ * @param cache_dir Directory of the cache, created if needed
+ * @return If the cspace was saved
+ */
+bool saveCSpace(const map_t * map, const std::string & cache_dir);
+
+}  // namespace nav2_amcl
+
+#endif  // NAV2_AMCL__MAP__MAP_CSPACE_HPP_
@@ -18,10 +18,15 @@
 #ifndef NAV2_AMCL__SENSORS__LASER__LASER_HPP_
 #define NAV2_AMCL__SENSORS__LASER__LASER_HPP_
 
+#include <cstdint>
+#include <functional>
+#include <vector>
+
 #include "nav2_amcl/map/map.hpp"
 #include "nav2_amcl/pf/pf.hpp"
 #include "nav2_amcl/pf/pf_pdf.hpp"
 #include "nav2_amcl/pf/pf_vector.hpp"
+#include "nav2_util/thread_pool.hpp"
 
 namespace nav2_amcl
 {
@@ -62,6 +67,12 @@ public:
    */
   void SetLaserPose(pf_vector_t & laser_pose);
 
+  /*
+   * @brief Set a thread pool to evaluate the sample likelihoods on
+   * @param thread_pool Thread pool to use, or NULL to evaluate them on the calling thread
+   */
+  void setThreadPool(nav2_util::ThreadPool * thread_pool);
+
 protected:
   double z_hit_;
   double z_rand_;
@@ -73,12 +84,62 @@ protected:
    * @param max_obs number of observations
    */
   void reallocTempData(int max_samples, int max_obs);
+
+  /*
+   * @brief Gather the poses of the samples, composed with the laser pose, into pose_x_,
+   * pose_y_ and pose_a_, and size likelihoods_ to the samples
+   * @param set Sample set to gather the poses of
+   */
+  void gatherLaserPoses(pf_sample_set_t * set);
+
+  /*
+   * @brief Get the number of chunks samples are evaluated in
+   * @param sample_count Number of samples
+   * @return Number of chunks
+   */
+  static size_t sampleChunkCount(int sample_count);
+
+  /*
+   * @brief Evaluate chunks of samples, on the thread pool if set. Samples are split in
+   * the same chunks whatever the number of threads.
+   * @param sample_count Number of samples
+   * @param fn Function evaluating the samples [begin, end) of the chunk of given index
+   */
+  void forEachSampleChunk(
+    int sample_count, const std::function<void(int begin, int end, size_t chunk)> & fn);
+
+  /*
+   * @brief Multiply the sample weights by their likelihoods_, in sample order so that
+   * the total weight is summed as in a serial update
+   * @param set Sample set to update
+   * @return Total weight of the samples
+   */
+  double applyLikelihoods(pf_sample_set_t * set);
+
+  /*
+   * @brief Index the distinct obstacle distances of the map cells, so that beam
+   * likelihoods are looked up per cell rather than evaluated per beam
+   * @return If the map has few enough distinct distances to be indexed
+   */
+  bool indexObstacleDistances();
+
   map_t * map_;
   pf_vector_t laser_pose_;
   int max_beams_;
   int max_samples_;
   int max_obs_;
   double ** temp_obs_;
+
+  nav2_util::ThreadPool * thread_pool_;
+  // Laser poses and likelihoods of the samples, as a structure of arrays
+  std::vector<double> pose_x_, pose_y_, pose_a_;
+  std::vector<double> likelihoods_;
+  // Beams of the scan used by the sensor model, and their index among the sampled beams
+  std::vector<double> beam_ranges_, beam_bearings_;
+  std::vector<int> beam_indices_;
+  // Index of the obstacle distance of each map cell in the distinct distances
+  std::vector<uint16_t> occ_dist_index_;
+  std::vector<float> occ_dists_;
 };
 
 /*
@@ -165,6 +226,8 @@ private:
    * @return if it was successful
    */
   static double sensorFunction(LaserData * data, pf_sample_set_t * set);
+  // Beam weights of the distinct obstacle distances
+  std::vector<double> dist_weights_;
 };
 
 /*
@@ -203,6 +266,10 @@ private:
   double beam_skip_distance_;
   double beam_skip_threshold_;
   double beam_skip_error_threshold_;
+  // Beam likelihoods of the distinct obstacle distances, their logarithms and
+  // whether they agree with the map
+  std::vector<double> dist_pz_, dist_log_pz_;
+  std::vector<uint8_t> dist_near_;
 };
 
 }  // namespace nav2_amcl
@@ -23,12 +23,14 @@
 #include "nav2_amcl/amcl_node.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "nav2_amcl/angleutils.hpp"
+#include "nav2_amcl/map/map_cspace.hpp"
 #include "nav2_util/geometry_utils.hpp"
 #include "nav2_amcl/pf/pf.hpp"
 #include "nav2_util/string_utils.hpp"
@@ -178,6 +180,12 @@ AmclNode::AmclNode(const rclcpp::NodeOptions & options)
 
   declare_parameter(
     "freespace_downsampling", rclcpp::ParameterValue(false));
+
+  declare_parameter(
+    "sensor_update_threads", rclcpp::ParameterValue(1));
+
+  declare_parameter(
+    "likelihood_field_cache_dir", rclcpp::ParameterValue(std::string("")));
 }
 
 AmclNode::~AmclNode()
@@ -314,6 +322,7 @@ AmclNode::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
   lasers_.clear();
   lasers_update_.clear();
   frame_to_laser_.clear();
+  sensor_thread_pool_.reset();
   force_update_ = true;
 
   if (set_initial_pose_) {
@@ -989,22 +998,26 @@ AmclNode::createLaserObject()
 {
   RCLCPP_INFO(get_logger(), "createLaserObject");
 
+  updateLikelihoodField();
+
+  nav2_amcl::Laser * laser;
   if (sensor_model_type_ == "beam") {
-    return new nav2_amcl::BeamModel(
+    laser = new nav2_amcl::BeamModel(
       z_hit_, z_short_, z_max_, z_rand_, sigma_hit_, lambda_short_,
       0.0, max_beams_, map_);
-  }
-
-  if (sensor_model_type_ == "likelihood_field_prob") {
-    return new nav2_amcl::LikelihoodFieldModelProb(
+  } else if (sensor_model_type_ == "likelihood_field_prob") {
+    laser = new nav2_amcl::LikelihoodFieldModelProb(
       z_hit_, z_rand_, sigma_hit_,
       laser_likelihood_max_dist_, do_beamskip_, beam_skip_distance_, beam_skip_threshold_,
       beam_skip_error_threshold_, max_beams_, map_);
+  } else {
+    laser = new nav2_amcl::LikelihoodFieldModel(
+      z_hit_, z_rand_, sigma_hit_,
+      laser_likelihood_max_dist_, max_beams_, map_);
   }
 
-  return new nav2_amcl::LikelihoodFieldModel(
-    z_hit_, z_rand_, sigma_hit_,
-    laser_likelihood_max_dist_, max_beams_, map_);
+  laser->setThreadPool(sensor_thread_pool_.get());
+  return laser;
 }
 
 void
@@ -1059,6 +1072,8 @@ AmclNode::initParameters()
   get_parameter("scan_topic", scan_topic_);
   get_parameter("map_topic", map_topic_);
   get_parameter("freespace_downsampling", freespace_downsampling_);
+  get_parameter("sensor_update_threads", sensor_update_threads_);
+  get_parameter("likelihood_field_cache_dir", likelihood_field_cache_dir_);
 
   save_pose_period_ = tf2::durationFromSec(1.0 / save_pose_rate);
   transform_tolerance_ = tf2::durationFromSec(tmp_tol);
@@ -1092,6 +1107,13 @@ AmclNode::initParameters()
     max_particles_ = min_particles_;
   }
 
+  if (sensor_update_threads_ < 0) {
+    RCLCPP_WARN(
+      get_logger(), "You've set sensor_update_threads to be negative,"
+      " this isn't allowed so it will be set to default value 1.");
+    sensor_update_threads_ = 1;
+  }
+
   if (resample_interval_ <= 0) {
     RCLCPP_WARN(
       get_logger(), "You've set resample_interval to be zero or negative,"
@@ -1382,6 +1404,41 @@ AmclNode::handleMapMessage(const nav_msgs::msg::OccupancyGrid & msg)
 #if NEW_UNIFORM_SAMPLING
   createFreeSpaceVector();
 #endif
+
+  // Compute the likelihood field on map receipt, rather than on the first scan
+  updateLikelihoodField();
+}
+
+void
+AmclNode::updateLikelihoodField()
+{
+  // The laser models only recompute the field if its max distance changed
+  if (map_ == NULL || sensor_model_type_ == "beam" ||
+    map_->max_occ_dist == laser_likelihood_max_dist_)
+  {
+    return;
+  }
+
+  if (!likelihood_field_cache_dir_.empty() &&
+    nav2_amcl::loadCSpace(map_, laser_likelihood_max_dist_, likelihood_field_cache_dir_))
+  {
+    RCLCPP_INFO(
+      get_logger(), "Loaded likelihood field from %s", likelihood_field_cache_dir_.c_str());
+    return;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  nav2_amcl::updateCSpace(map_, laser_likelihood_max_dist_, sensor_thread_pool_.get());
+  RCLCPP_INFO(
+    get_logger(), "Computed likelihood field in %.3f s",
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+  if (!likelihood_field_cache_dir_.empty() &&
+    !nav2_amcl::saveCSpace(map_, likelihood_field_cache_dir_))
+  {
+    RCLCPP_WARN(
+      get_logger(), "Failed to save likelihood field to %s", likelihood_field_cache_dir_.c_str());
+  }
 }
 
 void
@@ -1596,6 +1653,17 @@ AmclNode::initLaserScan()
 {
   scan_error_count_ = 0;
   last_laser_received_ts_ = rclcpp::Time(0);
+
+  // Particle likelihoods are evaluated on a thread pool, or on the scan callback thread
+  // with the default of a single thread. Weights are the same for any number of threads.
+  sensor_thread_pool_.reset();
+  if (sensor_update_threads_ != 1) {
+    sensor_thread_pool_ = std::make_unique<nav2_util::ThreadPool>(
+      static_cast<unsigned int>(sensor_update_threads_));
+    RCLCPP_INFO(
+      get_logger(), "Evaluating particle likelihoods on %u threads",
+      sensor_thread_pool_->size());
+  }
 }
 
 }  // namespace nav2_amcl
@@ -19,126 +19,268 @@
  *
  */
 
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <cstdio>
 #include <cstring>
-#include <queue>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
 #include "nav2_amcl/map/map.hpp"
+#include "nav2_amcl/map/map_cspace.hpp"
 
-/*
- * @struct CellData
- * @brief Data about map cells
- */
-struct CellData
+namespace nav2_amcl
 {
-  map_t * map_;
-  unsigned int i_, j_;
-  unsigned int src_i_, src_j_;
-  float occ_dist;
-};
 
-/*
- * @class CachedDistanceMap
- * @brief Cached map with distances
- */
-class CachedDistanceMap
+// Columns and rows are processed in chunks of these sizes on the thread pool
+static constexpr int kColumnChunk = 256;
+static constexpr int kRowChunk = 16;
+
+static void forEachChunk(
+  int count, int chunk_size, nav2_util::ThreadPool * thread_pool,
+  const std::function<void(int begin, int end)> & fn)
 {
-public:
-  /*
-   * @brief CachedDistanceMap constructor
-   */
-  CachedDistanceMap(double scale, double max_dist)
-  : distances_(NULL), scale_(scale), max_dist_(max_dist)
-  {
-    cell_radius_ = max_dist / scale;
-    distances_ = new double *[cell_radius_ + 2];
-    for (int i = 0; i <= cell_radius_ + 1; i++) {
-      distances_[i] = new double[cell_radius_ + 2];
-      for (int j = 0; j <= cell_radius_ + 1; j++) {
-        distances_[i][j] = sqrt(i * i + j * j);
-      }
+  const size_t chunks = (count + chunk_size - 1) / chunk_size;
+  auto process = [&](size_t chunk) {
+      const int begin = static_cast<int>(chunk) * chunk_size;
+      fn(begin, std::min(count, begin + chunk_size));
+    };
+
+  if (thread_pool && chunks > 1) {
+    thread_pool->parallelFor(chunks, process);
+  } else {
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+      process(chunk);
     }
   }
+}
 
-  /*
-   * @brief CachedDistanceMap destructor
-   */
-  ~CachedDistanceMap()
-  {
-    if (distances_) {
-      for (int i = 0; i <= cell_radius_ + 1; i++) {
-        delete[] distances_[i];
-      }
-      delete[] distances_;
-    }
+void updateCSpace(map_t * map, double max_occ_dist, nav2_util::ThreadPool * thread_pool)
+{
+  map->max_occ_dist = max_occ_dist;
+
+  const int size_x = map->size_x;
+  const int size_y = map->size_y;
+  if (size_x <= 0 || size_y <= 0) {
+    return;
   }
-  double ** distances_;
-  double scale_;
-  double max_dist_;
-  int cell_radius_;
-};
 
-/*
- * @brief operator<
- */
-bool operator<(const CellData & a, const CellData & b)
+  // Distances are only of interest up to the cell radius. Column distances are capped
+  // past it, which leaves every distance within the radius exact.
+  const int cell_radius = max_occ_dist / map->scale;
+  const int32_t cap = cell_radius + 1;
+
+  // First pass: distance along each column to the closest occupied cell of the column
+  std::vector<int32_t> column_dist(static_cast<size_t>(size_x) * size_y);
+  forEachChunk(
+    size_x, kColumnChunk, thread_pool, [&](int begin, int end) {
+      for (int i = begin; i < end; i++) {
+        const int index = MAP_INDEX(map, i, 0);
+        column_dist[index] = map->cells[index].occ_state == +1 ? 0 : cap;
+      }
+      for (int j = 1; j < size_y; j++) {
+        for (int i = begin; i < end; i++) {
+          const int index = MAP_INDEX(map, i, j);
+          column_dist[index] = map->cells[index].occ_state == +1 ?
+          0 : std::min(column_dist[index - size_x] + 1, cap);
+        }
+      }
+      for (int j = size_y - 2; j >= 0; j--) {
+        for (int i = begin; i < end; i++) {
+          const int index = MAP_INDEX(map, i, j);
+          column_dist[index] = std::min(column_dist[index], column_dist[index + size_x] + 1);
+        }
+      }
+    });
+
+  // Second pass: squared distance along each row to the lower envelope of the parabolas
+  // rooted at the column distances, i.e. the squared distance to the closest occupied cell
+  const float max_dist = max_occ_dist;
+  forEachChunk(
+    size_y, kRowChunk, thread_pool, [&](int begin, int end) {
+      std::vector<int64_t> f(size_x);
+      std::vector<int> v(size_x);
+      std::vector<double> z(size_x + 1);
+      auto intersection = [&f](int p, int q) {
+          return static_cast<double>((f[q] + int64_t(q) * q) - (f[p] + int64_t(p) * p)) /
+                 (2.0 * (q - p));
+        };
+
+      for (int j = begin; j < end; j++) {
+        for (int i = 0; i < size_x; i++) {
+          const int64_t g = column_dist[MAP_INDEX(map, i, j)];
+          f[i] = g * g;
+        }
+
+        int k = 0;
+        v[0] = 0;
+        z[0] = -std::numeric_limits<double>::infinity();
+        z[1] = std::numeric_limits<double>::infinity();
+        for (int q = 1; q < size_x; q++) {
+          double s = intersection(v[k], q);
+          while (s <= z[k]) {
+            k--;
+            s = intersection(v[k], q);
+          }
+          k++;
+          v[k] = q;
+          z[k] = s;
+          z[k + 1] = std::numeric_limits<double>::infinity();
+        }
+
+        k = 0;
+        for (int i = 0; i < size_x; i++) {
+          while (z[k + 1] < i) {
+            k++;
+          }
+          const int64_t di = i - v[k];
+          const double distance = sqrt(static_cast<double>(di * di + f[v[k]]));
+
+          map_cell_t & cell = map->cells[MAP_INDEX(map, i, j)];
+          if (cell.occ_state == +1) {
+            cell.occ_dist = 0.0;
+          } else if (distance > cell_radius) {
+            cell.occ_dist = max_dist;
+          } else {
+            cell.occ_dist = distance * map->scale;
+          }
+        }
+      }
+    });
+}
+
+uint64_t hashCSpace(const map_t * map, double max_occ_dist)
 {
-  return a.occ_dist > b.occ_dist;
+  // FNV-1a
+  uint64_t hash = 14695981039346656037ULL;
+  auto add = [&hash](const void * data, size_t size) {
+      const unsigned char * bytes = static_cast<const unsigned char *>(data);
+      for (size_t k = 0; k < size; k++) {
+        hash = (hash ^ bytes[k]) * 1099511628211ULL;
+      }
+    };
+
+  add(&map->size_x, sizeof(map->size_x));
+  add(&map->size_y, sizeof(map->size_y));
+  add(&map->scale, sizeof(map->scale));
+  add(&max_occ_dist, sizeof(max_occ_dist));
+  const size_t cell_count = static_cast<size_t>(map->size_x) * map->size_y;
+  for (size_t k = 0; k < cell_count; k++) {
+    add(&map->cells[k].occ_state, sizeof(map->cells[k].occ_state));
+  }
+  return hash;
 }
 
 /*
- * @brief get_distance_map
- * @param scale of cost information wrt distance
- * @param max_dist Maximum distance to cache from occupied information
- * @return Pointer to cached distance map
+ * @struct CSpaceCacheHeader
+ * @brief Header of a cspace cache file, followed by the distances of the cells
  */
-CachedDistanceMap *
-get_distance_map(double scale, double max_dist)
+struct CSpaceCacheHeader
 {
-  static CachedDistanceMap * cdm = NULL;
+  char magic[8];
+  uint64_t hash;
+  int32_t size_x, size_y;
+  double scale;
+  double max_occ_dist;
+};
 
-  if (!cdm || (cdm->scale_ != scale) || (cdm->max_dist_ != max_dist)) {
-    if (cdm) {
-      delete cdm;
-    }
-    cdm = new CachedDistanceMap(scale, max_dist);
-  }
+static constexpr char kCacheMagic[8] = {'A', 'M', 'C', 'L', 'C', 'S', 'P', '1'};
 
-  return cdm;
+static std::filesystem::path cachePath(const std::string & cache_dir, uint64_t hash)
+{
+  char name[64];
+  snprintf(name, sizeof(name), "cspace_%016llx.bin", static_cast<unsigned long long>(hash));
+  return std::filesystem::path(cache_dir) / name;
 }
 
-/*
- * @brief enqueue cell data for caching
- */
-void enqueue(
-  map_t * map, int i, int j,
-  int src_i, int src_j,
-  std::priority_queue<CellData> & Q,
-  CachedDistanceMap * cdm,
-  unsigned char * marked)
+bool loadCSpace(map_t * map, double max_occ_dist, const std::string & cache_dir)
 {
-  const int map_index = MAP_INDEX(map, i, j);
+  const uint64_t hash = hashCSpace(map, max_occ_dist);
+  std::ifstream file(cachePath(cache_dir, hash), std::ios::binary);
+  if (!file) {
+    return false;
+  }
 
-  if (marked[map_index]) {
-    return;
+  CSpaceCacheHeader header;
+  if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+    memcmp(header.magic, kCacheMagic, sizeof(kCacheMagic)) != 0 || header.hash != hash ||
+    header.size_x != map->size_x || header.size_y != map->size_y ||
+    header.scale != map->scale || header.max_occ_dist != max_occ_dist)
+  {
+    return false;
   }
 
-  int di = abs(i - src_i);
-  int dj = abs(j - src_j);
-  double distance = cdm->distances_[di][dj];
+  const size_t cell_count = static_cast<size_t>(map->size_x) * map->size_y;
+  std::vector<float> distances(cell_count);
+  if (!file.read(
+      reinterpret_cast<char *>(distances.data()), cell_count * sizeof(float)))
+  {
+    return false;
+  }
 
-  if (distance > cdm->cell_radius_) {
-    return;
+  for (size_t k = 0; k < cell_count; k++) {
+    map->cells[k].occ_dist = distances[k];
   }
+  map->max_occ_dist = max_occ_dist;
+  return true;
+}
 
-  map->cells[map_index].occ_dist = distance * map->scale;
+bool saveCSpace(const map_t * map, const std::string & cache_dir)
+{
+  std::error_code error;
+  std::filesystem::create_directories(cache_dir, error);
+  if (error) {
+    return false;
+  }
 
-  Q.emplace(CellData{map, static_cast<unsigned int>(i), static_cast<unsigned int>(j),
-      static_cast<unsigned int>(src_i), static_cast<unsigned int>(src_j),
-      map->cells[map_index].occ_dist});
+  CSpaceCacheHeader header;
+  memcpy(header.magic, kCacheMagic, sizeof(kCacheMagic));
+  header.hash = hashCSpace(map, map->max_occ_dist);
+  header.size_x = map->size_x;
+  header.size_y = map->size_y;
+  header.scale = map->scale;
+  header.max_occ_dist = map->max_occ_dist;
 
-  marked[map_index] = 1;
+  const size_t cell_count = static_cast<size_t>(map->size_x) * map->size_y;
+  std::vector<float> distances(cell_count);
+  for (size_t k = 0; k < cell_count; k++) {
+    distances[k] = map->cells[k].occ_dist;
+  }
+
+  // Written aside and renamed, so that concurrent readers never load a partial file. The
+  // temporary name is unique to the process and the call, so that concurrent writers of the
+  // same cspace never write to the same file
+  static std::atomic<unsigned int> save_count{0};
+  const std::filesystem::path path = cachePath(cache_dir, header.hash);
+  std::filesystem::path temp_path = path;
+  temp_path += ".tmp." + std::to_string(getpid()) + "." + std::to_string(save_count++);
+  bool written;
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    written = file.write(reinterpret_cast<const char *>(&header), sizeof(header)) &&
+      file.write(reinterpret_cast<const char *>(distances.data()), cell_count * sizeof(float));
+    file.close();
+    written = written && !file.fail();
+  }
+  if (written) {
+    std::filesystem::rename(temp_path, path, error);
+  }
+  if (!written || error) {
+    std::filesystem::remove(temp_path, error);
+    return false;
+  }
+  return true;
 }
 
+}  // namespace nav2_amcl
+
 /*
  * @brief Update the cspace distance values
  * @param map Map to update
@@ -146,64 +288,5 @@ void enqueue(
  */
 void map_update_cspace(map_t * map, double max_occ_dist)
 {
-  unsigned char * marked;
-  std::priority_queue<CellData> Q;
-
-  marked = new unsigned char[map->size_x * map->size_y];
-  memset(marked, 0, sizeof(unsigned char) * map->size_x * map->size_y);
-
-  map->max_occ_dist = max_occ_dist;
-
-  CachedDistanceMap * cdm = get_distance_map(map->scale, map->max_occ_dist);
-
-  // Enqueue all the obstacle cells
-  CellData cell;
-  cell.map_ = map;
-  int loop_map_index;
-  for (int i = 0; i < map->size_x; i++) {
-    cell.src_i_ = cell.i_ = i;
-    for (int j = 0; j < map->size_y; j++) {
-      loop_map_index = MAP_INDEX(map, i, j);
-      if (map->cells[loop_map_index].occ_state == +1) {
-        map->cells[loop_map_index].occ_dist = 0.0;
-        cell.src_j_ = cell.j_ = j;
-        marked[loop_map_index] = 1;
-        Q.push(cell);
-      } else {
-        map->cells[loop_map_index].occ_dist = max_occ_dist;
-      }
-    }
-  }
-
-  while (!Q.empty()) {
-    CellData current_cell = Q.top();
-    if (current_cell.i_ > 0) {
-      enqueue(
-          map, current_cell.i_ - 1, current_cell.j_,
-          current_cell.src_i_, current_cell.src_j_,
-          Q, cdm, marked);
-    }
-    if (current_cell.j_ > 0) {
-      enqueue(
-          map, current_cell.i_, current_cell.j_ - 1,
-          current_cell.src_i_, current_cell.src_j_,
-          Q, cdm, marked);
-    }
-    if (static_cast<int>(current_cell.i_) < map->size_x - 1) {
-      enqueue(
-          map, current_cell.i_ + 1, current_cell.j_,
-          current_cell.src_i_, current_cell.src_j_,
-          Q, cdm, marked);
-    }
-    if (static_cast<int>(current_cell.j_) < map->size_y - 1) {
-      enqueue(
-          map, current_cell.i_, current_cell.j_ + 1,
-          current_cell.src_i_, current_cell.src_j_,
-          Q, cdm, marked);
-    }
-
-    Q.pop();
-  }
-
-  delete[] marked;
+  nav2_amcl::updateCSpace(map, max_occ_dist);
 }
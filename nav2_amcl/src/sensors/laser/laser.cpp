@@ -19,15 +19,22 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <unordered_map>
+#include <utility>
 
 #include "nav2_amcl/sensors/laser/laser.hpp"
 
 namespace nav2_amcl
 {
 
+// Samples are evaluated in chunks of this size, small enough to balance the threads
+static constexpr int kSampleChunkSize = 64;
+
 Laser::Laser(size_t max_beams, map_t * map)
-: max_samples_(0), max_obs_(0), temp_obs_(NULL)
+: max_samples_(0), max_obs_(0), temp_obs_(NULL), thread_pool_(NULL)
 {
   max_beams_ = max_beams;
   map_ = map;
@@ -67,4 +74,99 @@ Laser::SetLaserPose(pf_vector_t & laser_pose)
   laser_pose_ = laser_pose;
 }
 
+void
+Laser::setThreadPool(nav2_util::ThreadPool * thread_pool)
+{
+  thread_pool_ = thread_pool;
+}
+
+void
+Laser::gatherLaserPoses(pf_sample_set_t * set)
+{
+  pose_x_.resize(set->sample_count);
+  pose_y_.resize(set->sample_count);
+  pose_a_.resize(set->sample_count);
+  likelihoods_.resize(set->sample_count);
+
+  for (int j = 0; j < set->sample_count; j++) {
+    // Take account of the laser pose relative to the robot
+    pf_vector_t pose = pf_vector_coord_add(laser_pose_, set->samples[j].pose);
+    pose_x_[j] = pose.v[0];
+    pose_y_[j] = pose.v[1];
+    pose_a_[j] = pose.v[2];
+  }
+}
+
+size_t
+Laser::sampleChunkCount(int sample_count)
+{
+  return (std::max(sample_count, 0) + kSampleChunkSize - 1) / kSampleChunkSize;
+}
+
+void
+Laser::forEachSampleChunk(
+  int sample_count, const std::function<void(int begin, int end, size_t chunk)> & fn)
+{
+  const size_t chunks = sampleChunkCount(sample_count);
+  auto evaluate = [&](size_t chunk) {
+      const int begin = static_cast<int>(chunk) * kSampleChunkSize;
+      fn(begin, std::min(sample_count, begin + kSampleChunkSize), chunk);
+    };
+
+  if (thread_pool_ && chunks > 1) {
+    thread_pool_->parallelFor(chunks, evaluate);
+  } else {
+    for (size_t chunk = 0; chunk < chunks; chunk++) {
+      evaluate(chunk);
+    }
+  }
+}
+
+double
+Laser::applyLikelihoods(pf_sample_set_t * set)
+{
+  double total_weight = 0.0;
+  for (int j = 0; j < set->sample_count; j++) {
+    pf_sample_t * sample = set->samples + j;
+    sample->weight *= likelihoods_[j];
+    total_weight += sample->weight;
+  }
+  return total_weight;
+}
+
+bool
+Laser::indexObstacleDistances()
+{
+  occ_dist_index_.clear();
+  occ_dists_.clear();
+
+  const size_t cell_count = static_cast<size_t>(map_->size_x) * map_->size_y;
+  std::vector<uint16_t> index(cell_count);
+  std::unordered_map<float, uint16_t> dist_indices;
+
+  // Neighbouring cells often share distances, so the last one found is checked first
+  float last_dist = std::numeric_limits<float>::quiet_NaN();
+  uint16_t last_index = 0;
+  for (size_t k = 0; k < cell_count; k++) {
+    const float dist = map_->cells[k].occ_dist;
+    if (dist != last_dist) {
+      auto it = dist_indices.find(dist);
+      if (it == dist_indices.end()) {
+        if (occ_dists_.size() > std::numeric_limits<uint16_t>::max()) {
+          occ_dists_.clear();
+          return false;
+        }
+        it = dist_indices.emplace(dist, static_cast<uint16_t>(occ_dists_.size())).first;
+        occ_dists_.push_back(dist);
+      }
+      last_dist = dist;
+      last_index = it->second;
+    }
+    index[k] = last_index;
+  }
+
+  occ_dist_index_ = std::move(index);
+  return true;
+}
+
 }  // namespace nav2_amcl
@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 #include "nav2_amcl/sensors/laser/laser.hpp"
 
@@ -44,20 +45,15 @@ LikelihoodFieldModel::LikelihoodFieldModel(
   if (map->max_occ_dist != max_occ_dist) {
     map_update_cspace(map, max_occ_dist);
   }
+  indexObstacleDistances();
 }
 
 double
 LikelihoodFieldModel::sensorFunction(LaserData * data, pf_sample_set_t * set)
 {
   LikelihoodFieldModel * self;
-  int i, j, step;
-  double z, pz;
-  double p;
+  int i, step;
   double obs_range, obs_bearing;
-  double total_weight;
-  pf_sample_t * sample;
-  pf_vector_t pose;
-  pf_vector_t hit;
 
   self = reinterpret_cast<LikelihoodFieldModel *>(data->laser);
 
@@ -72,50 +68,29 @@ LikelihoodFieldModel::sensorFunction(LaserData * data, pf_sample_set_t * set)
     step = 1;
   }
 
-  total_weight = 0.0;
+  self->beam_ranges_.clear();
+  self->beam_bearings_.clear();
+  for (i = 0; i < data->range_count; i += step) {
+    obs_range = data->ranges[i][0];
+    obs_bearing = data->ranges[i][1];
 
-  // Compute the sample weights
-  for (j = 0; j < set->sample_count; j++) {
-    sample = set->samples + j;
-    pose = sample->pose;
-
-    // Take account of the laser pose relative to the robot
-    pose = pf_vector_coord_add(self->laser_pose_, pose);
-
-    p = 1.0;
-
-    for (i = 0; i < data->range_count; i += step) {
-      obs_range = data->ranges[i][0];
-      obs_bearing = data->ranges[i][1];
-
-      // This model ignores max range readings
-      if (obs_range >= data->range_max) {
-        continue;
-      }
-
-      // Check for NaN
-      if (obs_range != obs_range) {
-        continue;
-      }
-
-      pz = 0.0;
+    // This model ignores max range readings
+    if (obs_range >= data->range_max) {
+      continue;
+    }
 
-      // Compute the endpoint of the beam
-      hit.v[0] = pose.v[0] + obs_range * cos(pose.v[2] + obs_bearing);
-      hit.v[1] = pose.v[1] + obs_range * sin(pose.v[2] + obs_bearing);
+    // Check for NaN
+    if (obs_range != obs_range) {
+      continue;
+    }
 
-      // Convert to map grid coords.
-      int mi, mj;
-      mi = MAP_GXWX(self->map_, hit.v[0]);
-      mj = MAP_GYWY(self->map_, hit.v[1]);
+    self->beam_ranges_.push_back(obs_range);
+    self->beam_bearings_.push_back(obs_bearing);
+  }
 
-      // Part 1: Get distance from the hit to closest obstacle.
-      // Off-map penalized as max distance
-      if (!MAP_VALID(self->map_, mi, mj)) {
-        z = self->map_->max_occ_dist;
-      } else {
-        z = self->map_->cells[MAP_INDEX(self->map_, mi, mj)].occ_dist;
-      }
+  // Weight of a beam ending at distance z from the closest obstacle
+  auto beam_weight = [&](double z) {
+      double pz = 0.0;
       // Gaussian model
       // NOTE: this should have a normalization of 1/(sqrt(2pi)*sigma)
       pz += self->z_hit_ * exp(-(z * z) / z_hit_denom);
@@ -129,14 +104,60 @@ LikelihoodFieldModel::sensorFunction(LaserData * data, pf_sample_set_t * set)
       //      p *= pz;
       // here we have an ad-hoc weighting scheme for combining beam probs
       // works well, though...
-      p += pz * pz * pz;
+      return pz * pz * pz;
+    };
+
+  // Weights are looked up per cell from those of the distinct obstacle distances,
+  // off-map hits being penalized as max distance
+  const bool indexed = !self->occ_dist_index_.empty();
+  if (indexed) {
+    self->dist_weights_.resize(self->occ_dists_.size());
+    for (size_t k = 0; k < self->occ_dists_.size(); k++) {
+      self->dist_weights_[k] = beam_weight(self->occ_dists_[k]);
     }
-
-    sample->weight *= p;
-    total_weight += sample->weight;
   }
+  const double off_map_weight = beam_weight(self->map_->max_occ_dist);
+
+  self->gatherLaserPoses(set);
+
+  // Compute the sample weights
+  const map_t * map = self->map_;
+  const size_t beam_count = self->beam_ranges_.size();
+  self->forEachSampleChunk(
+    set->sample_count, [&](int begin, int end, size_t /*chunk*/) {
+      std::vector<int> cells(beam_count);
+      for (int j = begin; j < end; j++) {
+        const double pose_x = self->pose_x_[j];
+        const double pose_y = self->pose_y_[j];
+        const double pose_a = self->pose_a_[j];
+
+        // Compute the map cells of the beam endpoints, -1 if off the map
+        for (size_t b = 0; b < beam_count; b++) {
+          const double range = self->beam_ranges_[b];
+          const double angle = pose_a + self->beam_bearings_[b];
+          const double hit_x = pose_x + range * cos(angle);
+          const double hit_y = pose_y + range * sin(angle);
+          const int mi = MAP_GXWX(map, hit_x);
+          const int mj = MAP_GYWY(map, hit_y);
+          cells[b] = MAP_VALID(map, mi, mj) ? MAP_INDEX(map, mi, mj) : -1;
+        }
+
+        // Then look up and combine the beam weights, in beam order
+        double p = 1.0;
+        for (size_t b = 0; b < beam_count; b++) {
+          if (cells[b] < 0) {
+            p += off_map_weight;
+          } else if (indexed) {
+            p += self->dist_weights_[self->occ_dist_index_[cells[b]]];
+          } else {
+            p += beam_weight(map->cells[cells[b]].occ_dist);
+          }
+        }
+        self->likelihoods_[j] = p;
+      }
+    });
 
-  return total_weight;
+  return self->applyLikelihoods(set);
 }
 
 
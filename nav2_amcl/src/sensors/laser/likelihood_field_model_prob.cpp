@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 #include "nav2_amcl/sensors/laser/laser.hpp"
 
@@ -52,6 +53,7 @@ LikelihoodFieldModelProb::LikelihoodFieldModelProb(
   if (map->max_occ_dist != max_occ_dist) {
     map_update_cspace(map, max_occ_dist);
   }
+  indexObstacleDistances();
 }
 
 // Determine the probability for the given pose
@@ -59,19 +61,12 @@ double
 LikelihoodFieldModelProb::sensorFunction(LaserData * data, pf_sample_set_t * set)
 {
   LikelihoodFieldModelProb * self;
-  int i, j, step;
-  double z, pz;
-  double log_p;
+  int i, step;
   double obs_range, obs_bearing;
   double total_weight;
-  pf_sample_t * sample;
-  pf_vector_t pose;
-  pf_vector_t hit;
 
   self = reinterpret_cast<LikelihoodFieldModelProb *>(data->laser);
 
-  total_weight = 0.0;
-
   step = ceil((data->range_count) / static_cast<double>(self->max_beams_));
 
   // Step size must be at least 1
@@ -98,12 +93,14 @@ LikelihoodFieldModelProb::sensorFunction(LaserData * data, pf_sample_set_t * set
     do_beamskip = false;
   }
 
-  // we need a count the no of particles for which the beam agreed with the map
-  int * obs_count = new int[self->max_beams_]();
+  // we need a count the no of particles for which the beam agreed with the map,
+  // kept per chunk of samples as they are evaluated concurrently
+  const size_t chunk_count = sampleChunkCount(set->sample_count);
+  std::vector<int> chunk_obs_count(chunk_count * self->max_beams_, 0);
 
   // we also need a mask of which observations to integrate (to decide which beams to integrate to
   // all particles)
-  bool * obs_mask = new bool[self->max_beams_]();
+  std::vector<bool> obs_mask(self->max_beams_, false);
 
   int beam_ind = 0;
 
@@ -125,59 +122,34 @@ LikelihoodFieldModelProb::sensorFunction(LaserData * data, pf_sample_set_t * set
     }
   }
 
-  // Compute the sample weights
-  for (j = 0; j < set->sample_count; j++) {
-    sample = set->samples + j;
-    pose = sample->pose;
-
-    // Take account of the laser pose relative to the robot
-    pose = pf_vector_coord_add(self->laser_pose_, pose);
-
-    log_p = 0;
-
-    beam_ind = 0;
-
-    for (i = 0; i < data->range_count; i += step, beam_ind++) {
-      obs_range = data->ranges[i][0];
-      obs_bearing = data->ranges[i][1];
-
-      // This model ignores max range readings
-      if (obs_range >= data->range_max) {
-        continue;
-      }
-
-      // Check for NaN
-      if (obs_range != obs_range) {
-        continue;
-      }
-
-      pz = 0.0;
-
-      // Compute the endpoint of the beam
-      hit.v[0] = pose.v[0] + obs_range * cos(pose.v[2] + obs_bearing);
-      hit.v[1] = pose.v[1] + obs_range * sin(pose.v[2] + obs_bearing);
+  self->beam_ranges_.clear();
+  self->beam_bearings_.clear();
+  self->beam_indices_.clear();
+  for (i = 0; i < data->range_count; i += step, beam_ind++) {
+    obs_range = data->ranges[i][0];
+    obs_bearing = data->ranges[i][1];
 
-      // Convert to map grid coords.
-      int mi, mj;
-      mi = MAP_GXWX(self->map_, hit.v[0]);
-      mj = MAP_GYWY(self->map_, hit.v[1]);
+    // This model ignores max range readings
+    if (obs_range >= data->range_max) {
+      continue;
+    }
 
-      // Part 1: Get distance from the hit to closest obstacle.
-      // Off-map penalized as max distance
+    // Check for NaN
+    if (obs_range != obs_range) {
+      continue;
+    }
 
-      if (!MAP_VALID(self->map_, mi, mj)) {
-        pz += self->z_hit_ * max_dist_prob;
-      } else {
-        z = self->map_->cells[MAP_INDEX(self->map_, mi, mj)].occ_dist;
-        if (z < beam_skip_distance) {
-          obs_count[beam_ind] += 1;
-        }
-        pz += self->z_hit_ * exp(-(z * z) / z_hit_denom);
-      }
+    self->beam_ranges_.push_back(obs_range);
+    self->beam_bearings_.push_back(obs_bearing);
+    self->beam_indices_.push_back(beam_ind);
+  }
 
-      // Gaussian model
+  // Probability of a beam ending at distance z from the closest obstacle
+  auto beam_pz = [&](double z) {
+      double pz = 0.0;
+      // Part 1: Gaussian model
       // NOTE: this should have a normalization of 1/(sqrt(2pi)*sigma)
-
+      pz += self->z_hit_ * exp(-(z * z) / z_hit_denom);
       // Part 2: random measurements
       pz += self->z_rand_ * z_rand_mult;
 
@@ -185,65 +157,135 @@ LikelihoodFieldModelProb::sensorFunction(LaserData * data, pf_sample_set_t * set
       assert(pz >= 0.0);
 
       // TODO(?): outlier rejection for short readings
-
-      if (!do_beamskip) {
-        log_p += log(pz);
-      } else {
-        self->temp_obs_[j][beam_ind] = pz;
-      }
-    }
-    if (!do_beamskip) {
-      sample->weight *= exp(log_p);
-      total_weight += sample->weight;
+      return pz;
+    };
+
+  // Probabilities are looked up per cell from those of the distinct obstacle distances
+  const bool indexed = !self->occ_dist_index_.empty();
+  if (indexed) {
+    const size_t dist_count = self->occ_dists_.size();
+    self->dist_pz_.resize(dist_count);
+    self->dist_log_pz_.resize(dist_count);
+    self->dist_near_.resize(dist_count);
+    for (size_t k = 0; k < dist_count; k++) {
+      const double z = self->occ_dists_[k];
+      self->dist_pz_[k] = beam_pz(z);
+      self->dist_log_pz_[k] = log(self->dist_pz_[k]);
+      self->dist_near_[k] = z < beam_skip_distance;
     }
   }
 
-  if (do_beamskip) {
-    int skipped_beam_count = 0;
-    for (beam_ind = 0; beam_ind < self->max_beams_; beam_ind++) {
-      if ((obs_count[beam_ind] / static_cast<double>(set->sample_count)) > beam_skip_threshold) {
-        obs_mask[beam_ind] = true;
-      } else {
-        obs_mask[beam_ind] = false;
-        skipped_beam_count++;
-      }
-    }
-
-    // we check if there is at least a critical number of beams that agreed with the map
-    // otherwise it probably indicates that the filter converged to a wrong solution
-    // if that's the case we integrate all the beams and hope the filter might converge to
-    // the right solution
-    bool error = false;
-
-    if (skipped_beam_count >= (beam_ind * self->beam_skip_error_threshold_)) {
-      fprintf(
-        stderr,
-        "Over %f%% of the observations were not in the map - pf may have converged to wrong pose -"
-        " integrating all observations\n",
-        (100 * self->beam_skip_error_threshold_));
-      error = true;
-    }
+  // Off-map hits are penalized as max distance
+  double off_map_pz = 0.0;
+  off_map_pz += self->z_hit_ * max_dist_prob;
+  off_map_pz += self->z_rand_ * z_rand_mult;
+  const double off_map_log_pz = log(off_map_pz);
 
-    for (j = 0; j < set->sample_count; j++) {
-      sample = set->samples + j;
-      pose = sample->pose;
+  self->gatherLaserPoses(set);
 
-      log_p = 0;
+  // Compute the sample weights
+  const map_t * map = self->map_;
+  const size_t beam_count = self->beam_ranges_.size();
+  self->forEachSampleChunk(
+    set->sample_count, [&](int begin, int end, size_t chunk) {
+      int * obs_count = chunk_obs_count.data() + chunk * self->max_beams_;
+      std::vector<int> cells(beam_count);
+      for (int j = begin; j < end; j++) {
+        const double pose_x = self->pose_x_[j];
+        const double pose_y = self->pose_y_[j];
+        const double pose_a = self->pose_a_[j];
+
+        // Compute the map cells of the beam endpoints, -1 if off the map
+        for (size_t b = 0; b < beam_count; b++) {
+          const double range = self->beam_ranges_[b];
+          const double angle = pose_a + self->beam_bearings_[b];
+          const double hit_x = pose_x + range * cos(angle);
+          const double hit_y = pose_y + range * sin(angle);
+          const int mi = MAP_GXWX(map, hit_x);
+          const int mj = MAP_GYWY(map, hit_y);
+          cells[b] = MAP_VALID(map, mi, mj) ? MAP_INDEX(map, mi, mj) : -1;
+        }
 
-      for (beam_ind = 0; beam_ind < self->max_beams_; beam_ind++) {
-        if (error || obs_mask[beam_ind]) {
-          log_p += log(self->temp_obs_[j][beam_ind]);
+        // Then look up the beam probabilities, in beam order
+        double log_p = 0;
+        for (size_t b = 0; b < beam_count; b++) {
+          double pz, log_pz;
+          if (cells[b] < 0) {
+            pz = off_map_pz;
+            log_pz = off_map_log_pz;
+          } else if (indexed) {
+            const uint16_t k = self->occ_dist_index_[cells[b]];
+            pz = self->dist_pz_[k];
+            log_pz = self->dist_log_pz_[k];
+            obs_count[self->beam_indices_[b]] += self->dist_near_[k];
+          } else {
+            const double z = map->cells[cells[b]].occ_dist;
+            if (z < beam_skip_distance) {
+              obs_count[self->beam_indices_[b]] += 1;
+            }
+            pz = beam_pz(z);
+            log_pz = log(pz);
+          }
+
+          if (!do_beamskip) {
+            log_p += log_pz;
+          } else {
+            self->temp_obs_[j][self->beam_indices_[b]] = pz;
+          }
+        }
+        if (!do_beamskip) {
+          self->likelihoods_[j] = exp(log_p);
         }
       }
+    });
 
-      sample->weight *= exp(log_p);
+  if (!do_beamskip) {
+    return self->applyLikelihoods(set);
+  }
 
-      total_weight += sample->weight;
+  int skipped_beam_count = 0;
+  for (beam_ind = 0; beam_ind < self->max_beams_; beam_ind++) {
+    int obs_count = 0;
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+      obs_count += chunk_obs_count[chunk * self->max_beams_ + beam_ind];
+    }
+    if ((obs_count / static_cast<double>(set->sample_count)) > beam_skip_threshold) {
+      obs_mask[beam_ind] = true;
+    } else {
+      obs_mask[beam_ind] = false;
+      skipped_beam_count++;
     }
   }
 
-  delete[] obs_count;
-  delete[] obs_mask;
+  // we check if there is at least a critical number of beams that agreed with the map
+  // otherwise it probably indicates that the filter converged to a wrong solution
+  // if that's the case we integrate all the beams and hope the filter might converge to
+  // the right solution
+  bool error = false;
+
+  if (skipped_beam_count >= (beam_ind * self->beam_skip_error_threshold_)) {
+    fprintf(
+      stderr,
+      "Over %f%% of the observations were not in the map - pf may have converged to wrong pose -"
+      " integrating all observations\n",
+      (100 * self->beam_skip_error_threshold_));
+    error = true;
+  }
+
+  self->forEachSampleChunk(
+    set->sample_count, [&](int begin, int end, size_t /*chunk*/) {
+      for (int j = begin; j < end; j++) {
+        double log_p = 0;
+        for (int k = 0; k < self->max_beams_; k++) {
+          if (error || obs_mask[k]) {
+            log_p += log(self->temp_obs_[j][k]);
+          }
+        }
+        self->likelihoods_[j] = exp(log_p);
+      }
+    });
+
+  total_weight = self->applyLikelihoods(set);
   return total_weight;
 }
 
@@ -0,0 +1,249 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_amcl/map/map.hpp"
+#include "nav2_amcl/map/map_cspace.hpp"
+#include "nav2_util/thread_pool.hpp"
+
+// Map with randomly occupied cells
+map_t * makeMap(int size_x, int size_y, unsigned int seed, double occupied_ratio)
+{
+  map_t * map = map_alloc();
+  map->size_x = size_x;
+  map->size_y = size_y;
+  map->scale = 0.05;
+  map->cells = reinterpret_cast<map_cell_t *>(malloc(sizeof(map_cell_t) * size_x * size_y));
+
+  std::mt19937 generator(seed);
+  std::bernoulli_distribution occupied(occupied_ratio);
+  for (int k = 0; k < size_x * size_y; k++) {
+    map->cells[k].occ_state = occupied(generator) ? +1 : -1;
+    map->cells[k].occ_dist = 0.0;
+  }
+  return map;
+}
+
+// Cells of the map which are occupied
+std::vector<std::pair<int, int>> occupiedCells(const map_t * map)
+{
+  std::vector<std::pair<int, int>> cells;
+  for (int j = 0; j < map->size_y; j++) {
+    for (int i = 0; i < map->size_x; i++) {
+      if (map->cells[MAP_INDEX(map, i, j)].occ_state == +1) {
+        cells.emplace_back(i, j);
+      }
+    }
+  }
+  return cells;
+}
+
+// Distance of a cell to the closest of all occupied cells, as the cspace defines it
+float bruteForceDistance(
+  const map_t * map, const std::vector<std::pair<int, int>> & occupied_cells,
+  int i, int j, double max_occ_dist)
+{
+  if (map->cells[MAP_INDEX(map, i, j)].occ_state == +1) {
+    return 0.0;
+  }
+
+  double best = std::numeric_limits<double>::infinity();
+  for (const auto & cell : occupied_cells) {
+    const double di = i - cell.first;
+    const double dj = j - cell.second;
+    best = std::min(best, sqrt(di * di + dj * dj));
+  }
+
+  const int cell_radius = max_occ_dist / map->scale;
+  if (best > cell_radius) {
+    return max_occ_dist;
+  }
+  return best * map->scale;
+}
+
+class CSpaceCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    cache_dir_ = std::filesystem::temp_directory_path() /
+      ("test_map_cspace_" + std::to_string(getpid()));
+    std::filesystem::remove_all(cache_dir_);
+  }
+
+  void TearDown() override
+  {
+    std::filesystem::remove_all(cache_dir_);
+  }
+
+  std::filesystem::path cacheFile(const map_t * map, double max_occ_dist)
+  {
+    char name[64];
+    snprintf(
+      name, sizeof(name), "cspace_%016llx.bin",
+      static_cast<unsigned long long>(nav2_amcl::hashCSpace(map, max_occ_dist)));
+    return cache_dir_ / name;
+  }
+
+  int countFiles()
+  {
+    int count = 0;
+    for (const auto & entry : std::filesystem::directory_iterator(cache_dir_)) {
+      (void)entry;
+      count++;
+    }
+    return count;
+  }
+
+  std::filesystem::path cache_dir_;
+};
+
+TEST(MapCSpace, MatchesBruteForce)
+{
+  nav2_util::ThreadPool thread_pool(4);
+  for (unsigned int seed = 0; seed < 12; seed++) {
+    // Maps wider than a column chunk, obstacles sparse enough that some cells are out of
+    // range, and radii from under a cell to larger than the map
+    const int size_x = 20 + 29 * seed;
+    const int size_y = 15 + 11 * seed;
+    const double max_occ_dist = 0.04 + 0.35 * seed;
+    map_t * map = makeMap(size_x, size_y, seed, seed % 2 ? 0.002 : 0.02);
+    map_t * pooled_map = makeMap(size_x, size_y, seed, seed % 2 ? 0.002 : 0.02);
+
+    nav2_amcl::updateCSpace(map, max_occ_dist);
+    nav2_amcl::updateCSpace(pooled_map, max_occ_dist, &thread_pool);
+
+    EXPECT_EQ(map->max_occ_dist, max_occ_dist);
+    const auto occupied_cells = occupiedCells(map);
+    int mismatches = 0;
+    for (int j = 0; j < size_y; j++) {
+      for (int i = 0; i < size_x; i++) {
+        const int index = MAP_INDEX(map, i, j);
+        const float expected = bruteForceDistance(map, occupied_cells, i, j, max_occ_dist);
+        if (map->cells[index].occ_dist != expected ||
+          pooled_map->cells[index].occ_dist != expected)
+        {
+          mismatches++;
+        }
+      }
+    }
+    EXPECT_EQ(mismatches, 0) << "seed " << seed;
+
+    map_free(map);
+    map_free(pooled_map);
+  }
+}
+
+TEST(MapCSpace, EmptyMap)
+{
+  map_t * map = makeMap(40, 30, 0, 0.0);
+  nav2_amcl::updateCSpace(map, 0.5);
+  for (int k = 0; k < 40 * 30; k++) {
+    const float occ_dist = map->cells[k].occ_dist;
+    EXPECT_EQ(occ_dist, 0.5f);
+  }
+  map_free(map);
+}
+
+TEST_F(CSpaceCacheTest, SaveLoadRoundTrip)
+{
+  map_t * map = makeMap(120, 90, 1, 0.01);
+  nav2_amcl::updateCSpace(map, 1.5);
+  ASSERT_TRUE(nav2_amcl::saveCSpace(map, cache_dir_.string()));
+
+  // Only the cache file is left behind
+  EXPECT_TRUE(std::filesystem::exists(cacheFile(map, 1.5)));
+  EXPECT_EQ(countFiles(), 1);
+
+  map_t * loaded_map = makeMap(120, 90, 1, 0.01);
+  ASSERT_TRUE(nav2_amcl::loadCSpace(loaded_map, 1.5, cache_dir_.string()));
+  EXPECT_EQ(loaded_map->max_occ_dist, 1.5);
+  for (int k = 0; k < 120 * 90; k++) {
+    const float loaded_occ_dist = loaded_map->cells[k].occ_dist;
+    const float occ_dist = map->cells[k].occ_dist;
+    EXPECT_EQ(loaded_occ_dist, occ_dist);
+  }
+
+  // Saving again replaces the file
+  ASSERT_TRUE(nav2_amcl::saveCSpace(map, cache_dir_.string()));
+  EXPECT_EQ(countFiles(), 1);
+
+  map_free(map);
+  map_free(loaded_map);
+}
+
+TEST_F(CSpaceCacheTest, RejectsOtherMapsAndDistances)
+{
+  map_t * map = makeMap(120, 90, 2, 0.01);
+  nav2_amcl::updateCSpace(map, 1.5);
+  ASSERT_TRUE(nav2_amcl::saveCSpace(map, cache_dir_.string()));
+
+  // Nothing cached for another maximum distance
+  map_t * other_map = makeMap(120, 90, 2, 0.01);
+  EXPECT_FALSE(nav2_amcl::loadCSpace(other_map, 2.0, cache_dir_.string()));
+
+  // Nor for another occupancy
+  other_map->cells[MAP_INDEX(other_map, 60, 45)].occ_state *= -1;
+  EXPECT_FALSE(nav2_amcl::loadCSpace(other_map, 1.5, cache_dir_.string()));
+
+  // Nor for another geometry
+  map_t * resized_map = makeMap(90, 120, 2, 0.01);
+  EXPECT_FALSE(nav2_amcl::loadCSpace(resized_map, 1.5, cache_dir_.string()));
+
+  // A file saved for another map or distance is rejected by its header, even under the name
+  // of the map being loaded
+  std::filesystem::copy_file(cacheFile(map, 1.5), cacheFile(other_map, 1.5));
+  EXPECT_FALSE(nav2_amcl::loadCSpace(other_map, 1.5, cache_dir_.string()));
+  std::filesystem::copy_file(cacheFile(map, 1.5), cacheFile(map, 2.0));
+  EXPECT_FALSE(nav2_amcl::loadCSpace(map, 2.0, cache_dir_.string()));
+  std::filesystem::copy_file(cacheFile(map, 1.5), cacheFile(resized_map, 1.5));
+  EXPECT_FALSE(nav2_amcl::loadCSpace(resized_map, 1.5, cache_dir_.string()));
+
+  // As is a truncated file
+  std::filesystem::resize_file(
+    cacheFile(map, 1.5), std::filesystem::file_size(cacheFile(map, 1.5)) - 1);
+  EXPECT_FALSE(nav2_amcl::loadCSpace(map, 1.5, cache_dir_.string()));
+
+  map_free(map);
+  map_free(other_map);
+  map_free(resized_map);
+}
+
+TEST_F(CSpaceCacheTest, FailedSaveLeavesNoTemporaryFile)
+{
+  map_t * map = makeMap(60, 40, 3, 0.01);
+  nav2_amcl::updateCSpace(map, 1.0);
+
+  // A directory in place of the cache file makes the rename fail
+  std::filesystem::create_directories(cacheFile(map, 1.0) / "occupied");
+  EXPECT_FALSE(nav2_amcl::saveCSpace(map, cache_dir_.string()));
+  EXPECT_EQ(countFiles(), 1);
+  EXPECT_FALSE(nav2_amcl::loadCSpace(map, 1.0, cache_dir_.string()));
+
+  map_free(map);
+}
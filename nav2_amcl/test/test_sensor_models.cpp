@@ -0,0 +1,165 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_amcl/map/map.hpp"
+#include "nav2_amcl/pf/pf.hpp"
+#include "nav2_amcl/sensors/laser/laser.hpp"
+#include "nav2_util/thread_pool.hpp"
+
+// 10m x 10m room at 5cm resolution, with an inner wall and a pillar
+constexpr int kSize = 200;
+constexpr double kResolution = 0.05;
+constexpr int kScanBeams = 360;
+constexpr double kRangeMax = 8.0;
+constexpr double kScanX = 3.2;
+constexpr double kScanY = 4.1;
+constexpr double kScanYaw = 0.4;
+// Enough particles for many chunks of samples, and a last partial chunk
+constexpr int kParticles = 1000;
+
+enum class Model { LikelihoodField, LikelihoodFieldProb, Beam };
+
+map_t * makeMap()
+{
+  map_t * map = map_alloc();
+  map->size_x = kSize;
+  map->size_y = kSize;
+  map->scale = kResolution;
+  // The origin is the center of the map
+  map->origin_x = 0.5 * kSize * kResolution;
+  map->origin_y = 0.5 * kSize * kResolution;
+  map->cells = reinterpret_cast<map_cell_t *>(malloc(sizeof(map_cell_t) * kSize * kSize));
+
+  for (int j = 0; j < kSize; j++) {
+    for (int i = 0; i < kSize; i++) {
+      const bool border = i == 0 || j == 0 || i == kSize - 1 || j == kSize - 1;
+      const bool wall = i == 120 && j > 60;
+      const bool pillar = std::abs(i - 40) < 4 && std::abs(j - 140) < 4;
+      map->cells[MAP_INDEX(map, i, j)].occ_state = (border || wall || pillar) ? +1 : -1;
+    }
+  }
+  return map;
+}
+
+// A scan ray cast from the scan pose, with range noise and a few invalid readings
+void recordScan(map_t * map, nav2_amcl::LaserData & data)
+{
+  std::mt19937 generator(42);
+  std::normal_distribution<double> noise(0.0, 0.02);
+
+  data.range_count = kScanBeams;
+  data.range_max = kRangeMax;
+  data.ranges = new double[kScanBeams][2];
+  for (int i = 0; i < kScanBeams; i++) {
+    const double bearing = -M_PI + i * 2.0 * M_PI / kScanBeams;
+    const double range = map_calc_range(map, kScanX, kScanY, kScanYaw + bearing, kRangeMax);
+    data.ranges[i][0] = i % 37 == 0 ? NAN : std::min(range + noise(generator), kRangeMax);
+    data.ranges[i][1] = bearing;
+  }
+}
+
+// Particles spread around the scan pose, as after a few updates from an initial pose
+void sampleParticles(pf_t * pf)
+{
+  std::mt19937 generator(7);
+  std::normal_distribution<double> position(0.0, 0.5);
+  std::normal_distribution<double> heading(0.0, 0.2);
+
+  pf_sample_set_t * set = pf->sets + pf->current_set;
+  set->sample_count = kParticles;
+  for (int j = 0; j < kParticles; j++) {
+    set->samples[j].pose.v[0] = kScanX + position(generator);
+    set->samples[j].pose.v[1] = kScanY + position(generator);
+    set->samples[j].pose.v[2] = kScanYaw + heading(generator);
+    set->samples[j].weight = 1.0 / kParticles;
+  }
+}
+
+std::unique_ptr<nav2_amcl::Laser> makeModel(Model model, map_t * map)
+{
+  switch (model) {
+    case Model::LikelihoodField:
+      return std::make_unique<nav2_amcl::LikelihoodFieldModel>(0.5, 0.5, 0.2, 2.0, 60, map);
+    case Model::LikelihoodFieldProb:
+      return std::make_unique<nav2_amcl::LikelihoodFieldModelProb>(
+        0.5, 0.5, 0.2, 2.0, true, 0.5, 0.3, 0.9, 60, map);
+    case Model::Beam:
+      return std::make_unique<nav2_amcl::BeamModel>(
+        0.5, 0.05, 0.05, 0.5, 0.2, 0.1, 0.0, 60, map);
+  }
+  return nullptr;
+}
+
+// Weights of the particles after a sensor update, on the calling thread if no thread pool
+std::vector<double> updateWeights(
+  nav2_amcl::Laser & laser, pf_t * pf, nav2_amcl::LaserData & data,
+  nav2_util::ThreadPool * thread_pool)
+{
+  laser.setThreadPool(thread_pool);
+  sampleParticles(pf);
+  EXPECT_TRUE(laser.sensorUpdate(pf, &data));
+
+  pf_sample_set_t * set = pf->sets + pf->current_set;
+  std::vector<double> weights(set->sample_count);
+  for (int j = 0; j < set->sample_count; j++) {
+    weights[j] = set->samples[j].weight;
+  }
+  return weights;
+}
+
+TEST(SensorModels, WeightsIndependentOfThreads)
+{
+  map_t * map = makeMap();
+
+  for (const Model model : {Model::LikelihoodField, Model::LikelihoodFieldProb, Model::Beam}) {
+    std::unique_ptr<nav2_amcl::Laser> laser = makeModel(model, map);
+    pf_vector_t laser_pose = pf_vector_zero();
+    laser->SetLaserPose(laser_pose);
+    nav2_amcl::LaserData data;
+    data.laser = laser.get();
+    recordScan(map, data);
+    pf_t * pf = pf_alloc(kParticles, kParticles, 0.001, 0.1, nullptr);
+    pf->sets[pf->current_set].converged = 1;
+
+    const std::vector<double> serial_weights = updateWeights(*laser, pf, data, nullptr);
+    ASSERT_EQ(serial_weights.size(), static_cast<size_t>(kParticles));
+    // The scan tells the particles apart
+    EXPECT_GT(
+      *std::max_element(serial_weights.begin(), serial_weights.end()),
+      *std::min_element(serial_weights.begin(), serial_weights.end()));
+
+    // Bit-identical weights, on one thread of a pool or on many
+    for (const unsigned int threads : {1u, 2u, 3u, 8u}) {
+      nav2_util::ThreadPool thread_pool(threads);
+      const std::vector<double> weights = updateWeights(*laser, pf, data, &thread_pool);
+      ASSERT_EQ(weights.size(), serial_weights.size());
+      for (size_t j = 0; j < weights.size(); j++) {
+        EXPECT_EQ(weights[j], serial_weights[j]) <<
+          "model " << static_cast<int>(model) << ", threads " << threads << ", sample " << j;
+      }
+    }
+
+    pf_free(pf);
+  }
+
+  map_free(map);
+}
@@ -101,6 +101,22 @@ protected:
    */
   void updatePolygon(double radius);
 
+  /**
+   * @brief Gets the bounding box of the circle
+   * @param min Output lower corner of the bounding box
+   * @param max Output upper corner of the bounding box
+   * @return False if the circle radius is not set, otherwise true
+   */
+  bool getBoundingBox(Point & min, Point & max) const override;
+
+  /**
+   * @brief Checks if point is inside the circle inflated by a margin
+   * @param point Given point to check
+   * @param margin Distance to the circle boundary
+   * @return True if given point is inside the inflated circle, otherwise false
+   */
+  bool isPointNear(const Point & point, const double margin) const override;
+
   /**
    * @brief Dynamic circle radius callback
    * @param msg Shared pointer to the radius value message
@@ -35,6 +35,7 @@
 #include "nav2_msgs/msg/collision_monitor_state.hpp"
 
 #include "nav2_collision_monitor/types.hpp"
+#include "nav2_collision_monitor/points_grid.hpp"
 #include "nav2_collision_monitor/polygon.hpp"
 #include "nav2_collision_monitor/circle.hpp"
 #include "nav2_collision_monitor/velocity_polygon.hpp"
@@ -160,30 +161,30 @@ protected:
   /**
    * @brief Processes the polygon of STOP, SLOWDOWN and LIMIT action type
    * @param polygon Polygon to process
-   * @param sources_collision_points_map Map containing source name as key and
-   * array of source's 2D obstacle points as value
+   * @param sources_points_grids Map containing source name as key and
+   * the grid of source's 2D obstacle points as value
    * @param velocity Desired robot velocity
    * @param robot_action Output processed robot action
    * @return True if returned action is caused by current polygon, otherwise false
    */
   bool processStopSlowdownLimit(
     const std::shared_ptr<Polygon> polygon,
-    const std::unordered_map<std::string, std::vector<Point>> & sources_collision_points_map,
+    const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
     const Velocity & velocity,
     Action & robot_action) const;
 
   /**
    * @brief Processes APPROACH action type
    * @param polygon Polygon to process
-   * @param sources_collision_points_map Map containing source name as key and
-   * array of source's 2D obstacle points as value
+   * @param sources_points_grids Map containing source name as key and
+   * the grid of source's 2D obstacle points as value
    * @param velocity Desired robot velocity
    * @param robot_action Output processed robot action
    * @return True if returned action is caused by current polygon, otherwise false
    */
   bool processApproach(
     const std::shared_ptr<Polygon> polygon,
-    const std::unordered_map<std::string, std::vector<Point>> & sources_collision_points_map,
+    const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
     const Velocity & velocity,
     Action & robot_action) const;
 
@@ -230,6 +231,10 @@ protected:
   /// @brief Whether main routine is active
   bool process_active_;
 
+  /// @brief Grids of the collision points of each source, kept between process() calls
+  /// to re-use their memory
+  std::unordered_map<std::string, PointsGrid> sources_points_grids_;
+
   /// @brief Previous robot action
   Action robot_action_prev_;
   /// @brief Latest timestamp when robot has 0-velocity
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COLLISION_MONITOR__COLLISION_TIME_GRID_HPP_
+#define NAV2_COLLISION_MONITOR__COLLISION_TIME_GRID_HPP_
+
+#include <limits>
+#include <vector>
+
+#include "nav2_collision_monitor/types.hpp"
+
+namespace nav2_collision_monitor
+{
+
+/// @brief Raster of the swept footprint of the robot moving with a fixed velocity:
+/// each cell keeps the earliest simulated time when the footprint might cover a point in it
+struct CollisionTimeGrid
+{
+  /// @brief Lower corner of the grid in the robot base frame
+  Point origin{0.0, 0.0};
+  /// @brief Upper corner of the grid in the robot base frame
+  Point end{0.0, 0.0};
+  /// @brief Size of the grid cells
+  double resolution{0.0};
+  /// @brief Number of grid cells in X direction
+  unsigned int size_x{0};
+  /// @brief Number of grid cells in Y direction
+  unsigned int size_y{0};
+  /// @brief Time before a collision for each cell, or infinity if footprint never covers it
+  std::vector<float> times;
+  /// @brief Maximum distance the footprint is inflated by on the time horizon,
+  /// for the velocity and grid quantisation
+  double error_bound{0.0};
+
+  /**
+   * @brief Gets the time before a collision with a point
+   * @param point Point in the robot base frame
+   * @return Time before a collision, or infinity if there is no collision
+   */
+  inline float getCollisionTime(const Point & point) const
+  {
+    const double x = (point.x - origin.x) / resolution;
+    const double y = (point.y - origin.y) / resolution;
+    if (!(x >= 0.0 && y >= 0.0 && x < size_x && y < size_y)) {
+      return std::numeric_limits<float>::infinity();
+    }
+    return times[static_cast<unsigned int>(y) * size_x + static_cast<unsigned int>(x)];
+  }
+};
+
+}  // namespace nav2_collision_monitor
+
+#endif  // NAV2_COLLISION_MONITOR__COLLISION_TIME_GRID_HPP_
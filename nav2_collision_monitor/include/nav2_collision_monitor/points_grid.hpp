@@ -0,0 +1,83 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COLLISION_MONITOR__POINTS_GRID_HPP_
+#define NAV2_COLLISION_MONITOR__POINTS_GRID_HPP_
+
+#include <vector>
+
+#include "nav2_collision_monitor/types.hpp"
+
+namespace nav2_collision_monitor
+{
+
+/**
+ * @brief Spatial index of the collision points of a data source in the robot base frame.
+ * The points are sorted by the cells of a regular grid covering them, so that the points
+ * near a shape could be obtained from the cells under its bounding box only.
+ */
+class PointsGrid
+{
+public:
+  /**
+   * @brief PointsGrid constructor
+   * @param resolution Size of the grid cells. It is increased if the points are spread
+   * over a too large area, to keep the number of cells proportional to the number of points.
+   */
+  explicit PointsGrid(const double resolution = 0.1);
+
+  /**
+   * @brief Indexes the points, replacing the previous ones.
+   * Points with non-finite coordinates are dropped, as they could not be inside any shape.
+   * @param points Array of points in the robot base frame
+   */
+  void setPoints(const std::vector<Point> & points);
+
+  /**
+   * @brief Gets the number of indexed points
+   * @return Number of points
+   */
+  size_t size() const;
+
+  /**
+   * @brief Adds the points from the cells overlapping a box to the output array.
+   * These contain all the points inside the box, as well as some points around it.
+   * @param min Lower corner of the box
+   * @param max Upper corner of the box
+   * @param points Array where the points to be added
+   */
+  void getPointsNear(const Point & min, const Point & max, std::vector<Point> & points) const;
+
+protected:
+  /// @brief Size of the grid cells the points are indexed with
+  double resolution_;
+  /// @brief Actual size of the grid cells, adjusted to the area of the points
+  double cell_size_;
+  /// @brief Lower corner of the grid
+  Point origin_;
+  /// @brief Number of grid cells in X direction
+  unsigned int size_x_;
+  /// @brief Number of grid cells in Y direction
+  unsigned int size_y_;
+  /// @brief Index of the first point of each cell, and the number of points at the end
+  std::vector<unsigned int> cell_offsets_;
+  /// @brief Points sorted by grid cells
+  std::vector<Point> points_;
+  /// @brief Cells of the input points, stored between calls to avoid re-allocations
+  std::vector<unsigned int> point_cells_;
+};
+
+}  // namespace nav2_collision_monitor
+
+#endif  // NAV2_COLLISION_MONITOR__POINTS_GRID_HPP_
@@ -15,8 +15,10 @@
 #ifndef NAV2_COLLISION_MONITOR__POLYGON_HPP_
 #define NAV2_COLLISION_MONITOR__POLYGON_HPP_
 
+#include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 #include <unordered_map>
 
@@ -30,6 +32,8 @@
 #include "nav2_costmap_2d/footprint_subscriber.hpp"
 
 #include "nav2_collision_monitor/types.hpp"
+#include "nav2_collision_monitor/points_grid.hpp"
+#include "nav2_collision_monitor/collision_time_grid.hpp"
 
 namespace nav2_collision_monitor
 {
@@ -163,6 +167,18 @@ public:
   virtual int getPointsInside(
     const std::unordered_map<std::string, std::vector<Point>> & sources_collision_points_map) const;
 
+  /**
+   * @brief Gets number of points inside given polygon,
+   * checking only the points from the grid cells under the polygon
+   * @param sources_points_grids Map containing source name as key,
+   * and the grid of source's points to be checked as value
+   * @return Number of points inside polygon,
+   * for sources in map that are associated with current polygon.
+   * If there are no points, returns zero value.
+   */
+  int getPointsInside(
+    const std::unordered_map<std::string, PointsGrid> & sources_points_grids) const;
+
   /**
    * @brief Obtains estimated (simulated) time before a collision.
    * Applicable for APPROACH model.
@@ -176,6 +192,21 @@ public:
     const std::unordered_map<std::string, std::vector<Point>> & sources_collision_points_map,
     const Velocity & velocity) const;
 
+  /**
+   * @brief Obtains estimated (simulated) time before a collision.
+   * Applicable for APPROACH model.
+   * On each simulation step, only the points from the grid cells under the moved polygon
+   * are checked.
+   * @param sources_points_grids Map containing source name as key,
+   * and the grid of source's 2D obstacle points as value
+   * @param velocity Simulated robot velocity
+   * @return Estimated time before a collision. If there is no collision,
+   * return value will be negative.
+   */
+  double getCollisionTime(
+    const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
+    const Velocity & velocity) const;
+
   /**
    * @brief Publishes polygon message into a its own topic
    */
@@ -239,6 +270,66 @@ protected:
   rcl_interfaces::msg::SetParametersResult dynamicParametersCallback(
     std::vector<rclcpp::Parameter> parameters);
 
+  /**
+   * @brief Gets the bounding box of the shape
+   * @param min Output lower corner of the bounding box
+   * @param max Output upper corner of the bounding box
+   * @return False if the shape is not set, otherwise true
+   */
+  virtual bool getBoundingBox(Point & min, Point & max) const;
+
+  /**
+   * @brief Gets the bounding box of the shape moved to a pose
+   * @param pose Pose of the shape in the robot base frame
+   * @param min Output lower corner of the bounding box
+   * @param max Output upper corner of the bounding box
+   * @return False if the shape is not set, otherwise true
+   */
+  bool getBoundingBox(const Pose & pose, Point & min, Point & max) const;
+
+  /**
+   * @brief Checks if point is inside the shape or closer to its boundary than a margin
+   * @param point Given point to check
+   * @param margin Distance to the shape boundary
+   * @return True if given point is inside the shape inflated by margin, otherwise false
+   */
+  virtual bool isPointNear(const Point & point, const double margin) const;
+
+  /**
+   * @brief Obtains estimated time before a collision from the collision time grid
+   * of the quantised velocity, looking up the time for each point near the swept footprint
+   * @param sources_points_grids Map containing source name as key,
+   * and the grid of source's 2D obstacle points as value
+   * @param velocity Simulated robot velocity
+   * @return Estimated time before a collision, not later than the simulated one.
+   * If there is no collision, return value will be negative.
+   */
+  double getCollisionTimeFromGrid(
+    const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
+    const Velocity & velocity) const;
+
+  /**
+   * @brief Rasterises the footprint swept during the simulated robot movement.
+   * The footprint is inflated on each simulation step by the largest deviation of the robot
+   * moving with any velocity of the quantisation bin, so the grid is conservative for all of them.
+   * @param velocity Center of the velocity quantisation bin
+   * @return Collision time grid for the velocity
+   */
+  std::shared_ptr<const CollisionTimeGrid> createCollisionTimeGrid(const Velocity & velocity) const;
+
+  /**
+   * @brief Gets the points of the polygon's sources which might be inside the shape
+   * moved to a pose, as they are in the grid cells under its bounding box
+   * @param pose Pose of the shape in the robot base frame
+   * @param sources_points_grids Map containing source name as key,
+   * and the grid of source's points as value
+   * @param points Output array of points in the robot base frame
+   */
+  void getPointsNear(
+    const Pose & pose,
+    const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
+    std::vector<Point> & points) const;
+
   /**
    * @brief Checks if point is inside polygon
    * @param point Given point to check
@@ -311,6 +402,21 @@ protected:
 
   /// @brief Polygon points (vertices) in a base_frame_id_
   std::vector<Point> poly_;
+
+  // Collision time grids
+  /// @brief Whether to look up the time before a collision in the precomputed grids
+  bool use_collision_time_grids_;
+  /// @brief Size of the collision time grid cells
+  double collision_time_grid_resolution_;
+  /// @brief Linear velocity quantisation step of the collision time grids
+  double collision_time_grid_linear_step_;
+  /// @brief Angular velocity quantisation step of the collision time grids
+  double collision_time_grid_angular_step_;
+  /// @brief Collision time grids of the quantised velocities used so far
+  mutable std::map<std::tuple<int, int, int>, std::shared_ptr<const CollisionTimeGrid>>
+  collision_time_grids_;
+  /// @brief Shape the collision time grids were made for
+  mutable std::vector<Point> collision_time_grids_shape_;
 };  // class Polygon
 
 }  // namespace nav2_collision_monitor
@@ -22,6 +22,7 @@
 #include "rclcpp/rclcpp.hpp"
 
 #include "tf2/time.hpp"
+#include "tf2/LinearMath/Transform.hpp"
 #include "tf2_ros/buffer.h"
 
 #include "nav2_collision_monitor/types.hpp"
@@ -138,6 +139,34 @@ protected:
     const std_msgs::msg::Header & data_header,
     tf2::Transform & tf_transform) const;
 
+  /**
+   * @brief Adds the points cached from the latest processed message to the data array,
+   * if it is still the latest obtained message. Messages are told apart by identity rather
+   * than by timestamp, as sources may publish repeated or zero stamps. The points are moved
+   * by the change of the transform, as long as it is a planar motion keeping their heights.
+   * @param message Latest obtained message
+   * @param tf_transform Current source->base_frame_id_ transform
+   * @param data Array where the cached points to be added
+   * @return True if the cached points were added, false if the message has to be processed
+   */
+  bool getCachedData(
+    const std::shared_ptr<const void> & message,
+    const tf2::Transform & tf_transform,
+    std::vector<Point> & data) const;
+
+  /**
+   * @brief Caches the points obtained from the latest message for further getData() calls
+   * @param message Message the points were obtained from
+   * @param tf_transform source->base_frame_id_ transform the points were obtained with
+   * @param data Data array, with the points of the message at its end
+   * @param first Index of the first point of the message in the data array
+   */
+  void setCachedData(
+    const std::shared_ptr<const void> & message,
+    const tf2::Transform & tf_transform,
+    const std::vector<Point> & data,
+    const size_t first);
+
   // ----- Variables -----
 
   /// @brief Collision Monitor node
@@ -167,6 +196,15 @@ protected:
   bool base_shift_correction_;
   /// @brief Whether source is enabled
   bool enabled_;
+
+  // Cached data
+  /// @brief Message the cached points were obtained from, if any. It is held so that
+  /// a newer message can not be allocated at the same address.
+  std::shared_ptr<const void> cached_message_;
+  /// @brief source->base_frame_id_ transform the cached points were obtained with
+  tf2::Transform cached_transform_;
+  /// @brief Points of the latest processed message in base frame
+  std::vector<Point> cached_points_;
 };  // class Source
 
 }  // namespace nav2_collision_monitor
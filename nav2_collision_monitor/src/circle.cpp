@@ -70,6 +70,23 @@ int Circle::getPointsInside(const std::vector<Point> & points) const
   return num;
 }
 
+bool Circle::getBoundingBox(Point & min, Point & max) const
+{
+  if (radius_squared_ == -1.0) {
+    return false;
+  }
+
+  min = {-radius_, -radius_};
+  max = {radius_, radius_};
+  return true;
+}
+
+bool Circle::isPointNear(const Point & point, const double margin) const
+{
+  const double radius = radius_ + margin;
+  return point.x * point.x + point.y * point.y < radius * radius;
+}
+
 bool Circle::isShapeSet()
 {
   if (radius_squared_ == -1.0) {
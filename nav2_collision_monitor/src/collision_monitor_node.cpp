@@ -471,6 +471,12 @@ void CollisionMonitor::process(const Velocity & cmd_vel_in, const std_msgs::msg:
     collision_points_marker_pub_->publish(std::move(marker_array));
   }
 
+  // Index the collision points of each source,
+  // so that polygons check only the points from the grid cells under them
+  for (const auto & source_points : sources_collision_points_map) {
+    sources_points_grids_[source_points.first].setPoints(source_points.second);
+  }
+
   for (std::shared_ptr<Polygon> polygon : polygons_) {
     if (!polygon->getEnabled()) {
       continue;
@@ -487,13 +493,13 @@ void CollisionMonitor::process(const Velocity & cmd_vel_in, const std_msgs::msg:
     if (at == STOP || at == SLOWDOWN || at == LIMIT) {
       // Process STOP/SLOWDOWN for the selected polygon
       if (processStopSlowdownLimit(
-          polygon, sources_collision_points_map, cmd_vel_in, robot_action))
+          polygon, sources_points_grids_, cmd_vel_in, robot_action))
       {
         action_polygon = polygon;
       }
     } else if (at == APPROACH) {
       // Process APPROACH for the selected polygon
-      if (processApproach(polygon, sources_collision_points_map, cmd_vel_in, robot_action)) {
+      if (processApproach(polygon, sources_points_grids_, cmd_vel_in, robot_action)) {
         action_polygon = polygon;
       }
     }
@@ -515,7 +521,7 @@ void CollisionMonitor::process(const Velocity & cmd_vel_in, const std_msgs::msg:
 
 bool CollisionMonitor::processStopSlowdownLimit(
   const std::shared_ptr<Polygon> polygon,
-  const std::unordered_map<std::string, std::vector<Point>> & sources_collision_points_map,
+  const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
   const Velocity & velocity,
   Action & robot_action) const
 {
@@ -523,7 +529,7 @@ bool CollisionMonitor::processStopSlowdownLimit(
     return false;
   }
 
-  if (polygon->getPointsInside(sources_collision_points_map) >= polygon->getMinPoints()) {
+  if (polygon->getPointsInside(sources_points_grids) >= polygon->getMinPoints()) {
     if (polygon->getActionType() == STOP) {
       // Setting up zero velocity for STOP model
       robot_action.polygon_name = polygon->getName();
@@ -574,7 +580,7 @@ bool CollisionMonitor::processStopSlowdownLimit(
 
 bool CollisionMonitor::processApproach(
   const std::shared_ptr<Polygon> polygon,
-  const std::unordered_map<std::string, std::vector<Point>> & sources_collision_points_map,
+  const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
   const Velocity & velocity,
   Action & robot_action) const
 {
@@ -583,7 +589,7 @@ bool CollisionMonitor::processApproach(
   }
 
   // Obtain time before a collision
-  const double collision_time = polygon->getCollisionTime(sources_collision_points_map, velocity);
+  const double collision_time = polygon->getCollisionTime(sources_points_grids, velocity);
   if (collision_time >= 0.0) {
     // If collision will occur, reduce robot speed
     const double change_ratio = collision_time / polygon->getTimeBeforeCollision();
@@ -84,6 +84,14 @@ bool PointCloud::getData(
     return false;
   }
 
+  // Re-use the points of the message if it has already been processed
+  if (getCachedData(data_, tf_transform, data)) {
+    return true;
+  }
+
+  const size_t first = data.size();
+  data.reserve(first + data_->width * data_->height);
+
   sensor_msgs::PointCloud2ConstIterator<float> iter_x(*data_, "x");
   sensor_msgs::PointCloud2ConstIterator<float> iter_y(*data_, "y");
   sensor_msgs::PointCloud2ConstIterator<float> iter_z(*data_, "z");
@@ -99,6 +107,8 @@ bool PointCloud::getData(
       data.push_back({p_v3_b.x(), p_v3_b.y()});
     }
   }
+
+  setCachedData(data_, tf_transform, data, first);
   return true;
 }
 
@@ -0,0 +1,134 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_collision_monitor/points_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace nav2_collision_monitor
+{
+
+// Minimum number of grid cells, so that a few points are not indexed with too coarse cells
+static constexpr double MIN_MAX_CELLS = 4096.0;
+// Marks points which are not indexed
+static constexpr unsigned int NO_CELL = std::numeric_limits<unsigned int>::max();
+
+PointsGrid::PointsGrid(const double resolution)
+: resolution_(resolution), cell_size_(resolution), origin_{0.0, 0.0}, size_x_(0), size_y_(0)
+{
+}
+
+void PointsGrid::setPoints(const std::vector<Point> & points)
+{
+  points_.clear();
+  cell_offsets_.clear();
+  size_x_ = 0;
+  size_y_ = 0;
+
+  // Bounds of the points
+  Point min{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  Point max{std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+  for (const Point & point : points) {
+    if (std::isfinite(point.x) && std::isfinite(point.y)) {
+      min.x = std::min(min.x, point.x);
+      min.y = std::min(min.y, point.y);
+      max.x = std::max(max.x, point.x);
+      max.y = std::max(max.y, point.y);
+    }
+  }
+  if (min.x > max.x) {
+    return;
+  }
+
+  // Keep the number of cells proportional to the number of points,
+  // in case of sparse points far from the robot
+  const double max_cells = std::max(MIN_MAX_CELLS, 4.0 * points.size());
+  cell_size_ = std::max(
+    resolution_, std::sqrt((max.x - min.x) * (max.y - min.y) / max_cells));
+  while (((max.x - min.x) / cell_size_ + 1.0) * ((max.y - min.y) / cell_size_ + 1.0) > max_cells) {
+    cell_size_ *= 2.0;
+  }
+  origin_ = min;
+  size_x_ = static_cast<unsigned int>((max.x - min.x) / cell_size_) + 1;
+  size_y_ = static_cast<unsigned int>((max.y - min.y) / cell_size_) + 1;
+
+  // Counting sort of the points by their cells
+  cell_offsets_.assign(size_x_ * size_y_ + 1, 0);
+  point_cells_.resize(points.size());
+  for (size_t i = 0; i < points.size(); i++) {
+    const Point & point = points[i];
+    if (std::isfinite(point.x) && std::isfinite(point.y)) {
+      const unsigned int cell_x = static_cast<unsigned int>((point.x - origin_.x) / cell_size_);
+      const unsigned int cell_y = static_cast<unsigned int>((point.y - origin_.y) / cell_size_);
+      point_cells_[i] = cell_y * size_x_ + cell_x;
+      cell_offsets_[point_cells_[i] + 1]++;
+    } else {
+      point_cells_[i] = NO_CELL;
+    }
+  }
+  for (size_t cell = 1; cell < cell_offsets_.size(); cell++) {
+    cell_offsets_[cell] += cell_offsets_[cell - 1];
+  }
+
+  points_.resize(cell_offsets_.back());
+  for (size_t i = 0; i < points.size(); i++) {
+    if (point_cells_[i] != NO_CELL) {
+      points_[cell_offsets_[point_cells_[i]]++] = points[i];
+    }
+  }
+  // Placing the points has moved each offset to the next cell
+  for (size_t cell = cell_offsets_.size() - 1; cell > 0; cell--) {
+    cell_offsets_[cell] = cell_offsets_[cell - 1];
+  }
+  cell_offsets_[0] = 0;
+}
+
+size_t PointsGrid::size() const
+{
+  return points_.size();
+}
+
+void PointsGrid::getPointsNear(
+  const Point & min, const Point & max, std::vector<Point> & points) const
+{
+  if (points_.empty()) {
+    return;
+  }
+
+  const double min_x = (min.x - origin_.x) / cell_size_;
+  const double min_y = (min.y - origin_.y) / cell_size_;
+  const double max_x = (max.x - origin_.x) / cell_size_;
+  const double max_y = (max.y - origin_.y) / cell_size_;
+  if (max_x < 0.0 || max_y < 0.0 || min_x >= size_x_ || min_y >= size_y_) {
+    return;
+  }
+
+  const unsigned int cell_min_x = static_cast<unsigned int>(std::max(min_x, 0.0));
+  const unsigned int cell_min_y = static_cast<unsigned int>(std::max(min_y, 0.0));
+  const unsigned int cell_max_x = static_cast<unsigned int>(std::min(max_x, size_x_ - 1.0));
+  const unsigned int cell_max_y = static_cast<unsigned int>(std::min(max_y, size_y_ - 1.0));
+
+  // Points of consecutive cells in a row are stored contiguously
+  for (unsigned int cell_y = cell_min_y; cell_y <= cell_max_y; cell_y++) {
+    const unsigned int row = cell_y * size_x_;
+    points.insert(
+      points.end(),
+      points_.begin() + cell_offsets_[row + cell_min_x],
+      points_.begin() + cell_offsets_[row + cell_max_x + 1]);
+  }
+}
+
+}  // namespace nav2_collision_monitor
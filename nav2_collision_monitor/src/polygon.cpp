@@ -14,7 +14,10 @@
 
 #include "nav2_collision_monitor/polygon.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <exception>
+#include <limits>
 #include <utility>
 
 #include "geometry_msgs/msg/point.hpp"
@@ -30,6 +33,9 @@
 namespace nav2_collision_monitor
 {
 
+// Maximum number of collision time grids kept for the quantised velocities
+static constexpr size_t MAX_COLLISION_TIME_GRIDS = 256;
+
 Polygon::Polygon(
   const nav2::LifecycleNode::WeakPtr & node,
   const std::string & polygon_name,
@@ -40,7 +46,7 @@ Polygon::Polygon(
   slowdown_ratio_(0.0), linear_limit_(0.0), angular_limit_(0.0),
   footprint_sub_(nullptr), tf_buffer_(tf_buffer),
   base_frame_id_(base_frame_id), transform_tolerance_(transform_tolerance),
-  node_clock_(nullptr)
+  node_clock_(nullptr), use_collision_time_grids_(false)
 {
   RCLCPP_INFO(logger_, "[%s]: Creating Polygon", polygon_name_.c_str());
 }
@@ -254,30 +260,49 @@ int Polygon::getPointsInside(
   return num;
 }
 
+int Polygon::getPointsInside(
+  const std::unordered_map<std::string, PointsGrid> & sources_points_grids) const
+{
+  std::vector<Point> points;
+  getPointsNear({0.0, 0.0, 0.0}, sources_points_grids, points);
+  return getPointsInside(points);
+}
+
 double Polygon::getCollisionTime(
   const std::unordered_map<std::string, std::vector<Point>> & sources_collision_points_map,
   const Velocity & velocity) const
 {
-  // Initial robot pose is {0,0} in base_footprint coordinates
-  Pose pose = {0.0, 0.0, 0.0};
-  Velocity vel = velocity;
-
-  std::vector<std::string> polygon_sources_names = getSourcesNames();
-  std::vector<Point> collision_points;
-
-  // Save all points coming from the sources associated with current polygon
-  for (const auto & source_name : polygon_sources_names) {
+  // Index the points of the sources associated with current polygon
+  std::unordered_map<std::string, PointsGrid> sources_points_grids;
+  for (const auto & source_name : sources_names_) {
     const auto & iter = sources_collision_points_map.find(source_name);
     if (iter != sources_collision_points_map.end()) {
-      collision_points.insert(collision_points.end(), iter->second.begin(), iter->second.end());
+      sources_points_grids[source_name].setPoints(iter->second);
     }
   }
 
-  // Array of points transformed to the frame concerned with pose on each simulation step
-  std::vector<Point> points_transformed = collision_points;
+  return getCollisionTime(sources_points_grids, velocity);
+}
+
+double Polygon::getCollisionTime(
+  const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
+  const Velocity & velocity) const
+{
+  if (use_collision_time_grids_) {
+    return getCollisionTimeFromGrid(sources_points_grids, velocity);
+  }
+
+  // Initial robot pose is {0,0} in base_footprint coordinates
+  Pose pose = {0.0, 0.0, 0.0};
+  Velocity vel = velocity;
+
+  // Array of points near the polygon on each simulation step,
+  // transformed to the frame concerned with the pose
+  std::vector<Point> points_transformed;
 
   // Check static polygon
-  if (getPointsInside(collision_points) >= min_points_) {
+  getPointsNear(pose, sources_points_grids, points_transformed);
+  if (getPointsInside(points_transformed) >= min_points_) {
     return 0.0;
   }
 
@@ -286,8 +311,9 @@ double Polygon::getCollisionTime(
     // Shift the robot pose towards to the vel during simulation_time_step_ time interval
     // NOTE: vel is changing during the simulation
     projectState(simulation_time_step_, pose, vel);
-    // Transform collision_points to the frame concerned with current robot pose
-    points_transformed = collision_points;
+    // Transform the points near the moved polygon to the frame concerned with current robot pose
+    points_transformed.clear();
+    getPointsNear(pose, sources_points_grids, points_transformed);
     transformPoints(pose, points_transformed);
     // If the collision occurred on this stage, return the actual time before a collision
     // as if robot was moved with given velocity
@@ -395,6 +421,41 @@ bool Polygon::getCommonParameters(
         node, polygon_name_ + ".simulation_time_step", rclcpp::ParameterValue(0.1));
       simulation_time_step_ =
         node->get_parameter(polygon_name_ + ".simulation_time_step").as_double();
+
+      nav2::declare_parameter_if_not_declared(
+        node, polygon_name_ + ".use_collision_time_grids", rclcpp::ParameterValue(false));
+      use_collision_time_grids_ =
+        node->get_parameter(polygon_name_ + ".use_collision_time_grids").as_bool();
+      if (use_collision_time_grids_) {
+        nav2::declare_parameter_if_not_declared(
+          node, polygon_name_ + ".collision_time_grid_resolution", rclcpp::ParameterValue(0.05));
+        collision_time_grid_resolution_ =
+          node->get_parameter(polygon_name_ + ".collision_time_grid_resolution").as_double();
+        nav2::declare_parameter_if_not_declared(
+          node, polygon_name_ + ".collision_time_grid_linear_step", rclcpp::ParameterValue(0.05));
+        collision_time_grid_linear_step_ =
+          node->get_parameter(polygon_name_ + ".collision_time_grid_linear_step").as_double();
+        nav2::declare_parameter_if_not_declared(
+          node, polygon_name_ + ".collision_time_grid_angular_step", rclcpp::ParameterValue(0.05));
+        collision_time_grid_angular_step_ =
+          node->get_parameter(polygon_name_ + ".collision_time_grid_angular_step").as_double();
+        if (
+          collision_time_grid_resolution_ <= 0.0 || collision_time_grid_linear_step_ <= 0.0 ||
+          collision_time_grid_angular_step_ <= 0.0)
+        {
+          RCLCPP_ERROR(
+            logger_,
+            "[%s]: Collision time grid resolution and velocity steps should be positive",
+            polygon_name_.c_str());
+          return false;
+        }
+        RCLCPP_INFO(
+          logger_,
+          "[%s]: Using collision time grids of %.3f m resolution, "
+          "for velocities quantised by %.3f m/s and %.3f rad/s",
+          polygon_name_.c_str(), collision_time_grid_resolution_,
+          collision_time_grid_linear_step_, collision_time_grid_angular_step_);
+      }
     }
 
     nav2::declare_parameter_if_not_declared(
@@ -602,6 +663,279 @@ void Polygon::polygonCallback(geometry_msgs::msg::PolygonStamped::ConstSharedPtr
   updatePolygon(msg);
 }
 
+bool Polygon::getBoundingBox(Point & min, Point & max) const
+{
+  if (poly_.empty()) {
+    return false;
+  }
+
+  min = poly_[0];
+  max = poly_[0];
+  for (const Point & vertex : poly_) {
+    min.x = std::min(min.x, vertex.x);
+    min.y = std::min(min.y, vertex.y);
+    max.x = std::max(max.x, vertex.x);
+    max.y = std::max(max.y, vertex.y);
+  }
+  return true;
+}
+
+bool Polygon::getBoundingBox(const Pose & pose, Point & min, Point & max) const
+{
+  Point shape_min, shape_max;
+  if (!getBoundingBox(shape_min, shape_max)) {
+    return false;
+  }
+
+  // Bounding box of the shape moved to the pose, containing its moved bounding box
+  const double cos_theta = std::cos(pose.theta);
+  const double sin_theta = std::sin(pose.theta);
+  min = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  max = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+  for (const Point & corner :
+    {shape_min, Point{shape_max.x, shape_min.y}, shape_max, Point{shape_min.x, shape_max.y}})
+  {
+    const double x = pose.x + corner.x * cos_theta - corner.y * sin_theta;
+    const double y = pose.y + corner.x * sin_theta + corner.y * cos_theta;
+    min.x = std::min(min.x, x);
+    min.y = std::min(min.y, y);
+    max.x = std::max(max.x, x);
+    max.y = std::max(max.y, y);
+  }
+  return true;
+}
+
+void Polygon::getPointsNear(
+  const Pose & pose,
+  const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
+  std::vector<Point> & points) const
+{
+  Point min, max;
+  if (!getBoundingBox(pose, min, max)) {
+    return;
+  }
+
+  // Keep the points on the boundary of the shape despite of rounding errors
+  static constexpr double BOUNDS_MARGIN = 1e-6;
+  min.x -= BOUNDS_MARGIN;
+  min.y -= BOUNDS_MARGIN;
+  max.x += BOUNDS_MARGIN;
+  max.y += BOUNDS_MARGIN;
+
+  for (const auto & source_name : sources_names_) {
+    const auto & iter = sources_points_grids.find(source_name);
+    if (iter != sources_points_grids.end()) {
+      iter->second.getPointsNear(min, max, points);
+    }
+  }
+}
+
+bool Polygon::isPointNear(const Point & point, const double margin) const
+{
+  if (isPointInside(point)) {
+    return true;
+  }
+
+  // Distance to the polygon edges
+  const double margin_squared = margin * margin;
+  const size_t poly_size = poly_.size();
+  for (size_t i = poly_size - 1, j = 0; j < poly_size; i = j++) {
+    const double edge_x = poly_[j].x - poly_[i].x;
+    const double edge_y = poly_[j].y - poly_[i].y;
+    const double length_squared = edge_x * edge_x + edge_y * edge_y;
+    double ratio = 0.0;
+    if (length_squared > 0.0) {
+      ratio = std::clamp(
+        ((point.x - poly_[i].x) * edge_x + (point.y - poly_[i].y) * edge_y) / length_squared,
+        0.0, 1.0);
+    }
+    const double dx = poly_[i].x + ratio * edge_x - point.x;
+    const double dy = poly_[i].y + ratio * edge_y - point.y;
+    if (dx * dx + dy * dy <= margin_squared) {
+      return true;
+    }
+  }
+  return false;
+}
+
+double Polygon::getCollisionTimeFromGrid(
+  const std::unordered_map<std::string, PointsGrid> & sources_points_grids,
+  const Velocity & velocity) const
+{
+  // Collision is triggered by any point even if there are none
+  if (min_points_ <= 0) {
+    return 0.0;
+  }
+
+  // Re-create the grids if the shape has changed (e.g. by the footprint subscription)
+  std::vector<Point> shape;
+  getPolygon(shape);
+  if (
+    shape.size() != collision_time_grids_shape_.size() ||
+    !std::equal(
+      shape.begin(), shape.end(), collision_time_grids_shape_.begin(),
+      [](const Point & a, const Point & b) {return a.x == b.x && a.y == b.y;}))
+  {
+    collision_time_grids_.clear();
+    collision_time_grids_shape_ = shape;
+  }
+
+  // Collision time grid for the center of the velocity quantisation bin
+  const std::tuple<int, int, int> bin{
+    static_cast<int>(std::lround(velocity.x / collision_time_grid_linear_step_)),
+    static_cast<int>(std::lround(velocity.y / collision_time_grid_linear_step_)),
+    static_cast<int>(std::lround(velocity.tw / collision_time_grid_angular_step_))};
+  auto iter = collision_time_grids_.find(bin);
+  if (iter == collision_time_grids_.end()) {
+    if (collision_time_grids_.size() >= MAX_COLLISION_TIME_GRIDS) {
+      collision_time_grids_.clear();
+    }
+    const Velocity bin_velocity{
+      std::get<0>(bin) * collision_time_grid_linear_step_,
+      std::get<1>(bin) * collision_time_grid_linear_step_,
+      std::get<2>(bin) * collision_time_grid_angular_step_};
+    iter = collision_time_grids_.emplace(bin, createCollisionTimeGrid(bin_velocity)).first;
+  }
+  const CollisionTimeGrid & grid = *iter->second;
+
+  // Times before a collision with the points under the swept footprint
+  std::vector<Point> points;
+  for (const auto & source_name : sources_names_) {
+    const auto & source_iter = sources_points_grids.find(source_name);
+    if (source_iter != sources_points_grids.end()) {
+      source_iter->second.getPointsNear(grid.origin, grid.end, points);
+    }
+  }
+  std::vector<float> times;
+  for (const Point & point : points) {
+    const float time = grid.getCollisionTime(point);
+    if (time != std::numeric_limits<float>::infinity()) {
+      times.push_back(time);
+    }
+  }
+
+  // The collision occurs when min_points_ points are covered by the footprint
+  if (times.size() < static_cast<size_t>(min_points_)) {
+    return -1.0;
+  }
+  std::nth_element(times.begin(), times.begin() + (min_points_ - 1), times.end());
+  return times[min_points_ - 1];
+}
+
+std::shared_ptr<const CollisionTimeGrid> Polygon::createCollisionTimeGrid(
+  const Velocity & velocity) const
+{
+  auto grid = std::make_shared<CollisionTimeGrid>();
+  grid->resolution = collision_time_grid_resolution_;
+
+  Point shape_min, shape_max;
+  if (!getBoundingBox(shape_min, shape_max)) {
+    return grid;
+  }
+
+  // Largest deviation of the robot moving with a velocity from the quantisation bin:
+  // its linear velocity differs by up to linear_error and the angular one by up to
+  // angular_error, so at time t the footprint is shifted by up to
+  // t * linear_error + speed * angular_error * t^2 / 2 and turned by up to angular_error * t,
+  // moving its points by up to radius * angular_error * t.
+  // Any point inside the grid cell is also within half_diagonal from its center.
+  const double linear_error = collision_time_grid_linear_step_ * std::sqrt(0.5);
+  const double angular_error = collision_time_grid_angular_step_ * 0.5;
+  const double speed = std::hypot(velocity.x, velocity.y);
+  // The furthest point of the footprint from the center of rotation is one of its vertices
+  std::vector<Point> shape;
+  getPolygon(shape);
+  double radius = 0.0;
+  for (const Point & vertex : shape) {
+    radius = std::max(radius, std::hypot(vertex.x, vertex.y));
+  }
+  const double half_diagonal = collision_time_grid_resolution_ * std::sqrt(0.5);
+
+  // Simulated poses, as in getCollisionTime(), with the footprint inflation
+  struct Step
+  {
+    Pose pose;
+    double margin;
+    double time;
+  };
+  std::vector<Step> steps{{{0.0, 0.0, 0.0}, half_diagonal, 0.0}};
+  Pose pose = {0.0, 0.0, 0.0};
+  Velocity vel = velocity;
+  double elapsed = 0.0;
+  for (double time = 0.0; time <= time_before_collision_; time += simulation_time_step_) {
+    projectState(simulation_time_step_, pose, vel);
+    elapsed += simulation_time_step_;
+    const double margin = half_diagonal +
+      elapsed * (linear_error + radius * angular_error) +
+      speed * angular_error * elapsed * elapsed * 0.5;
+    steps.push_back({pose, margin, time});
+  }
+  grid->error_bound = steps.back().margin;
+
+  // Grid covering the inflated footprint on all steps
+  Point min{std::numeric_limits<double>::max(), std::numeric_limits<double>::max()};
+  Point max{std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()};
+  for (const Step & step : steps) {
+    Point step_min, step_max;
+    getBoundingBox(step.pose, step_min, step_max);
+    min.x = std::min(min.x, step_min.x - step.margin);
+    min.y = std::min(min.y, step_min.y - step.margin);
+    max.x = std::max(max.x, step_max.x + step.margin);
+    max.y = std::max(max.y, step_max.y + step.margin);
+  }
+  grid->origin = min;
+  grid->size_x = static_cast<unsigned int>(std::ceil((max.x - min.x) / grid->resolution));
+  grid->size_y = static_cast<unsigned int>(std::ceil((max.y - min.y) / grid->resolution));
+  grid->end = {
+    min.x + grid->size_x * grid->resolution, min.y + grid->size_y * grid->resolution};
+  grid->times.assign(
+    grid->size_x * grid->size_y, std::numeric_limits<float>::infinity());
+
+  // Mark the cells the inflated footprint covers at each step with the earliest time
+  for (const Step & step : steps) {
+    Point step_min, step_max;
+    getBoundingBox(step.pose, step_min, step_max);
+    const unsigned int cell_min_x = static_cast<unsigned int>(
+      std::max(0.0, (step_min.x - step.margin - min.x) / grid->resolution));
+    const unsigned int cell_min_y = static_cast<unsigned int>(
+      std::max(0.0, (step_min.y - step.margin - min.y) / grid->resolution));
+    const unsigned int cell_max_x = std::min(
+      grid->size_x - 1,
+      static_cast<unsigned int>((step_max.x + step.margin - min.x) / grid->resolution));
+    const unsigned int cell_max_y = std::min(
+      grid->size_y - 1,
+      static_cast<unsigned int>((step_max.y + step.margin - min.y) / grid->resolution));
+    const float time = static_cast<float>(step.time);
+    const double cos_theta = std::cos(step.pose.theta);
+    const double sin_theta = std::sin(step.pose.theta);
+
+    for (unsigned int cell_y = cell_min_y; cell_y <= cell_max_y; cell_y++) {
+      for (unsigned int cell_x = cell_min_x; cell_x <= cell_max_x; cell_x++) {
+        float & cell_time = grid->times[cell_y * grid->size_x + cell_x];
+        if (cell_time <= time) {
+          continue;
+        }
+        // Cell center in the frame concerned with the robot pose on this step,
+        // as transformPoints() does
+        const double dx = min.x + (cell_x + 0.5) * grid->resolution - step.pose.x;
+        const double dy = min.y + (cell_y + 0.5) * grid->resolution - step.pose.y;
+        const Point center{dx * cos_theta + dy * sin_theta, -dx * sin_theta + dy * cos_theta};
+        if (isPointNear(center, step.margin)) {
+          cell_time = time;
+        }
+      }
+    }
+  }
+
+  RCLCPP_DEBUG(
+    logger_,
+    "[%s]: Created collision time grid of %ux%u cells for velocity (%.3f, %.3f, %.3f), "
+    "with the footprint inflated by up to %.3f m",
+    polygon_name_.c_str(), grid->size_x, grid->size_y,
+    velocity.x, velocity.y, velocity.tw, grid->error_bound);
+  return grid;
+}
+
 inline bool Polygon::isPointInside(const Point & point) const
 {
   // Adaptation of Shimrat, Moshe. "Algorithm 112: position of point relative to polygon."
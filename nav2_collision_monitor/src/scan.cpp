@@ -84,6 +84,14 @@ bool Scan::getData(
     return false;
   }
 
+  // Re-use the points of the message if it has already been processed
+  if (getCachedData(data_, tf_transform, data)) {
+    return true;
+  }
+
+  const size_t first = data.size();
+  data.reserve(first + data_->ranges.size());
+
   // Calculate poses and refill data array
   float angle = data_->angle_min;
   for (size_t i = 0; i < data_->ranges.size(); i++) {
@@ -100,6 +108,8 @@ bool Scan::getData(
     }
     angle += data_->angle_increment;
   }
+
+  setCachedData(data_, tf_transform, data, first);
   return true;
 }
 
@@ -14,6 +14,7 @@
 
 #include "nav2_collision_monitor/source.hpp"
 
+#include <cmath>
 #include <exception>
 
 #include "geometry_msgs/msg/transform_stamped.hpp"
@@ -160,4 +161,54 @@ bool Source::getTransform(
   return true;
 }
 
+bool Source::getCachedData(
+  const std::shared_ptr<const void> & message,
+  const tf2::Transform & tf_transform,
+  std::vector<Point> & data) const
+{
+  if (cached_message_ == nullptr || message != cached_message_) {
+    return false;
+  }
+
+  if (tf_transform == cached_transform_) {
+    data.insert(data.end(), cached_points_.begin(), cached_points_.end());
+    return true;
+  }
+
+  // The robot has moved since the points were cached (base_shift_correction_):
+  // they might be reused only if it is a planar motion, keeping the height filtering
+  const tf2::Transform correction = tf_transform * cached_transform_.inverse();
+  const tf2::Matrix3x3 & basis = correction.getBasis();
+  static constexpr double PLANAR_TOLERANCE = 1e-6;
+  if (
+    std::fabs(basis[2][0]) > PLANAR_TOLERANCE || std::fabs(basis[2][1]) > PLANAR_TOLERANCE ||
+    std::fabs(correction.getOrigin().z()) > PLANAR_TOLERANCE)
+  {
+    return false;
+  }
+
+  const double cos_theta = basis[0][0];
+  const double sin_theta = basis[1][0];
+  const double dx = correction.getOrigin().x();
+  const double dy = correction.getOrigin().y();
+  data.reserve(data.size() + cached_points_.size());
+  for (const Point & point : cached_points_) {
+    data.push_back(
+      {point.x * cos_theta - point.y * sin_theta + dx,
+        point.x * sin_theta + point.y * cos_theta + dy});
+  }
+  return true;
+}
+
+void Source::setCachedData(
+  const std::shared_ptr<const void> & message,
+  const tf2::Transform & tf_transform,
+  const std::vector<Point> & data,
+  const size_t first)
+{
+  cached_message_ = message;
+  cached_transform_ = tf_transform;
+  cached_points_.assign(data.begin() + first, data.end());
+}
+
 }  // namespace nav2_collision_monitor
@@ -21,6 +21,7 @@
 #include <vector>
 #include <string>
 #include <limits>
+#include <unordered_map>
 
 #include "rclcpp/rclcpp.hpp"
 #include "nav2_ros_common/lifecycle_node.hpp"
@@ -34,6 +35,7 @@
 #include "nav2_collision_monitor/types.hpp"
 #include "nav2_collision_monitor/polygon.hpp"
 #include "nav2_collision_monitor/circle.hpp"
+#include "nav2_collision_monitor/points_grid.hpp"
 
 using namespace std::chrono_literals;
 
@@ -209,6 +211,22 @@ public:
   {
     return visualize_;
   }
+
+  void setPolygon(const std::vector<nav2_collision_monitor::Point> & poly)
+  {
+    poly_ = poly;
+  }
+
+  void setUseCollisionTimeGrids(const bool use_collision_time_grids)
+  {
+    use_collision_time_grids_ = use_collision_time_grids;
+  }
+
+  std::shared_ptr<const nav2_collision_monitor::CollisionTimeGrid> getCollisionTimeGrid(
+    const nav2_collision_monitor::Velocity & velocity) const
+  {
+    return createCollisionTimeGrid(velocity);
+  }
 };  // PolygonWrapper
 
 class CircleWrapper : public nav2_collision_monitor::Circle
@@ -883,6 +901,42 @@ TEST_F(Tester, testCircleGetPointsInside)
   ASSERT_EQ(circle_->getPointsInside(points), 1);
 }
 
+TEST_F(Tester, testGetPointsInsideGrid)
+{
+  createPolygon("stop", true);
+  createCircle("stop", true);
+  const nav2_collision_monitor::Polygon & circle = *circle_;
+
+  // Points spread around the shapes, on their edges and far away from them
+  std::vector<nav2_collision_monitor::Point> points;
+  for (double x = -2.0; x <= 2.0; x += 0.05) {
+    for (double y = -2.0; y <= 2.0; y += 0.05) {
+      points.push_back({x, y});
+    }
+  }
+  points.push_back({100.0, -100.0});
+  points.push_back({std::numeric_limits<double>::quiet_NaN(), 0.0});
+
+  std::unordered_map<std::string, std::vector<nav2_collision_monitor::Point>> points_map;
+  points_map.insert({OBSERVATION_SOURCE_NAME, points});
+  std::unordered_map<std::string, nav2_collision_monitor::PointsGrid> grids_map;
+  grids_map[OBSERVATION_SOURCE_NAME].setPoints(points);
+  // Grid contains all finite points
+  ASSERT_EQ(grids_map[OBSERVATION_SOURCE_NAME].size(), points.size() - 1);
+
+  // Grid gives the same points inside shapes as the plain array
+  EXPECT_GT(polygon_->getPointsInside(grids_map), 0);
+  EXPECT_EQ(polygon_->getPointsInside(grids_map), polygon_->getPointsInside(points_map));
+  EXPECT_GT(circle.getPointsInside(grids_map), 0);
+  EXPECT_EQ(circle.getPointsInside(grids_map), circle.getPointsInside(points_map));
+
+  // Points from the sources not associated with polygon are ignored
+  grids_map.clear();
+  grids_map["other_source"].setPoints(points);
+  EXPECT_EQ(polygon_->getPointsInside(grids_map), 0);
+  EXPECT_EQ(circle.getPointsInside(grids_map), 0);
+}
+
 TEST_F(Tester, testPolygonGetCollisionTime)
 {
   createPolygon("approach", false);
@@ -952,6 +1006,120 @@ TEST_F(Tester, testPolygonGetCollisionTime)
   EXPECT_LT(polygon_->getCollisionTime(points_map, vel), 0.0);
 }
 
+TEST_F(Tester, testPolygonGetCollisionTimeGrid)
+{
+  createPolygon("approach", false);
+
+  // Set footprint for Polygon
+  test_node_->publishFootprint();
+  std::vector<nav2_collision_monitor::Point> footprint;
+  ASSERT_TRUE(waitFootprint(500ms, footprint));
+  ASSERT_EQ(footprint.size(), 4u);
+
+  // Two points 0.2 m ahead the footprint (0.5 m) among the points far away from the robot
+  std::vector<nav2_collision_monitor::Point> points{{0.7, -0.01}, {0.7, 0.01}};
+  for (double x = -10.0; x <= 10.0; x += 0.1) {
+    points.push_back({x, 5.0});
+    points.push_back({x, -5.0});
+  }
+  std::unordered_map<std::string, nav2_collision_monitor::PointsGrid> grids_map;
+  grids_map[OBSERVATION_SOURCE_NAME].setPoints(points);
+
+  // Forward movement: collision is expected to be ~= 0.2 m / 0.5 m/s seconds
+  nav2_collision_monitor::Velocity vel{0.5, 0.0, 0.0};
+  EXPECT_NEAR(polygon_->getCollisionTime(grids_map, vel), 0.4, SIMULATION_TIME_STEP);
+
+  // Backward movement: points are behind the robot, there is no collision
+  vel = {-0.5, 0.0, 0.0};
+  EXPECT_LT(polygon_->getCollisionTime(grids_map, vel), 0.0);
+
+  // Rotation: the points far away from the robot are never reached
+  vel = {0.0, 0.0, 1.0};
+  grids_map[OBSERVATION_SOURCE_NAME].setPoints(
+    std::vector<nav2_collision_monitor::Point>(points.begin() + 2, points.end()));
+  EXPECT_LT(polygon_->getCollisionTime(grids_map, vel), 0.0);
+}
+
+TEST_F(Tester, testGetCollisionTimeFromGrids)
+{
+  for (const std::string & shape_name : {POLYGON_NAME, CIRCLE_NAME}) {
+    test_node_->declare_parameter(
+      shape_name + ".use_collision_time_grids", rclcpp::ParameterValue(true));
+  }
+  createPolygon("approach", true);
+  createCircle("approach", true);
+
+  for (const nav2_collision_monitor::Polygon * shape : {
+      static_cast<nav2_collision_monitor::Polygon *>(polygon_.get()),
+      static_cast<nav2_collision_monitor::Polygon *>(circle_.get())})
+  {
+    // Two points 0.2 m ahead the footprint (0.5 m)
+    nav2_collision_monitor::Velocity vel{0.5, 0.0, 0.0};
+    std::unordered_map<std::string, std::vector<nav2_collision_monitor::Point>> points_map;
+    points_map.insert({OBSERVATION_SOURCE_NAME, {{0.7, -0.01}, {0.7, 0.01}}});
+    // Collision is expected to be ~= 0.2 m / 0.5 m/s seconds, or earlier
+    // by the footprint inflation for the grid and velocity quantisation
+    double collision_time = shape->getCollisionTime(points_map, vel);
+    EXPECT_LE(collision_time, 0.4 + SIMULATION_TIME_STEP);
+    EXPECT_GT(collision_time, 0.2);
+
+    // Slightly different velocity of the same quantisation bin gives the same result
+    vel = {0.51, 0.01, 0.01};
+    EXPECT_NEAR(shape->getCollisionTime(points_map, vel), collision_time, EPSILON);
+
+    // Two points are already inside footprint: collision time should be 0
+    points_map.clear();
+    points_map.insert({OBSERVATION_SOURCE_NAME, {{0.1, -0.01}, {0.1, 0.01}}});
+    EXPECT_NEAR(shape->getCollisionTime(points_map, vel), 0.0, EPSILON);
+
+    // Two points 1.0 m ahead the footprint are out of simulation prediction
+    points_map.clear();
+    points_map.insert({OBSERVATION_SOURCE_NAME, {{1.5, -0.01}, {1.5, 0.01}}});
+    EXPECT_LT(shape->getCollisionTime(points_map, vel), 0.0);
+
+    // Backward movement: points ahead the footprint are never reached
+    vel = {-0.5, 0.0, 0.0};
+    points_map.clear();
+    points_map.insert({OBSERVATION_SOURCE_NAME, {{0.7, -0.01}, {0.7, 0.01}}});
+    EXPECT_LT(shape->getCollisionTime(points_map, vel), 0.0);
+  }
+}
+
+TEST_F(Tester, testCollisionTimeGridOffCenterFootprint)
+{
+  test_node_->declare_parameter(
+    std::string(POLYGON_NAME) + ".use_collision_time_grids", rclcpp::ParameterValue(true));
+  createPolygon("approach", true);
+
+  // Footprint off the center of rotation: its furthest vertex (1.0, -1.0) is further than
+  // the minimum and maximum corners of its bounding box
+  const std::vector<nav2_collision_monitor::Point> off_center_footprint{
+    {-0.1, 0.1}, {1.0, 0.1}, {1.0, -1.0}, {-0.1, -1.0}};
+
+  // The footprint is inflated for rotation as much as a centered one of the same radius
+  const nav2_collision_monitor::Velocity vel{0.0, 0.0, 0.0};
+  polygon_->setPolygon(off_center_footprint);
+  const auto off_center_grid = polygon_->getCollisionTimeGrid(vel);
+  polygon_->setPolygon({{1.0, 1.0}, {1.0, -1.0}, {-1.0, -1.0}, {-1.0, 1.0}});
+  const auto centered_grid = polygon_->getCollisionTimeGrid(vel);
+  EXPECT_NEAR(off_center_grid->error_bound, centered_grid->error_bound, EPSILON);
+
+  // Rotating at the edges of a velocity quantisation bin, the points swept by the furthest
+  // vertex are not reached later than simulated
+  polygon_->setPolygon(off_center_footprint);
+  std::unordered_map<std::string, std::vector<nav2_collision_monitor::Point>> points_map;
+  points_map.insert({OBSERVATION_SOURCE_NAME, {{1.3, -0.01}, {1.3, 0.01}}});
+  for (const double tw : {0.9751, 1.0249}) {
+    polygon_->setUseCollisionTimeGrids(false);
+    const double simulated_time = polygon_->getCollisionTime(points_map, {0.0, 0.0, tw});
+    ASSERT_GE(simulated_time, 0.0);
+    polygon_->setUseCollisionTimeGrids(true);
+    const double grid_time = polygon_->getCollisionTime(points_map, {0.0, 0.0, tw});
+    EXPECT_GE(grid_time, 0.0);
+    EXPECT_LE(grid_time, simulated_time + EPSILON);
+  }
+}
+
 TEST_F(Tester, testPolygonPublish)
 {
   createPolygon("stop", true);
@@ -225,6 +225,16 @@ public:
   {
     return data_ != nullptr;
   }
+
+  bool dataReceived(const rclcpp::Time & stamp) const
+  {
+    return data_ != nullptr && rclcpp::Time(data_->header.stamp) == stamp;
+  }
+
+  bool dataReceived(const rclcpp::Time & stamp, const float range) const
+  {
+    return dataReceived(stamp) && data_->ranges[0] == range;
+  }
 };  // ScanWrapper
 
 class PointCloudWrapper : public nav2_collision_monitor::PointCloud
@@ -600,6 +610,82 @@ TEST_F(Tester, testGetData)
   checkPolygon(data);
 }
 
+TEST_F(Tester, testGetCachedData)
+{
+  rclcpp::Time curr_time = test_node_->now();
+
+  createSources();
+
+  sendTransforms(curr_time);
+
+  // Publish data for sources
+  test_node_->publishScan(curr_time, 1.0);
+  test_node_->publishPointCloud(curr_time);
+
+  // Wait until all sources will receive the data
+  ASSERT_TRUE(waitScan(500ms));
+  ASSERT_TRUE(waitPointCloud(500ms));
+
+  // Data obtained from the same messages for a few times should be consistent
+  std::vector<nav2_collision_monitor::Point> data;
+  for (int i = 0; i < 3; i++) {
+    data.clear();
+    ASSERT_TRUE(scan_->getData(curr_time, data));
+    checkScan(data);
+
+    data.clear();
+    ASSERT_TRUE(pointcloud_->getData(curr_time, data));
+    checkPointCloud(data);
+  }
+
+  // Cached points should be appended to the data array
+  data.clear();
+  ASSERT_TRUE(pointcloud_->getData(curr_time, data));
+  ASSERT_TRUE(pointcloud_->getData(curr_time, data));
+  ASSERT_EQ(data.size(), 4u);
+  checkPointCloud(std::vector<nav2_collision_monitor::Point>(data.begin() + 2, data.end()));
+
+  // New messages should replace the cached points
+  curr_time = curr_time + rclcpp::Duration::from_seconds(0.1);
+  sendTransforms(curr_time);
+  test_node_->publishScan(curr_time, 0.5);
+  rclcpp::Time start_time = test_node_->now();
+  while (
+    !scan_->dataReceived(curr_time) &&
+    test_node_->now() - start_time <= rclcpp::Duration(500ms))
+  {
+    rclcpp::spin_some(test_node_->get_node_base_interface());
+    std::this_thread::sleep_for(10ms);
+  }
+  ASSERT_TRUE(scan_->dataReceived(curr_time));
+
+  data.clear();
+  ASSERT_TRUE(scan_->getData(curr_time, data));
+  ASSERT_EQ(data.size(), 4u);
+  // Point 0: (0.5 + 0.1, 0.0 + 0.1)
+  EXPECT_NEAR(data[0].x, 0.6, EPSILON);
+  EXPECT_NEAR(data[0].y, 0.1, EPSILON);
+
+  // New messages should replace the cached points even if they repeat the timestamp
+  test_node_->publishScan(curr_time, 0.8);
+  start_time = test_node_->now();
+  while (
+    !scan_->dataReceived(curr_time, 0.8) &&
+    test_node_->now() - start_time <= rclcpp::Duration(500ms))
+  {
+    rclcpp::spin_some(test_node_->get_node_base_interface());
+    std::this_thread::sleep_for(10ms);
+  }
+  ASSERT_TRUE(scan_->dataReceived(curr_time, 0.8));
+
+  data.clear();
+  ASSERT_TRUE(scan_->getData(curr_time, data));
+  ASSERT_EQ(data.size(), 4u);
+  // Point 0: (0.8 + 0.1, 0.0 + 0.1)
+  EXPECT_NEAR(data[0].x, 0.9, EPSILON);
+  EXPECT_NEAR(data[0].y, 0.1, EPSILON);
+}
+
 TEST_F(Tester, testGetOutdatedData)
 {
   rclcpp::Time curr_time = test_node_->now();
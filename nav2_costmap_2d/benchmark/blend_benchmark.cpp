@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "nav2_costmap_2d/blend_kernels.hpp"
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+
+using nav2_costmap_2d::NO_INFORMATION;
+
+// 200m x 200m global costmap at 5cm resolution, blended from a static, an obstacle
+// and a filter layer
+constexpr unsigned int kSize = 4000;
+constexpr unsigned int kNumLayers = 3;
+
+std::vector<std::vector<unsigned char>> makeLayers()
+{
+  std::mt19937 generator(42);
+  std::vector<std::vector<unsigned char>> layers(kNumLayers);
+  for (auto & layer : layers) {
+    layer.resize(kSize * kSize);
+    for (auto & cost : layer) {
+      const unsigned int sample = generator() % 8;
+      cost = sample == 0 ? NO_INFORMATION : (sample == 1 ? nav2_costmap_2d::LETHAL_OBSTACLE : 0);
+    }
+  }
+  return layers;
+}
+
+// Blending as CostmapLayer::updateWithMax did, a cell and a layer at a time
+static void BM_PerCellBlendMax(benchmark::State & state)
+{
+  nav2_costmap_2d::Costmap2D master_grid(kSize, kSize, 0.05, 0.0, 0.0);
+  const auto layers = makeLayers();
+  unsigned char * master_array = master_grid.getCharMap();
+
+  for (auto _ : state) {
+    master_grid.resetMap(0, 0, kSize, kSize);
+    for (const auto & costmap : layers) {
+      for (unsigned int j = 0; j < kSize; j++) {
+        unsigned int it = j * kSize;
+        for (unsigned int i = 0; i < kSize; i++) {
+          if (costmap[it] == NO_INFORMATION) {
+            it++;
+            continue;
+          }
+          unsigned char old_cost = master_array[it];
+          if (old_cost == NO_INFORMATION || old_cost < costmap[it]) {
+            master_array[it] = costmap[it];
+          }
+          it++;
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+}
+
+// Argument is the number of layers blended in each pass over the master grid
+static void BM_BlendMax(benchmark::State & state)
+{
+  nav2_costmap_2d::Costmap2D master_grid(kSize, kSize, 0.05, 0.0, 0.0);
+  const auto layers = makeLayers();
+  std::vector<const unsigned char *> costs;
+  for (const auto & layer : layers) {
+    costs.push_back(layer.data());
+  }
+  const unsigned int fused = static_cast<unsigned int>(state.range(0));
+
+  state.SetLabel(nav2_costmap_2d::blendKernelsName());
+  for (auto _ : state) {
+    master_grid.resetMap(0, 0, kSize, kSize);
+    for (unsigned int k = 0; k < kNumLayers; k += fused) {
+      nav2_costmap_2d::blendWindow(
+        nav2_costmap_2d::BlendMode::Max, master_grid, costs.data() + k,
+        std::min(fused, kNumLayers - k), 0, 0, kSize, kSize);
+    }
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(BM_PerCellBlendMax)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BlendMax)->Arg(1)->Arg(kNumLayers)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "nav_msgs/msg/occupancy_grid.hpp"
+#include "tf2/LinearMath/Quaternion.hpp"
+#include "tf2/LinearMath/Transform.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_costmap_2d/costmap_filters/costmap_filter.hpp"
+
+class CostmapFilterWrapper : public nav2_costmap_2d::CostmapFilter
+{
+public:
+  using nav2_costmap_2d::CostmapFilter::forEachMaskCell;
+  using nav2_costmap_2d::CostmapFilter::getMaskCost;
+  using nav2_costmap_2d::CostmapFilter::maskDataToCost;
+  using nav2_costmap_2d::CostmapFilter::worldToMask;
+
+  void initializeFilter(const std::string &) {}
+  void process(
+    nav2_costmap_2d::Costmap2D &, int, int, int, int, const geometry_msgs::msg::Pose2D &)
+  {}
+  void resetFilter() {}
+};
+
+// 200m x 200m global costmap at 5cm resolution, with a mask of the same size
+constexpr unsigned int kSize = 4000;
+constexpr double kResolution = 0.05;
+
+nav_msgs::msg::OccupancyGrid::SharedPtr makeMask(double resolution)
+{
+  auto mask = std::make_shared<nav_msgs::msg::OccupancyGrid>();
+  mask->header.frame_id = "map";
+  mask->info.resolution = resolution;
+  mask->info.width = static_cast<unsigned int>(kSize * kResolution / resolution);
+  mask->info.height = mask->info.width;
+  mask->data.resize(mask->info.width * mask->info.height, 0);
+  for (unsigned int i = 0; i < mask->data.size(); i += 7) {
+    mask->data[i] = 100;
+  }
+  return mask;
+}
+
+tf2::Transform makeTransform(double yaw)
+{
+  return tf2::Transform(tf2::Quaternion(tf2::Vector3(0.0, 0.0, 1.0), yaw), tf2::Vector3());
+}
+
+// Arguments are the mask resolution in mm and the yaw of the mask frame in mrad
+static void BM_PerCellMaskSampling(benchmark::State & state)
+{
+  nav2_costmap_2d::Costmap2D master_grid(kSize, kSize, kResolution, 0.0, 0.0);
+  const auto mask = makeMask(state.range(0) / 1000.0);
+  const auto transform = makeTransform(state.range(1) / 1000.0);
+  CostmapFilterWrapper filter;
+
+  // Converting each cell to the mask, column by column, as filters did before
+  unsigned char * master_array = master_grid.getCharMap();
+  for (auto _ : state) {
+    for (unsigned int i = 0; i < kSize; i++) {
+      for (unsigned int j = 0; j < kSize; j++) {
+        double wx, wy;
+        master_grid.mapToWorld(i, j, wx, wy);
+        const tf2::Vector3 point = transform * tf2::Vector3(wx, wy, 0.0);
+        unsigned int mx, my;
+        if (filter.worldToMask(mask, point.x(), point.y(), mx, my)) {
+          master_array[master_grid.getIndex(i, j)] = filter.getMaskCost(mask, mx, my);
+        }
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+}
+
+static void BM_MaskSampling(benchmark::State & state)
+{
+  nav2_costmap_2d::Costmap2D master_grid(kSize, kSize, kResolution, 0.0, 0.0);
+  const auto mask = makeMask(state.range(0) / 1000.0);
+  const auto transform = makeTransform(state.range(1) / 1000.0);
+  CostmapFilterWrapper filter;
+
+  unsigned char * master_array = master_grid.getCharMap();
+  for (auto _ : state) {
+    filter.forEachMaskCell(
+      master_grid, mask, transform, 0, 0, kSize, kSize,
+      [&](unsigned int index, unsigned int mask_index) {
+        master_array[index] = CostmapFilterWrapper::maskDataToCost(mask->data[mask_index]);
+      });
+    benchmark::ClobberMemory();
+  }
+}
+
+BENCHMARK(BM_PerCellMaskSampling)
+->Args({50, 0})->Args({100, 0})->Args({50, 100})
+->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MaskSampling)
+->Args({50, 0})->Args({100, 0})->Args({50, 100})
+->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
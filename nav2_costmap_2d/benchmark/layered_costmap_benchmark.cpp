@@ -0,0 +1,115 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "geometry_msgs/msg/point.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "sensor_msgs/msg/point_cloud2.hpp"
+#include "sensor_msgs/point_cloud2_iterator.hpp"
+#include "tf2_ros/buffer.h"
+#include "nav2_costmap_2d/footprint.hpp"
+#include "nav2_costmap_2d/inflation_layer.hpp"
+#include "nav2_costmap_2d/layered_costmap.hpp"
+#include "nav2_costmap_2d/obstacle_layer.hpp"
+#include "nav2_costmap_2d/observation.hpp"
+#include "nav2_ros_common/lifecycle_node.hpp"
+
+class RosLockGuard
+{
+public:
+  RosLockGuard() {rclcpp::init(0, nullptr);}
+  ~RosLockGuard() {rclcpp::shutdown();}
+};
+
+RosLockGuard g_rclcpp;
+
+// 40m x 40m local costmap at 5cm resolution
+constexpr double kSizeMeters = 40.0;
+constexpr double kResolution = 0.05;
+constexpr unsigned int kNumPoints = 20000;
+
+nav2_costmap_2d::Observation makeObservation()
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(kNumPoints);
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(cloud, "z");
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> position(0.0, kSizeMeters);
+  for (unsigned int i = 0; i < kNumPoints; ++i, ++iter_x, ++iter_y, ++iter_z) {
+    *iter_x = position(generator);
+    *iter_y = position(generator);
+    *iter_z = 0.4;
+  }
+
+  geometry_msgs::msg::Point origin;
+  origin.x = kSizeMeters / 2.0;
+  origin.y = kSizeMeters / 2.0;
+  origin.z = 1.0;
+  return nav2_costmap_2d::Observation(origin, cloud, 100.0, 0.0, 100.0, 0.0);
+}
+
+static void BM_UpdateMap(benchmark::State & state)
+{
+  const unsigned int threads = static_cast<unsigned int>(state.range(0));
+  const std::string engine = state.range(1) ? "distance_transform" : "wavefront";
+
+  auto options = rclcpp::NodeOptions();
+  options.parameter_overrides(
+    {{"inflation.inflation_radius", 1.0}, {"inflation.inflation_engine", engine}});
+  auto node = std::make_shared<nav2::LifecycleNode>("layered_costmap_benchmark", "", options);
+  node->declare_parameter("track_unknown_space", rclcpp::ParameterValue(false));
+  node->declare_parameter("lethal_cost_threshold", rclcpp::ParameterValue(100));
+  node->declare_parameter("transform_tolerance", rclcpp::ParameterValue(0.3));
+  node->declare_parameter("observation_sources", rclcpp::ParameterValue(std::string("")));
+  tf2_ros::Buffer tf(node->get_clock());
+
+  nav2_costmap_2d::LayeredCostmap layers("map", false, false);
+  const unsigned int size = static_cast<unsigned int>(kSizeMeters / kResolution);
+  layers.resizeMap(size, size, kResolution, 0.0, 0.0);
+  layers.setUpdateThreads(threads, 128);
+
+  auto olayer = std::make_shared<nav2_costmap_2d::ObstacleLayer>();
+  olayer->initialize(&layers, "obstacles", &tf, node, nullptr);
+  layers.addPlugin(olayer);
+
+  auto ilayer = std::make_shared<nav2_costmap_2d::InflationLayer>();
+  ilayer->initialize(&layers, "inflation", &tf, node, nullptr);
+  layers.addPlugin(ilayer);
+
+  layers.setFootprint(nav2_costmap_2d::makeFootprintFromRadius(0.3));
+
+  auto observation = makeObservation();
+  olayer->addStaticObservation(observation, true, false);
+
+  for (auto _ : state) {
+    layers.updateMap(kSizeMeters / 2.0, kSizeMeters / 2.0, 0.0);
+  }
+}
+
+// Arguments are the number of update threads and if the distance transform engine is used
+BENCHMARK(BM_UpdateMap)->ArgsProduct({{1, 2, 4, 8}, {0, 1}})->Unit(benchmark::kMillisecond)
+->UseRealTime();
+
+BENCHMARK_MAIN();
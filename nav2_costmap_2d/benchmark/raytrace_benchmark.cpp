@@ -0,0 +1,159 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "geometry_msgs/msg/point.hpp"
+#include "rclcpp/rclcpp.hpp"
+#include "sensor_msgs/msg/point_cloud2.hpp"
+#include "sensor_msgs/point_cloud2_iterator.hpp"
+#include "tf2_ros/buffer.h"
+#include "nav2_costmap_2d/layered_costmap.hpp"
+#include "nav2_costmap_2d/obstacle_layer.hpp"
+#include "nav2_costmap_2d/observation.hpp"
+#include "nav2_costmap_2d/voxel_layer.hpp"
+#include "nav2_ros_common/lifecycle_node.hpp"
+
+class RosLockGuard
+{
+public:
+  RosLockGuard() {rclcpp::init(0, nullptr);}
+  ~RosLockGuard() {rclcpp::shutdown();}
+};
+
+RosLockGuard g_rclcpp;
+
+class ObstacleLayerWrapper : public nav2_costmap_2d::ObstacleLayer
+{
+public:
+  using nav2_costmap_2d::ObstacleLayer::raytraceFreespace;
+};
+
+class VoxelLayerWrapper : public nav2_costmap_2d::VoxelLayer
+{
+public:
+  using nav2_costmap_2d::VoxelLayer::raytraceFreespace;
+};
+
+// 40m x 40m local costmap at 5cm resolution
+constexpr double kSizeMeters = 40.0;
+constexpr double kResolution = 0.05;
+constexpr unsigned int kNumPoints = 100000;
+
+// A dense cloud of the surroundings of the sensor, as from a depth camera or a 3D lidar
+nav2_costmap_2d::Observation makeObservation()
+{
+  sensor_msgs::msg::PointCloud2 cloud;
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(kNumPoints);
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2Iterator<float> iter_z(cloud, "z");
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> angle(-M_PI, M_PI);
+  std::uniform_real_distribution<float> range(2.0, 10.0);
+  for (unsigned int i = 0; i < kNumPoints; ++i, ++iter_x, ++iter_y, ++iter_z) {
+    const float theta = angle(generator);
+    const float r = range(generator);
+    *iter_x = kSizeMeters / 2.0 + r * std::cos(theta);
+    *iter_y = kSizeMeters / 2.0 + r * std::sin(theta);
+    *iter_z = 0.4;
+  }
+
+  geometry_msgs::msg::Point origin;
+  origin.x = kSizeMeters / 2.0;
+  origin.y = kSizeMeters / 2.0;
+  origin.z = 1.0;
+  return nav2_costmap_2d::Observation(origin, cloud, 100.0, 0.0, 100.0, 0.0);
+}
+
+static void BM_RaytraceFreespace(benchmark::State & state)
+{
+  // Arguments are the angular and range bin widths in mrad and cm, 0 to trace every point
+  const double angular_resolution = state.range(0) / 1000.0;
+  const double range_resolution = state.range(1) / 100.0;
+
+  auto options = rclcpp::NodeOptions();
+  options.parameter_overrides(
+    {{"obstacles.raytrace_angular_resolution", angular_resolution},
+      {"obstacles.raytrace_range_resolution", range_resolution}});
+  auto node = std::make_shared<nav2::LifecycleNode>("raytrace_benchmark", "", options);
+  node->declare_parameter("track_unknown_space", rclcpp::ParameterValue(false));
+  node->declare_parameter("lethal_cost_threshold", rclcpp::ParameterValue(100));
+  node->declare_parameter("transform_tolerance", rclcpp::ParameterValue(0.3));
+  node->declare_parameter("observation_sources", rclcpp::ParameterValue(std::string("")));
+  tf2_ros::Buffer tf(node->get_clock());
+
+  nav2_costmap_2d::LayeredCostmap layers("map", false, false);
+  const unsigned int size = static_cast<unsigned int>(kSizeMeters / kResolution);
+  layers.resizeMap(size, size, kResolution, 0.0, 0.0);
+
+  auto olayer = std::make_shared<ObstacleLayerWrapper>();
+  olayer->initialize(&layers, "obstacles", &tf, node, nullptr);
+
+  const auto observation = makeObservation();
+  for (auto _ : state) {
+    double min_x = 1e30, min_y = 1e30, max_x = -1e30, max_y = -1e30;
+    olayer->raytraceFreespace(observation, &min_x, &min_y, &max_x, &max_y);
+    benchmark::DoNotOptimize(max_x);
+  }
+}
+
+static void BM_VoxelRaytraceFreespace(benchmark::State & state)
+{
+  // Arguments are the number of update threads and whether to use the sparse voxel grid
+  const unsigned int num_threads = static_cast<unsigned int>(state.range(0));
+  const bool use_sparse_voxel_grid = state.range(1) != 0;
+
+  auto options = rclcpp::NodeOptions();
+  options.parameter_overrides({{"voxels.use_sparse_voxel_grid", use_sparse_voxel_grid}});
+  auto node = std::make_shared<nav2::LifecycleNode>("raytrace_benchmark", "", options);
+  node->declare_parameter("track_unknown_space", rclcpp::ParameterValue(false));
+  node->declare_parameter("lethal_cost_threshold", rclcpp::ParameterValue(100));
+  node->declare_parameter("transform_tolerance", rclcpp::ParameterValue(0.3));
+  node->declare_parameter("observation_sources", rclcpp::ParameterValue(std::string("")));
+  tf2_ros::Buffer tf(node->get_clock());
+
+  nav2_costmap_2d::LayeredCostmap layers("map", false, false);
+  const unsigned int size = static_cast<unsigned int>(kSizeMeters / kResolution);
+  layers.resizeMap(size, size, kResolution, 0.0, 0.0);
+  layers.setUpdateThreads(num_threads, 64);
+
+  auto vlayer = std::make_shared<VoxelLayerWrapper>();
+  vlayer->initialize(&layers, "voxels", &tf, node, nullptr);
+
+  const auto observation = makeObservation();
+  for (auto _ : state) {
+    double min_x = 1e30, min_y = 1e30, max_x = -1e30, max_y = -1e30;
+    vlayer->raytraceFreespace(observation, &min_x, &min_y, &max_x, &max_y);
+    benchmark::DoNotOptimize(max_x);
+  }
+}
+
+BENCHMARK(BM_RaytraceFreespace)
+->Args({0, 0})->Args({2, 0})->Args({5, 0})->Args({10, 0})->Args({5, 50})
+->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_VoxelRaytraceFreespace)
+->Args({1, 0})->Args({4, 0})->Args({1, 1})->Args({4, 1})
+->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COSTMAP_2D__BLEND_KERNELS_HPP_
+#define NAV2_COSTMAP_2D__BLEND_KERNELS_HPP_
+
+#include <cstddef>
+
+#include "nav2_costmap_2d/costmap_2d.hpp"
+
+namespace nav2_costmap_2d
+{
+
+/**
+ * @enum nav2_costmap_2d::BlendMode
+ * @brief How the costs of a layer are combined with the master grid, as done by the
+ * CostmapLayer::updateWith* methods
+ */
+enum class BlendMode
+{
+  TrueOverwrite,  // every value is copied, including NO_INFORMATION
+  Overwrite,  // every value but NO_INFORMATION is copied
+  Max,  // maximum, known values overwrite NO_INFORMATION in the master grid
+  MaxWithoutUnknownOverwrite,  // maximum, NO_INFORMATION in the master grid is kept
+  Addition  // sum capped below INSCRIBED_INFLATED_OBSTACLE, known values overwrite NO_INFORMATION
+};
+
+/**
+ * @brief Name of the instruction set the blend kernels use on this CPU,
+ * one of "avx2", "sse2", "neon" or "scalar"
+ */
+const char * blendKernelsName();
+
+/**
+ * @brief Blend rows of layer costs into a row of the master grid, using the widest
+ * vector instructions available on the CPU. Several layers are blended in a single
+ * pass over the master row, with the same result as blending them one after another.
+ * @param mode Blend mode of the layers
+ * @param master Row of the master grid to update
+ * @param layers Rows of the layers' costs, in the order the layers are blended
+ * @param num_layers Number of layers
+ * @param n Number of cells in the rows
+ */
+void blendRows(
+  BlendMode mode, unsigned char * master, const unsigned char * const * layers,
+  unsigned int num_layers, std::size_t n);
+
+/**
+ * @brief Blend rows of layer costs into a row of the master grid, one cell at a time.
+ * Used for the ends of rows by the vector kernels and as a reference for them.
+ */
+void blendRowsScalar(
+  BlendMode mode, unsigned char * master, const unsigned char * const * layers,
+  unsigned int num_layers, std::size_t n);
+
+/**
+ * @brief Blend the costs of layers of the same size as the master grid into a window
+ * of it, row by row
+ * @param mode Blend mode of the layers
+ * @param master_grid The master grid to update
+ * @param layers Cost arrays of the layers, in the order the layers are blended
+ * @param num_layers Number of layers
+ * @param min_i, min_j, max_i, max_j The window to update, excluding max_i and max_j
+ */
+void blendWindow(
+  BlendMode mode, Costmap2D & master_grid, const unsigned char * const * layers,
+  unsigned int num_layers, int min_i, int min_j, int max_i, int max_j);
+
+}  // namespace nav2_costmap_2d
+
+#endif  // NAV2_COSTMAP_2D__BLEND_KERNELS_HPP_
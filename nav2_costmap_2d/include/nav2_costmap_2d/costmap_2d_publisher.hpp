@@ -42,11 +42,13 @@
 #include <algorithm>
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
 #include "nav2_costmap_2d/costmap_2d.hpp"
 #include "nav_msgs/msg/occupancy_grid.hpp"
 #include "map_msgs/msg/occupancy_grid_update.hpp"
+#include "nav2_msgs/msg/compressed_costmap.hpp"
 #include "nav2_msgs/msg/costmap.hpp"
 #include "nav2_msgs/msg/costmap_update.hpp"
 #include "nav2_msgs/srv/get_costmap.hpp"
@@ -67,6 +69,10 @@ class Costmap2DPublisher
 public:
   /**
    * @brief  Constructor for the Costmap2DPublisher
+   * @param compressed_tile_size If non-zero, the costmap is also published compressed
+   * on <topic_name>_raw_compressed, with changes tracked in square tiles of this size
+   * @param compressed_keyframe_interval Number of compressed messages between ones
+   * holding the whole costmap, for late or lossy subscribers to synchronise with
    */
   Costmap2DPublisher(
     const nav2::LifecycleNode::WeakPtr & parent,
@@ -74,7 +80,9 @@ public:
     std::string global_frame,
     std::string topic_name,
     bool always_send_full_costmap = false,
-    double map_vis_z = 0.0);
+    double map_vis_z = 0.0,
+    unsigned int compressed_tile_size = 0,
+    unsigned int compressed_keyframe_interval = 10);
 
   /**
    * @brief  Destructor
@@ -95,6 +103,9 @@ public:
     costmap_update_pub_->on_activate();
     costmap_raw_pub_->on_activate();
     costmap_raw_update_pub_->on_activate();
+    if (costmap_compressed_pub_) {
+      costmap_compressed_pub_->on_activate();
+    }
   }
 
   /**
@@ -106,6 +117,9 @@ public:
     costmap_update_pub_->on_deactivate();
     costmap_raw_pub_->on_deactivate();
     costmap_raw_update_pub_->on_deactivate();
+    if (costmap_compressed_pub_) {
+      costmap_compressed_pub_->on_deactivate();
+    }
   }
 
   /**
@@ -120,6 +134,9 @@ public:
     xn_ = std::max(xn, xn_);
     y0_ = std::min(y0, y0_);
     yn_ = std::max(yn, yn_);
+    if (costmap_compressed_pub_) {
+      markDirtyTiles(x0, xn, y0, yn);
+    }
   }
 
   /**
@@ -145,6 +162,14 @@ private:
   std::unique_ptr<map_msgs::msg::OccupancyGridUpdate> createGridUpdateMsg();
   /** @brief Prepare CostmapUpdate msg for publication. */
   std::unique_ptr<nav2_msgs::msg::CostmapUpdate> createCostmapUpdateMsg();
+  /**
+   * @brief Prepare CompressedCostmap msg for publication, holding the tiles which changed
+   * since the last one, or the whole costmap for keyframes
+   */
+  std::unique_ptr<nav2_msgs::msg::CompressedCostmap> createCompressedCostmapMsg();
+
+  /** @brief Mark the tiles of the compressed costmap overlapping the bounds as dirty */
+  void markDirtyTiles(unsigned int x0, unsigned int xn, unsigned int y0, unsigned int yn);
 
   /** @brief Publish the latest full costmap to the new subscriber. */
   // void onNewSubscription(const ros::SingleSubscriberPublisher& pub);
@@ -180,6 +205,9 @@ private:
   nav2::Publisher<nav2_msgs::msg::CostmapUpdate>::SharedPtr
     costmap_raw_update_pub_;
 
+  // Publisher for compressed raw costmap values, and changes to them
+  nav2::Publisher<nav2_msgs::msg::CompressedCostmap>::SharedPtr costmap_compressed_pub_;
+
   // Service for getting the costmaps
   nav2::ServiceServer<nav2_msgs::srv::GetCostmap>::SharedPtr
     costmap_service_;
@@ -188,6 +216,17 @@ private:
   unsigned int grid_width_, grid_height_;
   std::unique_ptr<nav_msgs::msg::OccupancyGrid> grid_;
   std::unique_ptr<nav2_msgs::msg::Costmap> costmap_raw_;
+
+  // The costmap as last sent compressed, to find the cells changed since
+  unsigned int compressed_tile_size_;
+  unsigned int compressed_keyframe_interval_;
+  unsigned int compressed_since_keyframe_{0};
+  uint32_t compressed_sequence_{0};
+  std::vector<unsigned char> compressed_snapshot_;
+  unsigned int snapshot_size_x_{0}, snapshot_size_y_{0};
+  double snapshot_resolution_{0.0}, snapshot_origin_x_{0.0}, snapshot_origin_y_{0.0};
+  unsigned int tiles_x_{0}, tiles_y_{0};
+  std::vector<bool> dirty_tiles_;
   // Translate from 0-255 values in costmap to -1 to 100 values in message.
   static char * cost_translation_table_;
 };
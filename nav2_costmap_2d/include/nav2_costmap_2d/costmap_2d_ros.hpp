@@ -46,6 +46,7 @@
 #include "geometry_msgs/msg/polygon.h"
 #include "geometry_msgs/msg/polygon_stamped.h"
 #include "nav2_costmap_2d/costmap_2d_publisher.hpp"
+#include "nav2_costmap_2d/costmap_snapshot.hpp"
 #include "nav2_costmap_2d/footprint.hpp"
 #include "nav2_costmap_2d/footprint_collision_checker.hpp"
 #include "nav2_costmap_2d/clear_costmap_service.hpp"
@@ -228,6 +229,20 @@ public:
     return layered_costmap_->getCostmap();
   }
 
+  /**
+   * @brief Get an immutable snapshot of the "master" costmap as of its last update.
+   *
+   * Unlike getCostmap(), the snapshot is read without locking its mutex, so readers neither
+   * wait for updates of the costmap nor hold them up. It stays valid and unchanged for as
+   * long as it is held, so hold it only for a single planning or control cycle.
+   * @return The snapshot, or nullptr if enable_costmap_snapshots is false or the costmap
+   * was not updated yet
+   */
+  std::shared_ptr<const Costmap2D> getCostmapSnapshot() const
+  {
+    return costmap_snapshots_ ? costmap_snapshots_->get() : nullptr;
+  }
+
   /**
    * @brief  Returns the global frame of the costmap
    * @return The global frame of the costmap
@@ -363,6 +378,7 @@ protected:
   std::shared_ptr<tf2_ros::TransformListener> tf_listener_;
 
   std::unique_ptr<LayeredCostmap> layered_costmap_{nullptr};
+  std::unique_ptr<CostmapSnapshotBuffer> costmap_snapshots_{nullptr};
   std::string name_;
 
   /**
@@ -384,12 +400,18 @@ protected:
    */
   void getParameters();
   bool always_send_full_costmap_{false};
+  bool publish_compressed_costmap_{false};  ///< Whether to also publish compressed costmaps
+  int compressed_costmap_tile_size_{64};    ///< Side length in cells of compressed dirty tiles
+  int compressed_costmap_keyframe_interval_{10};  ///< Compressed messages between keyframes
+  bool enable_costmap_snapshots_{true};     ///< Whether to snapshot the costmap on updates
   std::string footprint_;
   float footprint_padding_{0};
   std::string global_frame_;                ///< The global frame for the costmap
   int map_height_meters_{0};
   double map_publish_frequency_{0};
   double map_update_frequency_{0};
+  int update_threads_{1};                 ///< Threads to update the layers with, 0 for all cores
+  int update_tile_size_{128};             ///< Side length in cells of tiles updated concurrently
   int map_width_meters_{0};
   double origin_x_{0};
   double origin_y_{0};
@@ -0,0 +1,88 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COSTMAP_2D__COSTMAP_COMPRESSION_HPP_
+#define NAV2_COSTMAP_2D__COSTMAP_COMPRESSION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "nav2_msgs/msg/costmap_tile.hpp"
+
+namespace nav2_costmap_2d
+{
+
+/**
+ * @brief Run-length encode cost data, appending it to a buffer. The encoding is a
+ * sequence of tokens, each starting with a LEB128 varint v holding a count of
+ * (v >> 1) + 1. If the low bit of v is set, the token is a run of count cells of the
+ * single cost following it, otherwise count cells of literal costs follow.
+ * The long runs of FREE_SPACE and NO_INFORMATION in costmaps take a few bytes each.
+ * @param data Costs to encode
+ * @param n Number of costs
+ * @param out [out] Buffer to append the encoding to
+ */
+void encodeRunLength(const unsigned char * data, std::size_t n, std::vector<uint8_t> & out);
+
+/**
+ * @brief Decode run-length encoded cost data
+ * @param in Encoded data
+ * @param in_size Size of the encoded data
+ * @param out [out] Costs to decode into
+ * @param n Number of costs expected
+ * @return If the encoding was valid and held exactly n costs
+ */
+bool decodeRunLength(const uint8_t * in, std::size_t in_size, unsigned char * out, std::size_t n);
+
+/**
+ * @brief Encode a rectangle of cells of a costmap into a tile, run-length encoding it
+ * if that makes it smaller
+ * @param data Costs of the costmap
+ * @param map_size_x Number of cells of the costmap in x
+ * @param x, y, size_x, size_y The rectangle to encode, which must be inside of the costmap
+ * @param compress If the tile may be run-length encoded
+ * @param tile [out] The tile
+ */
+void encodeTile(
+  const unsigned char * data, unsigned int map_size_x,
+  unsigned int x, unsigned int y, unsigned int size_x, unsigned int size_y,
+  bool compress, nav2_msgs::msg::CostmapTile & tile);
+
+/**
+ * @brief Decode a tile into a costmap
+ * @param tile The tile
+ * @param data [out] Costs of the costmap
+ * @param map_size_x, map_size_y Number of cells of the costmap
+ * @return If the tile was valid and inside of the costmap
+ */
+bool decodeTile(
+  const nav2_msgs::msg::CostmapTile & tile, unsigned char * data,
+  unsigned int map_size_x, unsigned int map_size_y);
+
+/**
+ * @brief Shift the costs of a costmap as Costmap2D::updateOrigin() does for a move
+ * of a whole number of cells: the cost at (x, y) moves to (x - shift_x, y - shift_y)
+ * @param data Costs of the costmap
+ * @param size_x, size_y Number of cells of the costmap
+ * @param shift_x, shift_y Number of cells to shift by
+ * @param fill Cost of the newly exposed cells
+ */
+void shiftCostmapData(
+  unsigned char * data, unsigned int size_x, unsigned int size_y,
+  int shift_x, int shift_y, unsigned char fill);
+
+}  // namespace nav2_costmap_2d
+
+#endif  // NAV2_COSTMAP_2D__COSTMAP_COMPRESSION_HPP_
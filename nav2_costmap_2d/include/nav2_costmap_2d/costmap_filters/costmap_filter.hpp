@@ -41,6 +41,8 @@
 #ifndef NAV2_COSTMAP_2D__COSTMAP_FILTERS__COSTMAP_FILTER_HPP_
 #define NAV2_COSTMAP_2D__COSTMAP_FILTERS__COSTMAP_FILTER_HPP_
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <mutex>
 #include <memory>
@@ -49,6 +51,7 @@
 #include "std_srvs/srv/set_bool.hpp"
 #include "nav2_costmap_2d/layer.hpp"
 #include "nav_msgs/msg/occupancy_grid.hpp"
+#include "tf2/LinearMath/Transform.hpp"
 #include "nav2_ros_common/service_server.hpp"
 
 namespace nav2_costmap_2d
@@ -224,6 +227,92 @@ protected:
     nav_msgs::msg::OccupancyGrid::ConstSharedPtr filter_mask,
     const unsigned int mx, const unsigned int & my) const;
 
+  /**
+   * @brief  Convert filter mask data to a cost
+   * @param  data The data of a filter mask cell
+   * @return The cost to set the cell to
+   */
+  static unsigned char maskDataToCost(const int8_t data);
+
+  /**
+   * @brief  Visit the cells of a window of the master grid whose centers fall in the filter
+   * mask, along with the corresponding mask cells. Rows are walked in memory order, stepping
+   * the mask coordinates along them by the affine transform. When the mask is axis-aligned
+   * with the master grid at the same resolution, the mask indexes are stepped directly.
+   * @param  master_grid Master grid to visit the cells of
+   * @param  filter_mask Filter mask to sample
+   * @param  transform Transform from the master grid frame to the mask frame
+   * @param  min_i Low window map boundary OX
+   * @param  min_j Low window map boundary OY
+   * @param  max_i High window map boundary OX, exclusive
+   * @param  max_j High window map boundary OY, exclusive
+   * @param  visit Called as visit(master_index, mask_index) for each cell in the mask
+   */
+  template<typename VisitorT>
+  void forEachMaskCell(
+    const nav2_costmap_2d::Costmap2D & master_grid,
+    nav_msgs::msg::OccupancyGrid::ConstSharedPtr filter_mask,
+    const tf2::Transform & transform,
+    unsigned int min_i, unsigned int min_j, unsigned int max_i, unsigned int max_j,
+    VisitorT && visit) const
+  {
+    const double resolution = master_grid.getResolution();
+    const double mask_resolution = filter_mask->info.resolution;
+    const int mask_width = static_cast<int>(filter_mask->info.width);
+    const int mask_height = static_cast<int>(filter_mask->info.height);
+    const unsigned int size_x = master_grid.getSizeInCellsX();
+
+    // Mask coordinates of the center of master_grid cell (0, 0), and their steps by cell
+    const tf2::Vector3 origin = transform * tf2::Vector3(
+      master_grid.getOriginX() + 0.5 * resolution,
+      master_grid.getOriginY() + 0.5 * resolution, 0.0);
+    const tf2::Vector3 step_i = transform.getBasis() * tf2::Vector3(resolution, 0.0, 0.0);
+    const tf2::Vector3 step_j = transform.getBasis() * tf2::Vector3(0.0, resolution, 0.0);
+    const double u0 = (origin.x() - filter_mask->info.origin.position.x) / mask_resolution;
+    const double v0 = (origin.y() - filter_mask->info.origin.position.y) / mask_resolution;
+    const double du_i = step_i.x() / mask_resolution, dv_i = step_i.y() / mask_resolution;
+    const double du_j = step_j.x() / mask_resolution, dv_j = step_j.y() / mask_resolution;
+
+    // Axis-aligned at the same resolution, up to a negligible drift over the whole grid
+    const double max_drift = 1e-3 / std::max(size_x, master_grid.getSizeInCellsY());
+    if (std::abs(du_i - 1.0) < max_drift && std::abs(dv_j - 1.0) < max_drift &&
+      std::abs(dv_i) < max_drift && std::abs(du_j) < max_drift)
+    {
+      const int offset_i = static_cast<int>(std::floor(u0));
+      const int offset_j = static_cast<int>(std::floor(v0));
+      const int begin_i = std::max(static_cast<int>(min_i), -offset_i);
+      const int end_i = std::min(static_cast<int>(max_i), mask_width - offset_i);
+      const int begin_j = std::max(static_cast<int>(min_j), -offset_j);
+      const int end_j = std::min(static_cast<int>(max_j), mask_height - offset_j);
+      for (int j = begin_j; j < end_j; ++j) {
+        unsigned int index = j * size_x + begin_i;
+        unsigned int mask_index = (j + offset_j) * mask_width + begin_i + offset_i;
+        for (int i = begin_i; i < end_i; ++i) {
+          visit(index++, mask_index++);
+        }
+      }
+      return;
+    }
+
+    for (unsigned int j = min_j; j < max_j; ++j) {
+      const double row_u = u0 + min_i * du_i + j * du_j;
+      const double row_v = v0 + min_i * dv_i + j * dv_j;
+      unsigned int index = j * size_x + min_i;
+      for (unsigned int k = 0; k < max_i - min_i; ++k, ++index) {
+        const double u = row_u + k * du_i;
+        const double v = row_v + k * dv_i;
+        if (u < 0.0 || v < 0.0) {
+          continue;
+        }
+        const unsigned int mx = static_cast<unsigned int>(u);
+        const unsigned int my = static_cast<unsigned int>(v);
+        if (mx < filter_mask->info.width && my < filter_mask->info.height) {
+          visit(index, my * filter_mask->info.width + mx);
+        }
+      }
+    }
+  }
+
   /**
    * @brief: Name of costmap filter info topic
    */
@@ -38,6 +38,7 @@
 #ifndef NAV2_COSTMAP_2D__COSTMAP_LAYER_HPP_
 #define NAV2_COSTMAP_2D__COSTMAP_LAYER_HPP_
 
+#include <mutex>
 #include <string>
 
 #include <rclcpp/rclcpp.hpp>
@@ -194,6 +195,9 @@ protected:
  */
   CombinationMethod combination_method_from_int(const int value);
 
+  // Held on the update thread between beginTiledUpdate() and endTiledUpdate()
+  std::unique_lock<Costmap2D::mutex_t> tile_lock_;
+
 private:
   double extra_min_x_, extra_max_x_, extra_min_y_, extra_max_y_;
 };
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COSTMAP_2D__COSTMAP_SNAPSHOT_HPP_
+#define NAV2_COSTMAP_2D__COSTMAP_SNAPSHOT_HPP_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "nav2_costmap_2d/costmap_2d.hpp"
+
+namespace nav2_costmap_2d
+{
+
+/**
+ * @class CostmapSnapshotBuffer
+ * @brief Immutable, reference counted snapshots of a costmap, which readers hold and read
+ * without locking the costmap and without blocking or being blocked by its updates.
+ *
+ * Snapshots are taken into a small pool of buffers, RCU style: a buffer is only refilled
+ * once no reader holds it anymore, and then only with the cells updated since it was last
+ * filled. When readers hold every buffer, a new one is allocated for the next snapshot.
+ */
+class CostmapSnapshotBuffer
+{
+public:
+  /**
+   * @brief A constructor
+   * @param num_buffers Number of buffers to keep and reuse, 3 for triple buffering
+   */
+  explicit CostmapSnapshotBuffer(unsigned int num_buffers = 3);
+
+  /**
+   * @brief Take a snapshot of a costmap, which must be locked
+   * @param costmap Costmap to take a snapshot of
+   * @param x0, xn, y0, yn Window of cells, as [x0, xn) x [y0, yn), changed since the
+   * last snapshot. Changes of the size, resolution or origin are detected.
+   */
+  void update(
+    const Costmap2D & costmap,
+    unsigned int x0, unsigned int xn, unsigned int y0, unsigned int yn);
+
+  /**
+   * @brief Copy the whole costmap into the next snapshots, such as after it was reset
+   * outside of the windows given to update()
+   */
+  void invalidate();
+
+  /**
+   * @brief Get the latest snapshot. Does not lock the costmap nor wait for update().
+   * @return Snapshot, which stays valid and unchanged for as long as it is held,
+   * or nullptr if none was taken yet
+   */
+  std::shared_ptr<const Costmap2D> get() const;
+
+protected:
+  struct Buffer
+  {
+    Costmap2D costmap;
+    // Set while a snapshot of the buffer is held, cleared by the last reader releasing it
+    std::atomic<bool> held{false};
+    // Window of cells changed since the buffer was last filled
+    unsigned int x0{0}, xn{0}, y0{0}, yn{0};
+    bool whole{true};
+  };
+
+  /**
+   * @brief Get a buffer to fill, one which no reader holds if possible
+   */
+  std::shared_ptr<Buffer> acquireBuffer();
+
+  unsigned int num_buffers_;
+  std::mutex update_mutex_;
+  std::vector<std::shared_ptr<Buffer>> buffers_;
+  // Only accessed with std::atomic_load and std::atomic_store
+  std::shared_ptr<const Costmap2D> latest_;
+};
+
+}  // namespace nav2_costmap_2d
+
+#endif  // NAV2_COSTMAP_2D__COSTMAP_SNAPSHOT_HPP_
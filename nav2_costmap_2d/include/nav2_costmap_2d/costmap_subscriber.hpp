@@ -20,6 +20,7 @@
 
 #include "rclcpp/rclcpp.hpp"
 #include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_msgs/msg/compressed_costmap.hpp"
 #include "nav2_msgs/msg/costmap.hpp"
 #include "nav2_msgs/msg/costmap_update.hpp"
 #include "nav2_ros_common/lifecycle_node.hpp"
@@ -40,14 +41,31 @@ public:
     const nav2::LifecycleNode::WeakPtr & parent,
     const std::string & topic_name);
 
+  /**
+   * @brief A constructor
+   * @param parent Node to subscribe with
+   * @param topic_name Raw costmap topic, such as "costmap_raw"
+   * @param use_compressed If to subscribe to the compressed costmap on <topic_name>_compressed
+   * instead, which the costmap publishes with publish_compressed_costmap set
+   */
   template<typename NodeT>
   CostmapSubscriber(
     const NodeT & parent,
-    const std::string & topic_name)
+    const std::string & topic_name,
+    const bool use_compressed = false)
   : topic_name_(topic_name)
   {
     logger_ = parent->get_logger();
 
+    if (use_compressed) {
+      compressed_costmap_sub_ =
+        nav2::interfaces::create_subscription<nav2_msgs::msg::CompressedCostmap>(
+        parent, topic_name_ + "_compressed",
+        std::bind(&CostmapSubscriber::compressedCostmapCallback, this, std::placeholders::_1),
+        nav2::qos::LatchedSubscriptionQoS());
+      return;
+    }
+
     // Could be using a user rclcpp::Node, so need to use the Nav2 factory to create the
     // subscription to convert nav2::LifecycleNode, rclcpp::Node or rclcpp_lifecycle::LifecycleNode
     costmap_sub_ = nav2::interfaces::create_subscription<nav2_msgs::msg::Costmap>(
@@ -78,6 +96,11 @@ public:
    * @brief Callback for the costmap's update topic
    */
   void costmapUpdateCallback(const nav2_msgs::msg::CostmapUpdate::SharedPtr update_msg);
+  /**
+   * @brief Callback for the compressed costmap topic. Deltas are applied only on top of
+   * the message before them, otherwise they are dropped until the next keyframe.
+   */
+  void compressedCostmapCallback(const nav2_msgs::msg::CompressedCostmap::SharedPtr msg);
 
   std::string getFrameID() const
   {
@@ -95,6 +118,10 @@ protected:
 
   nav2::Subscription<nav2_msgs::msg::Costmap>::SharedPtr costmap_sub_;
   nav2::Subscription<nav2_msgs::msg::CostmapUpdate>::SharedPtr costmap_update_sub_;
+  nav2::Subscription<nav2_msgs::msg::CompressedCostmap>::SharedPtr compressed_costmap_sub_;
+  // Sequence number of the last compressed message applied, if in sync with the publisher
+  uint32_t compressed_sequence_{0};
+  bool compressed_in_sync_{false};
 
   std::shared_ptr<Costmap2D> costmap_;
   nav2_msgs::msg::Costmap::SharedPtr costmap_msg_;
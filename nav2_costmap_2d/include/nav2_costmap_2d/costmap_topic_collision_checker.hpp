@@ -84,7 +84,19 @@ public:
     const geometry_msgs::msg::Pose2D & pose,
     bool fetch_costmap_and_footprint = true);
 
+  /**
+   * @brief Score poses with precomputed footprint stencils, rather than rasterising
+   * the footprint at every pose
+   * @param use_stencils Whether to use footprint stencils
+   */
+  void setUseFootprintStencils(bool use_stencils);
+
 protected:
+  /**
+   * @brief Fetch the latest footprint, in the robot frame
+   */
+  void fetchFootprint();
+
   /**
    * @brief Get a footprint at a set pose
    *
@@ -104,6 +116,7 @@ protected:
   rclcpp::Clock::SharedPtr clock_;
   Footprint footprint_;
   std::string footprint_string_;
+  bool use_stencils_{false};
 };
 
 }  // namespace nav2_costmap_2d
@@ -26,6 +26,7 @@
 #include "geometry_msgs/msg/pose_stamped.hpp"
 #include "geometry_msgs/msg/pose2_d.hpp"
 #include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_costmap_2d/footprint_stencil.hpp"
 #include "nav2_util/robot_utils.hpp"
 
 namespace nav2_costmap_2d
@@ -79,9 +80,30 @@ public:
   {
     return costmap_;
   }
+  /**
+   * @brief Check footprints at poses with precomputed footprint stencils in
+   * footprintCostAtPose, rather than rasterising the footprint for every pose.
+   * Poses are quantised to stencil headings and to quarters of a cell.
+   * @param use_stencils Whether to use footprint stencils
+   * @param filled Whether stencils cover the interior of the footprint as well
+   */
+  void setUseFootprintStencils(bool use_stencils, bool filled = false);
+  /**
+   * @brief Rasterise the footprint stencil for a footprint if it or the costmap resolution
+   * changed. Called by footprintCostAtPose, or ahead of concurrent footprintCostAtPose calls.
+   */
+  void updateFootprintStencil(const Footprint & footprint);
 
 protected:
+  /**
+   * @brief Find the footprint cost at a pose from the footprint stencil
+   */
+  double footprintStencilCost(double x, double y, double theta, const Footprint & footprint);
+
   CostmapT costmap_;
+  bool use_stencils_{false};
+  bool fill_stencils_{false};
+  std::shared_ptr<const FootprintStencil> stencil_;
 };
 
 }  // namespace nav2_costmap_2d
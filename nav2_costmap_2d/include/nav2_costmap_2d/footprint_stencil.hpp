@@ -0,0 +1,112 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_COSTMAP_2D__FOOTPRINT_STENCIL_HPP_
+#define NAV2_COSTMAP_2D__FOOTPRINT_STENCIL_HPP_
+
+#include <cmath>
+#include <vector>
+
+#include "geometry_msgs/msg/point.hpp"
+
+namespace nav2_costmap_2d
+{
+
+/**
+ * @class FootprintStencil
+ * @brief Cells covered by a footprint, rasterised ahead of time for quantised headings and
+ * positions within a cell. Checking a footprint at a pose then reads the costs of the cells
+ * of its stencil, rather than transforming and rasterising the footprint for every pose.
+ */
+class FootprintStencil
+{
+public:
+  /**
+   * @brief Offset of a cell from the cell of the pose
+   */
+  struct Cell
+  {
+    int dx;
+    int dy;
+  };
+
+  /**
+   * @brief A constructor
+   * @param footprint Footprint, relative to the robot pose
+   * @param resolution Resolution of the costmaps to check the footprint in
+   * @param filled Whether to cover the interior of the footprint, not only its outline
+   * @param num_headings Number of headings to rasterise the footprint at, or 0 for just
+   * enough that no point of the footprint moves by more than a quarter cell between them
+   * @param close_from_last Whether to close the outline with a line from the last point to
+   * the first, rather than from the first to the last as FootprintCollisionChecker does.
+   * Lines are rasterised differently in either direction, so this should match the
+   * footprint check the stencil stands in for.
+   */
+  FootprintStencil(
+    const std::vector<geometry_msgs::msg::Point> & footprint, double resolution,
+    bool filled = false, unsigned int num_headings = 0, bool close_from_last = false);
+
+  /**
+   * @brief Whether the stencil was rasterised for a footprint, resolution and filling.
+   * Footprints whose points are within a tenth of a cell of each other are the same.
+   */
+  bool isFor(
+    const std::vector<geometry_msgs::msg::Point> & footprint, double resolution,
+    bool filled) const;
+
+  /**
+   * @brief Get the cells of the footprint at a pose
+   * @param theta Heading of the pose, in radians
+   * @param fx, fy Position of the pose within its cell, in cells in [0, 1)
+   * @return Cell offsets from the cell of the pose. Cells furthest from the pose, where
+   * obstacles are met first, come first so that collisions are found early.
+   */
+  const std::vector<Cell> & getCells(double theta, double fx, double fy) const
+  {
+    double turns = theta * INV_TWO_PI;
+    turns -= std::floor(turns);
+    unsigned int bin = static_cast<unsigned int>(turns * num_headings_ + 0.5);
+    if (bin >= num_headings_) {
+      bin -= num_headings_;
+    }
+    const unsigned int phase = (fx < 0.5 ? 0u : 1u) + (fy < 0.5 ? 0u : 2u);
+    return stencils_[bin * NUM_PHASES + phase];
+  }
+
+  /**
+   * @brief Get the largest offset of any cell from the cell of the pose, in cells
+   */
+  int getRadius() const {return radius_;}
+
+  /**
+   * @brief Get the number of headings the footprint is rasterised at
+   */
+  unsigned int getNumHeadings() const {return num_headings_;}
+
+protected:
+  // Positions within a cell are quantised to the centers of its quadrants
+  static constexpr unsigned int NUM_PHASES = 4;
+  static constexpr double INV_TWO_PI = 0.15915494309189535;
+
+  std::vector<geometry_msgs::msg::Point> footprint_;
+  double resolution_;
+  bool filled_;
+  unsigned int num_headings_;
+  int radius_{0};
+  std::vector<std::vector<Cell>> stencils_;
+};
+
+}  // namespace nav2_costmap_2d
+
+#endif  // NAV2_COSTMAP_2D__FOOTPRINT_STENCIL_HPP_
@@ -48,6 +48,7 @@
 #include "nav2_costmap_2d/layer.hpp"
 #include "nav2_costmap_2d/layered_costmap.hpp"
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
+#include "nav2_util/distance_transform.hpp"
 
 namespace nav2_costmap_2d
 {
@@ -124,6 +125,49 @@ public:
     nav2_costmap_2d::Costmap2D & master_grid,
     int min_i, int min_j, int max_i, int max_j) override;
 
+  /**
+   * @brief Inflation may be run concurrently over disjoint tiles, with obstacles
+   * gathered once for the whole window in beginTiledUpdate()
+   */
+  bool isTileSafe() override {return true;}
+
+  /**
+   * @brief Obstacles up to the inflation radius away influence the costs in a tile
+   */
+  unsigned int getTileHalo() override {return cell_inflation_radius_;}
+
+  /**
+   * @brief Lock the layer and gather the obstacle cells of the window to inflate
+   * ahead of a tiled update
+   * @param master_grid The master costmap grid to update
+   * @param min_x X min map coord of the window to update
+   * @param min_y Y min map coord of the window to update
+   * @param max_x X max map coord of the window to update
+   * @param max_y Y max map coord of the window to update
+   * @return If tiles should be updated
+   */
+  bool beginTiledUpdate(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j) override;
+
+  /**
+   * @brief Inflate the obstacles within the inflation radius of a tile into it
+   * @param master_grid The master costmap grid to update
+   * @param min_x X min map coord of the tile to update
+   * @param min_y Y min map coord of the tile to update
+   * @param max_x X max map coord of the tile to update
+   * @param max_y Y max map coord of the tile to update
+   */
+  void updateTile(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j) override;
+
+  /**
+   * @brief Unlock the layer after a tiled update
+   * @param master_grid The master costmap grid updated
+   */
+  void endTiledUpdate(nav2_costmap_2d::Costmap2D & master_grid) override;
+
   /**
    * @brief Match the size of the master costmap
    */
@@ -260,6 +304,45 @@ protected:
     return layered_costmap_->getCostmap()->cellDistance(world_dist);
   }
 
+  /**
+   * @brief If a cell of the master grid is an obstacle to inflate around
+   * @param cost Cost of the cell
+   */
+  inline bool isInflationSource(unsigned char cost) const
+  {
+    return cost == LETHAL_OBSTACLE || (inflate_around_unknown_ && cost == NO_INFORMATION);
+  }
+
+  /**
+   * @brief If the distance transform engine is used with the current inflation radius
+   */
+  bool useDistanceTransform() const;
+
+  /**
+   * @brief Bring the persistent distance field up to date with the obstacles of the
+   * master grid around a window, recomputing it only around cells which changed
+   * @param master_grid The master costmap grid
+   * @param min_i X min map coord of the window to update
+   * @param min_j Y min map coord of the window to update
+   * @param max_i X max map coord of the window to update
+   * @param max_j Y max map coord of the window to update
+   */
+  void updateDistanceField(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j);
+
+  /**
+   * @brief Apply the costs of the distance field to a window of the master grid
+   * @param master_grid The master costmap grid to update
+   * @param min_i X min map coord of the window to update
+   * @param min_j Y min map coord of the window to update
+   * @param max_i X max map coord of the window to update
+   * @param max_j Y max map coord of the window to update
+   */
+  void applyDistanceField(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j);
+
   /**
    * @brief Enqueue new cells in cache distance update search
    */
@@ -274,8 +357,21 @@ protected:
   rcl_interfaces::msg::SetParametersResult
   dynamicParametersCallback(std::vector<rclcpp::Parameter> parameters);
 
+  /**
+   * @brief Algorithms to compute the distances from obstacles with
+   * WAVEFRONT: Brushfire from every obstacle in the update window, on every update
+   * DISTANCE_TRANSFORM: Exact Euclidean distance transform, kept between updates and only
+   * recomputed around obstacles which changed
+   */
+  enum class InflationEngine
+  {
+    WAVEFRONT = 0,
+    DISTANCE_TRANSFORM = 1
+  };
+
   double inflation_radius_, inscribed_radius_, cost_scaling_factor_;
   bool inflate_unknown_, inflate_around_unknown_;
+  InflationEngine engine_;
   unsigned int cell_inflation_radius_;
   unsigned int cached_cell_inflation_radius_;
   std::vector<std::vector<CellData>> inflation_cells_;
@@ -288,11 +384,28 @@ protected:
   std::vector<double> cached_distances_;
   std::vector<std::vector<int>> distance_matrix_;
   unsigned int cache_length_;
+
+  // Costs indexed by squared cell distance, up to the squared inflation radius
+  std::vector<unsigned char> cached_sq_distance_costs_;
+  // Squared cell distance of every cell to the nearest obstacle, clamped one past the
+  // squared inflation radius. Always the exact distance transform of its own zero cells.
+  std::vector<uint16_t> distance_field_;
+  bool distance_field_valid_;
+  double distance_field_origin_x_, distance_field_origin_y_;
+  nav2_util::SquaredDistanceTransform distance_transform_;
+  std::vector<uint8_t> transform_obstacles_;
+  std::vector<uint32_t> transform_sq_distances_;
   double last_min_x_, last_min_y_, last_max_x_, last_max_y_;
 
   // Indicates that the entire costmap should be reinflated next time around.
   bool need_reinflation_;
   mutex_t * access_;
+  // Held on the update thread between beginTiledUpdate() and endTiledUpdate()
+  std::unique_lock<mutex_t> tile_lock_;
+  // Obstacle cells of the window being updated in tiles, as x coordinates bucketed by row
+  std::vector<unsigned int> tile_seeds_x_;
+  std::vector<std::size_t> tile_seeds_row_start_;
+  int tile_seeds_min_j_{0};
   // Dynamic parameters handler
   rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr dyn_params_handler_;
 };
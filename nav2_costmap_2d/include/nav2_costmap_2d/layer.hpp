@@ -43,6 +43,7 @@
 
 #include "tf2_ros/buffer.h"
 #include "rclcpp/rclcpp.hpp"
+#include "nav2_costmap_2d/blend_kernels.hpp"
 #include "nav2_costmap_2d/costmap_2d.hpp"
 #include "nav2_costmap_2d/layered_costmap.hpp"
 #include "nav2_ros_common/lifecycle_node.hpp"
@@ -111,6 +112,69 @@ public:
     Costmap2D & master_grid,
     int min_i, int min_j, int max_i, int max_j) = 0;
 
+  /**
+   * @brief If this layer supports tiled updates. When the LayeredCostmap is configured
+   *        with more than one update thread, tile-safe layers have updateTile() called
+   *        concurrently on disjoint tiles of the update window instead of a single call
+   *        to updateCosts(). Layers which override updateCosts() of a tile-safe base
+   *        class should override this as well.
+   */
+  virtual bool isTileSafe() {return false;}
+
+  /**
+   * @brief Number of cells around a tile whose master grid values influence this
+   *        layer's output inside of the tile (e.g. the inflation radius). Layers with a
+   *        halo are only dispatched once every tile of the preceding layers is complete,
+   *        rather than being run back to back with them on each tile.
+   */
+  virtual unsigned int getTileHalo() {return 0;}
+
+  /**
+   * @brief Called once on the update thread before updateTile() is dispatched over
+   *        the tiles of the update window. Stateful work, such as locking the layer,
+   *        footprint clearing or transform lookups, should be done here.
+   * @return If updateTile() should be called for the tiles of this update
+   */
+  virtual bool beginTiledUpdate(
+    Costmap2D & /*master_grid*/,
+    int /*min_i*/, int /*min_j*/, int /*max_i*/, int /*max_j*/)
+  {
+    return true;
+  }
+
+  /**
+   * @brief Update the underlying costmap within a single tile of the update window.
+   *        May be called concurrently for different tiles, so it must only write cells
+   *        inside of the tile and not modify any other state of the layer.
+   */
+  virtual void updateTile(
+    Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j)
+  {
+    updateCosts(master_grid, min_i, min_j, max_i, max_j);
+  }
+
+  /**
+   * @brief If updateTile() only blends costs the size of the master grid into it, get
+   *        them so that consecutive layers blending with the same mode are combined in a
+   *        single pass over the master grid. Called after beginTiledUpdate() returned true.
+   *        Layers which override updateTile() of a base class reporting a blend should
+   *        override this as well.
+   * @param mode [out] Blend mode of the costs
+   * @param costs [out] Costs to blend, indexed as the master grid
+   * @return If updateTile() is this blend, so need not be called
+   */
+  virtual bool getTileBlend(BlendMode & /*mode*/, const unsigned char * & /*costs*/)
+  {
+    return false;
+  }
+
+  /**
+   * @brief Called once on the update thread after every tile of the update window has
+   *        been processed, even if beginTiledUpdate() returned false.
+   */
+  virtual void endTiledUpdate(Costmap2D & /*master_grid*/) {}
+
   /** @brief Implement this to make this layer match the size of the parent costmap. */
   virtual void matchSize() {}
 
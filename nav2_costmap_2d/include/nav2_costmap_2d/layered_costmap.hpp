@@ -45,6 +45,7 @@
 #include "nav2_costmap_2d/cost_values.hpp"
 #include "nav2_costmap_2d/layer.hpp"
 #include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_util/thread_pool.hpp"
 
 namespace nav2_costmap_2d
 {
@@ -211,7 +212,45 @@ public:
   * of poorly configured setups. */
   bool isOutofBounds(double robot_x, double robot_y);
 
+  /**
+   * @brief Set the number of threads used to update the layers in updateMap().
+   * With more than one thread, the update window is split into square tiles and
+   * layers reporting isTileSafe() are updated over them concurrently. Other layers
+   * are still updated serially over the whole window, in order.
+   * @param num_threads Number of threads including the update thread, 1 is serial
+   * and 0 uses the number of hardware threads
+   * @param tile_size Length of a side of a tile in cells
+   */
+  void setUpdateThreads(unsigned int num_threads, unsigned int tile_size);
+
+  /**
+   * @brief Get the number of threads used to update the layers
+   */
+  unsigned int getUpdateThreads()
+  {
+    return update_pool_ ? update_pool_->size() : 1u;
+  }
+
+  /**
+   * @brief Get the pool layers are updated with, if multi-threaded. Layers may also use it
+   * to parallelize their own work from updateBounds() and beginTiledUpdate().
+   * @return Thread pool or nullptr when updating serially
+   */
+  nav2_util::ThreadPool * getUpdateThreadPool()
+  {
+    return update_pool_.get();
+  }
+
 private:
+  /**
+   * @brief Update the costs of a set of layers in order over a window of a grid,
+   * dispatching tile-safe layers over tiles of the window if multi-threaded. Consecutive
+   * layers blending with the same mode are blended in a single pass.
+   */
+  void updateLayers(
+    std::vector<std::shared_ptr<Layer>> & layers, Costmap2D & grid,
+    int x0, int y0, int xn, int yn);
+
   // primary_costmap_ is a bottom costmap used by plugins when costmap filters were enabled.
   // combined_costmap_ is a final costmap where all results produced by plugins and filters (if any)
   // to be merged.
@@ -233,6 +272,9 @@ private:
   bool size_locked_;
   std::atomic<double> circumscribed_radius_, inscribed_radius_;
   std::shared_ptr<std::vector<geometry_msgs::msg::Point>> footprint_;
+
+  std::unique_ptr<nav2_util::ThreadPool> update_pool_;
+  unsigned int tile_size_;
 };
 
 }  // namespace nav2_costmap_2d
@@ -32,6 +32,8 @@
 #ifndef NAV2_COSTMAP_2D__OBSERVATION_HPP_
 #define NAV2_COSTMAP_2D__OBSERVATION_HPP_
 
+#include <memory>
+
 #include <geometry_msgs/msg/point.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
@@ -40,8 +42,8 @@ namespace nav2_costmap_2d
 
 /**
  * @brief Stores an observation in terms of a point cloud and the origin of the source
- * @note Tried to make members and constructor arguments const but the compiler would not accept the default
- * assignment operator for vector insertion!
+ * @note The point cloud is immutable and shared between the copies of an observation,
+ * so observations are cheap to copy
  */
 class Observation
 {
@@ -50,34 +52,20 @@ public:
    * @brief  Creates an empty observation
    */
   Observation()
-  : cloud_(new sensor_msgs::msg::PointCloud2()), obstacle_max_range_(0.0), obstacle_min_range_(0.0),
-    raytrace_max_range_(0.0),
-    raytrace_min_range_(0.0)
+  : cloud_(std::make_shared<sensor_msgs::msg::PointCloud2>()), obstacle_max_range_(0.0),
+    obstacle_min_range_(0.0), raytrace_max_range_(0.0), raytrace_min_range_(0.0)
   {
   }
   /**
    * @brief A destructor
    */
-  virtual ~Observation()
-  {
-    delete cloud_;
-  }
+  virtual ~Observation() = default;
 
   /**
-   * @brief  Copy assignment operator
+   * @brief  Copy assignment operator, sharing the point cloud of the observation
    * @param obs The observation to copy
    */
-  Observation & operator=(const Observation & obs)
-  {
-    origin_ = obs.origin_;
-    cloud_ = new sensor_msgs::msg::PointCloud2(*(obs.cloud_));
-    obstacle_max_range_ = obs.obstacle_max_range_;
-    obstacle_min_range_ = obs.obstacle_min_range_;
-    raytrace_max_range_ = obs.raytrace_max_range_;
-    raytrace_min_range_ = obs.raytrace_min_range_;
-
-    return *this;
-  }
+  Observation & operator=(const Observation & obs) = default;
 
   /**
    * @brief  Creates an observation from an origin point and a point cloud
@@ -92,7 +80,7 @@ public:
     geometry_msgs::msg::Point & origin, const sensor_msgs::msg::PointCloud2 & cloud,
     double obstacle_max_range, double obstacle_min_range, double raytrace_max_range,
     double raytrace_min_range)
-  : origin_(origin), cloud_(new sensor_msgs::msg::PointCloud2(cloud)),
+  : origin_(origin), cloud_(std::make_shared<sensor_msgs::msg::PointCloud2>(cloud)),
     obstacle_max_range_(obstacle_max_range), obstacle_min_range_(obstacle_min_range),
     raytrace_max_range_(raytrace_max_range), raytrace_min_range_(
       raytrace_min_range)
@@ -100,17 +88,32 @@ public:
   }
 
   /**
-   * @brief  Copy constructor
-   * @param obs The observation to copy
+   * @brief  Creates an observation sharing a point cloud, without copying it
+   * @param origin The origin point of the observation
+   * @param cloud The point cloud of the observation, which should not be modified afterwards
+   * @param obstacle_max_range The range out to which an observation should be able to insert obstacles
+   * @param obstacle_min_range The range from which an observation should be able to insert obstacles
+   * @param raytrace_max_range The range out to which an observation should be able to clear via raytracing
+   * @param raytrace_min_range The range from which an observation should be able to clear via raytracing
    */
-  Observation(const Observation & obs)
-  : origin_(obs.origin_), cloud_(new sensor_msgs::msg::PointCloud2(*(obs.cloud_))),
-    obstacle_max_range_(obs.obstacle_max_range_), obstacle_min_range_(obs.obstacle_min_range_),
-    raytrace_max_range_(obs.raytrace_max_range_),
-    raytrace_min_range_(obs.raytrace_min_range_)
+  Observation(
+    const geometry_msgs::msg::Point & origin,
+    sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud,
+    double obstacle_max_range, double obstacle_min_range, double raytrace_max_range,
+    double raytrace_min_range)
+  : origin_(origin), cloud_(std::move(cloud)),
+    obstacle_max_range_(obstacle_max_range), obstacle_min_range_(obstacle_min_range),
+    raytrace_max_range_(raytrace_max_range), raytrace_min_range_(
+      raytrace_min_range)
   {
   }
 
+  /**
+   * @brief  Copy constructor, sharing the point cloud of the observation
+   * @param obs The observation to copy
+   */
+  Observation(const Observation & obs) = default;
+
   /**
    * @brief  Creates an observation from a point cloud
    * @param cloud The point cloud of the observation
@@ -120,14 +123,14 @@ public:
   Observation(
     const sensor_msgs::msg::PointCloud2 & cloud, double obstacle_max_range,
     double obstacle_min_range)
-  : cloud_(new sensor_msgs::msg::PointCloud2(cloud)), obstacle_max_range_(obstacle_max_range),
-    obstacle_min_range_(obstacle_min_range),
+  : cloud_(std::make_shared<sensor_msgs::msg::PointCloud2>(cloud)),
+    obstacle_max_range_(obstacle_max_range), obstacle_min_range_(obstacle_min_range),
     raytrace_max_range_(0.0), raytrace_min_range_(0.0)
   {
   }
 
   geometry_msgs::msg::Point origin_;
-  sensor_msgs::msg::PointCloud2 * cloud_;
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud_;
   double obstacle_max_range_, obstacle_min_range_, raytrace_max_range_, raytrace_min_range_;
 };
 
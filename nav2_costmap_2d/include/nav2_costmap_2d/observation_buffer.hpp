@@ -44,6 +44,8 @@
 #include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
 #include "rclcpp/time.hpp"
 #include "tf2_ros/buffer.h"
+#include "builtin_interfaces/msg/time.hpp"
+#include "geometry_msgs/msg/transform_stamped.hpp"
 #include "tf2_sensor_msgs/tf2_sensor_msgs.hpp"
 #include "sensor_msgs/msg/point_cloud2.hpp"
 #include "nav2_costmap_2d/observation.hpp"
@@ -93,14 +95,23 @@ public:
   ~ObservationBuffer();
 
   /**
-   * @brief  Transforms a PointCloud to the global frame and buffers it
+   * @brief  Looks up the transform of a PointCloud to the global frame and buffers a copy of it
    * <b>Note: The burden is on the user to make sure the transform is available... ie they should use a MessageNotifier</b>
    * @param  cloud The cloud to be buffered
    */
   void bufferCloud(const sensor_msgs::msg::PointCloud2 & cloud);
 
   /**
-   * @brief  Pushes copies of all current observations onto the end of the vector passed in
+   * @brief  Looks up the transform of a PointCloud to the global frame and buffers it without
+   * copying. The cloud is transformed and filtered only once, when it is first observed.
+   * <b>Note: The burden is on the user to make sure the transform is available... ie they should use a MessageNotifier</b>
+   * @param  cloud The cloud to be buffered, which should not be modified afterwards
+   */
+  void bufferCloud(sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud);
+
+  /**
+   * @brief  Pushes all current observations onto the end of the vector passed in.
+   * The observations share their point clouds with the buffer, so are cheap to copy.
    * @param  observations The vector to be filled
    */
   void getObservations(std::vector<Observation> & observations);
@@ -133,11 +144,30 @@ public:
   void resetLastUpdated();
 
 private:
+  /**
+   * @struct BufferedCloud
+   * @brief A buffered point cloud, with its transform to the global frame
+   */
+  struct BufferedCloud
+  {
+    builtin_interfaces::msg::Time stamp;
+    sensor_msgs::msg::PointCloud2::ConstSharedPtr raw_cloud;  ///< @brief Reset once processed
+    geometry_msgs::msg::TransformStamped transform;
+    Observation observation;
+  };
+
   /**
    * @brief  Removes any stale observations from the buffer list
    */
   void purgeStaleObservations();
 
+  /**
+   * @brief  Transforms the points of a raw cloud to the global frame and keeps those within
+   * the height bounds in a compact float32 xyz cloud, in a single pass
+   * @param  buffered_cloud The buffered cloud to process
+   */
+  void processCloud(BufferedCloud & buffered_cloud) const;
+
   rclcpp::Clock::SharedPtr clock_;
   rclcpp::Logger logger_{rclcpp::get_logger("nav2_costmap_2d")};
   tf2_ros::Buffer & tf2_buffer_;
@@ -146,7 +176,7 @@ private:
   rclcpp::Time last_updated_;
   std::string global_frame_;
   std::string sensor_frame_;
-  std::list<Observation> observation_list_;
+  std::list<BufferedCloud> observation_list_;
   std::string topic_name_;
   double min_obstacle_height_, max_obstacle_height_;
   std::recursive_mutex lock_;  ///< @brief A lock for accessing data in callbacks safely
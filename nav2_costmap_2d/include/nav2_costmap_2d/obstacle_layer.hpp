@@ -40,6 +40,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "rclcpp/rclcpp.hpp"
@@ -114,6 +115,51 @@ public:
     nav2_costmap_2d::Costmap2D & master_grid,
     int min_i, int min_j, int max_i, int max_j);
 
+  /**
+   * @brief The layer only combines its own grid into the master grid, so it can be
+   * updated concurrently over disjoint tiles
+   */
+  virtual bool isTileSafe() {return true;}
+
+  /**
+   * @brief Lock the layer and clear the footprint ahead of a tiled update
+   * @param master_grid The master costmap grid to update
+   * @param min_x X min map coord of the window to update
+   * @param min_y Y min map coord of the window to update
+   * @param max_x X max map coord of the window to update
+   * @param max_y Y max map coord of the window to update
+   * @return If tiles should be updated
+   */
+  virtual bool beginTiledUpdate(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j);
+
+  /**
+   * @brief Combine the layer into the master costmap within a tile
+   * @param master_grid The master costmap grid to update
+   * @param min_x X min map coord of the tile to update
+   * @param min_y Y min map coord of the tile to update
+   * @param max_x X max map coord of the tile to update
+   * @param max_y Y max map coord of the tile to update
+   */
+  virtual void updateTile(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j);
+
+  /**
+   * @brief Get the blend of the layer into the master costmap, done by updateTile()
+   * @param mode [out] Blend mode of the combination method
+   * @param costs [out] Costs of the layer
+   * @return If the combination method blends the layer into the master costmap
+   */
+  virtual bool getTileBlend(BlendMode & mode, const unsigned char * & costs);
+
+  /**
+   * @brief Unlock the layer after a tiled update
+   * @param master_grid The master costmap grid updated
+   */
+  virtual void endTiledUpdate(nav2_costmap_2d::Costmap2D & master_grid);
+
   /**
    * @brief Deactivate the layer
    */
@@ -208,6 +254,18 @@ protected:
     double * max_x,
     double * max_y);
 
+  /**
+   * @brief  Reduce the points of a clearing observation to the farthest point of each angular
+   * (and optionally range) bin around its origin, to trace one ray per bin
+   * @param clearing_observation The observation used to raytrace
+   * @param endpoints The ray endpoints, in the order the bins were first hit
+   * @return False if the resolutions give too many bins, in which case a ray should be
+   * traced to every point
+   */
+  bool binClearingPoints(
+    const nav2_costmap_2d::Observation & clearing_observation,
+    std::vector<std::pair<double, double>> & endpoints);
+
   /**
    * @brief Process update costmap with raytracing the window bounds
    */
@@ -231,6 +289,25 @@ protected:
   std::string global_frame_;  ///< @brief The global frame for the costmap
   double min_obstacle_height_;  ///< @brief Max Obstacle Height
   double max_obstacle_height_;  ///< @brief Max Obstacle Height
+  /// @brief Angular bin width to clear space in, 0 to trace a ray to every point
+  double raytrace_angular_resolution_;
+  /// @brief Range bin width to clear space in within angular bins, 0 for one bin per angle
+  double raytrace_range_resolution_;
+
+  /**
+   * @struct RaytraceBin
+   * @brief The farthest point of a clearing bin
+   */
+  struct RaytraceBin
+  {
+    double range_sq;
+    double x;
+    double y;
+  };
+  /// @brief Clearing bins, kept to avoid reallocating them on each update
+  std::vector<RaytraceBin> raytrace_bins_;
+  std::vector<unsigned int> raytrace_touched_bins_;
+  std::vector<std::pair<double, double>> raytrace_endpoints_;
 
   /// @brief Used to project laser scans into point clouds
   laser_geometry::LaserProjection projector_;
@@ -48,6 +48,7 @@
 #include "nav2_costmap_2d/layered_costmap.hpp"
 #include "nav_msgs/msg/occupancy_grid.hpp"
 #include "nav2_costmap_2d/footprint.hpp"
+#include "tf2/LinearMath/Transform.hpp"
 
 namespace nav2_costmap_2d
 {
@@ -118,6 +119,53 @@ public:
     nav2_costmap_2d::Costmap2D & master_grid,
     int min_i, int min_j, int max_i, int max_j);
 
+  /**
+   * @brief The layer only copies its own map into the master grid, so it can be
+   * updated concurrently over disjoint tiles
+   */
+  virtual bool isTileSafe() {return true;}
+
+  /**
+   * @brief Lock the layer, clear the footprint and look up the map transform
+   * ahead of a tiled update
+   * @param master_grid The master costmap grid to update
+   * @param min_x X min map coord of the window to update
+   * @param min_y Y min map coord of the window to update
+   * @param max_x X max map coord of the window to update
+   * @param max_y Y max map coord of the window to update
+   * @return If tiles should be updated
+   */
+  virtual bool beginTiledUpdate(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j);
+
+  /**
+   * @brief Update the costs in the master costmap within a tile
+   * @param master_grid The master costmap grid to update
+   * @param min_x X min map coord of the tile to update
+   * @param min_y Y min map coord of the tile to update
+   * @param max_x X max map coord of the tile to update
+   * @param max_y Y max map coord of the tile to update
+   */
+  virtual void updateTile(
+    nav2_costmap_2d::Costmap2D & master_grid,
+    int min_i, int min_j, int max_i, int max_j);
+
+  /**
+   * @brief Get the blend of the map into the master costmap, done by updateTile()
+   * when the costmap is not rolling
+   * @param mode [out] Blend mode, Max if using the maximum and TrueOverwrite otherwise
+   * @param costs [out] Costs of the map
+   * @return If the map is blended without transforming it, as it is when not rolling
+   */
+  virtual bool getTileBlend(BlendMode & mode, const unsigned char * & costs);
+
+  /**
+   * @brief Restore the cleared footprint and unlock the layer after a tiled update
+   * @param master_grid The master costmap grid updated
+   */
+  virtual void endTiledUpdate(nav2_costmap_2d::Costmap2D & master_grid);
+
   /**
    * @brief Match the size of the master costmap
    */
@@ -163,6 +211,10 @@ protected:
   std::vector<geometry_msgs::msg::Point> transformed_footprint_;
   bool footprint_clearing_enabled_;
   bool restore_cleared_footprint_;
+  // Map region cleared under the footprint for the update in progress
+  std::vector<MapLocation> map_region_to_restore_;
+  // global_frame_ to map_frame_ transform for the update in progress, when rolling
+  tf2::Transform update_transform_;
   /**
    * @brief Clear costmap layer info below the robot's footprint
    */
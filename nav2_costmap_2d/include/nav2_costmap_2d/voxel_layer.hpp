@@ -52,6 +52,7 @@
 #include <sensor_msgs/msg/point_cloud2.hpp>
 #include <nav2_costmap_2d/obstacle_layer.hpp>
 #include <nav2_voxel_grid/voxel_grid.hpp>
+#include <nav2_voxel_grid/sparse_voxel_grid.hpp>
 
 namespace nav2_costmap_2d
 {
@@ -67,7 +68,7 @@ public:
    * @brief Voxel Layer constructor
    */
   VoxelLayer()
-  : voxel_grid_(0, 0, 0)
+  : voxel_grid_(0, 0, 0), sparse_voxel_grid_(0, 0, 0)
   {
     costmap_ = NULL;  // this is the unsigned char* member of parent class's parent class Costmap2D
   }
@@ -141,9 +142,43 @@ protected:
     double * max_x,
     double * max_y);
 
+  /**
+   * @brief Clear the voxels of the rays in clearing_rays_, over strips of x cells
+   * in parallel if the costmap is updated with multiple threads
+   * @param max_length Maximum length of the rays to clear, in cells
+   * @param min_length Length along the rays to start clearing from, in cells
+   */
+  void clearRays(unsigned int max_length, unsigned int min_length);
+
+  /**
+   * @brief Mark a voxel in the grid in use
+   * @return If the column of the voxel should be marked in the costmap
+   */
+  inline bool markVoxelInMap(unsigned int mx, unsigned int my, unsigned int mz)
+  {
+    if (use_sparse_voxel_grid_) {
+      return sparse_voxel_grid_.markVoxelInMap(mx, my, mz, mark_threshold_);
+    }
+    return voxel_grid_.markVoxelInMap(mx, my, mz, mark_threshold_);
+  }
+
+  /**
+   * @struct ClearingRay
+   * @brief A ray from a sensor to a clearing endpoint, in map coordinates
+   */
+  struct ClearingRay
+  {
+    double x0, y0, z0;
+    double x1, y1, z1;
+  };
+
   bool publish_voxel_;
   nav2::Publisher<nav2_msgs::msg::VoxelGrid>::SharedPtr voxel_pub_;
   nav2_voxel_grid::VoxelGrid voxel_grid_;
+  // Used instead of voxel_grid_ if use_sparse_voxel_grid_, supporting up to 64 z voxels
+  nav2_voxel_grid::SparseVoxelGrid sparse_voxel_grid_;
+  bool use_sparse_voxel_grid_{false};
+  std::vector<ClearingRay> clearing_rays_;
   double z_resolution_, origin_z_;
   int unknown_threshold_, mark_threshold_, size_z_;
   nav2::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr
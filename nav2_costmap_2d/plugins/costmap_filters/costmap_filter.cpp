@@ -217,7 +217,11 @@ unsigned char CostmapFilter::getMaskCost(
 {
   const unsigned int index = my * filter_mask->info.width + mx;
 
-  const char data = filter_mask->data[index];
+  return maskDataToCost(filter_mask->data[index]);
+}
+
+unsigned char CostmapFilter::maskDataToCost(const int8_t data)
+{
   if (data == nav2_util::OCC_GRID_UNKNOWN) {
     return NO_INFORMATION;
   } else {
@@ -35,6 +35,8 @@
  * Author: Alexey Merzlyakov
  *********************************************************************/
 
+#include <array>
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <algorithm>
@@ -297,52 +299,31 @@ void KeepoutFilter::process(
     }
   }
 
-  unsigned int i, j;  // master_grid iterators
-  unsigned int index;  // corresponding index of master_grid
-  double gl_wx, gl_wy;  // world coordinates in a global_frame_
-  double msk_wx, msk_wy;  // world coordinates in a mask_frame
-  unsigned int mx, my;  // filter_mask_ coordinates
-  unsigned char data, old_data;  // master_grid element data
+  // Costs of all filter mask data values, to not convert them for each cell
+  std::array<unsigned char, 256> mask_costs;
+  for (int value = INT8_MIN; value <= INT8_MAX; ++value) {
+    mask_costs[static_cast<uint8_t>(value)] = maskDataToCost(static_cast<int8_t>(value));
+  }
+  const int8_t * mask_data = filter_mask_->data.data();
+  const bool use_override_cost = override_lethal_cost_ && is_pose_lethal;
 
   // Main master_grid updating loop
-  // Iterate in costmap window by master_grid indexes
+  // Iterate in costmap window by master_grid rows, with the corresponding filter_mask_ cells
   unsigned char * master_array = master_grid.getCharMap();
-  for (i = mg_min_x_u; i < mg_max_x_u; i++) {
-    for (j = mg_min_y_u; j < mg_max_y_u; j++) {
-      index = master_grid.getIndex(i, j);
-      old_data = master_array[index];
-      // Calculating corresponding to (i, j) point at filter_mask_:
-      // Get world coordinates in global_frame_
-      master_grid.mapToWorld(i, j, gl_wx, gl_wy);
-      if (mask_frame != global_frame_) {
-        // Transform (i, j) point from global_frame_ to mask_frame
-        tf2::Vector3 point(gl_wx, gl_wy, 0);
-        point = tf2_transform * point;
-        msk_wx = point.x();
-        msk_wy = point.y();
-      } else {
-        // In this case master_grid and filter-mask are in the same frame
-        msk_wx = gl_wx;
-        msk_wy = gl_wy;
+  forEachMaskCell(
+    master_grid, filter_mask_, tf2_transform, mg_min_x_u, mg_min_y_u, mg_max_x_u, mg_max_y_u,
+    [&](unsigned int index, unsigned int mask_index) {
+      const unsigned char data = mask_costs[static_cast<uint8_t>(mask_data[mask_index])];
+      // Update if mask_ data is valid and greater than existing master_grid's one
+      if (data == NO_INFORMATION) {
+        return;
       }
-      // Get mask coordinates corresponding to (i, j) point at filter_mask_
-      if (worldToMask(filter_mask_, msk_wx, msk_wy, mx, my)) {
-        data = getMaskCost(filter_mask_, mx, my);
-        // Update if mask_ data is valid and greater than existing master_grid's one
-        if (data == NO_INFORMATION) {
-          continue;
-        }
 
-        if (data > old_data || old_data == NO_INFORMATION) {
-          if (override_lethal_cost_ && is_pose_lethal) {
-            master_array[index] = lethal_override_cost_;
-          } else {
-            master_array[index] = data;
-          }
-        }
+      const unsigned char old_data = master_array[index];
+      if (data > old_data || old_data == NO_INFORMATION) {
+        master_array[index] = use_override_cost ? lethal_override_cost_ : data;
       }
-    }
-  }
+    });
 
   last_pose_lethal_ = is_pose_lethal;
 }
@@ -37,8 +37,10 @@
  *********************************************************************/
 #include "nav2_costmap_2d/inflation_layer.hpp"
 
+#include <cmath>
 #include <limits>
 #include <map>
+#include <string>
 #include <vector>
 #include <algorithm>
 #include <utility>
@@ -64,10 +66,14 @@ InflationLayer::InflationLayer()
   cost_scaling_factor_(0),
   inflate_unknown_(false),
   inflate_around_unknown_(false),
+  engine_(InflationEngine::WAVEFRONT),
   cell_inflation_radius_(0),
   cached_cell_inflation_radius_(0),
   resolution_(0),
   cache_length_(0),
+  distance_field_valid_(false),
+  distance_field_origin_x_(0),
+  distance_field_origin_y_(0),
   last_min_x_(std::numeric_limits<double>::lowest()),
   last_min_y_(std::numeric_limits<double>::lowest()),
   last_max_x_(std::numeric_limits<double>::max()),
@@ -94,6 +100,7 @@ InflationLayer::onInitialize()
   declareParameter("cost_scaling_factor", rclcpp::ParameterValue(10.0));
   declareParameter("inflate_unknown", rclcpp::ParameterValue(false));
   declareParameter("inflate_around_unknown", rclcpp::ParameterValue(false));
+  declareParameter("inflation_engine", rclcpp::ParameterValue(std::string("wavefront")));
 
   {
     auto node = node_.lock();
@@ -106,6 +113,19 @@ InflationLayer::onInitialize()
     node->get_parameter(name_ + "." + "inflate_unknown", inflate_unknown_);
     node->get_parameter(name_ + "." + "inflate_around_unknown", inflate_around_unknown_);
 
+    std::string engine;
+    node->get_parameter(name_ + "." + "inflation_engine", engine);
+    if (engine == "distance_transform") {
+      engine_ = InflationEngine::DISTANCE_TRANSFORM;
+    } else {
+      if (engine != "wavefront") {
+        RCLCPP_WARN(
+          logger_, "Unknown inflation_engine '%s' for %s, using 'wavefront'",
+          engine.c_str(), name_.c_str());
+      }
+      engine_ = InflationEngine::WAVEFRONT;
+    }
+
     dyn_params_handler_ = node->add_on_set_parameters_callback(
       std::bind(
         &InflationLayer::dynamicParametersCallback,
@@ -129,7 +149,12 @@ InflationLayer::matchSize()
   resolution_ = costmap->getResolution();
   cell_inflation_radius_ = cellDistance(inflation_radius_);
   computeCaches();
-  seen_ = std::vector<bool>(costmap->getSizeInCellsX() * costmap->getSizeInCellsY(), false);
+  distance_field_valid_ = false;
+  if (useDistanceTransform()) {
+    seen_.clear();
+  } else {
+    seen_ = std::vector<bool>(costmap->getSizeInCellsX() * costmap->getSizeInCellsY(), false);
+  }
 }
 
 void
@@ -201,6 +226,13 @@ InflationLayer::updateCosts(
     return;
   }
 
+  if (useDistanceTransform()) {
+    updateDistanceField(master_grid, min_i, min_j, max_i, max_j);
+    applyDistanceField(master_grid, min_i, min_j, max_i, max_j);
+    current_ = true;
+    return;
+  }
+
   // make sure the inflation list is empty at the beginning of the cycle (should always be true)
   for (auto & dist : inflation_cells_) {
     RCLCPP_FATAL_EXPRESSION(
@@ -249,7 +281,7 @@ InflationLayer::updateCosts(
     for (int i = min_i; i < max_i; i++) {
       int index = static_cast<int>(master_grid.getIndex(i, j));
       unsigned char cost = master_array[index];
-      if (cost == LETHAL_OBSTACLE || (inflate_around_unknown_ && cost == NO_INFORMATION)) {
+      if (isInflationSource(cost)) {
         obs_bin.emplace_back(i, j, i, j);
       }
     }
@@ -320,6 +352,299 @@ InflationLayer::updateCosts(
   current_ = true;
 }
 
+bool
+InflationLayer::beginTiledUpdate(
+  nav2_costmap_2d::Costmap2D & master_grid, int min_i, int min_j,
+  int max_i,
+  int max_j)
+{
+  tile_lock_ = std::unique_lock<mutex_t>(*getMutex());
+  tile_seeds_x_.clear();
+  tile_seeds_row_start_.clear();
+  if (!enabled_ || (cell_inflation_radius_ == 0)) {
+    return false;
+  }
+
+  if (useDistanceTransform()) {
+    // The field is updated for the whole window up front, tiles only read from it
+    updateDistanceField(master_grid, min_i, min_j, max_i, max_j);
+    current_ = true;
+    return true;
+  }
+
+  unsigned char * master_array = master_grid.getCharMap();
+  unsigned int size_x = master_grid.getSizeInCellsX(), size_y = master_grid.getSizeInCellsY();
+
+  // Gather the obstacles once for the window expanded by the inflation radius before
+  // any tile is written, since tiles may overwrite unknown cells next to each other
+  min_i = std::max(0, min_i - static_cast<int>(cell_inflation_radius_));
+  min_j = std::max(0, min_j - static_cast<int>(cell_inflation_radius_));
+  max_i = std::min(static_cast<int>(size_x), max_i + static_cast<int>(cell_inflation_radius_));
+  max_j = std::min(static_cast<int>(size_y), max_j + static_cast<int>(cell_inflation_radius_));
+
+  tile_seeds_min_j_ = min_j;
+  tile_seeds_row_start_.reserve(std::max(0, max_j - min_j) + 1);
+  for (int j = min_j; j < max_j; j++) {
+    tile_seeds_row_start_.push_back(tile_seeds_x_.size());
+    for (int i = min_i; i < max_i; i++) {
+      unsigned char cost = master_array[master_grid.getIndex(i, j)];
+      if (isInflationSource(cost)) {
+        tile_seeds_x_.push_back(i);
+      }
+    }
+  }
+  tile_seeds_row_start_.push_back(tile_seeds_x_.size());
+
+  current_ = true;
+  return true;
+}
+
+void
+InflationLayer::updateTile(
+  nav2_costmap_2d::Costmap2D & master_grid, int min_i, int min_j,
+  int max_i,
+  int max_j)
+{
+  if (useDistanceTransform()) {
+    applyDistanceField(master_grid, min_i, min_j, max_i, max_j);
+    return;
+  }
+
+  unsigned char * master_array = master_grid.getCharMap();
+  const int r = static_cast<int>(cell_inflation_radius_);
+
+  // Only obstacles within the inflation radius of the tile can affect it, and the
+  // wavefront from them to a tile cell stays within the tile expanded by that radius
+  const int rows = static_cast<int>(tile_seeds_row_start_.size()) - 1;
+  const int region_min_i = std::max(0, min_i - r);
+  const int region_min_j = std::max(tile_seeds_min_j_, min_j - r);
+  const int region_max_i = std::min(static_cast<int>(master_grid.getSizeInCellsX()), max_i + r);
+  const int region_max_j = std::min(tile_seeds_min_j_ + rows, max_j + r);
+  if (region_max_i <= region_min_i || region_max_j <= region_min_j) {
+    return;
+  }
+
+  const unsigned int region_size_x = region_max_i - region_min_i;
+  const unsigned int region_size_y = region_max_j - region_min_j;
+  std::vector<bool> seen(region_size_x * region_size_y, false);
+  std::vector<std::vector<CellData>> inflation_cells(inflation_cells_.size());
+
+  for (int j = region_min_j; j < region_max_j; j++) {
+    const int row = j - tile_seeds_min_j_;
+    auto it = std::lower_bound(
+      tile_seeds_x_.begin() + tile_seeds_row_start_[row],
+      tile_seeds_x_.begin() + tile_seeds_row_start_[row + 1],
+      static_cast<unsigned int>(region_min_i));
+    auto end = tile_seeds_x_.begin() + tile_seeds_row_start_[row + 1];
+    for (; it != end && static_cast<int>(*it) < region_max_i; ++it) {
+      inflation_cells[0].emplace_back(*it, j, *it, j);
+    }
+  }
+
+  const unsigned int cache_r = cell_inflation_radius_ + 2;
+  auto enqueue_cell = [&](
+    unsigned int region_index, unsigned int mx, unsigned int my,
+    unsigned int src_x, unsigned int src_y)
+    {
+      if (seen[region_index] || distanceLookup(mx, my, src_x, src_y) > cell_inflation_radius_) {
+        return;
+      }
+      const auto dist = distance_matrix_[mx - src_x + cache_r][my - src_y + cache_r];
+      inflation_cells[dist].emplace_back(mx, my, src_x, src_y);
+    };
+
+  // Same wavefront as in updateCosts(), bounded to the region of this tile
+  for (auto & dist_bin : inflation_cells) {
+    for (std::size_t i = 0; i < dist_bin.size(); ++i) {
+      const CellData & cell = dist_bin[i];
+      unsigned int mx = cell.x_;
+      unsigned int my = cell.y_;
+      unsigned int sx = cell.src_x_;
+      unsigned int sy = cell.src_y_;
+      unsigned int region_index = (my - region_min_j) * region_size_x + (mx - region_min_i);
+
+      if (seen[region_index]) {
+        continue;
+      }
+
+      seen[region_index] = true;
+
+      if (static_cast<int>(mx) >= min_i && static_cast<int>(my) >= min_j &&
+        static_cast<int>(mx) < max_i && static_cast<int>(my) < max_j)
+      {
+        unsigned int index = master_grid.getIndex(mx, my);
+        unsigned char cost = costLookup(mx, my, sx, sy);
+        unsigned char old_cost = master_array[index];
+        if (old_cost == NO_INFORMATION &&
+          (inflate_unknown_ ? (cost > FREE_SPACE) : (cost >= INSCRIBED_INFLATED_OBSTACLE)))
+        {
+          master_array[index] = cost;
+        } else {
+          master_array[index] = std::max(old_cost, cost);
+        }
+      }
+
+      if (static_cast<int>(mx) > region_min_i) {
+        enqueue_cell(region_index - 1, mx - 1, my, sx, sy);
+      }
+      if (static_cast<int>(my) > region_min_j) {
+        enqueue_cell(region_index - region_size_x, mx, my - 1, sx, sy);
+      }
+      if (static_cast<int>(mx) < region_max_i - 1) {
+        enqueue_cell(region_index + 1, mx + 1, my, sx, sy);
+      }
+      if (static_cast<int>(my) < region_max_j - 1) {
+        enqueue_cell(region_index + region_size_x, mx, my + 1, sx, sy);
+      }
+    }
+    dist_bin = std::vector<CellData>();
+  }
+}
+
+void
+InflationLayer::endTiledUpdate(nav2_costmap_2d::Costmap2D & /*master_grid*/)
+{
+  tile_seeds_x_.clear();
+  tile_seeds_row_start_.clear();
+  if (tile_lock_.owns_lock()) {
+    tile_lock_.unlock();
+  }
+}
+
+bool
+InflationLayer::useDistanceTransform() const
+{
+  // Squared distances, clamped one past the squared radius, are stored in 16 bits
+  return engine_ == InflationEngine::DISTANCE_TRANSFORM &&
+         cell_inflation_radius_ * cell_inflation_radius_ + 1 <=
+         std::numeric_limits<uint16_t>::max();
+}
+
+void
+InflationLayer::updateDistanceField(
+  nav2_costmap_2d::Costmap2D & master_grid, int min_i, int min_j,
+  int max_i,
+  int max_j)
+{
+  unsigned char * master_array = master_grid.getCharMap();
+  const int size_x = static_cast<int>(master_grid.getSizeInCellsX());
+  const int size_y = static_cast<int>(master_grid.getSizeInCellsY());
+  const int r = static_cast<int>(cell_inflation_radius_);
+  const uint16_t max_sq_distance = static_cast<uint16_t>(r * r + 1);
+  const std::size_t size = static_cast<std::size_t>(size_x) * size_y;
+
+  // The field is kept per cell of the master grid, so it starts over from an empty
+  // map whenever the grid is resized or a rolling window moves its origin
+  if (!distance_field_valid_ || distance_field_.size() != size ||
+    master_grid.getOriginX() != distance_field_origin_x_ ||
+    master_grid.getOriginY() != distance_field_origin_y_)
+  {
+    distance_field_.assign(size, max_sq_distance);
+    distance_field_origin_x_ = master_grid.getOriginX();
+    distance_field_origin_y_ = master_grid.getOriginY();
+    distance_field_valid_ = true;
+  }
+
+  // Obstacles up to the inflation radius outside of the window influence costs inside of it
+  const int scan_min_i = std::max(0, min_i - r);
+  const int scan_min_j = std::max(0, min_j - r);
+  const int scan_max_i = std::min(size_x, max_i + r);
+  const int scan_max_j = std::min(size_y, max_j + r);
+
+  // Find the cells which became or stopped being obstacles since the last update
+  int changed_min_i = size_x, changed_min_j = size_y, changed_max_i = -1, changed_max_j = -1;
+  for (int j = scan_min_j; j < scan_max_j; j++) {
+    const std::size_t row = static_cast<std::size_t>(j) * size_x;
+    for (int i = scan_min_i; i < scan_max_i; i++) {
+      if (isInflationSource(master_array[row + i]) != (distance_field_[row + i] == 0)) {
+        changed_min_i = std::min(changed_min_i, i);
+        changed_min_j = std::min(changed_min_j, j);
+        changed_max_i = std::max(changed_max_i, i);
+        changed_max_j = std::max(changed_max_j, j);
+      }
+    }
+  }
+
+  if (changed_max_i < 0) {
+    return;
+  }
+
+  // Distances can only change within the inflation radius of those cells, and depend
+  // on obstacles at most the inflation radius further away
+  const int dirty_min_i = std::max(0, changed_min_i - r);
+  const int dirty_min_j = std::max(0, changed_min_j - r);
+  const int dirty_max_i = std::min(size_x, changed_max_i + 1 + r);
+  const int dirty_max_j = std::min(size_y, changed_max_j + 1 + r);
+  const int src_min_i = std::max(0, dirty_min_i - r);
+  const int src_min_j = std::max(0, dirty_min_j - r);
+  const int src_max_i = std::min(size_x, dirty_max_i + r);
+  const int src_max_j = std::min(size_y, dirty_max_j + r);
+  const unsigned int src_size_x = src_max_i - src_min_i;
+  const unsigned int src_size_y = src_max_j - src_min_j;
+
+  transform_obstacles_.resize(static_cast<std::size_t>(src_size_x) * src_size_y);
+  transform_sq_distances_.resize(transform_obstacles_.size());
+  for (int j = src_min_j; j < src_max_j; j++) {
+    const std::size_t row = static_cast<std::size_t>(j) * size_x;
+    uint8_t * obstacles = &transform_obstacles_[static_cast<std::size_t>(j - src_min_j) *
+      src_size_x];
+    const bool scanned_row = j >= scan_min_j && j < scan_max_j;
+    for (int i = src_min_i; i < src_max_i; i++) {
+      // Outside of the scanned area the master grid may hold costs written by this
+      // layer, so keep the obstacles the field already knows about there
+      if (scanned_row && i >= scan_min_i && i < scan_max_i) {
+        obstacles[i - src_min_i] = isInflationSource(master_array[row + i]);
+      } else {
+        obstacles[i - src_min_i] = distance_field_[row + i] == 0;
+      }
+    }
+  }
+
+  distance_transform_.compute(
+    transform_obstacles_.data(), src_size_x, src_size_y, max_sq_distance,
+    transform_sq_distances_.data(), layered_costmap_->getUpdateThreadPool());
+
+  for (int j = dirty_min_j; j < dirty_max_j; j++) {
+    const uint32_t * sq_distances = &transform_sq_distances_[
+      static_cast<std::size_t>(j - src_min_j) * src_size_x + (dirty_min_i - src_min_i)];
+    std::copy(
+      sq_distances, sq_distances + (dirty_max_i - dirty_min_i),
+      distance_field_.begin() + static_cast<std::size_t>(j) * size_x + dirty_min_i);
+  }
+}
+
+void
+InflationLayer::applyDistanceField(
+  nav2_costmap_2d::Costmap2D & master_grid, int min_i, int min_j,
+  int max_i,
+  int max_j)
+{
+  unsigned char * master_array = master_grid.getCharMap();
+  const std::size_t size_x = master_grid.getSizeInCellsX();
+  const uint32_t max_inflated_sq_distance = cell_inflation_radius_ * cell_inflation_radius_;
+
+  for (int j = min_j; j < max_j; j++) {
+    const std::size_t row = static_cast<std::size_t>(j) * size_x;
+    for (int i = min_i; i < max_i; i++) {
+      const uint16_t sq_distance = distance_field_[row + i];
+      if (sq_distance > max_inflated_sq_distance) {
+        continue;
+      }
+
+      // Same rule as the wavefront for combining with the existing cost
+      const unsigned char cost = cached_sq_distance_costs_[sq_distance];
+      const unsigned char old_cost = master_array[row + i];
+      if (old_cost == NO_INFORMATION &&
+        (inflate_unknown_ ? (cost > FREE_SPACE) : (cost >= INSCRIBED_INFLATED_OBSTACLE)))
+      {
+        master_array[row + i] = cost;
+      } else {
+        master_array[row + i] = std::max(old_cost, cost);
+      }
+    }
+  }
+}
+
 /**
  * @brief  Given an index of a cell in the costmap, place it into a list pending for obstacle inflation
  * @param  grid The costmap
@@ -386,6 +711,20 @@ InflationLayer::computeCaches()
   int max_dist = generateIntegerDistances();
   inflation_cells_.clear();
   inflation_cells_.resize(max_dist + 1);
+
+  if (engine_ == InflationEngine::DISTANCE_TRANSFORM) {
+    if (useDistanceTransform()) {
+      const unsigned int max_sq_distance = cell_inflation_radius_ * cell_inflation_radius_;
+      cached_sq_distance_costs_.resize(max_sq_distance + 1);
+      for (unsigned int sq_distance = 0; sq_distance <= max_sq_distance; ++sq_distance) {
+        cached_sq_distance_costs_[sq_distance] = computeCost(std::sqrt(sq_distance));
+      }
+    } else {
+      RCLCPP_WARN(
+        logger_, "Inflation radius of %u cells is too large for the distance transform "
+        "engine of %s, using the wavefront", cell_inflation_radius_, name_.c_str());
+    }
+  }
 }
 
 int
@@ -476,6 +815,7 @@ InflationLayer::dynamicParametersCallback(
         inflate_around_unknown_ != parameter.as_bool())
       {
         inflate_around_unknown_ = parameter.as_bool();
+        distance_field_valid_ = false;
         need_reinflation_ = true;
       }
     }
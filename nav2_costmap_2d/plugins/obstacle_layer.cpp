@@ -39,6 +39,7 @@
 #include "nav2_costmap_2d/obstacle_layer.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <string>
 #include <vector>
@@ -61,6 +62,9 @@ using rcl_interfaces::msg::ParameterType;
 namespace nav2_costmap_2d
 {
 
+// Most clearing bins an observation may be split into, beyond which every point is traced
+static constexpr double MAX_RAYTRACE_BINS = 1 << 20;
+
 ObstacleLayer::~ObstacleLayer()
 {
   auto node = node_.lock();
@@ -86,6 +90,8 @@ void ObstacleLayer::onInitialize()
   declareParameter("min_obstacle_height", rclcpp::ParameterValue(0.0));
   declareParameter("max_obstacle_height", rclcpp::ParameterValue(2.0));
   declareParameter("combination_method", rclcpp::ParameterValue(1));
+  declareParameter("raytrace_angular_resolution", rclcpp::ParameterValue(0.0));
+  declareParameter("raytrace_range_resolution", rclcpp::ParameterValue(0.0));
   declareParameter("observation_sources", rclcpp::ParameterValue(std::string("")));
 
   auto node = node_.lock();
@@ -97,6 +103,22 @@ void ObstacleLayer::onInitialize()
   node->get_parameter(name_ + "." + "footprint_clearing_enabled", footprint_clearing_enabled_);
   node->get_parameter(name_ + "." + "min_obstacle_height", min_obstacle_height_);
   node->get_parameter(name_ + "." + "max_obstacle_height", max_obstacle_height_);
+  node->get_parameter(
+    name_ + "." + "raytrace_angular_resolution", raytrace_angular_resolution_);
+  node->get_parameter(name_ + "." + "raytrace_range_resolution", raytrace_range_resolution_);
+  if (!(raytrace_angular_resolution_ >= 0.0) || std::isinf(raytrace_angular_resolution_)) {
+    RCLCPP_WARN(
+      logger_, "raytrace_angular_resolution must be a positive value, or 0 to trace a ray "
+      "to every point, but %f was given. Tracing a ray to every point.",
+      raytrace_angular_resolution_);
+    raytrace_angular_resolution_ = 0.0;
+  }
+  if (!(raytrace_range_resolution_ >= 0.0) || std::isinf(raytrace_range_resolution_)) {
+    RCLCPP_WARN(
+      logger_, "raytrace_range_resolution must be a positive value, or 0 for one bin per "
+      "angle, but %f was given. Using one bin per angle.", raytrace_range_resolution_);
+    raytrace_range_resolution_ = 0.0;
+  }
   node->get_parameter("track_unknown_space", track_unknown_space);
   node->get_parameter("transform_tolerance", transform_tolerance);
   node->get_parameter(name_ + "." + "observation_sources", topics_string);
@@ -351,6 +373,7 @@ ObstacleLayer::dynamicParametersCallback(
 {
   std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
   rcl_interfaces::msg::SetParametersResult result;
+  result.successful = true;
 
   for (auto parameter : parameters) {
     const auto & param_type = parameter.get_type();
@@ -364,6 +387,21 @@ ObstacleLayer::dynamicParametersCallback(
         min_obstacle_height_ = parameter.as_double();
       } else if (param_name == name_ + "." + "max_obstacle_height") {
         max_obstacle_height_ = parameter.as_double();
+      } else if (param_name == name_ + "." + "raytrace_angular_resolution" ||
+        param_name == name_ + "." + "raytrace_range_resolution")
+      {
+        // only positive bin widths enable binning, 0 disables it
+        const double resolution = parameter.as_double();
+        if (!(resolution >= 0.0) || std::isinf(resolution)) {
+          RCLCPP_ERROR(
+            logger_, "You try to set %s to %f, only positive values or 0 are allowed.",
+            param_name.c_str(), resolution);
+          result.successful = false;
+        } else if (param_name == name_ + "." + "raytrace_angular_resolution") {
+          raytrace_angular_resolution_ = resolution;
+        } else {
+          raytrace_range_resolution_ = resolution;
+        }
       }
     } else if (param_type == ParameterType::PARAMETER_BOOL) {
       if (param_name == name_ + "." + "enabled" && enabled_ != parameter.as_bool()) {
@@ -381,7 +419,6 @@ ObstacleLayer::dynamicParametersCallback(
     }
   }
 
-  result.successful = true;
   return result;
 }
 
@@ -390,20 +427,20 @@ ObstacleLayer::laserScanCallback(
   sensor_msgs::msg::LaserScan::ConstSharedPtr message,
   const std::shared_ptr<nav2_costmap_2d::ObservationBuffer> & buffer)
 {
-  // project the laser into a point cloud
-  sensor_msgs::msg::PointCloud2 cloud;
-  cloud.header = message->header;
+  // project the laser into a point cloud, shared with the buffer without copying
+  auto cloud = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  cloud->header = message->header;
 
   // project the scan into a point cloud
   try {
-    projector_.transformLaserScanToPointCloud(message->header.frame_id, *message, cloud, *tf_);
+    projector_.transformLaserScanToPointCloud(message->header.frame_id, *message, *cloud, *tf_);
   } catch (tf2::TransformException & ex) {
     RCLCPP_WARN(
       logger_,
       "High fidelity enabled, but TF returned a transform exception to frame %s: %s",
       global_frame_.c_str(),
       ex.what());
-    projector_.projectLaser(*message, cloud);
+    projector_.projectLaser(*message, *cloud);
   } catch (std::runtime_error & ex) {
     RCLCPP_WARN(
       logger_,
@@ -434,19 +471,19 @@ ObstacleLayer::laserScanValidInfCallback(
     }
   }
 
-  // project the laser into a point cloud
-  sensor_msgs::msg::PointCloud2 cloud;
-  cloud.header = message.header;
+  // project the laser into a point cloud, shared with the buffer without copying
+  auto cloud = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  cloud->header = message.header;
 
   // project the scan into a point cloud
   try {
-    projector_.transformLaserScanToPointCloud(message.header.frame_id, message, cloud, *tf_);
+    projector_.transformLaserScanToPointCloud(message.header.frame_id, message, *cloud, *tf_);
   } catch (tf2::TransformException & ex) {
     RCLCPP_WARN(
       logger_,
       "High fidelity enabled, but TF returned a transform exception to frame %s: %s",
       global_frame_.c_str(), ex.what());
-    projector_.projectLaser(message, cloud);
+    projector_.projectLaser(message, *cloud);
   } catch (std::runtime_error & ex) {
     RCLCPP_WARN(
       logger_,
@@ -467,9 +504,9 @@ ObstacleLayer::pointCloud2Callback(
   sensor_msgs::msg::PointCloud2::ConstSharedPtr message,
   const std::shared_ptr<ObservationBuffer> & buffer)
 {
-  // buffer the point cloud
+  // buffer the point cloud, sharing the message rather than copying it
   buffer->lock();
-  buffer->bufferCloud(*message);
+  buffer->bufferCloud(message);
   buffer->unlock();
 }
 
@@ -589,9 +626,21 @@ ObstacleLayer::updateCosts(
   int max_i,
   int max_j)
 {
-  std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
+  if (beginTiledUpdate(master_grid, min_i, min_j, max_i, max_j)) {
+    updateTile(master_grid, min_i, min_j, max_i, max_j);
+  }
+  endTiledUpdate(master_grid);
+}
+
+bool
+ObstacleLayer::beginTiledUpdate(
+  nav2_costmap_2d::Costmap2D & /*master_grid*/, int /*min_i*/, int /*min_j*/,
+  int /*max_i*/,
+  int /*max_j*/)
+{
+  tile_lock_ = std::unique_lock<Costmap2D::mutex_t>(*getMutex());
   if (!enabled_) {
-    return;
+    return false;
   }
 
   // if not current due to reset, set current now after clearing
@@ -603,7 +652,15 @@ ObstacleLayer::updateCosts(
   if (footprint_clearing_enabled_) {
     setConvexPolygonCost(transformed_footprint_, nav2_costmap_2d::FREE_SPACE);
   }
+  return true;
+}
 
+void
+ObstacleLayer::updateTile(
+  nav2_costmap_2d::Costmap2D & master_grid, int min_i, int min_j,
+  int max_i,
+  int max_j)
+{
   switch (combination_method_) {
     case CombinationMethod::Overwrite:
       updateWithOverwrite(master_grid, min_i, min_j, max_i, max_j);
@@ -619,6 +676,34 @@ ObstacleLayer::updateCosts(
   }
 }
 
+bool
+ObstacleLayer::getTileBlend(BlendMode & mode, const unsigned char * & costs)
+{
+  switch (combination_method_) {
+    case CombinationMethod::Overwrite:
+      mode = BlendMode::Overwrite;
+      break;
+    case CombinationMethod::Max:
+      mode = BlendMode::Max;
+      break;
+    case CombinationMethod::MaxWithoutUnknownOverwrite:
+      mode = BlendMode::MaxWithoutUnknownOverwrite;
+      break;
+    default:  // Nothing
+      return false;
+  }
+  costs = costmap_;
+  return true;
+}
+
+void
+ObstacleLayer::endTiledUpdate(nav2_costmap_2d::Costmap2D & /*master_grid*/)
+{
+  if (tile_lock_.owns_lock()) {
+    tile_lock_.unlock();
+  }
+}
+
 void
 ObstacleLayer::addStaticObservation(
   nav2_costmap_2d::Observation & obs,
@@ -709,63 +794,150 @@ ObstacleLayer::raytraceFreespace(
 
   touch(ox, oy, min_x, min_y, max_x, max_y);
 
-  // for each point in the cloud, we want to trace a line from the origin
+  unsigned int cell_raytrace_max_range = cellDistance(clearing_observation.raytrace_max_range_);
+  unsigned int cell_raytrace_min_range = cellDistance(clearing_observation.raytrace_min_range_);
+  MarkCell marker(costmap_, FREE_SPACE);
+
+  // trace a line from the origin to an endpoint and clear obstacles along it
+  auto raytrace = [&](double wx, double wy) {
+      // now we also need to make sure that the endpoint we're raytracing
+      // to isn't off the costmap and scale if necessary
+      double a = wx - ox;
+      double b = wy - oy;
+
+      // the minimum value to raytrace from is the origin
+      if (wx < origin_x) {
+        double t = (origin_x - ox) / a;
+        wx = origin_x;
+        wy = oy + b * t;
+      }
+      if (wy < origin_y) {
+        double t = (origin_y - oy) / b;
+        wx = ox + a * t;
+        wy = origin_y;
+      }
+
+      // the maximum value to raytrace to is the end of the map
+      if (wx > map_end_x) {
+        double t = (map_end_x - ox) / a;
+        wx = map_end_x - .001;
+        wy = oy + b * t;
+      }
+      if (wy > map_end_y) {
+        double t = (map_end_y - oy) / b;
+        wx = ox + a * t;
+        wy = map_end_y - .001;
+      }
+
+      // now that the vector is scaled correctly... we'll get the map coordinates of its endpoint
+      unsigned int x1, y1;
+
+      // check for legality just in case
+      if (!worldToMap(wx, wy, x1, y1)) {
+        return;
+      }
+
+      // and finally... we can execute our trace to clear obstacles along that line
+      raytraceLine(marker, x0, y0, x1, y1, cell_raytrace_max_range, cell_raytrace_min_range);
+
+      updateRaytraceBounds(
+        ox, oy, wx, wy, clearing_observation.raytrace_max_range_,
+        clearing_observation.raytrace_min_range_, min_x, min_y, max_x,
+        max_y);
+    };
+
+  // if binning, we trace a single line to the farthest point of each bin
+  if (raytrace_angular_resolution_ > 0.0 &&
+    binClearingPoints(clearing_observation, raytrace_endpoints_))
+  {
+    for (const auto & endpoint : raytrace_endpoints_) {
+      raytrace(endpoint.first, endpoint.second);
+    }
+    return;
+  }
+
+  // otherwise, for each point in the cloud, we want to trace a line from the origin
   // and clear obstacles along it
   sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x");
   sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
 
   for (; iter_x != iter_x.end(); ++iter_x, ++iter_y) {
-    double wx = *iter_x;
-    double wy = *iter_y;
-
-    // now we also need to make sure that the endpoint we're raytracing
-    // to isn't off the costmap and scale if necessary
-    double a = wx - ox;
-    double b = wy - oy;
-
-    // the minimum value to raytrace from is the origin
-    if (wx < origin_x) {
-      double t = (origin_x - ox) / a;
-      wx = origin_x;
-      wy = oy + b * t;
-    }
-    if (wy < origin_y) {
-      double t = (origin_y - oy) / b;
-      wx = ox + a * t;
-      wy = origin_y;
-    }
+    raytrace(*iter_x, *iter_y);
+  }
+}
 
-    // the maximum value to raytrace to is the end of the map
-    if (wx > map_end_x) {
-      double t = (map_end_x - ox) / a;
-      wx = map_end_x - .001;
-      wy = oy + b * t;
-    }
-    if (wy > map_end_y) {
-      double t = (map_end_y - oy) / b;
-      wx = ox + a * t;
-      wy = map_end_y - .001;
-    }
+bool
+ObstacleLayer::binClearingPoints(
+  const Observation & clearing_observation,
+  std::vector<std::pair<double, double>> & endpoints)
+{
+  const double ox = clearing_observation.origin_.x;
+  const double oy = clearing_observation.origin_.y;
+  const sensor_msgs::msg::PointCloud2 & cloud = *(clearing_observation.cloud_);
 
-    // now that the vector is scaled correctly... we'll get the map coordinates of its endpoint
-    unsigned int x1, y1;
+  // points beyond the raytrace range share the last range bin, as their rays are cut short
+  const double angular_bins_count =
+    std::max(1.0, std::ceil(2.0 * M_PI / raytrace_angular_resolution_));
+  double range_bins_count = 1.0;
+  if (raytrace_range_resolution_ > 0.0) {
+    range_bins_count = std::floor(
+      std::max(clearing_observation.raytrace_max_range_, 0.0) / raytrace_range_resolution_) + 1.0;
+  }
+  if (!(angular_bins_count * range_bins_count <= MAX_RAYTRACE_BINS)) {
+    RCLCPP_WARN_THROTTLE(
+      logger_, *(clock_), 2000,
+      "Raytrace resolutions of %f rad and %f m give too many bins for a raytrace range of %f m,"
+      " tracing a ray to every point instead", raytrace_angular_resolution_,
+      raytrace_range_resolution_, clearing_observation.raytrace_max_range_);
+    return false;
+  }
+  const unsigned int angular_bins = static_cast<unsigned int>(angular_bins_count);
+  const unsigned int range_bins = static_cast<unsigned int>(range_bins_count);
+  const size_t num_bins = static_cast<size_t>(angular_bins) * range_bins;
+  if (raytrace_bins_.size() != num_bins) {
+    raytrace_bins_.assign(num_bins, RaytraceBin{-1.0, 0.0, 0.0});
+  }
+  raytrace_touched_bins_.clear();
 
-    // check for legality just in case
-    if (!worldToMap(wx, wy, x1, y1)) {
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
+  for (; iter_x != iter_x.end(); ++iter_x, ++iter_y) {
+    const double a = *iter_x - ox;
+    const double b = *iter_y - oy;
+    const double range_sq = a * a + b * b;
+    if (!std::isfinite(range_sq)) {
       continue;
     }
+    const unsigned int angle_bin = std::min(
+      static_cast<unsigned int>((std::atan2(b, a) + M_PI) / raytrace_angular_resolution_),
+      angular_bins - 1);
+    unsigned int range_bin = 0;
+    if (range_bins > 1) {
+      range_bin = static_cast<unsigned int>(
+        std::min(std::sqrt(range_sq) / raytrace_range_resolution_, range_bins_count - 1.0));
+    }
 
-    unsigned int cell_raytrace_max_range = cellDistance(clearing_observation.raytrace_max_range_);
-    unsigned int cell_raytrace_min_range = cellDistance(clearing_observation.raytrace_min_range_);
-    MarkCell marker(costmap_, FREE_SPACE);
-    // and finally... we can execute our trace to clear obstacles along that line
-    raytraceLine(marker, x0, y0, x1, y1, cell_raytrace_max_range, cell_raytrace_min_range);
+    const unsigned int index = angle_bin * range_bins + range_bin;
+    RaytraceBin & bin = raytrace_bins_[index];
+    if (bin.range_sq < 0.0) {
+      raytrace_touched_bins_.push_back(index);
+    }
+    if (range_sq > bin.range_sq) {
+      bin.range_sq = range_sq;
+      bin.x = *iter_x;
+      bin.y = *iter_y;
+    }
+  }
 
-    updateRaytraceBounds(
-      ox, oy, wx, wy, clearing_observation.raytrace_max_range_,
-      clearing_observation.raytrace_min_range_, min_x, min_y, max_x,
-      max_y);
+  // collect the farthest points, resetting the bins for the next observation
+  endpoints.clear();
+  endpoints.reserve(raytrace_touched_bins_.size());
+  for (const unsigned int index : raytrace_touched_bins_) {
+    RaytraceBin & bin = raytrace_bins_[index];
+    endpoints.emplace_back(bin.x, bin.y);
+    bin.range_sq = -1.0;
   }
+  return true;
 }
 
 void
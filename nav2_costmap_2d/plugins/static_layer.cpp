@@ -397,9 +397,21 @@ StaticLayer::updateCosts(
   nav2_costmap_2d::Costmap2D & master_grid,
   int min_i, int min_j, int max_i, int max_j)
 {
-  std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
+  if (beginTiledUpdate(master_grid, min_i, min_j, max_i, max_j)) {
+    updateTile(master_grid, min_i, min_j, max_i, max_j);
+  }
+  endTiledUpdate(master_grid);
+}
+
+bool
+StaticLayer::beginTiledUpdate(
+  nav2_costmap_2d::Costmap2D & /*master_grid*/,
+  int /*min_i*/, int /*min_j*/, int /*max_i*/, int /*max_j*/)
+{
+  tile_lock_ = std::unique_lock<Costmap2D::mutex_t>(*getMutex());
+  map_region_to_restore_.clear();
   if (!enabled_) {
-    return;
+    return false;
   }
   if (!map_received_in_update_bounds_) {
     static int count = 0;
@@ -408,27 +420,17 @@ StaticLayer::updateCosts(
       RCLCPP_WARN(logger_, "Can't update static costmap layer, no map received");
       count = 0;
     }
-    return;
+    return false;
   }
 
-  std::vector<MapLocation> map_region_to_restore;
   if (footprint_clearing_enabled_) {
-    map_region_to_restore.reserve(100);
-    getMapRegionOccupiedByPolygon(transformed_footprint_, map_region_to_restore);
-    setMapRegionOccupiedByPolygon(map_region_to_restore, nav2_costmap_2d::FREE_SPACE);
+    map_region_to_restore_.reserve(100);
+    getMapRegionOccupiedByPolygon(transformed_footprint_, map_region_to_restore_);
+    setMapRegionOccupiedByPolygon(map_region_to_restore_, nav2_costmap_2d::FREE_SPACE);
   }
 
-  if (!layered_costmap_->isRolling()) {
-    // if not rolling, the layered costmap (master_grid) has same coordinates as this layer
-    if (!use_maximum_) {
-      updateWithTrueOverwrite(master_grid, min_i, min_j, max_i, max_j);
-    } else {
-      updateWithMax(master_grid, min_i, min_j, max_i, max_j);
-    }
-  } else {
+  if (layered_costmap_->isRolling()) {
     // If rolling window, the master_grid is unlikely to have same coordinates as this layer
-    unsigned int mx, my;
-    double wx, wy;
     // Might even be in a different frame
     geometry_msgs::msg::TransformStamped transform;
     try {
@@ -437,19 +439,38 @@ StaticLayer::updateCosts(
         transform_tolerance_);
     } catch (tf2::TransformException & ex) {
       RCLCPP_ERROR(logger_, "StaticLayer: %s", ex.what());
-      return;
+      return false;
     }
-    // Copy map data given proper transformations
-    tf2::Transform tf2_transform;
-    tf2::fromMsg(transform.transform, tf2_transform);
+    tf2::fromMsg(transform.transform, update_transform_);
+  }
+
+  current_ = true;
+  return true;
+}
 
+void
+StaticLayer::updateTile(
+  nav2_costmap_2d::Costmap2D & master_grid,
+  int min_i, int min_j, int max_i, int max_j)
+{
+  if (!layered_costmap_->isRolling()) {
+    // if not rolling, the layered costmap (master_grid) has same coordinates as this layer
+    if (!use_maximum_) {
+      updateWithTrueOverwrite(master_grid, min_i, min_j, max_i, max_j);
+    } else {
+      updateWithMax(master_grid, min_i, min_j, max_i, max_j);
+    }
+  } else {
+    unsigned int mx, my;
+    double wx, wy;
+    // Copy map data given proper transformations
     for (int i = min_i; i < max_i; ++i) {
       for (int j = min_j; j < max_j; ++j) {
         // Convert master_grid coordinates (i,j) into global_frame_(wx,wy) coordinates
         layered_costmap_->getCostmap()->mapToWorld(i, j, wx, wy);
         // Transform from global_frame_ to map_frame_
         tf2::Vector3 p(wx, wy, 0);
-        p = tf2_transform * p;
+        p = update_transform_ * p;
         // Set master_grid with cell from map
         if (worldToMap(p.x(), p.y(), mx, my)) {
           if (!use_maximum_) {
@@ -461,12 +482,31 @@ StaticLayer::updateCosts(
       }
     }
   }
+}
+
+bool
+StaticLayer::getTileBlend(BlendMode & mode, const unsigned char * & costs)
+{
+  if (layered_costmap_->isRolling()) {
+    return false;
+  }
+  mode = use_maximum_ ? BlendMode::Max : BlendMode::TrueOverwrite;
+  costs = costmap_;
+  return true;
+}
 
+void
+StaticLayer::endTiledUpdate(nav2_costmap_2d::Costmap2D & /*master_grid*/)
+{
   if (footprint_clearing_enabled_ && restore_cleared_footprint_) {
     // restore the map region occupied by the polygon using cached data
-    restoreMapRegionOccupiedByPolygon(map_region_to_restore);
+    restoreMapRegionOccupiedByPolygon(map_region_to_restore_);
+  }
+  map_region_to_restore_.clear();
+
+  if (tile_lock_.owns_lock()) {
+    tile_lock_.unlock();
   }
-  current_ = true;
 }
 
 /**
@@ -44,10 +44,12 @@
 #include <memory>
 #include <utility>
 
+#include "nav2_util/thread_pool.hpp"
 #include "pluginlib/class_list_macros.hpp"
 #include "sensor_msgs/point_cloud2_iterator.hpp"
 
 #define VOXEL_BITS 16
+#define SPARSE_VOXEL_BITS 64
 PLUGINLIB_EXPORT_CLASS(nav2_costmap_2d::VoxelLayer, nav2_costmap_2d::Layer)
 
 using nav2_costmap_2d::NO_INFORMATION;
@@ -72,6 +74,7 @@ void VoxelLayer::onInitialize()
   declareParameter("mark_threshold", rclcpp::ParameterValue(0));
   declareParameter("combination_method", rclcpp::ParameterValue(1));
   declareParameter("publish_voxel_map", rclcpp::ParameterValue(false));
+  declareParameter("use_sparse_voxel_grid", rclcpp::ParameterValue(false));
 
   auto node = node_.lock();
   if (!node) {
@@ -87,6 +90,7 @@ void VoxelLayer::onInitialize()
   node->get_parameter(name_ + "." + "unknown_threshold", unknown_threshold_);
   node->get_parameter(name_ + "." + "mark_threshold", mark_threshold_);
   node->get_parameter(name_ + "." + "publish_voxel_map", publish_voxel_);
+  node->get_parameter(name_ + "." + "use_sparse_voxel_grid", use_sparse_voxel_grid_);
 
   int combination_method_param{};
   node->get_parameter(name_ + "." + "combination_method", combination_method_param);
@@ -102,7 +106,7 @@ void VoxelLayer::onInitialize()
     "clearing_endpoints", nav2::qos::LatchedPublisherQoS());
   clearing_endpoints_pub_->on_activate();
 
-  unknown_threshold_ += (VOXEL_BITS - size_z_);
+  unknown_threshold_ += ((use_sparse_voxel_grid_ ? SPARSE_VOXEL_BITS : VOXEL_BITS) - size_z_);
   matchSize();
 
   // Add callback for dynamic parameters
@@ -125,8 +129,14 @@ void VoxelLayer::matchSize()
 {
   std::lock_guard<Costmap2D::mutex_t> guard(*getMutex());
   ObstacleLayer::matchSize();
-  voxel_grid_.resize(size_x_, size_y_, size_z_);
-  assert(voxel_grid_.sizeX() == size_x_ && voxel_grid_.sizeY() == size_y_);
+  if (use_sparse_voxel_grid_) {
+    voxel_grid_.resize(0, 0, 0);
+    sparse_voxel_grid_.resize(size_x_, size_y_, size_z_);
+    assert(sparse_voxel_grid_.sizeX() == size_x_ && sparse_voxel_grid_.sizeY() == size_y_);
+  } else {
+    voxel_grid_.resize(size_x_, size_y_, size_z_);
+    assert(voxel_grid_.sizeX() == size_x_ && voxel_grid_.sizeY() == size_y_);
+  }
 }
 
 void VoxelLayer::reset()
@@ -144,6 +154,7 @@ void VoxelLayer::resetMaps()
   // doesn't implement this, so it actually goes all the way to Costmap2D
   ObstacleLayer::resetMaps();
   voxel_grid_.reset();
+  sparse_voxel_grid_.reset();
 }
 
 void VoxelLayer::updateBounds(
@@ -224,7 +235,7 @@ void VoxelLayer::updateBounds(
       }
 
       // mark the cell in the voxel grid and check if we should also mark it in the costmap
-      if (voxel_grid_.markVoxelInMap(mx, my, mz, mark_threshold_)) {
+      if (markVoxelInMap(mx, my, mz)) {
         unsigned int index = getIndex(mx, my);
 
         costmap_[index] = LETHAL_OBSTACLE;
@@ -237,12 +248,21 @@ void VoxelLayer::updateBounds(
 
   if (publish_voxel_) {
     auto grid_msg = std::make_unique<nav2_msgs::msg::VoxelGrid>();
-    unsigned int size = voxel_grid_.sizeX() * voxel_grid_.sizeY();
-    grid_msg->size_x = voxel_grid_.sizeX();
-    grid_msg->size_y = voxel_grid_.sizeY();
-    grid_msg->size_z = voxel_grid_.sizeZ();
-    grid_msg->data.resize(size);
-    memcpy(&grid_msg->data[0], voxel_grid_.getData(), size * sizeof(unsigned int));
+    if (use_sparse_voxel_grid_) {
+      // the message holds 16 z voxels per column, so only the lowest are published
+      grid_msg->size_x = sparse_voxel_grid_.sizeX();
+      grid_msg->size_y = sparse_voxel_grid_.sizeY();
+      grid_msg->size_z = std::min<unsigned int>(sparse_voxel_grid_.sizeZ(), VOXEL_BITS);
+      grid_msg->data.resize(grid_msg->size_x * grid_msg->size_y);
+      sparse_voxel_grid_.getDenseData(grid_msg->data.data());
+    } else {
+      unsigned int size = voxel_grid_.sizeX() * voxel_grid_.sizeY();
+      grid_msg->size_x = voxel_grid_.sizeX();
+      grid_msg->size_y = voxel_grid_.sizeY();
+      grid_msg->size_z = voxel_grid_.sizeZ();
+      grid_msg->data.resize(size);
+      memcpy(&grid_msg->data[0], voxel_grid_.getData(), size * sizeof(unsigned int));
+    }
 
     grid_msg->origin.x = origin_x_;
     grid_msg->origin.y = origin_y_;
@@ -322,6 +342,10 @@ void VoxelLayer::raytraceFreespace(
   double map_end_y = origin_y_ + getSizeInMetersY();
   double map_end_z = origin_z_ + getSizeInMetersZ();
 
+  unsigned int cell_raytrace_max_range = cellDistance(clearing_observation.raytrace_max_range_);
+  unsigned int cell_raytrace_min_range = cellDistance(clearing_observation.raytrace_min_range_);
+  clearing_rays_.clear();
+
   sensor_msgs::PointCloud2ConstIterator<float> iter_x(*(clearing_observation.cloud_), "x");
   sensor_msgs::PointCloud2ConstIterator<float> iter_y(*(clearing_observation.cloud_), "y");
   sensor_msgs::PointCloud2ConstIterator<float> iter_z(*(clearing_observation.cloud_), "z");
@@ -375,16 +399,7 @@ void VoxelLayer::raytraceFreespace(
 
     double point_x, point_y, point_z;
     if (worldToMap3DFloat(wpx, wpy, wpz, point_x, point_y, point_z)) {
-      unsigned int cell_raytrace_max_range = cellDistance(clearing_observation.raytrace_max_range_);
-      unsigned int cell_raytrace_min_range = cellDistance(clearing_observation.raytrace_min_range_);
-
-
-      // voxel_grid_.markVoxelLine(sensor_x, sensor_y, sensor_z, point_x, point_y, point_z);
-      voxel_grid_.clearVoxelLineInMap(
-        sensor_x, sensor_y, sensor_z, point_x, point_y, point_z,
-        costmap_,
-        unknown_threshold_, mark_threshold_, FREE_SPACE, NO_INFORMATION,
-        cell_raytrace_max_range, cell_raytrace_min_range);
+      clearing_rays_.push_back({sensor_x, sensor_y, sensor_z, point_x, point_y, point_z});
 
       updateRaytraceBounds(
         ox, oy, wpx, wpy, clearing_observation.raytrace_max_range_,
@@ -404,6 +419,8 @@ void VoxelLayer::raytraceFreespace(
     }
   }
 
+  clearRays(cell_raytrace_max_range, cell_raytrace_min_range);
+
   if (publish_clearing_points) {
     clearing_endpoints_->header.frame_id = global_frame_;
     clearing_endpoints_->header.stamp = clearing_observation.cloud_->header.stamp;
@@ -412,6 +429,50 @@ void VoxelLayer::raytraceFreespace(
   }
 }
 
+void VoxelLayer::clearRays(unsigned int max_length, unsigned int min_length)
+{
+  auto clear_strip = [&](unsigned int strip_min_x, unsigned int strip_max_x) {
+      for (const ClearingRay & ray : clearing_rays_) {
+        // skip rays which do not cross the strip
+        if (std::max(ray.x0, ray.x1) < strip_min_x || std::min(ray.x0, ray.x1) >= strip_max_x) {
+          continue;
+        }
+        if (use_sparse_voxel_grid_) {
+          sparse_voxel_grid_.clearVoxelLineInMap(
+            ray.x0, ray.y0, ray.z0, ray.x1, ray.y1, ray.z1, costmap_,
+            unknown_threshold_, mark_threshold_, FREE_SPACE, NO_INFORMATION,
+            max_length, min_length, strip_min_x, strip_max_x);
+        } else {
+          voxel_grid_.clearVoxelLineInMapRange(
+            ray.x0, ray.y0, ray.z0, ray.x1, ray.y1, ray.z1, costmap_,
+            unknown_threshold_, mark_threshold_, FREE_SPACE, NO_INFORMATION,
+            max_length, min_length, strip_min_x, strip_max_x);
+        }
+      }
+    };
+
+  nav2_util::ThreadPool * pool = layered_costmap_->getUpdateThreadPool();
+  if (!pool || pool->size() < 2 || clearing_rays_.size() < 2) {
+    clear_strip(0, size_x_);
+    return;
+  }
+
+  // Each strip of x cells is cleared by one thread, so columns are only written to by
+  // one thread at a time. Clearing only removes voxels, so the result does not depend on
+  // the order rays are cleared in. Strips are aligned to the blocks of the sparse grid
+  // as those are allocated on write, and a few strips per thread balance the load.
+  const unsigned int block = nav2_voxel_grid::SparseVoxelGrid::BLOCK_SIZE;
+  const unsigned int num_blocks = (size_x_ + block - 1) / block;
+  const unsigned int blocks_per_strip = std::max(1u, num_blocks / (4 * pool->size()));
+  const unsigned int strip_size = blocks_per_strip * block;
+  const unsigned int num_strips = (size_x_ + strip_size - 1) / strip_size;
+  pool->parallelFor(
+    num_strips, [&](std::size_t strip) {
+      const unsigned int strip_min_x = static_cast<unsigned int>(strip) * strip_size;
+      clear_strip(strip_min_x, std::min(strip_min_x + strip_size, size_x_));
+    });
+}
+
 void VoxelLayer::updateOrigin(double new_origin_x, double new_origin_y)
 {
   // project the new origin into the grid
@@ -439,6 +500,25 @@ void VoxelLayer::updateOrigin(double new_origin_x, double new_origin_y)
   unsigned int cell_size_x = upper_right_x - lower_left_x;
   unsigned int cell_size_y = upper_right_y - lower_left_y;
 
+  if (use_sparse_voxel_grid_) {
+    // the sparse grid shifts its columns in place, so only the costmap needs copying
+    unsigned char * local_map = new unsigned char[cell_size_x * cell_size_y];
+    copyMapRegion(
+      costmap_, lower_left_x, lower_left_y, size_x_, local_map, 0, 0, cell_size_x,
+      cell_size_x,
+      cell_size_y);
+    ObstacleLayer::resetMaps();
+    sparse_voxel_grid_.shift(cell_ox, cell_oy);
+
+    origin_x_ = new_grid_ox;
+    origin_y_ = new_grid_oy;
+    copyMapRegion(
+      local_map, 0, 0, cell_size_x, costmap_, lower_left_x - cell_ox, lower_left_y - cell_oy,
+      size_x_, cell_size_x, cell_size_y);
+    delete[] local_map;
+    return;
+  }
+
   // we need a map to store the obstacles in the window temporarily
   unsigned char * local_map = new unsigned char[cell_size_x * cell_size_y];
   unsigned int * local_voxel_map = new unsigned int[cell_size_x * cell_size_y];
@@ -526,7 +606,8 @@ VoxelLayer::dynamicParametersCallback(
         size_z_ = parameter.as_int();
         resize_map_needed = true;
       } else if (param_name == name_ + "." + "unknown_threshold") {
-        unknown_threshold_ = parameter.as_int() + (VOXEL_BITS - size_z_);
+        unknown_threshold_ = parameter.as_int() +
+          ((use_sparse_voxel_grid_ ? SPARSE_VOXEL_BITS : VOXEL_BITS) - size_z_);
       } else if (param_name == name_ + "." + "mark_threshold") {
         mark_threshold_ = parameter.as_int();
       } else if (param_name == name_ + "." + "combination_method") {
@@ -0,0 +1,329 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_costmap_2d/blend_kernels.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define NAV2_COSTMAP_2D_BLEND_X86
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define NAV2_COSTMAP_2D_BLEND_NEON
+#endif
+
+#include "nav2_costmap_2d/cost_values.hpp"
+
+namespace nav2_costmap_2d
+{
+
+namespace
+{
+
+// Layers blended in a single pass over a row of the master grid, more are done in groups
+constexpr unsigned int MAX_FUSED_LAYERS = 8;
+
+// Largest sum of the Addition mode, one below INSCRIBED_INFLATED_OBSTACLE
+constexpr unsigned char MAX_ADDITION = INSCRIBED_INFLATED_OBSTACLE - 1;
+
+/**
+ * @brief Blend one cost into a cell of the master grid. All modes are branch-free,
+ * NO_INFORMATION being handled by selects and by the wrap of 255 + 1 to 0.
+ */
+inline unsigned char blendCost(BlendMode mode, unsigned char master, unsigned char cost)
+{
+  switch (mode) {
+    case BlendMode::TrueOverwrite:
+      return cost;
+    case BlendMode::Overwrite:
+      return cost == NO_INFORMATION ? master : cost;
+    case BlendMode::Max:
+      // Shifting NO_INFORMATION to 0 makes it lose to any known cost on either side
+      return static_cast<unsigned char>(
+        std::max(static_cast<unsigned char>(master + 1), static_cast<unsigned char>(cost + 1)) - 1);
+    case BlendMode::MaxWithoutUnknownOverwrite:
+      // Only the layer's NO_INFORMATION is shifted to 0, the master's stays the maximum
+      return std::max(master, std::min(cost, static_cast<unsigned char>(cost + 1)));
+    case BlendMode::Addition:
+      {
+        const int sum = master + cost;
+        const unsigned char added =
+          sum > MAX_ADDITION ? MAX_ADDITION : static_cast<unsigned char>(sum);
+        const unsigned char known = master == NO_INFORMATION ? cost : added;
+        return cost == NO_INFORMATION ? master : known;
+      }
+  }
+  return master;
+}
+
+#if defined(NAV2_COSTMAP_2D_BLEND_X86)
+
+/**
+ * @brief Blend 32 costs into cells of the master grid using AVX2,
+ * with the same results as blendCost()
+ */
+__attribute__((target("avx2")))
+inline __m256i blendAVX2(BlendMode mode, __m256i master, __m256i cost)
+{
+  const __m256i one = _mm256_set1_epi8(1);
+  const __m256i unknown = _mm256_set1_epi8(static_cast<char>(NO_INFORMATION));
+  switch (mode) {
+    case BlendMode::TrueOverwrite:
+      return cost;
+    case BlendMode::Overwrite:
+      return _mm256_blendv_epi8(cost, master, _mm256_cmpeq_epi8(cost, unknown));
+    case BlendMode::Max:
+      return _mm256_sub_epi8(
+        _mm256_max_epu8(_mm256_add_epi8(master, one), _mm256_add_epi8(cost, one)), one);
+    case BlendMode::MaxWithoutUnknownOverwrite:
+      return _mm256_max_epu8(master, _mm256_min_epu8(cost, _mm256_add_epi8(cost, one)));
+    case BlendMode::Addition:
+      {
+        const __m256i added = _mm256_min_epu8(
+          _mm256_adds_epu8(master, cost), _mm256_set1_epi8(static_cast<char>(MAX_ADDITION)));
+        const __m256i known = _mm256_blendv_epi8(
+          added, cost, _mm256_cmpeq_epi8(master, unknown));
+        return _mm256_blendv_epi8(known, master, _mm256_cmpeq_epi8(cost, unknown));
+      }
+  }
+  return master;
+}
+
+/**
+ * @brief Blend rows of layer costs 32 cells at a time using AVX2.
+ * Only called after checking that the CPU supports AVX2.
+ */
+__attribute__((target("avx2")))
+void blendRowsAVX2(
+  BlendMode mode, unsigned char * master, const unsigned char * const * layers,
+  unsigned int num_layers, std::size_t n)
+{
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256i cells = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(master + i));
+    for (unsigned int k = 0; k < num_layers; ++k) {
+      cells = blendAVX2(
+        mode, cells, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(layers[k] + i)));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(master + i), cells);
+  }
+
+  const unsigned char * tails[MAX_FUSED_LAYERS];
+  for (unsigned int k = 0; k < num_layers; ++k) {
+    tails[k] = layers[k] + i;
+  }
+  blendRowsScalar(mode, master + i, tails, num_layers, n - i);
+}
+
+/**
+ * @brief Select the bytes of a where the mask is set and of b elsewhere.
+ * SSE2 has no blendv, which needs SSE4.1.
+ */
+inline __m128i selectSSE2(__m128i mask, __m128i a, __m128i b)
+{
+  return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/**
+ * @brief Blend 16 costs into cells of the master grid using SSE2, which every x86-64
+ * CPU supports, with the same results as blendCost()
+ */
+inline __m128i blendSSE2(BlendMode mode, __m128i master, __m128i cost)
+{
+  const __m128i one = _mm_set1_epi8(1);
+  const __m128i unknown = _mm_set1_epi8(static_cast<char>(NO_INFORMATION));
+  switch (mode) {
+    case BlendMode::TrueOverwrite:
+      return cost;
+    case BlendMode::Overwrite:
+      return selectSSE2(_mm_cmpeq_epi8(cost, unknown), master, cost);
+    case BlendMode::Max:
+      return _mm_sub_epi8(_mm_max_epu8(_mm_add_epi8(master, one), _mm_add_epi8(cost, one)), one);
+    case BlendMode::MaxWithoutUnknownOverwrite:
+      return _mm_max_epu8(master, _mm_min_epu8(cost, _mm_add_epi8(cost, one)));
+    case BlendMode::Addition:
+      {
+        const __m128i added = _mm_min_epu8(
+          _mm_adds_epu8(master, cost), _mm_set1_epi8(static_cast<char>(MAX_ADDITION)));
+        const __m128i known = selectSSE2(_mm_cmpeq_epi8(master, unknown), cost, added);
+        return selectSSE2(_mm_cmpeq_epi8(cost, unknown), master, known);
+      }
+  }
+  return master;
+}
+
+/**
+ * @brief Blend rows of layer costs 16 cells at a time using SSE2
+ */
+void blendRowsSSE2(
+  BlendMode mode, unsigned char * master, const unsigned char * const * layers,
+  unsigned int num_layers, std::size_t n)
+{
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m128i cells = _mm_loadu_si128(reinterpret_cast<const __m128i *>(master + i));
+    for (unsigned int k = 0; k < num_layers; ++k) {
+      cells = blendSSE2(
+        mode, cells, _mm_loadu_si128(reinterpret_cast<const __m128i *>(layers[k] + i)));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(master + i), cells);
+  }
+
+  const unsigned char * tails[MAX_FUSED_LAYERS];
+  for (unsigned int k = 0; k < num_layers; ++k) {
+    tails[k] = layers[k] + i;
+  }
+  blendRowsScalar(mode, master + i, tails, num_layers, n - i);
+}
+
+#elif defined(NAV2_COSTMAP_2D_BLEND_NEON)
+
+/**
+ * @brief Blend 16 costs into cells of the master grid using NEON,
+ * with the same results as blendCost()
+ */
+inline uint8x16_t blendNEON(BlendMode mode, uint8x16_t master, uint8x16_t cost)
+{
+  const uint8x16_t one = vdupq_n_u8(1);
+  const uint8x16_t unknown = vdupq_n_u8(NO_INFORMATION);
+  switch (mode) {
+    case BlendMode::TrueOverwrite:
+      return cost;
+    case BlendMode::Overwrite:
+      return vbslq_u8(vceqq_u8(cost, unknown), master, cost);
+    case BlendMode::Max:
+      return vsubq_u8(vmaxq_u8(vaddq_u8(master, one), vaddq_u8(cost, one)), one);
+    case BlendMode::MaxWithoutUnknownOverwrite:
+      return vmaxq_u8(master, vminq_u8(cost, vaddq_u8(cost, one)));
+    case BlendMode::Addition:
+      {
+        const uint8x16_t added = vminq_u8(vqaddq_u8(master, cost), vdupq_n_u8(MAX_ADDITION));
+        const uint8x16_t known = vbslq_u8(vceqq_u8(master, unknown), cost, added);
+        return vbslq_u8(vceqq_u8(cost, unknown), master, known);
+      }
+  }
+  return master;
+}
+
+/**
+ * @brief Blend rows of layer costs 16 cells at a time using NEON
+ */
+void blendRowsNEON(
+  BlendMode mode, unsigned char * master, const unsigned char * const * layers,
+  unsigned int num_layers, std::size_t n)
+{
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    uint8x16_t cells = vld1q_u8(master + i);
+    for (unsigned int k = 0; k < num_layers; ++k) {
+      cells = blendNEON(mode, cells, vld1q_u8(layers[k] + i));
+    }
+    vst1q_u8(master + i, cells);
+  }
+
+  const unsigned char * tails[MAX_FUSED_LAYERS];
+  for (unsigned int k = 0; k < num_layers; ++k) {
+    tails[k] = layers[k] + i;
+  }
+  blendRowsScalar(mode, master + i, tails, num_layers, n - i);
+}
+
+#endif
+
+}  // namespace
+
+const char * blendKernelsName()
+{
+#if defined(NAV2_COSTMAP_2D_BLEND_X86)
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2 ? "avx2" : "sse2";
+#elif defined(NAV2_COSTMAP_2D_BLEND_NEON)
+  return "neon";
+#else
+  return "scalar";
+#endif
+}
+
+void blendRowsScalar(
+  BlendMode mode, unsigned char * master, const unsigned char * const * layers,
+  unsigned int num_layers, std::size_t n)
+{
+  for (std::size_t i = 0; i < n; ++i) {
+    unsigned char cell = master[i];
+    for (unsigned int k = 0; k < num_layers; ++k) {
+      cell = blendCost(mode, cell, layers[k][i]);
+    }
+    master[i] = cell;
+  }
+}
+
+void blendRows(
+  BlendMode mode, unsigned char * master, const unsigned char * const * layers,
+  unsigned int num_layers, std::size_t n)
+{
+  if (num_layers == 0) {
+    return;
+  }
+
+  // Only the last layer counts when overwriting everything
+  if (mode == BlendMode::TrueOverwrite) {
+    std::memcpy(master, layers[num_layers - 1], n);
+    return;
+  }
+
+  for (unsigned int k = 0; k < num_layers; k += MAX_FUSED_LAYERS) {
+    const unsigned int group = std::min(num_layers - k, MAX_FUSED_LAYERS);
+#if defined(NAV2_COSTMAP_2D_BLEND_X86)
+    static const bool has_avx2 = __builtin_cpu_supports("avx2");
+    if (has_avx2) {
+      blendRowsAVX2(mode, master, layers + k, group, n);
+    } else {
+      blendRowsSSE2(mode, master, layers + k, group, n);
+    }
+#elif defined(NAV2_COSTMAP_2D_BLEND_NEON)
+    blendRowsNEON(mode, master, layers + k, group, n);
+#else
+    blendRowsScalar(mode, master, layers + k, group, n);
+#endif
+  }
+}
+
+void blendWindow(
+  BlendMode mode, Costmap2D & master_grid, const unsigned char * const * layers,
+  unsigned int num_layers, int min_i, int min_j, int max_i, int max_j)
+{
+  if (min_i >= max_i || num_layers == 0) {
+    return;
+  }
+
+  unsigned char * master_array = master_grid.getCharMap();
+  const unsigned int span = master_grid.getSizeInCellsX();
+  const std::size_t n = static_cast<std::size_t>(max_i - min_i);
+
+  for (unsigned int k = 0; k < num_layers; k += MAX_FUSED_LAYERS) {
+    const unsigned int group = std::min(num_layers - k, MAX_FUSED_LAYERS);
+    const unsigned char * rows[MAX_FUSED_LAYERS];
+    for (int j = min_j; j < max_j; j++) {
+      const std::size_t it = static_cast<std::size_t>(j) * span + min_i;
+      for (unsigned int g = 0; g < group; ++g) {
+        rows[g] = layers[k + g] + it;
+      }
+      blendRows(mode, master_array + it, rows, group, n);
+    }
+  }
+}
+
+}  // namespace nav2_costmap_2d
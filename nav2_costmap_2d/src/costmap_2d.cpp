@@ -211,19 +211,20 @@ Costmap2D & Costmap2D::operator=(const Costmap2D & map)
     return *this;
   }
 
-  // clean up old data
-  deleteMaps();
+  // reuse the old data if it is the same size, such as when copying snapshots
+  if (costmap_ == NULL || size_x_ != map.size_x_ || size_y_ != map.size_y_) {
+    // clean up old data
+    deleteMaps();
+
+    // initialize our various maps
+    initMaps(map.size_x_, map.size_y_);
+  }
 
-  size_x_ = map.size_x_;
-  size_y_ = map.size_y_;
   resolution_ = map.resolution_;
   origin_x_ = map.origin_x_;
   origin_y_ = map.origin_y_;
   default_value_ = map.default_value_;
 
-  // initialize our various maps
-  initMaps(size_x_, size_y_);
-
   // copy the cost map
   memcpy(costmap_, map.costmap_, size_x_ * size_y_ * sizeof(unsigned char));
 
@@ -38,11 +38,14 @@
  *********************************************************************/
 #include "nav2_costmap_2d/costmap_2d_publisher.hpp"
 
+#include <cmath>
+#include <cstring>
 #include <string>
 #include <memory>
 #include <utility>
 
 #include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_compression.hpp"
 
 namespace nav2_costmap_2d
 {
@@ -55,13 +58,17 @@ Costmap2DPublisher::Costmap2DPublisher(
   std::string global_frame,
   std::string topic_name,
   bool always_send_full_costmap,
-  double map_vis_z)
+  double map_vis_z,
+  unsigned int compressed_tile_size,
+  unsigned int compressed_keyframe_interval)
 : costmap_(costmap),
   global_frame_(global_frame),
   topic_name_(topic_name),
   active_(false),
   always_send_full_costmap_(always_send_full_costmap),
-  map_vis_z_(map_vis_z)
+  map_vis_z_(map_vis_z),
+  compressed_tile_size_(compressed_tile_size),
+  compressed_keyframe_interval_(std::max(1u, compressed_keyframe_interval))
 {
   auto node = parent.lock();
   clock_ = node->get_clock();
@@ -78,6 +85,10 @@ Costmap2DPublisher::Costmap2DPublisher(
     topic_name + "_updates", nav2::qos::LatchedPublisherQoS());
   costmap_raw_update_pub_ = node->create_publisher<nav2_msgs::msg::CostmapUpdate>(
     topic_name + "_raw_updates", nav2::qos::LatchedPublisherQoS());
+  if (compressed_tile_size_ > 0) {
+    costmap_compressed_pub_ = node->create_publisher<nav2_msgs::msg::CompressedCostmap>(
+      topic_name + "_raw_compressed", nav2::qos::LatchedPublisherQoS());
+  }
 
   // Create a service that will use the callback function to handle requests.
   costmap_service_ = node->create_service<nav2_msgs::srv::GetCostmap>(
@@ -232,6 +243,136 @@ std::unique_ptr<nav2_msgs::msg::CostmapUpdate> Costmap2DPublisher::createCostmap
   return msg;
 }
 
+void Costmap2DPublisher::markDirtyTiles(
+  unsigned int x0, unsigned int xn, unsigned int y0, unsigned int yn)
+{
+  if (dirty_tiles_.empty() || x0 >= xn || y0 >= yn) {
+    return;
+  }
+  xn = std::min(xn, snapshot_size_x_);
+  yn = std::min(yn, snapshot_size_y_);
+  for (unsigned int ty = y0 / compressed_tile_size_; ty * compressed_tile_size_ < yn; ++ty) {
+    for (unsigned int tx = x0 / compressed_tile_size_; tx * compressed_tile_size_ < xn; ++tx) {
+      dirty_tiles_[ty * tiles_x_ + tx] = true;
+    }
+  }
+}
+
+std::unique_ptr<nav2_msgs::msg::CompressedCostmap>
+Costmap2DPublisher::createCompressedCostmapMsg()
+{
+  auto msg = std::make_unique<nav2_msgs::msg::CompressedCostmap>();
+  const unsigned int size_x = costmap_->getSizeInCellsX();
+  const unsigned int size_y = costmap_->getSizeInCellsY();
+  const double resolution = costmap_->getResolution();
+  const unsigned char * data = costmap_->getCharMap();
+
+  msg->header.stamp = clock_->now();
+  msg->header.frame_id = global_frame_;
+  msg->metadata.layer = "master";
+  msg->metadata.resolution = resolution;
+  msg->metadata.size_x = size_x;
+  msg->metadata.size_y = size_y;
+  msg->metadata.origin.position.x = costmap_->getOriginX();
+  msg->metadata.origin.position.y = costmap_->getOriginY();
+  msg->metadata.origin.position.z = 0.0;
+  msg->metadata.origin.orientation.w = 1.0;
+
+  bool keyframe = always_send_full_costmap_ || compressed_snapshot_.empty() ||
+    snapshot_size_x_ != size_x || snapshot_size_y_ != size_y ||
+    snapshot_resolution_ != resolution ||
+    ++compressed_since_keyframe_ >= compressed_keyframe_interval_;
+
+  // A rolling window moves by whole cells, anything else needs a keyframe
+  int shift_x = 0, shift_y = 0;
+  if (!keyframe) {
+    const double cells_x = (costmap_->getOriginX() - snapshot_origin_x_) / resolution;
+    const double cells_y = (costmap_->getOriginY() - snapshot_origin_y_) / resolution;
+    shift_x = static_cast<int>(std::lround(cells_x));
+    shift_y = static_cast<int>(std::lround(cells_y));
+    keyframe = std::abs(cells_x - shift_x) > 1e-3 || std::abs(cells_y - shift_y) > 1e-3 ||
+      static_cast<unsigned int>(std::abs(shift_x)) >= size_x ||
+      static_cast<unsigned int>(std::abs(shift_y)) >= size_y;
+  }
+
+  snapshot_origin_x_ = costmap_->getOriginX();
+  snapshot_origin_y_ = costmap_->getOriginY();
+
+  if (keyframe) {
+    msg->is_delta = false;
+    msg->tiles.resize(1);
+    encodeTile(data, size_x, 0, 0, size_x, size_y, true, msg->tiles[0]);
+
+    compressed_snapshot_.assign(data, data + static_cast<std::size_t>(size_x) * size_y);
+    snapshot_size_x_ = size_x;
+    snapshot_size_y_ = size_y;
+    snapshot_resolution_ = resolution;
+    compressed_since_keyframe_ = 0;
+    tiles_x_ = (size_x + compressed_tile_size_ - 1) / compressed_tile_size_;
+    tiles_y_ = (size_y + compressed_tile_size_ - 1) / compressed_tile_size_;
+    dirty_tiles_.assign(static_cast<std::size_t>(tiles_x_) * tiles_y_, false);
+    return msg;
+  }
+
+  msg->is_delta = true;
+  msg->shift_x = shift_x;
+  msg->shift_y = shift_y;
+  unsigned char * snapshot = compressed_snapshot_.data();
+
+  auto add_tile = [&](unsigned int x, unsigned int y, unsigned int w, unsigned int h) {
+      msg->tiles.emplace_back();
+      encodeTile(data, size_x, x, y, w, h, true, msg->tiles.back());
+      for (unsigned int j = y; j < y + h; ++j) {
+        const std::size_t row = static_cast<std::size_t>(j) * size_x + x;
+        std::memcpy(snapshot + row, data + row, w);
+      }
+    };
+
+  if (shift_x != 0 || shift_y != 0) {
+    // Only the newly exposed strips are sent for the move itself
+    shiftCostmapData(snapshot, size_x, size_y, shift_x, shift_y, NO_INFORMATION);
+    const unsigned int strip_w = std::abs(shift_x);
+    const unsigned int strip_h = std::abs(shift_y);
+    const unsigned int strip_x = shift_x > 0 ? size_x - strip_w : 0;
+    const unsigned int strip_y = shift_y > 0 ? size_y - strip_h : 0;
+    if (strip_w > 0) {
+      add_tile(strip_x, 0, strip_w, size_y);
+    }
+    if (strip_h > 0) {
+      add_tile(shift_x > 0 ? 0 : strip_w, strip_y, size_x - strip_w, strip_h);
+    }
+
+    // The bounds were marked before the move, so check every tile
+    std::fill(dirty_tiles_.begin(), dirty_tiles_.end(), true);
+  }
+
+  // Send the rows of each dirty tile from the first to the last which changed
+  for (unsigned int ty = 0; ty < tiles_y_; ++ty) {
+    for (unsigned int tx = 0; tx < tiles_x_; ++tx) {
+      if (!dirty_tiles_[ty * tiles_x_ + tx]) {
+        continue;
+      }
+      dirty_tiles_[ty * tiles_x_ + tx] = false;
+      const unsigned int x0 = tx * compressed_tile_size_;
+      const unsigned int y0 = ty * compressed_tile_size_;
+      const unsigned int w = std::min(compressed_tile_size_, size_x - x0);
+      const unsigned int yn = std::min(y0 + compressed_tile_size_, size_y);
+      unsigned int first = yn, last = y0;
+      for (unsigned int j = y0; j < yn; ++j) {
+        const std::size_t row = static_cast<std::size_t>(j) * size_x + x0;
+        if (std::memcmp(snapshot + row, data + row, w) != 0) {
+          first = std::min(first, j);
+          last = j;
+        }
+      }
+      if (first < yn) {
+        add_tile(x0, first, w, last - first + 1);
+      }
+    }
+  }
+  return msg;
+}
+
 void Costmap2DPublisher::publishCostmap()
 {
   float resolution = costmap_->getResolution();
@@ -261,6 +402,22 @@ void Costmap2DPublisher::publishCostmap()
     }
   }
 
+  if (costmap_compressed_pub_) {
+    if (costmap_compressed_pub_->get_subscription_count() > 0) {
+      std::unique_lock<Costmap2D::mutex_t> lock(*(costmap_->getMutex()));
+      auto msg = createCompressedCostmapMsg();
+      // Deltas without any change are not sent
+      if (!msg->is_delta || !msg->tiles.empty()) {
+        msg->sequence = ++compressed_sequence_;
+        costmap_compressed_pub_->publish(std::move(msg));
+      }
+    } else {
+      // Start with a keyframe once subscribed to again
+      compressed_snapshot_.clear();
+      dirty_tiles_.clear();
+    }
+  }
+
   xn_ = yn_ = 0;
   x0_ = costmap_->getSizeInCellsX();
   y0_ = costmap_->getSizeInCellsY();
@@ -124,6 +124,10 @@ void Costmap2DROS::init()
   RCLCPP_INFO(get_logger(), "Creating Costmap");
 
   declare_parameter("always_send_full_costmap", rclcpp::ParameterValue(false));
+  declare_parameter("publish_compressed_costmap", rclcpp::ParameterValue(false));
+  declare_parameter("compressed_costmap_tile_size", rclcpp::ParameterValue(64));
+  declare_parameter("compressed_costmap_keyframe_interval", rclcpp::ParameterValue(10));
+  declare_parameter("enable_costmap_snapshots", rclcpp::ParameterValue(true));
   declare_parameter("map_vis_z", rclcpp::ParameterValue(0.0));
   declare_parameter("footprint_padding", rclcpp::ParameterValue(0.01f));
   declare_parameter("footprint", rclcpp::ParameterValue(std::string("[]")));
@@ -147,6 +151,8 @@ void Costmap2DROS::init()
   declare_parameter("trinary_costmap", rclcpp::ParameterValue(true));
   declare_parameter("unknown_cost_value", rclcpp::ParameterValue(static_cast<unsigned char>(0xff)));
   declare_parameter("update_frequency", rclcpp::ParameterValue(5.0));
+  declare_parameter("update_threads", rclcpp::ParameterValue(1));
+  declare_parameter("update_tile_size", rclcpp::ParameterValue(128));
   declare_parameter("use_maximum", rclcpp::ParameterValue(false));
 }
 
@@ -172,6 +178,10 @@ Costmap2DROS::on_configure(const rclcpp_lifecycle::State & /*state*/)
   // Create the costmap itself
   layered_costmap_ = std::make_unique<LayeredCostmap>(
     global_frame_, rolling_window_, track_unknown_space_);
+  layered_costmap_->setUpdateThreads(update_threads_, update_tile_size_);
+  if (enable_costmap_snapshots_) {
+    costmap_snapshots_ = std::make_unique<CostmapSnapshotBuffer>();
+  }
 
   if (!layered_costmap_->isSizeLocked()) {
     layered_costmap_->resizeMap(
@@ -240,10 +250,13 @@ Costmap2DROS::on_configure(const rclcpp_lifecycle::State & /*state*/)
   footprint_pub_ = create_publisher<geometry_msgs::msg::PolygonStamped>(
     "published_footprint");
 
+  const unsigned int compressed_tile_size =
+    publish_compressed_costmap_ ? compressed_costmap_tile_size_ : 0;
   costmap_publisher_ = std::make_unique<Costmap2DPublisher>(
     shared_from_this(),
     layered_costmap_->getCostmap(), global_frame_,
-    "costmap", always_send_full_costmap_, map_vis_z_);
+    "costmap", always_send_full_costmap_, map_vis_z_,
+    compressed_tile_size, compressed_costmap_keyframe_interval_);
 
   auto layers = layered_costmap_->getPlugins();
 
@@ -254,7 +267,8 @@ Costmap2DROS::on_configure(const rclcpp_lifecycle::State & /*state*/)
         std::make_unique<Costmap2DPublisher>(
           shared_from_this(),
           costmap_layer.get(), global_frame_,
-          layer->getName(), always_send_full_costmap_, map_vis_z_)
+          layer->getName(), always_send_full_costmap_, map_vis_z_,
+          compressed_tile_size, compressed_costmap_keyframe_interval_)
       );
     }
   }
@@ -387,6 +401,7 @@ Costmap2DROS::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
   layer_publishers_.clear();
 
   layered_costmap_.reset();
+  costmap_snapshots_.reset();
 
   tf_listener_.reset();
   tf_buffer_.reset();
@@ -411,6 +426,10 @@ Costmap2DROS::getParameters()
 
   // Get all of the required parameters
   get_parameter("always_send_full_costmap", always_send_full_costmap_);
+  get_parameter("publish_compressed_costmap", publish_compressed_costmap_);
+  get_parameter("compressed_costmap_tile_size", compressed_costmap_tile_size_);
+  get_parameter("compressed_costmap_keyframe_interval", compressed_costmap_keyframe_interval_);
+  get_parameter("enable_costmap_snapshots", enable_costmap_snapshots_);
   get_parameter("map_vis_z", map_vis_z_);
   get_parameter("footprint", footprint_);
   get_parameter("footprint_padding", footprint_padding_);
@@ -427,6 +446,8 @@ Costmap2DROS::getParameters()
   get_parameter("transform_tolerance", transform_tolerance_);
   get_parameter("initial_transform_timeout", initial_transform_timeout_);
   get_parameter("update_frequency", map_update_frequency_);
+  get_parameter("update_threads", update_threads_);
+  get_parameter("update_tile_size", update_tile_size_);
   get_parameter("width", map_width_meters_);
   get_parameter("plugins", plugin_names_);
   get_parameter("filters", filter_names_);
@@ -485,6 +506,32 @@ Costmap2DROS::getParameters()
       get_logger(), "You try to set height of map to be negative or zero,"
       " this isn't allowed, please give a positive value.");
   }
+
+  // 5. The layers are updated by at least one thread over tiles of at least one cell
+  if (update_threads_ < 0) {
+    RCLCPP_ERROR(
+      get_logger(), "update_threads cannot be negative, updating the layers serially.");
+    update_threads_ = 1;
+  }
+  if (update_tile_size_ <= 0) {
+    RCLCPP_ERROR(
+      get_logger(), "update_tile_size must be positive, using the default of 128 cells.");
+    update_tile_size_ = 128;
+  }
+
+  // 6. Compressed costmaps track changes in tiles of at least one cell
+  if (compressed_costmap_tile_size_ <= 0) {
+    RCLCPP_ERROR(
+      get_logger(),
+      "compressed_costmap_tile_size must be positive, using the default of 64 cells.");
+    compressed_costmap_tile_size_ = 64;
+  }
+  if (compressed_costmap_keyframe_interval_ <= 0) {
+    RCLCPP_ERROR(
+      get_logger(),
+      "compressed_costmap_keyframe_interval must be positive, sending only keyframes.");
+    compressed_costmap_keyframe_interval_ = 1;
+  }
 }
 
 void
@@ -600,6 +647,14 @@ Costmap2DROS::updateMap()
       const double yaw = tf2::getYaw(pose.pose.orientation);
       layered_costmap_->updateMap(x, y, yaw);
 
+      if (costmap_snapshots_) {
+        Costmap2D * costmap = layered_costmap_->getCostmap();
+        std::unique_lock<Costmap2D::mutex_t> lock(*(costmap->getMutex()));
+        unsigned int x0, y0, xn, yn;
+        layered_costmap_->getBounds(&x0, &xn, &y0, &yn);
+        costmap_snapshots_->update(*costmap, x0, xn, y0, yn);
+      }
+
       auto footprint = std::make_unique<geometry_msgs::msg::PolygonStamped>();
       footprint->header = pose.header;
       transformFootprint(x, y, yaw, padded_footprint_, *footprint);
@@ -695,6 +750,9 @@ Costmap2DROS::resetLayers()
 {
   Costmap2D * top = layered_costmap_->getCostmap();
   top->resetMap(0, 0, top->getSizeInCellsX(), top->getSizeInCellsY());
+  if (costmap_snapshots_) {
+    costmap_snapshots_->invalidate();
+  }
 
   // Reset each of the plugins
   std::vector<std::shared_ptr<Layer>> * plugins = layered_costmap_->getPlugins();
@@ -839,6 +897,9 @@ Costmap2DROS::dynamicParametersCallback(std::vector<rclcpp::Parameter> parameter
     layered_costmap_->resizeMap(
       (unsigned int)(map_width_meters_ / resolution_),
       (unsigned int)(map_height_meters_ / resolution_), resolution_, origin_x_, origin_y_);
+    if (costmap_snapshots_) {
+      costmap_snapshots_->invalidate();
+    }
     updateMap();
   }
 
@@ -0,0 +1,221 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_costmap_2d/costmap_compression.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace nav2_costmap_2d
+{
+
+namespace
+{
+
+// Shorter runs of equal costs are cheaper to store as literals
+constexpr std::size_t MIN_RUN = 4;
+
+inline void appendVarint(uint64_t value, std::vector<uint8_t> & out)
+{
+  while (value >= 0x80) {
+    out.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(value));
+}
+
+inline bool readVarint(const uint8_t * in, std::size_t in_size, std::size_t & pos, uint64_t & value)
+{
+  value = 0;
+  for (unsigned int shift = 0; shift < 64; shift += 7) {
+    if (pos >= in_size) {
+      return false;
+    }
+    const uint8_t byte = in[pos++];
+    value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline void appendLiterals(const unsigned char * data, std::size_t n, std::vector<uint8_t> & out)
+{
+  if (n > 0) {
+    appendVarint(static_cast<uint64_t>(n - 1) << 1, out);
+    out.insert(out.end(), data, data + n);
+  }
+}
+
+/**
+ * @brief Get the end of the run of costs equal to data[i], comparing 8 costs at a time
+ */
+inline std::size_t runEnd(const unsigned char * data, std::size_t i, std::size_t n)
+{
+  uint64_t pattern;
+  std::memset(&pattern, data[i], sizeof(pattern));
+  std::size_t end = i + 1;
+  while (end + sizeof(pattern) <= n) {
+    uint64_t word;
+    std::memcpy(&word, data + end, sizeof(word));
+    if (word != pattern) {
+      break;
+    }
+    end += sizeof(pattern);
+  }
+  while (end < n && data[end] == data[i]) {
+    ++end;
+  }
+  return end;
+}
+
+}  // namespace
+
+void encodeRunLength(const unsigned char * data, std::size_t n, std::vector<uint8_t> & out)
+{
+  std::size_t literal_start = 0;
+  std::size_t i = 0;
+  while (i < n) {
+    const std::size_t end = runEnd(data, i, n);
+    if (end - i >= MIN_RUN) {
+      appendLiterals(data + literal_start, i - literal_start, out);
+      appendVarint((static_cast<uint64_t>(end - i - 1) << 1) | 1, out);
+      out.push_back(data[i]);
+      literal_start = end;
+    }
+    i = end;
+  }
+  appendLiterals(data + literal_start, n - literal_start, out);
+}
+
+bool decodeRunLength(const uint8_t * in, std::size_t in_size, unsigned char * out, std::size_t n)
+{
+  std::size_t pos = 0;
+  std::size_t written = 0;
+  while (pos < in_size) {
+    uint64_t token;
+    if (!readVarint(in, in_size, pos, token)) {
+      return false;
+    }
+    const uint64_t count = (token >> 1) + 1;
+    if (count > n - written) {
+      return false;
+    }
+
+    if (token & 1) {
+      if (pos >= in_size) {
+        return false;
+      }
+      std::memset(out + written, in[pos++], count);
+    } else {
+      if (count > in_size - pos) {
+        return false;
+      }
+      std::memcpy(out + written, in + pos, count);
+      pos += count;
+    }
+    written += count;
+  }
+  return written == n;
+}
+
+void encodeTile(
+  const unsigned char * data, unsigned int map_size_x,
+  unsigned int x, unsigned int y, unsigned int size_x, unsigned int size_y,
+  bool compress, nav2_msgs::msg::CostmapTile & tile)
+{
+  tile.x = x;
+  tile.y = y;
+  tile.size_x = size_x;
+  tile.size_y = size_y;
+  tile.encoding = nav2_msgs::msg::CostmapTile::ENCODING_RAW;
+  tile.data.resize(static_cast<std::size_t>(size_x) * size_y);
+  for (unsigned int j = 0; j < size_y; ++j) {
+    std::memcpy(
+      tile.data.data() + static_cast<std::size_t>(j) * size_x,
+      data + static_cast<std::size_t>(y + j) * map_size_x + x, size_x);
+  }
+
+  if (compress) {
+    std::vector<uint8_t> encoded;
+    encoded.reserve(tile.data.size() / 4);
+    encodeRunLength(tile.data.data(), tile.data.size(), encoded);
+    if (encoded.size() < tile.data.size()) {
+      tile.encoding = nav2_msgs::msg::CostmapTile::ENCODING_RLE;
+      tile.data.swap(encoded);
+    }
+  }
+}
+
+bool decodeTile(
+  const nav2_msgs::msg::CostmapTile & tile, unsigned char * data,
+  unsigned int map_size_x, unsigned int map_size_y)
+{
+  if (tile.x > map_size_x || tile.size_x > map_size_x - tile.x ||
+    tile.y > map_size_y || tile.size_y > map_size_y - tile.y)
+  {
+    return false;
+  }
+
+  const std::size_t n = static_cast<std::size_t>(tile.size_x) * tile.size_y;
+  const unsigned char * costs = tile.data.data();
+  std::vector<unsigned char> decoded;
+  if (tile.encoding == nav2_msgs::msg::CostmapTile::ENCODING_RLE) {
+    decoded.resize(n);
+    if (!decodeRunLength(tile.data.data(), tile.data.size(), decoded.data(), n)) {
+      return false;
+    }
+    costs = decoded.data();
+  } else if (tile.encoding != nav2_msgs::msg::CostmapTile::ENCODING_RAW ||
+    tile.data.size() != n)
+  {
+    return false;
+  }
+
+  for (unsigned int j = 0; j < tile.size_y; ++j) {
+    std::memcpy(
+      data + static_cast<std::size_t>(tile.y + j) * map_size_x + tile.x,
+      costs + static_cast<std::size_t>(j) * tile.size_x, tile.size_x);
+  }
+  return true;
+}
+
+void shiftCostmapData(
+  unsigned char * data, unsigned int size_x, unsigned int size_y,
+  int shift_x, int shift_y, unsigned char fill)
+{
+  const int sx = static_cast<int>(size_x);
+  const int sy = static_cast<int>(size_y);
+  const int kept = std::max(0, sx - std::abs(shift_x));
+  const int dst_x = std::max(0, -shift_x);
+  const int src_x = std::max(0, shift_x);
+
+  // Rows are moved in the order that reads each before it is overwritten
+  for (int k = 0; k < sy; ++k) {
+    const int y = shift_y >= 0 ? k : sy - 1 - k;
+    unsigned char * row = data + static_cast<std::size_t>(y) * size_x;
+    const int src_y = y + shift_y;
+    if (src_y < 0 || src_y >= sy || kept == 0) {
+      std::memset(row, fill, size_x);
+      continue;
+    }
+    std::memmove(row + dst_x, data + static_cast<std::size_t>(src_y) * size_x + src_x, kept);
+    std::memset(row, fill, dst_x);
+    std::memset(row + dst_x + kept, fill, sx - dst_x - kept);
+  }
+}
+
+}  // namespace nav2_costmap_2d
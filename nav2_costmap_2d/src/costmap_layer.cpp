@@ -125,24 +125,8 @@ void CostmapLayer::updateWithMax(
     return;
   }
 
-  unsigned char * master_array = master_grid.getCharMap();
-  unsigned int span = master_grid.getSizeInCellsX();
-
-  for (int j = min_j; j < max_j; j++) {
-    unsigned int it = j * span + min_i;
-    for (int i = min_i; i < max_i; i++) {
-      if (costmap_[it] == NO_INFORMATION) {
-        it++;
-        continue;
-      }
-
-      unsigned char old_cost = master_array[it];
-      if (old_cost == NO_INFORMATION || old_cost < costmap_[it]) {
-        master_array[it] = costmap_[it];
-      }
-      it++;
-    }
-  }
+  const unsigned char * costs = costmap_;
+  blendWindow(BlendMode::Max, master_grid, &costs, 1, min_i, min_j, max_i, max_j);
 }
 
 void CostmapLayer::updateWithMaxWithoutUnknownOverwrite(
@@ -154,24 +138,9 @@ void CostmapLayer::updateWithMaxWithoutUnknownOverwrite(
     return;
   }
 
-  unsigned char * master_array = master_grid.getCharMap();
-  unsigned int span = master_grid.getSizeInCellsX();
-
-  for (int j = min_j; j < max_j; j++) {
-    unsigned int it = j * span + min_i;
-    for (int i = min_i; i < max_i; i++) {
-      if (costmap_[it] == NO_INFORMATION) {
-        it++;
-        continue;
-      }
-
-      unsigned char old_cost = master_array[it];
-      if (old_cost != NO_INFORMATION && old_cost < costmap_[it]) {
-        master_array[it] = costmap_[it];
-      }
-      it++;
-    }
-  }
+  const unsigned char * costs = costmap_;
+  blendWindow(
+    BlendMode::MaxWithoutUnknownOverwrite, master_grid, &costs, 1, min_i, min_j, max_i, max_j);
 }
 
 void CostmapLayer::updateWithTrueOverwrite(
@@ -188,16 +157,8 @@ void CostmapLayer::updateWithTrueOverwrite(
     throw std::runtime_error("Can't update costmap layer: It has't been initialized yet!");
   }
 
-  unsigned char * master = master_grid.getCharMap();
-  unsigned int span = master_grid.getSizeInCellsX();
-
-  for (int j = min_j; j < max_j; j++) {
-    unsigned int it = span * j + min_i;
-    for (int i = min_i; i < max_i; i++) {
-      master[it] = costmap_[it];
-      it++;
-    }
-  }
+  const unsigned char * costs = costmap_;
+  blendWindow(BlendMode::TrueOverwrite, master_grid, &costs, 1, min_i, min_j, max_i, max_j);
 }
 
 void CostmapLayer::updateWithOverwrite(
@@ -207,18 +168,9 @@ void CostmapLayer::updateWithOverwrite(
   if (!enabled_) {
     return;
   }
-  unsigned char * master = master_grid.getCharMap();
-  unsigned int span = master_grid.getSizeInCellsX();
 
-  for (int j = min_j; j < max_j; j++) {
-    unsigned int it = span * j + min_i;
-    for (int i = min_i; i < max_i; i++) {
-      if (costmap_[it] != NO_INFORMATION) {
-        master[it] = costmap_[it];
-      }
-      it++;
-    }
-  }
+  const unsigned char * costs = costmap_;
+  blendWindow(BlendMode::Overwrite, master_grid, &costs, 1, min_i, min_j, max_i, max_j);
 }
 
 void CostmapLayer::updateWithAddition(
@@ -228,31 +180,9 @@ void CostmapLayer::updateWithAddition(
   if (!enabled_) {
     return;
   }
-  unsigned char * master_array = master_grid.getCharMap();
-  unsigned int span = master_grid.getSizeInCellsX();
 
-  for (int j = min_j; j < max_j; j++) {
-    unsigned int it = j * span + min_i;
-    for (int i = min_i; i < max_i; i++) {
-      if (costmap_[it] == NO_INFORMATION) {
-        it++;
-        continue;
-      }
-
-      unsigned char old_cost = master_array[it];
-      if (old_cost == NO_INFORMATION) {
-        master_array[it] = costmap_[it];
-      } else {
-        int sum = old_cost + costmap_[it];
-        if (sum >= nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE) {
-          master_array[it] = nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE - 1;
-        } else {
-          master_array[it] = sum;
-        }
-      }
-      it++;
-    }
-  }
+  const unsigned char * costs = costmap_;
+  blendWindow(BlendMode::Addition, master_grid, &costs, 1, min_i, min_j, max_i, max_j);
 }
 
 CombinationMethod CostmapLayer::combination_method_from_int(const int value)
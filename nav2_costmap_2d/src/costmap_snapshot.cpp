@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_costmap_2d/costmap_snapshot.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+namespace nav2_costmap_2d
+{
+
+CostmapSnapshotBuffer::CostmapSnapshotBuffer(unsigned int num_buffers)
+: num_buffers_(std::max(1u, num_buffers))
+{
+  buffers_.reserve(num_buffers_);
+}
+
+void CostmapSnapshotBuffer::update(
+  const Costmap2D & costmap,
+  unsigned int x0, unsigned int xn, unsigned int y0, unsigned int yn)
+{
+  std::lock_guard<std::mutex> lock(update_mutex_);
+
+  // The changed cells are out of date in every buffer
+  if (x0 < xn && y0 < yn) {
+    for (auto & buffer : buffers_) {
+      if (buffer->x0 >= buffer->xn || buffer->y0 >= buffer->yn) {
+        buffer->x0 = x0;
+        buffer->xn = xn;
+        buffer->y0 = y0;
+        buffer->yn = yn;
+      } else {
+        buffer->x0 = std::min(buffer->x0, x0);
+        buffer->xn = std::max(buffer->xn, xn);
+        buffer->y0 = std::min(buffer->y0, y0);
+        buffer->yn = std::max(buffer->yn, yn);
+      }
+    }
+  }
+
+  std::shared_ptr<Buffer> buffer = acquireBuffer();
+  Costmap2D & snapshot = buffer->costmap;
+  const unsigned int size_x = costmap.getSizeInCellsX();
+  const unsigned int size_y = costmap.getSizeInCellsY();
+  if (buffer->whole ||
+    snapshot.getSizeInCellsX() != size_x || snapshot.getSizeInCellsY() != size_y ||
+    snapshot.getResolution() != costmap.getResolution() ||
+    snapshot.getOriginX() != costmap.getOriginX() ||
+    snapshot.getOriginY() != costmap.getOriginY())
+  {
+    snapshot = costmap;
+  } else {
+    // Only the cells changed since this buffer was last filled are out of date
+    const unsigned int copy_xn = std::min(buffer->xn, size_x);
+    const unsigned int copy_yn = std::min(buffer->yn, size_y);
+    if (buffer->x0 < copy_xn) {
+      const unsigned char * src = costmap.getCharMap();
+      unsigned char * dst = snapshot.getCharMap();
+      for (unsigned int j = buffer->y0; j < copy_yn; ++j) {
+        const std::size_t row = static_cast<std::size_t>(j) * size_x + buffer->x0;
+        std::memcpy(dst + row, src + row, copy_xn - buffer->x0);
+      }
+    }
+  }
+  buffer->x0 = buffer->xn = buffer->y0 = buffer->yn = 0;
+  buffer->whole = false;
+
+  // The buffer is free again once the last copy of its snapshot is released
+  buffer->held.store(true, std::memory_order_relaxed);
+  std::shared_ptr<const Costmap2D> latest(
+    &snapshot, [buffer](const Costmap2D *) {
+        buffer->held.store(false, std::memory_order_release);
+      });
+  std::atomic_store(&latest_, std::move(latest));
+}
+
+std::shared_ptr<CostmapSnapshotBuffer::Buffer> CostmapSnapshotBuffer::acquireBuffer()
+{
+  for (auto & buffer : buffers_) {
+    // Acquire orders the reads of the last reader before the buffer is refilled
+    if (!buffer->held.load(std::memory_order_acquire)) {
+      return buffer;
+    }
+  }
+
+  if (buffers_.size() < num_buffers_) {
+    buffers_.push_back(std::make_shared<Buffer>());
+    return buffers_.back();
+  }
+
+  // Readers hold every buffer, so leave one of them to its readers and allocate another
+  auto latest = std::atomic_load(&latest_);
+  auto replaced = std::find_if(
+    buffers_.begin(), buffers_.end(), [&](const std::shared_ptr<Buffer> & buffer) {
+        return &buffer->costmap != latest.get();
+      });
+  if (replaced == buffers_.end()) {
+    replaced = buffers_.begin();
+  }
+  *replaced = std::make_shared<Buffer>();
+  return *replaced;
+}
+
+void CostmapSnapshotBuffer::invalidate()
+{
+  std::lock_guard<std::mutex> lock(update_mutex_);
+  for (auto & buffer : buffers_) {
+    buffer->whole = true;
+  }
+}
+
+std::shared_ptr<const Costmap2D> CostmapSnapshotBuffer::get() const
+{
+  return std::atomic_load(&latest_);
+}
+
+}  // namespace nav2_costmap_2d
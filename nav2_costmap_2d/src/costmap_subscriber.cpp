@@ -15,8 +15,11 @@
 #include <string>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "nav2_costmap_2d/costmap_subscriber.hpp"
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_compression.hpp"
 
 namespace nav2_costmap_2d
 {
@@ -86,6 +89,69 @@ void CostmapSubscriber::costmapUpdateCallback(
   }
 }
 
+void CostmapSubscriber::compressedCostmapCallback(
+  const nav2_msgs::msg::CompressedCostmap::SharedPtr msg)
+{
+  if (msg->is_delta &&
+    (!compressed_in_sync_ || msg->sequence != compressed_sequence_ + 1))
+  {
+    RCLCPP_DEBUG(logger_, "Missed compressed costmap messages, waiting for a keyframe.");
+    compressed_in_sync_ = false;
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(costmap_msg_mutex_);
+    frame_id_ = msg->header.frame_id;
+  }
+  const auto & metadata = msg->metadata;
+  if (!isCostmapReceived()) {
+    costmap_ = std::make_shared<Costmap2D>(
+      metadata.size_x, metadata.size_y, metadata.resolution,
+      metadata.origin.position.x, metadata.origin.position.y);
+  }
+
+  std::lock_guard<Costmap2D::mutex_t> lock(*(costmap_->getMutex()));
+  const bool metadata_changed = costmap_->getSizeInCellsX() != metadata.size_x ||
+    costmap_->getSizeInCellsY() != metadata.size_y ||
+    costmap_->getResolution() != metadata.resolution ||
+    costmap_->getOriginX() != metadata.origin.position.x ||
+    costmap_->getOriginY() != metadata.origin.position.y;
+  if (msg->is_delta && metadata_changed) {
+    // Deltas only move the costmap, which keeps its size and resolution
+    if (costmap_->getSizeInCellsX() != metadata.size_x ||
+      costmap_->getSizeInCellsY() != metadata.size_y ||
+      costmap_->getResolution() != metadata.resolution)
+    {
+      RCLCPP_WARN(logger_, "Compressed costmap delta does not match the costmap.");
+      compressed_in_sync_ = false;
+      return;
+    }
+    std::vector<unsigned char> data(
+      costmap_->getCharMap(), costmap_->getCharMap() + metadata.size_x * metadata.size_y);
+    shiftCostmapData(
+      data.data(), metadata.size_x, metadata.size_y, msg->shift_x, msg->shift_y, NO_INFORMATION);
+    costmap_->resizeMap(
+      metadata.size_x, metadata.size_y, metadata.resolution,
+      metadata.origin.position.x, metadata.origin.position.y);
+    std::copy(data.begin(), data.end(), costmap_->getCharMap());
+  } else if (metadata_changed) {
+    costmap_->resizeMap(
+      metadata.size_x, metadata.size_y, metadata.resolution,
+      metadata.origin.position.x, metadata.origin.position.y);
+  }
+
+  for (const auto & tile : msg->tiles) {
+    if (!decodeTile(tile, costmap_->getCharMap(), metadata.size_x, metadata.size_y)) {
+      RCLCPP_WARN(logger_, "Invalid compressed costmap tile, waiting for a keyframe.");
+      compressed_in_sync_ = false;
+      return;
+    }
+  }
+  compressed_sequence_ = msg->sequence;
+  compressed_in_sync_ = true;
+}
+
 void CostmapSubscriber::processCurrentCostmapMsg()
 {
   std::scoped_lock lock(*(costmap_->getMutex()), costmap_msg_mutex_);
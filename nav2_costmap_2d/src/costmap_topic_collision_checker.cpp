@@ -94,21 +94,39 @@ double CostmapTopicCollisionChecker::scorePose(
     throw IllegalPoseException(name_, "Pose Goes Off Grid.");
   }
 
+  if (use_stencils_) {
+    if (fetch_costmap_and_footprint) {
+      fetchFootprint();
+    }
+    return collision_checker_.footprintCostAtPose(pose.x, pose.y, pose.theta, footprint_);
+  }
+
   return collision_checker_.footprintCost(getFootprint(pose, fetch_costmap_and_footprint));
 }
 
+void CostmapTopicCollisionChecker::setUseFootprintStencils(bool use_stencils)
+{
+  use_stencils_ = use_stencils;
+  collision_checker_.setUseFootprintStencils(use_stencils);
+}
+
+void CostmapTopicCollisionChecker::fetchFootprint()
+{
+  std_msgs::msg::Header header;
+
+  // if footprint_sub_ was not initialized (alternative constructor), we are using the
+  // footprint built from the footprint_string alternative constructor argument.
+  if (footprint_sub_ && !footprint_sub_->getFootprintInRobotFrame(footprint_, header)) {
+    throw CollisionCheckerException("Current footprint not available.");
+  }
+}
+
 Footprint CostmapTopicCollisionChecker::getFootprint(
   const geometry_msgs::msg::Pose2D & pose,
   bool fetch_latest_footprint)
 {
   if (fetch_latest_footprint) {
-    std_msgs::msg::Header header;
-
-    // if footprint_sub_ was not initialized (alternative constructor), we are using the
-    // footprint built from the footprint_string alternative constructor argument.
-    if (footprint_sub_ && !footprint_sub_->getFootprintInRobotFrame(footprint_, header)) {
-      throw CollisionCheckerException("Current footprint not available.");
-    }
+    fetchFootprint();
   }
   Footprint footprint;
   transformFootprint(pose.x, pose.y, pose.theta, footprint_, footprint);
@@ -18,6 +18,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <cmath>
 
 #include "nav2_costmap_2d/footprint_collision_checker.hpp"
 
@@ -129,6 +130,11 @@ template<typename CostmapT>
 double FootprintCollisionChecker<CostmapT>::footprintCostAtPose(
   double x, double y, double theta, const Footprint & footprint)
 {
+  if (use_stencils_) {
+    updateFootprintStencil(footprint);
+    return footprintStencilCost(x, y, theta, footprint);
+  }
+
   double cos_th = cos(theta);
   double sin_th = sin(theta);
   Footprint oriented_footprint;
@@ -143,8 +149,76 @@ double FootprintCollisionChecker<CostmapT>::footprintCostAtPose(
   return footprintCost(oriented_footprint);
 }
 
+template<typename CostmapT>
+void FootprintCollisionChecker<CostmapT>::setUseFootprintStencils(bool use_stencils, bool filled)
+{
+  use_stencils_ = use_stencils;
+  fill_stencils_ = filled;
+}
+
+template<typename CostmapT>
+void FootprintCollisionChecker<CostmapT>::updateFootprintStencil(const Footprint & footprint)
+{
+  const double resolution = costmap_->getResolution();
+  if (!stencil_ || !stencil_->isFor(footprint, resolution, fill_stencils_)) {
+    stencil_ = std::make_shared<FootprintStencil>(footprint, resolution, fill_stencils_);
+  }
+}
+
+template<typename CostmapT>
+double FootprintCollisionChecker<CostmapT>::footprintStencilCost(
+  double x, double y, double theta, const Footprint & footprint)
+{
+  const double resolution = costmap_->getResolution();
+  const double gx = (x - costmap_->getOriginX()) / resolution;
+  const double gy = (y - costmap_->getOriginY()) / resolution;
+  const int size_x = static_cast<int>(costmap_->getSizeInCellsX());
+  const int size_y = static_cast<int>(costmap_->getSizeInCellsY());
+
+  // Away from the edges of the map, the whole footprint is on it. Near them, the footprint
+  // is off the map exactly when one of its points is, as in footprintCost()
+  const int radius = stencil_->getRadius() + 1;
+  const bool inside = gx >= radius && gy >= radius &&
+    gx < size_x - radius && gy < size_y - radius;
+  if (!inside) {
+    const double cos_th = cos(theta);
+    const double sin_th = sin(theta);
+    unsigned int mx, my;
+    for (const auto & point : footprint) {
+      if (!worldToMap(
+          x + (point.x * cos_th - point.y * sin_th),
+          y + (point.x * sin_th + point.y * cos_th), mx, my))
+      {
+        return static_cast<double>(LETHAL_OBSTACLE);
+      }
+    }
+  }
+
+  const int cx = static_cast<int>(std::floor(gx));
+  const int cy = static_cast<int>(std::floor(gy));
+  const unsigned char * costs = costmap_->getCharMap();
+  unsigned char footprint_cost = 0;
+  for (const auto & cell : stencil_->getCells(theta, gx - cx, gy - cy)) {
+    const int px = cx + cell.dx;
+    const int py = cy + cell.dy;
+    // Cells rounded off the map while the footprint is on it are skipped
+    if (!inside && (px < 0 || py < 0 || px >= size_x || py >= size_y)) {
+      continue;
+    }
+    const unsigned char cost = costs[py * size_x + px];
+    // if in collision, no need to continue
+    if (cost == LETHAL_OBSTACLE) {
+      return static_cast<double>(LETHAL_OBSTACLE);
+    }
+    footprint_cost = std::max(footprint_cost, cost);
+  }
+  return static_cast<double>(footprint_cost);
+}
+
 // declare our valid template parameters
 template class FootprintCollisionChecker<std::shared_ptr<nav2_costmap_2d::Costmap2D>>;
 template class FootprintCollisionChecker<nav2_costmap_2d::Costmap2D *>;
+template class FootprintCollisionChecker<const nav2_costmap_2d::Costmap2D *>;
+template class FootprintCollisionChecker<std::shared_ptr<const nav2_costmap_2d::Costmap2D>>;
 
 }  // namespace nav2_costmap_2d
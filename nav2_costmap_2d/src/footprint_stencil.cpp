@@ -0,0 +1,182 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_costmap_2d/footprint_stencil.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <utility>
+
+#include "nav2_util/line_iterator.hpp"
+
+namespace nav2_costmap_2d
+{
+
+namespace
+{
+
+struct Vertex
+{
+  double x;
+  double y;
+};
+
+// Even-odd rule, as the outline of a non-convex footprint may wind either way
+bool insidePolygon(const std::vector<Vertex> & polygon, double x, double y)
+{
+  bool inside = false;
+  for (std::size_t i = 0, j = polygon.size() - 1; i < polygon.size(); j = i++) {
+    if ((polygon[i].y > y) != (polygon[j].y > y) &&
+      x < polygon[j].x + (y - polygon[j].y) * (polygon[i].x - polygon[j].x) /
+      (polygon[i].y - polygon[j].y))
+    {
+      inside = !inside;
+    }
+  }
+  return inside;
+}
+
+}  // namespace
+
+FootprintStencil::FootprintStencil(
+  const std::vector<geometry_msgs::msg::Point> & footprint, double resolution,
+  bool filled, unsigned int num_headings, bool close_from_last)
+: footprint_(footprint), resolution_(resolution), filled_(filled), num_headings_(num_headings)
+{
+  double max_range = 0.0;
+  for (const auto & point : footprint_) {
+    max_range = std::max(max_range, std::hypot(point.x, point.y) / resolution_);
+  }
+  if (num_headings_ == 0) {
+    // A heading step of 0.5 / range radians moves points by at most a quarter cell
+    // to the nearest rasterised heading
+    num_headings_ = static_cast<unsigned int>(std::ceil(4.0 * M_PI * max_range));
+  }
+  num_headings_ = std::max(1u, num_headings_);
+  stencils_.resize(num_headings_ * NUM_PHASES);
+  if (footprint_.empty()) {
+    return;
+  }
+
+  std::vector<Vertex> polygon(footprint_.size());
+  std::vector<std::pair<int, int>> vertex_cells(footprint_.size());
+  std::vector<std::pair<Cell, bool>> cells;
+  for (unsigned int bin = 0; bin < num_headings_; ++bin) {
+    const double theta = 2.0 * M_PI * bin / num_headings_;
+    const double cos_th = std::cos(theta);
+    const double sin_th = std::sin(theta);
+    for (unsigned int phase = 0; phase < NUM_PHASES; ++phase) {
+      // Pose at the center of a quadrant of its cell, so points are relative to the corner
+      const double fx = phase % 2 ? 0.75 : 0.25;
+      const double fy = phase / 2 ? 0.75 : 0.25;
+      int min_x = 0, max_x = 0, min_y = 0, max_y = 0;
+      for (std::size_t i = 0; i < footprint_.size(); ++i) {
+        const auto & point = footprint_[i];
+        polygon[i].x = fx + (point.x * cos_th - point.y * sin_th) / resolution_;
+        polygon[i].y = fy + (point.x * sin_th + point.y * cos_th) / resolution_;
+        vertex_cells[i] = {
+          static_cast<int>(std::floor(polygon[i].x)), static_cast<int>(std::floor(polygon[i].y))};
+        min_x = std::min(min_x, vertex_cells[i].first);
+        max_x = std::max(max_x, vertex_cells[i].first);
+        min_y = std::min(min_y, vertex_cells[i].second);
+        max_y = std::max(max_y, vertex_cells[i].second);
+      }
+
+      // Outline, rasterised as footprintCost() does between the cells of the points,
+      // closing it from the first to the last point, or from the last to the first
+      cells.clear();
+      for (std::size_t i = 0; i < vertex_cells.size(); ++i) {
+        const bool closing = i + 1 == vertex_cells.size();
+        const bool reversed = closing && !close_from_last;
+        const auto & start = vertex_cells[reversed ? 0 : i];
+        const auto & end = vertex_cells[closing ? (reversed ? i : 0) : i + 1];
+        for (nav2_util::LineIterator line(start.first, start.second, end.first, end.second);
+          line.isValid(); line.advance())
+        {
+          cells.push_back({{line.getX(), line.getY()}, true});
+        }
+      }
+
+      // Interior, as the cells whose centers are inside of the footprint
+      if (filled_ && footprint_.size() > 2) {
+        for (int y = min_y; y <= max_y; ++y) {
+          for (int x = min_x; x <= max_x; ++x) {
+            if (insidePolygon(polygon, x + 0.5, y + 0.5)) {
+              cells.push_back({{x, y}, false});
+            }
+          }
+        }
+      }
+
+      // Outline before interior cells, and outermost cells first, which obstacles reach
+      // first. Duplicates are removed keeping the outline cell.
+      auto range = [&](const Cell & cell) {
+          const double dx = cell.dx + 0.5 - fx;
+          const double dy = cell.dy + 0.5 - fy;
+          return dx * dx + dy * dy;
+        };
+      std::sort(
+        cells.begin(), cells.end(), [](const auto & a, const auto & b) {
+          if (a.first.dy != b.first.dy) {
+            return a.first.dy < b.first.dy;
+          }
+          if (a.first.dx != b.first.dx) {
+            return a.first.dx < b.first.dx;
+          }
+          return a.second > b.second;
+        });
+      cells.erase(
+        std::unique(
+          cells.begin(), cells.end(), [](const auto & a, const auto & b) {
+            return a.first.dx == b.first.dx && a.first.dy == b.first.dy;
+          }), cells.end());
+      std::stable_sort(
+        cells.begin(), cells.end(), [&](const auto & a, const auto & b) {
+          if (a.second != b.second) {
+            return a.second;
+          }
+          return range(a.first) > range(b.first);
+        });
+
+      auto & stencil = stencils_[bin * NUM_PHASES + phase];
+      stencil.reserve(cells.size());
+      for (const auto & cell : cells) {
+        stencil.push_back(cell.first);
+        radius_ = std::max({radius_, std::abs(cell.first.dx), std::abs(cell.first.dy)});
+      }
+    }
+  }
+}
+
+bool FootprintStencil::isFor(
+  const std::vector<geometry_msgs::msg::Point> & footprint, double resolution,
+  bool filled) const
+{
+  if (resolution != resolution_ || filled != filled_ || footprint.size() != footprint_.size()) {
+    return false;
+  }
+  // Footprints transformed back from published footprints vary slightly between updates
+  const double tolerance = 0.1 * resolution_;
+  for (std::size_t i = 0; i < footprint.size(); ++i) {
+    if (std::abs(footprint[i].x - footprint_[i].x) > tolerance ||
+      std::abs(footprint[i].y - footprint_[i].y) > tolerance)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace nav2_costmap_2d
@@ -69,7 +69,8 @@ LayeredCostmap::LayeredCostmap(std::string global_frame, bool rolling_window, bo
   size_locked_(false),
   circumscribed_radius_(1.0),
   inscribed_radius_(0.1),
-  footprint_(std::make_shared<std::vector<geometry_msgs::msg::Point>>())
+  footprint_(std::make_shared<std::vector<geometry_msgs::msg::Point>>()),
+  tile_size_(128)
 {
   if (track_unknown) {
     primary_costmap_.setDefaultValue(NO_INFORMATION);
@@ -215,20 +216,12 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
   if (filters_.size() == 0) {
     // If there are no filters enabled just update costmap sequentially by each plugin
     combined_costmap_.resetMap(x0, y0, xn, yn);
-    for (vector<std::shared_ptr<Layer>>::iterator plugin = plugins_.begin();
-      plugin != plugins_.end(); ++plugin)
-    {
-      (*plugin)->updateCosts(combined_costmap_, x0, y0, xn, yn);
-    }
+    updateLayers(plugins_, combined_costmap_, x0, y0, xn, yn);
   } else {
     // Costmap Filters enabled
     // 1. Update costmap by plugins
     primary_costmap_.resetMap(x0, y0, xn, yn);
-    for (vector<std::shared_ptr<Layer>>::iterator plugin = plugins_.begin();
-      plugin != plugins_.end(); ++plugin)
-    {
-      (*plugin)->updateCosts(primary_costmap_, x0, y0, xn, yn);
-    }
+    updateLayers(plugins_, primary_costmap_, x0, y0, xn, yn);
 
     // 2. Copy processed costmap window to a final costmap.
     // primary_costmap_ remain to be untouched for further usage by plugins.
@@ -242,11 +235,7 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
 
     // 3. Apply filters over the plugins in order to make filters' work
     // not being considered by plugins on next updateMap() calls
-    for (vector<std::shared_ptr<Layer>>::iterator filter = filters_.begin();
-      filter != filters_.end(); ++filter)
-    {
-      (*filter)->updateCosts(combined_costmap_, x0, y0, xn, yn);
-    }
+    updateLayers(filters_, combined_costmap_, x0, y0, xn, yn);
   }
 
   bx0_ = x0;
@@ -257,6 +246,111 @@ void LayeredCostmap::updateMap(double robot_x, double robot_y, double robot_yaw)
   initialized_ = true;
 }
 
+void LayeredCostmap::updateLayers(
+  std::vector<std::shared_ptr<Layer>> & layers, Costmap2D & grid,
+  int x0, int y0, int xn, int yn)
+{
+  // Without update threads, the whole window is a single tile
+  const int tile_size = update_pool_ ?
+    static_cast<int>(tile_size_) : std::max({1, xn - x0, yn - y0});
+  const int tiles_x = std::max(1, (xn - x0 + tile_size - 1) / tile_size);
+  const int tiles_y = std::max(1, (yn - y0 + tile_size - 1) / tile_size);
+  const std::size_t num_tiles = static_cast<std::size_t>(tiles_x) * tiles_y;
+
+  // A step of a stage either updates a layer or blends the costs of consecutive
+  // layers with the same blend mode in a single pass
+  struct TileStep
+  {
+    Layer * layer;
+    BlendMode mode;
+    std::vector<const unsigned char *> costs;
+  };
+
+  std::size_t i = 0;
+  while (i < layers.size()) {
+    // Serially, only layers without a halo are staged, to fuse their blends
+    if (!layers[i]->isTileSafe() || (!update_pool_ && layers[i]->getTileHalo() != 0)) {
+      layers[i]->updateCosts(grid, x0, y0, xn, yn);
+      ++i;
+      continue;
+    }
+
+    // Following tile-safe layers without a halo only read the cells they write, so they
+    // can run back to back on each tile. A layer with a halo needs every tile of the
+    // layers before it complete, so it always starts a new stage.
+    std::size_t stage_end = i + 1;
+    while (stage_end < layers.size() && layers[stage_end]->isTileSafe() &&
+      layers[stage_end]->getTileHalo() == 0)
+    {
+      ++stage_end;
+    }
+
+    std::vector<TileStep> stage;
+    stage.reserve(stage_end - i);
+    for (std::size_t k = i; k < stage_end; ++k) {
+      if (!layers[k]->beginTiledUpdate(grid, x0, y0, xn, yn)) {
+        continue;
+      }
+      BlendMode mode = BlendMode::Overwrite;
+      const unsigned char * costs = nullptr;
+      if (!layers[k]->getTileBlend(mode, costs)) {
+        stage.push_back({layers[k].get(), mode, {}});
+      } else if (!stage.empty() && !stage.back().layer && stage.back().mode == mode) {
+        stage.back().costs.push_back(costs);
+      } else {
+        stage.push_back({nullptr, mode, {costs}});
+      }
+    }
+
+    auto update_tile = [&](std::size_t tile) {
+        const int tx0 = x0 + static_cast<int>(tile % tiles_x) * tile_size;
+        const int ty0 = y0 + static_cast<int>(tile / tiles_x) * tile_size;
+        const int txn = std::min(tx0 + tile_size, xn);
+        const int tyn = std::min(ty0 + tile_size, yn);
+        for (auto & step : stage) {
+          if (step.layer) {
+            step.layer->updateTile(grid, tx0, ty0, txn, tyn);
+          } else {
+            blendWindow(
+              step.mode, grid, step.costs.data(), static_cast<unsigned int>(step.costs.size()),
+              tx0, ty0, txn, tyn);
+          }
+        }
+      };
+
+    try {
+      if (update_pool_) {
+        update_pool_->parallelFor(stage.empty() ? 0 : num_tiles, update_tile);
+      } else if (!stage.empty()) {
+        update_tile(0);
+      }
+    } catch (...) {
+      for (std::size_t k = i; k < stage_end; ++k) {
+        layers[k]->endTiledUpdate(grid);
+      }
+      throw;
+    }
+
+    for (std::size_t k = i; k < stage_end; ++k) {
+      layers[k]->endTiledUpdate(grid);
+    }
+    i = stage_end;
+  }
+}
+
+void LayeredCostmap::setUpdateThreads(unsigned int num_threads, unsigned int tile_size)
+{
+  std::unique_lock<Costmap2D::mutex_t> lock(*(combined_costmap_.getMutex()));
+  tile_size_ = std::max(1u, tile_size);
+  update_pool_.reset();
+  if (num_threads != 1) {
+    update_pool_ = std::make_unique<nav2_util::ThreadPool>(num_threads);
+    if (update_pool_->size() == 1) {
+      update_pool_.reset();
+    }
+  }
+}
+
 bool LayeredCostmap::isCurrent()
 {
   current_ = true;
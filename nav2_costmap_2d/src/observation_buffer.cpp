@@ -37,12 +37,15 @@
 #include "nav2_costmap_2d/observation_buffer.hpp"
 
 #include <algorithm>
+#include <cstring>
 #include <list>
+#include <memory>
 #include <string>
 #include <vector>
 #include <chrono>
 
 #include "tf2/convert.hpp"
+#include "tf2/LinearMath/Transform.hpp"
 #include "sensor_msgs/point_cloud2_iterator.hpp"
 using namespace std::chrono_literals;
 
@@ -81,78 +84,47 @@ ObservationBuffer::~ObservationBuffer()
 }
 
 void ObservationBuffer::bufferCloud(const sensor_msgs::msg::PointCloud2 & cloud)
+{
+  bufferCloud(std::make_shared<const sensor_msgs::msg::PointCloud2>(cloud));
+}
+
+void ObservationBuffer::bufferCloud(sensor_msgs::msg::PointCloud2::ConstSharedPtr cloud)
 {
   geometry_msgs::msg::PointStamped global_origin;
 
   // create a new observation on the list to be populated
-  observation_list_.push_front(Observation());
+  observation_list_.push_front(BufferedCloud());
+  BufferedCloud & buffered_cloud = observation_list_.front();
 
   // check whether the origin frame has been set explicitly
   // or whether we should get it from the cloud
-  std::string origin_frame = sensor_frame_ == "" ? cloud.header.frame_id : sensor_frame_;
+  std::string origin_frame = sensor_frame_ == "" ? cloud->header.frame_id : sensor_frame_;
 
   try {
     // given these observations come from sensors...
     // we'll need to store the origin pt of the sensor
     geometry_msgs::msg::PointStamped local_origin;
-    local_origin.header.stamp = cloud.header.stamp;
+    local_origin.header.stamp = cloud->header.stamp;
     local_origin.header.frame_id = origin_frame;
     local_origin.point.x = 0;
     local_origin.point.y = 0;
     local_origin.point.z = 0;
     tf2_buffer_.transform(local_origin, global_origin, global_frame_, tf_tolerance_);
-    tf2::convert(global_origin.point, observation_list_.front().origin_);
+    tf2::convert(global_origin.point, buffered_cloud.observation.origin_);
 
     // make sure to pass on the raytrace/obstacle range
     // of the observation buffer to the observations
-    observation_list_.front().raytrace_max_range_ = raytrace_max_range_;
-    observation_list_.front().raytrace_min_range_ = raytrace_min_range_;
-    observation_list_.front().obstacle_max_range_ = obstacle_max_range_;
-    observation_list_.front().obstacle_min_range_ = obstacle_min_range_;
-
-    sensor_msgs::msg::PointCloud2 global_frame_cloud;
-
-    // transform the point cloud
-    tf2_buffer_.transform(cloud, global_frame_cloud, global_frame_, tf_tolerance_);
-    global_frame_cloud.header.stamp = cloud.header.stamp;
-
-    // now we need to remove observations from the cloud that are below
-    // or above our height thresholds
-    sensor_msgs::msg::PointCloud2 & observation_cloud = *(observation_list_.front().cloud_);
-    observation_cloud.height = global_frame_cloud.height;
-    observation_cloud.width = global_frame_cloud.width;
-    observation_cloud.fields = global_frame_cloud.fields;
-    observation_cloud.is_bigendian = global_frame_cloud.is_bigendian;
-    observation_cloud.point_step = global_frame_cloud.point_step;
-    observation_cloud.row_step = global_frame_cloud.row_step;
-    observation_cloud.is_dense = global_frame_cloud.is_dense;
-
-    unsigned int cloud_size = global_frame_cloud.height * global_frame_cloud.width;
-    sensor_msgs::PointCloud2Modifier modifier(observation_cloud);
-    modifier.resize(cloud_size);
-    unsigned int point_count = 0;
-
-    // copy over the points that are within our height bounds
-    sensor_msgs::PointCloud2Iterator<float> iter_z(global_frame_cloud, "z");
-    std::vector<unsigned char>::const_iterator iter_global = global_frame_cloud.data.begin(),
-      iter_global_end = global_frame_cloud.data.end();
-    std::vector<unsigned char>::iterator iter_obs = observation_cloud.data.begin();
-    for (; iter_global != iter_global_end; ++iter_z, iter_global +=
-      global_frame_cloud.point_step)
-    {
-      if ((*iter_z) <= max_obstacle_height_ &&
-        (*iter_z) >= min_obstacle_height_)
-      {
-        std::copy(iter_global, iter_global + global_frame_cloud.point_step, iter_obs);
-        iter_obs += global_frame_cloud.point_step;
-        ++point_count;
-      }
-    }
+    buffered_cloud.observation.raytrace_max_range_ = raytrace_max_range_;
+    buffered_cloud.observation.raytrace_min_range_ = raytrace_min_range_;
+    buffered_cloud.observation.obstacle_max_range_ = obstacle_max_range_;
+    buffered_cloud.observation.obstacle_min_range_ = obstacle_min_range_;
 
-    // resize the cloud for the number of legal points
-    modifier.resize(point_count);
-    observation_cloud.header.stamp = cloud.header.stamp;
-    observation_cloud.header.frame_id = global_frame_cloud.header.frame_id;
+    // only look up the transform of the cloud for now, it is transformed once it is observed
+    buffered_cloud.transform = tf2_buffer_.lookupTransform(
+      global_frame_, cloud->header.frame_id, tf2_ros::fromMsg(cloud->header.stamp),
+      tf_tolerance_);
+    buffered_cloud.stamp = cloud->header.stamp;
+    buffered_cloud.raw_cloud = std::move(cloud);
   } catch (tf2::TransformException & ex) {
     // if an exception occurs, we need to remove the empty observation from the list
     observation_list_.pop_front();
@@ -160,7 +132,7 @@ void ObservationBuffer::bufferCloud(const sensor_msgs::msg::PointCloud2 & cloud)
       logger_,
       "TF Exception that should never happen for sensor frame: %s, cloud frame: %s, %s",
       sensor_frame_.c_str(),
-      cloud.header.frame_id.c_str(), ex.what());
+      cloud->header.frame_id.c_str(), ex.what());
     return;
   }
 
@@ -171,23 +143,75 @@ void ObservationBuffer::bufferCloud(const sensor_msgs::msg::PointCloud2 & cloud)
   purgeStaleObservations();
 }
 
-// returns a copy of the observations
+void ObservationBuffer::processCloud(BufferedCloud & buffered_cloud) const
+{
+  const sensor_msgs::msg::PointCloud2 & raw_cloud = *buffered_cloud.raw_cloud;
+  tf2::Transform transform;
+  tf2::fromMsg(buffered_cloud.transform.transform, transform);
+  const tf2::Matrix3x3 & basis = transform.getBasis();
+  const tf2::Vector3 & origin = transform.getOrigin();
+
+  auto observation_cloud = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  observation_cloud->header.stamp = raw_cloud.header.stamp;
+  observation_cloud->header.frame_id = buffered_cloud.transform.header.frame_id;
+  observation_cloud->height = 1;
+  observation_cloud->is_bigendian = false;
+  observation_cloud->is_dense = true;
+  sensor_msgs::PointCloud2Modifier modifier(*observation_cloud);
+  modifier.setPointCloud2Fields(
+    3, "x", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "y", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "z", 1, sensor_msgs::msg::PointField::FLOAT32);
+  const size_t cloud_size = static_cast<size_t>(raw_cloud.height) * raw_cloud.width;
+  modifier.resize(cloud_size);
+
+  // transform the points and copy over those within our height bounds, in a single pass
+  size_t point_count = 0;
+  if (cloud_size > 0) {
+    sensor_msgs::PointCloud2ConstIterator<float> iter_x(raw_cloud, "x");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_y(raw_cloud, "y");
+    sensor_msgs::PointCloud2ConstIterator<float> iter_z(raw_cloud, "z");
+    unsigned char * iter_obs = observation_cloud->data.data();
+    for (size_t i = 0; i != cloud_size; ++i, ++iter_x, ++iter_y, ++iter_z) {
+      const tf2::Vector3 point(*iter_x, *iter_y, *iter_z);
+      const float z = static_cast<float>(basis[2].dot(point) + origin.z());
+      if (z <= max_obstacle_height_ && z >= min_obstacle_height_) {
+        const float xyz[3] = {
+          static_cast<float>(basis[0].dot(point) + origin.x()),
+          static_cast<float>(basis[1].dot(point) + origin.y()),
+          z};
+        std::memcpy(iter_obs, xyz, sizeof(xyz));
+        iter_obs += sizeof(xyz);
+        ++point_count;
+      }
+    }
+  }
+
+  // resize the cloud for the number of legal points
+  modifier.resize(point_count);
+  buffered_cloud.observation.cloud_ = std::move(observation_cloud);
+  buffered_cloud.raw_cloud.reset();
+}
+
+// returns views of the observations
 void ObservationBuffer::getObservations(std::vector<Observation> & observations)
 {
   // first... let's make sure that we don't have any stale observations
   purgeStaleObservations();
 
-  // now we'll just copy the observations for the caller
-  std::list<Observation>::iterator obs_it;
-  for (obs_it = observation_list_.begin(); obs_it != observation_list_.end(); ++obs_it) {
-    observations.push_back(*obs_it);
+  // now we'll process any new observations and share them with the caller
+  for (auto & buffered_cloud : observation_list_) {
+    if (buffered_cloud.raw_cloud) {
+      processCloud(buffered_cloud);
+    }
+    observations.push_back(buffered_cloud.observation);
   }
 }
 
 void ObservationBuffer::purgeStaleObservations()
 {
   if (!observation_list_.empty()) {
-    std::list<Observation>::iterator obs_it = observation_list_.begin();
+    std::list<BufferedCloud>::iterator obs_it = observation_list_.begin();
     // if we're keeping observations for no time... then we'll only keep one observation
     if (observation_keep_time_ == rclcpp::Duration(0.0s)) {
       observation_list_.erase(++obs_it, observation_list_.end());
@@ -196,10 +220,9 @@ void ObservationBuffer::purgeStaleObservations()
 
     // otherwise... we'll have to loop through the observations to see which ones are stale
     for (obs_it = observation_list_.begin(); obs_it != observation_list_.end(); ++obs_it) {
-      Observation & obs = *obs_it;
       // check if the observation is out of date... and if it is,
       // remove it and those that follow from the list
-      if ((clock_->now() - obs.cloud_->header.stamp) >
+      if ((clock_->now() - obs_it->stamp) >
         observation_keep_time_)
       {
         observation_list_.erase(obs_it, observation_list_.end());
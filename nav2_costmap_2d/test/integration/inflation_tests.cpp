@@ -509,6 +509,133 @@ TEST_F(TestNode, testInflation)
   ASSERT_EQ(costmap->getCost(0, 9), nav2_costmap_2d::LETHAL_OBSTACLE);
 }
 
+/**
+ * Test that updating the layers concurrently over tiles matches updating them serially
+ */
+TEST_F(TestNode, testTiledUpdateMatchesSerial)
+{
+  initNode(1);
+  tf2_ros::Buffer tf(node_->get_clock());
+  nav2_costmap_2d::LayeredCostmap serial_layers("frame", false, false);
+  nav2_costmap_2d::LayeredCostmap tiled_layers("frame", false, false);
+  tiled_layers.setUpdateThreads(4, 3);
+  EXPECT_EQ(serial_layers.getUpdateThreads(), 1u);
+  EXPECT_EQ(tiled_layers.getUpdateThreads(), 4u);
+
+  std::shared_ptr<nav2_costmap_2d::StaticLayer> serial_slayer = nullptr, tiled_slayer = nullptr;
+  std::shared_ptr<nav2_costmap_2d::ObstacleLayer> serial_olayer = nullptr, tiled_olayer = nullptr;
+  std::shared_ptr<nav2_costmap_2d::InflationLayer> serial_ilayer = nullptr, tiled_ilayer = nullptr;
+  for (auto * layers : {&serial_layers, &tiled_layers}) {
+    const bool tiled = layers == &tiled_layers;
+    std::vector<Point> polygon = setRadii(*layers, 1, 1);
+    addStaticLayer(*layers, tf, node_, tiled ? tiled_slayer : serial_slayer);
+    addObstacleLayer(*layers, tf, node_, tiled ? tiled_olayer : serial_olayer);
+    addInflationLayer(*layers, tf, node_, tiled ? tiled_ilayer : serial_ilayer);
+    layers->setFootprint(polygon);
+  }
+  waitForMap(serial_slayer);
+  waitForMap(tiled_slayer);
+
+  auto expectEqualMaps = [&]() {
+      nav2_costmap_2d::Costmap2D * serial = serial_layers.getCostmap();
+      nav2_costmap_2d::Costmap2D * tiled = tiled_layers.getCostmap();
+      ASSERT_EQ(serial->getSizeInCellsX(), tiled->getSizeInCellsX());
+      ASSERT_EQ(serial->getSizeInCellsY(), tiled->getSizeInCellsY());
+      for (unsigned int j = 0; j < serial->getSizeInCellsY(); ++j) {
+        for (unsigned int i = 0; i < serial->getSizeInCellsX(); ++i) {
+          EXPECT_EQ(serial->getCost(i, j), tiled->getCost(i, j)) << "at " << i << ", " << j;
+        }
+      }
+    };
+
+  serial_layers.updateMap(0, 0, 0);
+  tiled_layers.updateMap(0, 0, 0);
+  expectEqualMaps();
+
+  for (auto & olayer : {serial_olayer, tiled_olayer}) {
+    addObservation(olayer, 0, 0, 0.4);
+    addObservation(olayer, 2, 0);
+    addObservation(olayer, 1, 9);
+  }
+  serial_layers.updateMap(0, 0, 0);
+  tiled_layers.updateMap(0, 0, 0);
+  expectEqualMaps();
+  ASSERT_EQ(tiled_layers.getCostmap()->getCost(1, 9), nav2_costmap_2d::LETHAL_OBSTACLE);
+}
+
+/**
+ * Test that the distance transform engine matches the wavefront as obstacles change
+ */
+TEST_F(TestNode, testDistanceTransformMatchesWavefront)
+{
+  std::vector<rclcpp::Parameter> parameters;
+  for (const std::string name : {"inflation", "dt_inflation"}) {
+    parameters.push_back(rclcpp::Parameter(name + ".cost_scaling_factor", 1.0));
+    parameters.push_back(rclcpp::Parameter(name + ".inflation_radius", 1.0));
+  }
+  parameters.push_back(
+    rclcpp::Parameter("dt_inflation.inflation_engine", std::string("distance_transform")));
+  initNode(parameters);
+  tf2_ros::Buffer tf(node_->get_clock());
+  nav2_costmap_2d::LayeredCostmap wavefront_layers("frame", false, false);
+  nav2_costmap_2d::LayeredCostmap dt_layers("frame", false, false);
+
+  std::shared_ptr<nav2_costmap_2d::StaticLayer> wavefront_slayer = nullptr, dt_slayer = nullptr;
+  std::shared_ptr<nav2_costmap_2d::ObstacleLayer> wavefront_olayer = nullptr, dt_olayer = nullptr;
+  std::shared_ptr<nav2_costmap_2d::InflationLayer> wavefront_ilayer = nullptr;
+  for (auto * layers : {&wavefront_layers, &dt_layers}) {
+    const bool dt = layers == &dt_layers;
+    std::vector<Point> polygon = setRadii(*layers, 1, 1);
+    addStaticLayer(*layers, tf, node_, dt ? dt_slayer : wavefront_slayer);
+    addObstacleLayer(*layers, tf, node_, dt ? dt_olayer : wavefront_olayer);
+    if (dt) {
+      auto dt_ilayer = std::make_shared<nav2_costmap_2d::InflationLayer>();
+      dt_ilayer->initialize(layers, "dt_inflation", &tf, node_, nullptr);
+      layers->addPlugin(dt_ilayer);
+    } else {
+      addInflationLayer(*layers, tf, node_, wavefront_ilayer);
+    }
+    layers->setFootprint(polygon);
+  }
+  waitForMap(wavefront_slayer);
+  waitForMap(dt_slayer);
+
+  auto expectEqualMaps = [&]() {
+      nav2_costmap_2d::Costmap2D * wavefront = wavefront_layers.getCostmap();
+      nav2_costmap_2d::Costmap2D * dt = dt_layers.getCostmap();
+      for (unsigned int j = 0; j < wavefront->getSizeInCellsY(); ++j) {
+        for (unsigned int i = 0; i < wavefront->getSizeInCellsX(); ++i) {
+          EXPECT_EQ(wavefront->getCost(i, j), dt->getCost(i, j)) << "at " << i << ", " << j;
+        }
+      }
+    };
+
+  wavefront_layers.updateMap(0, 0, 0);
+  dt_layers.updateMap(0, 0, 0);
+  expectEqualMaps();
+
+  // Obstacles appearing and disappearing only recompute the distance field around them
+  for (auto & olayer : {wavefront_olayer, dt_olayer}) {
+    addObservation(olayer, 0, 0, 0.4);
+    addObservation(olayer, 2, 0);
+    addObservation(olayer, 1, 9);
+  }
+  wavefront_layers.updateMap(0, 0, 0);
+  dt_layers.updateMap(0, 0, 0);
+  expectEqualMaps();
+  ASSERT_EQ(dt_layers.getCostmap()->getCost(1, 9), nav2_costmap_2d::LETHAL_OBSTACLE);
+
+  for (auto & olayer : {wavefront_olayer, dt_olayer}) {
+    olayer->clearStaticObservations(true, true);
+    olayer->reset();
+    addObservation(olayer, 5, 5);
+  }
+  wavefront_layers.updateMap(0, 0, 0);
+  dt_layers.updateMap(0, 0, 0);
+  expectEqualMaps();
+  ASSERT_EQ(dt_layers.getCostmap()->getCost(5, 5), nav2_costmap_2d::LETHAL_OBSTACLE);
+}
+
 /**
  * Test specific inflation scenario to ensure we do not set inflated obstacles to be raw obstacles.
  */
@@ -41,6 +41,7 @@
 #include "nav2_costmap_2d/costmap_2d.hpp"
 #include "nav2_costmap_2d/layered_costmap.hpp"
 #include "nav2_costmap_2d/observation_buffer.hpp"
+#include "nav2_costmap_2d/voxel_layer.hpp"
 #include "../testing_helper.hpp"
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
 
@@ -400,6 +401,154 @@ TEST_F(TestNode, testRaytracing) {
   ASSERT_EQ(lethal_count, 1);
 }
 
+/**
+ * Test for ray tracing free space in angular bins
+ */
+TEST_F(TestNode, testAngularBinRaytracing) {
+  tf2_ros::Buffer tf(node_->get_clock());
+
+  nav2_costmap_2d::LayeredCostmap layers("frame", false, false);
+  layers.resizeMap(10, 10, 1, 0, 0);
+
+  std::shared_ptr<nav2_costmap_2d::ObstacleLayer> olayer = nullptr;
+  addObstacleLayer(layers, tf, node_, olayer);
+  node_->set_parameter(rclcpp::Parameter("obstacles.raytrace_angular_resolution", 0.1));
+
+  // Fill in the diagonal and the first column, except <0,0> for the sensor
+  for (int i = 1; i < 10; ++i) {
+    olayer->setCost(i, i, nav2_costmap_2d::LETHAL_OBSTACLE);
+    olayer->setCost(0, i, nav2_costmap_2d::LETHAL_OBSTACLE);
+  }
+
+  // Two of the points are in the same angular bin, so a single ray is traced to the farthest
+  sensor_msgs::msg::PointCloud2 cloud;
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(3);
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  const float points[3][2] = {{5.5, 5.5}, {9.5, 9.5}, {0.5, 9.5}};
+  for (const auto & point : points) {
+    *iter_x = point[0];
+    *iter_y = point[1];
+    ++iter_x;
+    ++iter_y;
+  }
+  geometry_msgs::msg::Point origin;
+  origin.x = 0.5;
+  origin.y = 0.5;
+  nav2_costmap_2d::Observation obs(origin, cloud, 100.0, 0.0, 100.0, 0.0);
+  olayer->addStaticObservation(obs, false, true);
+
+  layers.updateMap(0, 0, 0);
+
+  // Both bins are cleared up to their farthest points
+  ASSERT_EQ(countValues(*(layers.getCostmap()), nav2_costmap_2d::LETHAL_OBSTACLE), 2);
+  ASSERT_EQ(layers.getCostmap()->getCost(9, 9), nav2_costmap_2d::LETHAL_OBSTACLE);
+  ASSERT_EQ(layers.getCostmap()->getCost(0, 9), nav2_costmap_2d::LETHAL_OBSTACLE);
+  ASSERT_EQ(layers.getCostmap()->getCost(5, 5), nav2_costmap_2d::FREE_SPACE);
+}
+
+/**
+ * Test for rejecting raytrace bin widths and tracing every ray when the bins are too many
+ */
+TEST_F(TestNode, testRaytraceBinLimits) {
+  tf2_ros::Buffer tf(node_->get_clock());
+
+  nav2_costmap_2d::LayeredCostmap layers("frame", false, false);
+  layers.resizeMap(10, 10, 1, 0, 0);
+
+  std::shared_ptr<nav2_costmap_2d::ObstacleLayer> olayer = nullptr;
+  addObstacleLayer(layers, tf, node_, olayer);
+
+  // Negative bin widths are rejected, keeping the previous ones
+  ASSERT_TRUE(
+    node_->set_parameter(
+      rclcpp::Parameter("obstacles.raytrace_angular_resolution", 0.1)).successful);
+  EXPECT_FALSE(
+    node_->set_parameter(
+      rclcpp::Parameter("obstacles.raytrace_angular_resolution", -0.1)).successful);
+  EXPECT_FALSE(
+    node_->set_parameter(
+      rclcpp::Parameter("obstacles.raytrace_range_resolution", -1.0)).successful);
+  EXPECT_EQ(node_->get_parameter("obstacles.raytrace_angular_resolution").as_double(), 0.1);
+  EXPECT_EQ(node_->get_parameter("obstacles.raytrace_range_resolution").as_double(), 0.0);
+
+  // Bin widths giving too many bins to allocate fall back to tracing a ray to every point
+  ASSERT_TRUE(
+    node_->set_parameter(
+      rclcpp::Parameter("obstacles.raytrace_angular_resolution", 1e-9)).successful);
+  ASSERT_TRUE(
+    node_->set_parameter(
+      rclcpp::Parameter("obstacles.raytrace_range_resolution", 1e-9)).successful);
+
+  // Fill in the diagonal and the first column, except <0,0> for the sensor
+  for (int i = 1; i < 10; ++i) {
+    olayer->setCost(i, i, nav2_costmap_2d::LETHAL_OBSTACLE);
+    olayer->setCost(0, i, nav2_costmap_2d::LETHAL_OBSTACLE);
+  }
+
+  sensor_msgs::msg::PointCloud2 cloud;
+  sensor_msgs::PointCloud2Modifier modifier(cloud);
+  modifier.setPointCloud2FieldsByString(1, "xyz");
+  modifier.resize(3);
+  sensor_msgs::PointCloud2Iterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2Iterator<float> iter_y(cloud, "y");
+  const float points[3][2] = {{5.5, 5.5}, {9.5, 9.5}, {0.5, 9.5}};
+  for (const auto & point : points) {
+    *iter_x = point[0];
+    *iter_y = point[1];
+    ++iter_x;
+    ++iter_y;
+  }
+  geometry_msgs::msg::Point origin;
+  origin.x = 0.5;
+  origin.y = 0.5;
+  nav2_costmap_2d::Observation obs(origin, cloud, 100.0, 0.0, 100.0, 0.0);
+  olayer->addStaticObservation(obs, false, true);
+
+  layers.updateMap(0, 0, 0);
+
+  // Every ray is cleared up to its point
+  ASSERT_EQ(countValues(*(layers.getCostmap()), nav2_costmap_2d::LETHAL_OBSTACLE), 2);
+  ASSERT_EQ(layers.getCostmap()->getCost(9, 9), nav2_costmap_2d::LETHAL_OBSTACLE);
+  ASSERT_EQ(layers.getCostmap()->getCost(0, 9), nav2_costmap_2d::LETHAL_OBSTACLE);
+  ASSERT_EQ(layers.getCostmap()->getCost(5, 5), nav2_costmap_2d::FREE_SPACE);
+}
+
+/**
+ * Test for marking and clearing above 16 z voxels with a sparse voxel grid, clearing in parallel
+ */
+TEST_F(TestNode, testSparseVoxelRaytracing) {
+  tf2_ros::Buffer tf(node_->get_clock());
+
+  nav2_costmap_2d::LayeredCostmap layers("frame", false, false);
+  layers.resizeMap(40, 40, 1, 0, 0);
+  layers.setUpdateThreads(4, 8);
+
+  node_->declare_parameter("voxels.use_sparse_voxel_grid", rclcpp::ParameterValue(true));
+  node_->declare_parameter("voxels.z_voxels", rclcpp::ParameterValue(30));
+  node_->declare_parameter("voxels.max_obstacle_height", rclcpp::ParameterValue(10.0));
+  std::shared_ptr<nav2_costmap_2d::ObstacleLayer> vlayer =
+    std::make_shared<nav2_costmap_2d::VoxelLayer>();
+  vlayer->initialize(&layers, "voxels", &tf, node_, nullptr);
+  layers.addPlugin(std::shared_ptr<nav2_costmap_2d::Layer>(vlayer));
+
+  // Mark two obstacles in the 26th z voxel
+  addObservation(vlayer, 20.5, 20.5, 5.1, 0.5, 0.5, 5.1, true, false);
+  addObservation(vlayer, 10.5, 30.5, 5.1, 0.5, 0.5, 5.1, true, false);
+  layers.updateMap(0, 0, 0);
+  ASSERT_EQ(countValues(*(layers.getCostmap()), nav2_costmap_2d::LETHAL_OBSTACLE), 2);
+
+  // Clear through the first of them, across several strips of the map
+  vlayer->clearStaticObservations(true, false);
+  addObservation(vlayer, 35.5, 35.5, 5.1, 0.5, 0.5, 5.1, false, true);
+  layers.updateMap(0, 0, 0);
+  ASSERT_EQ(countValues(*(layers.getCostmap()), nav2_costmap_2d::LETHAL_OBSTACLE), 1);
+  ASSERT_EQ(layers.getCostmap()->getCost(10, 30), nav2_costmap_2d::LETHAL_OBSTACLE);
+  ASSERT_NE(layers.getCostmap()->getCost(20, 20), nav2_costmap_2d::LETHAL_OBSTACLE);
+}
+
 /**
  * Test dynamic parameter setting of obstacle layer
  */
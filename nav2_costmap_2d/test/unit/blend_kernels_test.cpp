@@ -0,0 +1,149 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "nav2_costmap_2d/blend_kernels.hpp"
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+
+using nav2_costmap_2d::BlendMode;
+using nav2_costmap_2d::NO_INFORMATION;
+
+const BlendMode kModes[] = {
+  BlendMode::TrueOverwrite, BlendMode::Overwrite, BlendMode::Max,
+  BlendMode::MaxWithoutUnknownOverwrite, BlendMode::Addition};
+
+// The blend of a single cell, as written in the CostmapLayer::updateWith* methods
+unsigned char referenceBlend(BlendMode mode, unsigned char old_cost, unsigned char cost)
+{
+  switch (mode) {
+    case BlendMode::TrueOverwrite:
+      return cost;
+    case BlendMode::Overwrite:
+      return cost != NO_INFORMATION ? cost : old_cost;
+    case BlendMode::Max:
+      if (cost == NO_INFORMATION) {
+        return old_cost;
+      }
+      return (old_cost == NO_INFORMATION || old_cost < cost) ? cost : old_cost;
+    case BlendMode::MaxWithoutUnknownOverwrite:
+      if (cost == NO_INFORMATION) {
+        return old_cost;
+      }
+      return (old_cost != NO_INFORMATION && old_cost < cost) ? cost : old_cost;
+    case BlendMode::Addition:
+      {
+        if (cost == NO_INFORMATION) {
+          return old_cost;
+        }
+        if (old_cost == NO_INFORMATION) {
+          return cost;
+        }
+        const int sum = old_cost + cost;
+        if (sum >= nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE) {
+          return nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE - 1;
+        }
+        return sum;
+      }
+  }
+  return old_cost;
+}
+
+TEST(BlendKernels, allCosts)
+{
+  SCOPED_TRACE(std::string("Blend kernels: ") + nav2_costmap_2d::blendKernelsName());
+
+  // Rows of every pair of costs, long enough for the vector kernels and a scalar tail
+  std::vector<unsigned char> old_costs, costs;
+  for (int old_cost = 0; old_cost < 256; ++old_cost) {
+    for (int cost = 0; cost < 256; ++cost) {
+      old_costs.push_back(old_cost);
+      costs.push_back(cost);
+    }
+  }
+  old_costs.push_back(NO_INFORMATION);
+  costs.push_back(NO_INFORMATION);
+
+  for (const BlendMode mode : kModes) {
+    std::vector<unsigned char> vector_row(old_costs), scalar_row(old_costs);
+    const unsigned char * layer = costs.data();
+    nav2_costmap_2d::blendRows(mode, vector_row.data(), &layer, 1, costs.size());
+    nav2_costmap_2d::blendRowsScalar(mode, scalar_row.data(), &layer, 1, costs.size());
+    for (std::size_t i = 0; i < costs.size(); ++i) {
+      const unsigned char expected = referenceBlend(mode, old_costs[i], costs[i]);
+      ASSERT_EQ(vector_row[i], expected) << "mode " << static_cast<int>(mode) <<
+        ", master " << static_cast<int>(old_costs[i]) << ", cost " << static_cast<int>(costs[i]);
+      ASSERT_EQ(scalar_row[i], expected);
+    }
+  }
+}
+
+TEST(BlendKernels, fusedWindow)
+{
+  std::mt19937 generator(42);
+  auto random_cost = [&]() -> unsigned char {
+      return generator() % 3 == 0 ? NO_INFORMATION : generator() % 256;
+    };
+
+  const unsigned int size_x = 77, size_y = 13;
+  for (const BlendMode mode : kModes) {
+    // More layers than are fused in a single pass
+    for (unsigned int num_layers = 1; num_layers <= 11; ++num_layers) {
+      nav2_costmap_2d::Costmap2D fused(size_x, size_y, 0.05, 0.0, 0.0);
+      for (unsigned int j = 0; j < size_y; ++j) {
+        for (unsigned int i = 0; i < size_x; ++i) {
+          fused.setCost(i, j, random_cost());
+        }
+      }
+      nav2_costmap_2d::Costmap2D sequential(fused);
+
+      std::vector<std::vector<unsigned char>> layers(num_layers);
+      std::vector<const unsigned char *> layer_costs;
+      for (auto & layer : layers) {
+        for (unsigned int k = 0; k < size_x * size_y; ++k) {
+          layer.push_back(random_cost());
+        }
+        layer_costs.push_back(layer.data());
+      }
+
+      nav2_costmap_2d::blendWindow(
+        mode, fused, layer_costs.data(), num_layers, 3, 2, size_x - 5, size_y - 1);
+      for (const auto & layer : layers) {
+        for (unsigned int j = 2; j < size_y - 1; ++j) {
+          for (unsigned int i = 3; i < size_x - 5; ++i) {
+            sequential.setCost(
+              i, j, referenceBlend(mode, sequential.getCost(i, j), layer[j * size_x + i]));
+          }
+        }
+      }
+
+      for (unsigned int j = 0; j < size_y; ++j) {
+        for (unsigned int i = 0; i < size_x; ++i) {
+          ASSERT_EQ(fused.getCost(i, j), sequential.getCost(i, j));
+        }
+      }
+    }
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
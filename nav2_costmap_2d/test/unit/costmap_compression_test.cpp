@@ -0,0 +1,164 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_costmap_2d/costmap_compression.hpp"
+
+using nav2_costmap_2d::FREE_SPACE;
+using nav2_costmap_2d::LETHAL_OBSTACLE;
+using nav2_costmap_2d::NO_INFORMATION;
+
+// Costmap-like data: long runs of free and unknown space around scattered obstacles
+std::vector<unsigned char> makeCosts(std::size_t n, unsigned int seed)
+{
+  std::mt19937 generator(seed);
+  std::vector<unsigned char> costs;
+  while (costs.size() < n) {
+    const unsigned int sample = generator() % 4;
+    const std::size_t length = sample == 0 ? generator() % 3000 : generator() % 12;
+    const unsigned char cost = sample == 0 ? (generator() % 2 ? FREE_SPACE : NO_INFORMATION) :
+      (sample == 1 ? LETHAL_OBSTACLE : generator() % 256);
+    for (std::size_t k = 0; k < length && costs.size() < n; ++k) {
+      costs.push_back(sample == 3 ? generator() % 256 : cost);
+    }
+  }
+  return costs;
+}
+
+TEST(CostmapCompression, runLengthRoundTrip)
+{
+  for (const std::size_t n : {0ul, 1ul, 3ul, 4ul, 17ul, 1000ul, 250000ul}) {
+    const auto costs = makeCosts(n, n);
+    std::vector<uint8_t> encoded;
+    nav2_costmap_2d::encodeRunLength(costs.data(), costs.size(), encoded);
+    std::vector<unsigned char> decoded(n);
+    ASSERT_TRUE(
+      nav2_costmap_2d::decodeRunLength(encoded.data(), encoded.size(), decoded.data(), n));
+    EXPECT_EQ(decoded, costs);
+  }
+
+  // A single run of a whole costmap is a couple of bytes
+  std::vector<unsigned char> unknown(1000000, NO_INFORMATION);
+  std::vector<uint8_t> encoded;
+  nav2_costmap_2d::encodeRunLength(unknown.data(), unknown.size(), encoded);
+  EXPECT_LE(encoded.size(), 5u);
+
+  // Costs without any runs grow only by the token headers
+  std::vector<unsigned char> ramp(1000);
+  for (std::size_t i = 0; i < ramp.size(); ++i) {
+    ramp[i] = static_cast<unsigned char>(i);
+  }
+  encoded.clear();
+  nav2_costmap_2d::encodeRunLength(ramp.data(), ramp.size(), encoded);
+  EXPECT_EQ(encoded.size(), ramp.size() + 2);
+}
+
+TEST(CostmapCompression, runLengthInvalid)
+{
+  const auto costs = makeCosts(5000, 7);
+  std::vector<uint8_t> encoded;
+  nav2_costmap_2d::encodeRunLength(costs.data(), costs.size(), encoded);
+  std::vector<unsigned char> decoded(costs.size());
+
+  // Truncated, too short or too long for the number of costs expected
+  EXPECT_FALSE(
+    nav2_costmap_2d::decodeRunLength(
+      encoded.data(), encoded.size() - 1, decoded.data(), decoded.size()));
+  EXPECT_FALSE(
+    nav2_costmap_2d::decodeRunLength(
+      encoded.data(), encoded.size(), decoded.data(), decoded.size() + 1));
+  EXPECT_FALSE(
+    nav2_costmap_2d::decodeRunLength(
+      encoded.data(), encoded.size(), decoded.data(), decoded.size() - 1));
+
+  // Unterminated varint and a run missing its cost
+  const std::vector<uint8_t> unterminated(12, 0xFF);
+  EXPECT_FALSE(
+    nav2_costmap_2d::decodeRunLength(
+      unterminated.data(), unterminated.size(), decoded.data(), decoded.size()));
+  const std::vector<uint8_t> missing_cost = {0x03};
+  EXPECT_FALSE(nav2_costmap_2d::decodeRunLength(missing_cost.data(), 1, decoded.data(), 2));
+}
+
+TEST(CostmapCompression, tileRoundTrip)
+{
+  const unsigned int size_x = 300, size_y = 200;
+  const auto costs = makeCosts(size_x * size_y, 3);
+  std::vector<unsigned char> decoded(size_x * size_y, FREE_SPACE);
+
+  nav2_msgs::msg::CostmapTile raw, compressed;
+  nav2_costmap_2d::encodeTile(costs.data(), size_x, 40, 30, 100, 120, false, raw);
+  nav2_costmap_2d::encodeTile(costs.data(), size_x, 40, 30, 100, 120, true, compressed);
+  EXPECT_EQ(raw.encoding, nav2_msgs::msg::CostmapTile::ENCODING_RAW);
+  EXPECT_EQ(raw.data.size(), 100u * 120u);
+  EXPECT_EQ(compressed.encoding, nav2_msgs::msg::CostmapTile::ENCODING_RLE);
+  EXPECT_LT(compressed.data.size(), raw.data.size());
+
+  for (const auto & tile : {raw, compressed}) {
+    std::fill(decoded.begin(), decoded.end(), FREE_SPACE);
+    ASSERT_TRUE(nav2_costmap_2d::decodeTile(tile, decoded.data(), size_x, size_y));
+    for (unsigned int j = 0; j < size_y; ++j) {
+      for (unsigned int i = 0; i < size_x; ++i) {
+        const bool inside = i >= 40 && i < 140 && j >= 30 && j < 150;
+        ASSERT_EQ(decoded[j * size_x + i], inside ? costs[j * size_x + i] : FREE_SPACE);
+      }
+    }
+  }
+
+  // Tiles outside of the costmap or not matching their size are rejected
+  auto outside = raw;
+  outside.x = 250;
+  EXPECT_FALSE(nav2_costmap_2d::decodeTile(outside, decoded.data(), size_x, size_y));
+  auto short_tile = raw;
+  short_tile.data.pop_back();
+  EXPECT_FALSE(nav2_costmap_2d::decodeTile(short_tile, decoded.data(), size_x, size_y));
+  auto unknown_encoding = raw;
+  unknown_encoding.encoding = 7;
+  EXPECT_FALSE(nav2_costmap_2d::decodeTile(unknown_encoding, decoded.data(), size_x, size_y));
+}
+
+TEST(CostmapCompression, shiftMatchesUpdateOrigin)
+{
+  const unsigned int size_x = 37, size_y = 23;
+  const double resolution = 0.5;
+  const auto costs = makeCosts(size_x * size_y, 11);
+
+  for (int shift_y = -25; shift_y <= 25; shift_y += 5) {
+    for (int shift_x = -40; shift_x <= 40; shift_x += 3) {
+      nav2_costmap_2d::Costmap2D costmap(size_x, size_y, resolution, 0.0, 0.0, NO_INFORMATION);
+      std::copy(costs.begin(), costs.end(), costmap.getCharMap());
+      costmap.updateOrigin(shift_x * resolution, shift_y * resolution);
+
+      std::vector<unsigned char> shifted(costs);
+      nav2_costmap_2d::shiftCostmapData(
+        shifted.data(), size_x, size_y, shift_x, shift_y, NO_INFORMATION);
+      for (unsigned int k = 0; k < size_x * size_y; ++k) {
+        ASSERT_EQ(shifted[k], costmap.getCharMap()[k]) <<
+          "shift " << shift_x << ", " << shift_y << " at cell " << k;
+      }
+    }
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -16,10 +16,13 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "rclcpp/rclcpp.hpp"
 #include "nav2_util/occ_grid_values.hpp"
 #include "nav_msgs/msg/occupancy_grid.hpp"
+#include "tf2/LinearMath/Quaternion.hpp"
+#include "tf2/LinearMath/Transform.hpp"
 #include "geometry_msgs/msg/pose2_d.hpp"
 #include "nav2_costmap_2d/costmap_2d.hpp"
 #include "nav2_costmap_2d/cost_values.hpp"
@@ -44,6 +47,18 @@ public:
     return nav2_costmap_2d::CostmapFilter::getMaskCost(filter_mask, mx, my);
   }
 
+  template<typename VisitorT>
+  void forEachMaskCell(
+    const nav2_costmap_2d::Costmap2D & master_grid,
+    nav_msgs::msg::OccupancyGrid::ConstSharedPtr filter_mask,
+    const tf2::Transform & transform,
+    unsigned int min_i, unsigned int min_j, unsigned int max_i, unsigned int max_j,
+    VisitorT && visit) const
+  {
+    nav2_costmap_2d::CostmapFilter::forEachMaskCell(
+      master_grid, filter_mask, transform, min_i, min_j, max_i, max_j, visit);
+  }
+
   // API coverage
   void initializeFilter(const std::string &) {}
   void process(
@@ -129,6 +144,58 @@ TEST(CostmapFilter, testGetMaskCost)
   ASSERT_EQ(cf.getMaskCost(mask, 1, 1), nav2_costmap_2d::LETHAL_OBSTACLE);
 }
 
+TEST(CostmapFilter, testForEachMaskCell)
+{
+  // 5cm master grid partially overlapping a mask, sampled at the same resolution,
+  // at a coarser one, and rotated
+  nav2_costmap_2d::Costmap2D master_grid(120, 90, 0.05, -3.0, 2.0);
+  auto mask = std::make_shared<nav_msgs::msg::OccupancyGrid>();
+  mask->header.frame_id = "map";
+  mask->info.width = 70;
+  mask->info.height = 50;
+  mask->info.origin.position.x = -2.0;
+  mask->info.origin.position.y = 2.5;
+  mask->data.resize(mask->info.width * mask->info.height, nav2_util::OCC_GRID_OCCUPIED);
+
+  CostmapFilterWrapper cf;
+  const unsigned int min_i = 10, min_j = 5, max_i = 110, max_j = 80;
+  for (const float resolution : {0.05f, 0.08f}) {
+    for (const double yaw : {0.0, 0.3}) {
+      mask->info.resolution = resolution;
+      tf2::Transform transform(
+        tf2::Quaternion(tf2::Vector3(0.0, 0.0, 1.0), yaw), tf2::Vector3(0.2, -0.1, 0.0));
+
+      std::vector<int> mask_indexes(
+        master_grid.getSizeInCellsX() * master_grid.getSizeInCellsY(), -1);
+      cf.forEachMaskCell(
+        master_grid, mask, transform, min_i, min_j, max_i, max_j,
+        [&](unsigned int index, unsigned int mask_index) {
+          mask_indexes[index] = mask_index;
+        });
+
+      // Compare with converting each cell to the mask
+      unsigned int in_mask = 0;
+      for (unsigned int j = 0; j < master_grid.getSizeInCellsY(); j++) {
+        for (unsigned int i = 0; i < master_grid.getSizeInCellsX(); i++) {
+          double wx, wy;
+          master_grid.mapToWorld(i, j, wx, wy);
+          const tf2::Vector3 point = transform * tf2::Vector3(wx, wy, 0.0);
+          unsigned int mx, my;
+          int expected = -1;
+          if (i >= min_i && i < max_i && j >= min_j && j < max_j &&
+            cf.worldToMask(mask, point.x(), point.y(), mx, my))
+          {
+            expected = my * mask->info.width + mx;
+            in_mask++;
+          }
+          ASSERT_EQ(mask_indexes[master_grid.getIndex(i, j)], expected);
+        }
+      }
+      EXPECT_GT(in_mask, 0u);
+    }
+  }
+}
+
 int main(int argc, char ** argv)
 {
   // Initialize the system
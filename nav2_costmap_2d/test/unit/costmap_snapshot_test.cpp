@@ -0,0 +1,165 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_costmap_2d/costmap_snapshot.hpp"
+
+using nav2_costmap_2d::Costmap2D;
+using nav2_costmap_2d::CostmapSnapshotBuffer;
+
+void expectSameCostmap(const Costmap2D & snapshot, const Costmap2D & costmap)
+{
+  ASSERT_EQ(snapshot.getSizeInCellsX(), costmap.getSizeInCellsX());
+  ASSERT_EQ(snapshot.getSizeInCellsY(), costmap.getSizeInCellsY());
+  EXPECT_EQ(snapshot.getResolution(), costmap.getResolution());
+  EXPECT_EQ(snapshot.getOriginX(), costmap.getOriginX());
+  EXPECT_EQ(snapshot.getOriginY(), costmap.getOriginY());
+  for (unsigned int j = 0; j < costmap.getSizeInCellsY(); ++j) {
+    for (unsigned int i = 0; i < costmap.getSizeInCellsX(); ++i) {
+      ASSERT_EQ(snapshot.getCost(i, j), costmap.getCost(i, j)) << "cell " << i << ", " << j;
+    }
+  }
+}
+
+TEST(CostmapSnapshot, heldSnapshotsDoNotChange)
+{
+  CostmapSnapshotBuffer snapshots;
+  EXPECT_EQ(snapshots.get(), nullptr);
+
+  Costmap2D costmap(40, 30, 0.1, 1.0, 2.0, nav2_costmap_2d::FREE_SPACE);
+  snapshots.update(costmap, 0, 40, 0, 30);
+  auto first = snapshots.get();
+  ASSERT_NE(first, nullptr);
+  expectSameCostmap(*first, costmap);
+
+  // Later updates, even more than there are buffers, leave the held snapshot alone
+  Costmap2D first_costmap(costmap);
+  for (unsigned int k = 0; k < 10; ++k) {
+    costmap.setCost(k, k, nav2_costmap_2d::LETHAL_OBSTACLE);
+    snapshots.update(costmap, k, k + 1, k, k + 1);
+    expectSameCostmap(*snapshots.get(), costmap);
+  }
+  expectSameCostmap(*first, first_costmap);
+}
+
+TEST(CostmapSnapshot, buffersAreReused)
+{
+  CostmapSnapshotBuffer snapshots(3);
+  Costmap2D costmap(20, 20, 0.1, 0.0, 0.0, nav2_costmap_2d::FREE_SPACE);
+  std::set<const Costmap2D *> buffers;
+  for (unsigned int k = 0; k < 20; ++k) {
+    costmap.setCost(k, 19 - k, nav2_costmap_2d::LETHAL_OBSTACLE);
+    snapshots.update(costmap, k, k + 1, 19 - k, 20 - k);
+    auto snapshot = snapshots.get();
+    expectSameCostmap(*snapshot, costmap);
+    buffers.insert(snapshot.get());
+  }
+  EXPECT_LE(buffers.size(), 2u);
+}
+
+TEST(CostmapSnapshot, randomUpdates)
+{
+  std::mt19937 generator(42);
+  CostmapSnapshotBuffer snapshots(3);
+  Costmap2D costmap(64, 48, 0.05, 0.0, 0.0, nav2_costmap_2d::NO_INFORMATION);
+  snapshots.update(costmap, 0, 0, 0, 0);
+
+  // Snapshots held for a few updates each, as slow readers do
+  std::vector<std::pair<std::shared_ptr<const Costmap2D>, std::unique_ptr<Costmap2D>>> held;
+  for (unsigned int k = 0; k < 500; ++k) {
+    const unsigned int action = generator() % 20;
+    unsigned int x0 = 0, xn = 0, y0 = 0, yn = 0;
+    if (action == 0) {
+      // Rolling window move, detected from the origin
+      costmap.updateOrigin(
+        costmap.getOriginX() + (static_cast<int>(generator() % 9) - 4) * 0.05,
+        costmap.getOriginY() + (static_cast<int>(generator() % 9) - 4) * 0.05);
+    } else if (action == 1) {
+      // Reset outside of any window
+      costmap.resetMap(0, 0, costmap.getSizeInCellsX(), costmap.getSizeInCellsY());
+      snapshots.invalidate();
+    } else {
+      x0 = generator() % 64;
+      xn = x0 + 1 + generator() % (64 - x0);
+      y0 = generator() % 48;
+      yn = y0 + 1 + generator() % (48 - y0);
+      for (unsigned int j = y0; j < yn; ++j) {
+        for (unsigned int i = x0; i < xn; ++i) {
+          costmap.setCost(i, j, generator() % 256);
+        }
+      }
+    }
+    snapshots.update(costmap, x0, xn, y0, yn);
+    expectSameCostmap(*snapshots.get(), costmap);
+
+    if (generator() % 3 == 0) {
+      held.emplace_back(snapshots.get(), std::make_unique<Costmap2D>(costmap));
+    }
+    if (held.size() > 4 || (!held.empty() && generator() % 4 == 0)) {
+      const std::size_t index = generator() % held.size();
+      expectSameCostmap(*held[index].first, *held[index].second);
+      held.erase(held.begin() + index);
+    }
+  }
+}
+
+TEST(CostmapSnapshot, concurrentReaders)
+{
+  CostmapSnapshotBuffer snapshots;
+  Costmap2D costmap(100, 100, 0.1, 0.0, 0.0, 0);
+  snapshots.update(costmap, 0, 100, 0, 100);
+
+  // Each update fills the whole costmap with a single cost, so readers can tell whether
+  // a snapshot was changed while they held it
+  std::atomic<bool> done{false};
+  std::atomic<unsigned int> torn{0};
+  auto reader = [&]() {
+      while (!done) {
+        auto snapshot = snapshots.get();
+        const unsigned char * data = snapshot->getCharMap();
+        for (unsigned int k = 0; k < 100 * 100; ++k) {
+          if (data[k] != data[0]) {
+            ++torn;
+            break;
+          }
+        }
+      }
+    };
+  std::thread first_reader(reader), second_reader(reader);
+  for (unsigned int k = 1; k < 2000; ++k) {
+    costmap.resetMap(0, 0, 100, 100);
+    std::fill(costmap.getCharMap(), costmap.getCharMap() + 100 * 100, k % 250);
+    snapshots.update(costmap, 0, 100, 0, 100);
+  }
+  done = true;
+  first_reader.join();
+  second_reader.join();
+  EXPECT_EQ(torn, 0u);
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -12,13 +12,20 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 #include <memory>
+#include <random>
+#include <set>
+#include <utility>
 
 #include "gtest/gtest.h"
 #include "nav2_costmap_2d/footprint_collision_checker.hpp"
 #include "nav2_costmap_2d/footprint.hpp"
+#include "nav2_costmap_2d/footprint_stencil.hpp"
+#include "nav2_util/line_iterator.hpp"
 
 TEST(collision_footprint, test_basic)
 {
@@ -158,6 +165,165 @@ TEST(collision_footprint, test_point_and_line_cost)
   EXPECT_NEAR(right_value, 254.0, 0.001);
 }
 
+nav2_costmap_2d::Footprint makeStencilFootprint()
+{
+  // Non-convex, off-center footprint
+  nav2_costmap_2d::Footprint footprint;
+  for (const auto & xy : std::vector<std::pair<double, double>>{
+      {0.62, 0.31}, {0.12, 0.28}, {0.05, 0.05}, {-0.33, 0.29}, {-0.41, -0.27}, {0.58, -0.33}})
+  {
+    geometry_msgs::msg::Point p;
+    p.x = xy.first;
+    p.y = xy.second;
+    footprint.push_back(p);
+  }
+  return footprint;
+}
+
+TEST(collision_footprint, test_stencil_matches_footprint_cost)
+{
+  std::shared_ptr<nav2_costmap_2d::Costmap2D> costmap_ =
+    std::make_shared<nav2_costmap_2d::Costmap2D>(60, 50, 0.05, 1.0, -2.0, 0);
+  std::mt19937 generator(5);
+  for (unsigned int k = 0; k < 300; ++k) {
+    costmap_->setCost(generator() % 60, generator() % 50, 1 + generator() % 254);
+  }
+  const auto footprint = makeStencilFootprint();
+
+  nav2_costmap_2d::FootprintCollisionChecker<std::shared_ptr<nav2_costmap_2d::Costmap2D>>
+  collision_checker(costmap_), stencil_checker(costmap_);
+  stencil_checker.setUseFootprintStencils(true);
+
+  // At the headings and positions in a cell the stencils are rasterised for, the stencils
+  // are the rasterised footprints, also where the footprint is partly off the map
+  unsigned int lethal = 0, off_map = 0;
+  nav2_costmap_2d::FootprintStencil stencil(footprint, 0.05);
+  for (unsigned int k = 0; k < 2000; ++k) {
+    const double theta = 2.0 * M_PI * (generator() % stencil.getNumHeadings()) /
+      stencil.getNumHeadings() - 2.0 * M_PI * (generator() % 2);
+    const double x = 1.0 + 0.05 * (generator() % 60 + (generator() % 2 ? 0.25 : 0.75));
+    const double y = -2.0 + 0.05 * (generator() % 50 + (generator() % 2 ? 0.25 : 0.75));
+    const double expected = collision_checker.footprintCostAtPose(x, y, theta, footprint);
+    EXPECT_EQ(stencil_checker.footprintCostAtPose(x, y, theta, footprint), expected) <<
+      "pose " << x << ", " << y << ", " << theta;
+    unsigned int mx, my;
+    off_map += !collision_checker.worldToMap(x + 0.62, y + 0.31, mx, my);
+    lethal += expected == 254.0;
+  }
+  EXPECT_GT(lethal, 0u);
+  EXPECT_GT(off_map, 0u);
+}
+
+TEST(collision_footprint, test_stencil_outline_closing)
+{
+  const auto footprint = makeStencilFootprint();
+  const double resolution = 0.05;
+  for (const bool close_from_last : {false, true}) {
+    nav2_costmap_2d::FootprintStencil stencil(footprint, resolution, false, 0, close_from_last);
+    const unsigned int num_headings = stencil.getNumHeadings();
+    for (unsigned int bin = 0; bin < num_headings; ++bin) {
+      const double theta = 2.0 * M_PI * bin / num_headings;
+      for (const double fx : {0.25, 0.75}) {
+        for (const double fy : {0.25, 0.75}) {
+          // Cells of the points of the footprint at the pose, relative to the cell of the pose
+          std::vector<std::pair<int, int>> points;
+          for (const auto & p : footprint) {
+            points.emplace_back(
+              static_cast<int>(std::floor(fx + (p.x * cos(theta) - p.y * sin(theta)) / resolution)),
+              static_cast<int>(
+                std::floor(fy + (p.x * sin(theta) + p.y * cos(theta)) / resolution)));
+          }
+
+          // The outline as footprintCost() rasterises it, or closed the other way around
+          std::set<std::pair<int, int>> expected;
+          auto add_line = [&](const std::pair<int, int> & a, const std::pair<int, int> & b) {
+              for (nav2_util::LineIterator line(a.first, a.second, b.first, b.second);
+                line.isValid(); line.advance())
+              {
+                expected.insert({line.getX(), line.getY()});
+              }
+            };
+          for (std::size_t i = 0; i + 1 < points.size(); ++i) {
+            add_line(points[i], points[i + 1]);
+          }
+          if (close_from_last) {
+            add_line(points.back(), points.front());
+          } else {
+            add_line(points.front(), points.back());
+          }
+
+          std::set<std::pair<int, int>> cells;
+          for (const auto & cell : stencil.getCells(theta, fx, fy)) {
+            cells.insert({cell.dx, cell.dy});
+          }
+          EXPECT_EQ(cells, expected) << "heading " << bin << ", " << fx << ", " << fy;
+        }
+      }
+    }
+  }
+}
+
+TEST(collision_footprint, test_stencil_cells)
+{
+  const auto footprint = makeStencilFootprint();
+  nav2_costmap_2d::FootprintStencil outline(footprint, 0.05);
+  nav2_costmap_2d::FootprintStencil filled(footprint, 0.05, true, 16);
+  EXPECT_EQ(filled.getNumHeadings(), 16u);
+  // Points move by at most a quarter cell to the nearest heading
+  EXPECT_GE(outline.getNumHeadings(), 4.0 * M_PI * std::hypot(0.62, 0.31) / 0.05);
+
+  EXPECT_TRUE(outline.isFor(footprint, 0.05, false));
+  EXPECT_FALSE(outline.isFor(footprint, 0.05, true));
+  EXPECT_FALSE(outline.isFor(footprint, 0.1, false));
+  auto moved = footprint;
+  moved[2].x += 0.01;
+  EXPECT_FALSE(outline.isFor(moved, 0.05, false));
+
+  for (const double theta : {0.0, 1.0, 3.0, -2.0}) {
+    const auto & outline_cells = outline.getCells(theta, 0.3, 0.6);
+    const auto & filled_cells = filled.getCells(theta, 0.3, 0.6);
+    EXPECT_GT(filled_cells.size(), outline_cells.size());
+    // Cells inside of the footprint are only in filled stencils
+    auto has = [](const auto & cells, int dx, int dy) {
+        return std::any_of(
+          cells.begin(), cells.end(), [&](const auto & c) {return c.dx == dx && c.dy == dy;});
+      };
+    EXPECT_TRUE(has(filled_cells, static_cast<int>(std::round(5 * cos(theta))),
+      static_cast<int>(std::round(5 * sin(theta)))));
+    EXPECT_FALSE(has(outline_cells, static_cast<int>(std::round(5 * cos(theta))),
+      static_cast<int>(std::round(5 * sin(theta)))));
+
+    // Outermost cells come first
+    auto range = [](const auto & c) {return c.dx * c.dx + c.dy * c.dy;};
+    EXPECT_GT(range(outline_cells.front()), range(outline_cells.back()));
+    for (const auto & c : filled_cells) {
+      EXPECT_LE(std::max(std::abs(c.dx), std::abs(c.dy)), filled.getRadius());
+    }
+  }
+}
+
+TEST(collision_footprint, test_stencil_filled_and_updated)
+{
+  std::shared_ptr<nav2_costmap_2d::Costmap2D> costmap_ =
+    std::make_shared<nav2_costmap_2d::Costmap2D>(100, 100, 0.1, 0, 0, 0);
+  costmap_->setCost(50, 50, 254);
+  auto footprint = makeStencilFootprint();
+
+  nav2_costmap_2d::FootprintCollisionChecker<std::shared_ptr<nav2_costmap_2d::Costmap2D>>
+  collision_checker(costmap_);
+  collision_checker.setUseFootprintStencils(true);
+  EXPECT_NEAR(collision_checker.footprintCostAtPose(4.7, 5.05, 0.0, footprint), 0.0, 0.001);
+  collision_checker.setUseFootprintStencils(true, true);
+  EXPECT_NEAR(collision_checker.footprintCostAtPose(4.7, 5.05, 0.0, footprint), 254.0, 0.001);
+
+  // A changed footprint is rasterised again
+  for (auto & p : footprint) {
+    p.x *= 0.1;
+    p.y *= 0.1;
+  }
+  EXPECT_NEAR(collision_checker.footprintCostAtPose(4.7, 5.05, 0.0, footprint), 0.0, 0.001);
+}
+
 TEST(collision_footprint, not_enough_points)
 {
   geometry_msgs::msg::Point p1;
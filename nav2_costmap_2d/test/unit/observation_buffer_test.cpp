@@ -0,0 +1,155 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+#include "tf2_ros/buffer.h"
+#include "sensor_msgs/point_cloud2_iterator.hpp"
+#include "nav2_costmap_2d/observation_buffer.hpp"
+
+class ObservationBufferTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    node_ = std::make_shared<nav2::LifecycleNode>("observation_buffer_test");
+    tf_ = std::make_shared<tf2_ros::Buffer>(node_->get_clock());
+
+    // The sensor is 1m ahead of and 0.5m above the origin of the map, rotated by 90 degrees
+    geometry_msgs::msg::TransformStamped transform;
+    transform.header.frame_id = "map";
+    transform.child_frame_id = "sensor";
+    transform.transform.translation.x = 1.0;
+    transform.transform.translation.z = 0.5;
+    transform.transform.rotation.z = std::sqrt(0.5);
+    transform.transform.rotation.w = std::sqrt(0.5);
+    tf_->setTransform(transform, "test", true);
+
+    buffer_ = std::make_shared<nav2_costmap_2d::ObservationBuffer>(
+      node_, "cloud", 0.0, 0.0, 0.0, 1.0, 2.5, 0.0, 3.0, 0.0, *tf_, "map", "",
+      tf2::durationFromSec(0.1));
+  }
+
+  sensor_msgs::msg::PointCloud2::SharedPtr makeCloud(
+    const std::vector<std::array<float, 3>> & points)
+  {
+    auto cloud = std::make_shared<sensor_msgs::msg::PointCloud2>();
+    cloud->header.frame_id = "sensor";
+    cloud->header.stamp = node_->now();
+    cloud->height = 1;
+    sensor_msgs::PointCloud2Modifier modifier(*cloud);
+    modifier.setPointCloud2FieldsByString(2, "xyz", "rgb");
+    modifier.resize(points.size());
+    sensor_msgs::PointCloud2Iterator<float> iter_x(*cloud, "x");
+    sensor_msgs::PointCloud2Iterator<float> iter_y(*cloud, "y");
+    sensor_msgs::PointCloud2Iterator<float> iter_z(*cloud, "z");
+    for (const auto & point : points) {
+      *iter_x = point[0];
+      *iter_y = point[1];
+      *iter_z = point[2];
+      ++iter_x;
+      ++iter_y;
+      ++iter_z;
+    }
+    return cloud;
+  }
+
+  nav2::LifecycleNode::SharedPtr node_;
+  std::shared_ptr<tf2_ros::Buffer> tf_;
+  std::shared_ptr<nav2_costmap_2d::ObservationBuffer> buffer_;
+};
+
+TEST_F(ObservationBufferTest, testTransformAndFilter)
+{
+  // The second point is below and the third above the height bounds in the map frame
+  buffer_->bufferCloud(makeCloud({{1.0, 0.0, 0.0}, {1.0, 0.0, -0.6}, {2.0, 1.0, 0.6}}));
+
+  std::vector<nav2_costmap_2d::Observation> observations;
+  buffer_->getObservations(observations);
+  ASSERT_EQ(observations.size(), 1u);
+  const auto & observation = observations[0];
+  EXPECT_NEAR(observation.origin_.x, 1.0, 1e-6);
+  EXPECT_NEAR(observation.origin_.y, 0.0, 1e-6);
+  EXPECT_NEAR(observation.origin_.z, 0.5, 1e-6);
+  EXPECT_EQ(observation.obstacle_max_range_, 2.5);
+  EXPECT_EQ(observation.raytrace_max_range_, 3.0);
+
+  // The observation holds a compact xyz cloud in the global frame
+  const auto & cloud = *observation.cloud_;
+  EXPECT_EQ(cloud.header.frame_id, "map");
+  EXPECT_EQ(cloud.point_step, 3 * sizeof(float));
+  ASSERT_EQ(cloud.width * cloud.height, 1u);
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(cloud, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(cloud, "z");
+  EXPECT_NEAR(*iter_x, 1.0, 1e-6);
+  EXPECT_NEAR(*iter_y, 1.0, 1e-6);
+  EXPECT_NEAR(*iter_z, 0.5, 1e-6);
+}
+
+TEST_F(ObservationBufferTest, testSharedObservations)
+{
+  buffer_->bufferCloud(makeCloud({{1.0, 0.0, 0.0}, {2.0, 0.0, 0.0}}));
+
+  // Observations share the cloud processed once, rather than copying it
+  std::vector<nav2_costmap_2d::Observation> first, second;
+  buffer_->getObservations(first);
+  buffer_->getObservations(second);
+  ASSERT_EQ(first.size(), 1u);
+  ASSERT_EQ(second.size(), 1u);
+  EXPECT_EQ(first[0].cloud_, second[0].cloud_);
+  EXPECT_EQ(first[0].cloud_->width, 2u);
+
+  nav2_costmap_2d::Observation copy = first[0];
+  EXPECT_EQ(copy.cloud_, first[0].cloud_);
+
+  // With no keep time, only the latest cloud is kept
+  buffer_->bufferCloud(makeCloud({{1.0, 0.0, 0.0}}));
+  std::vector<nav2_costmap_2d::Observation> third;
+  buffer_->getObservations(third);
+  ASSERT_EQ(third.size(), 1u);
+  EXPECT_NE(third[0].cloud_, first[0].cloud_);
+  EXPECT_EQ(third[0].cloud_->width, 1u);
+}
+
+TEST_F(ObservationBufferTest, testUnknownFrame)
+{
+  auto cloud = makeCloud({{1.0, 0.0, 0.0}});
+  cloud->header.frame_id = "unknown";
+  buffer_->bufferCloud(cloud);
+
+  std::vector<nav2_costmap_2d::Observation> observations;
+  buffer_->getObservations(observations);
+  EXPECT_TRUE(observations.empty());
+}
+
+int main(int argc, char ** argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  rclcpp::init(0, nullptr);
+
+  int result = RUN_ALL_TESTS();
+
+  rclcpp::shutdown();
+
+  return result;
+}
@@ -55,6 +55,8 @@ Controller::Controller(
       node, "controller.rotate_to_heading_max_angular_accel", rclcpp::ParameterValue(3.2));
   nav2::declare_parameter_if_not_declared(
     node, "controller.use_collision_detection", rclcpp::ParameterValue(true));
+  nav2::declare_parameter_if_not_declared(
+    node, "controller.use_footprint_stencils", rclcpp::ParameterValue(false));
   nav2::declare_parameter_if_not_declared(
     node, "controller.costmap_topic",
     rclcpp::ParameterValue(std::string("local_costmap/costmap_raw")));
@@ -179,6 +181,7 @@ bool Controller::isTrajectoryCollisionFree(
   // Generate path
   double distance = std::numeric_limits<double>::max();
   unsigned int max_iter = static_cast<unsigned int>(ceil(projection_time_ / simulation_time_step_));
+  bool fetch_costmap_and_footprint = true;
 
   do{
     // Apply velocities to calculate next pose
@@ -201,17 +204,22 @@ bool Controller::isTrajectoryCollisionFree(
       nav2_util::geometry_utils::euclidean_distance(target_pose, next_pose.pose) :
       std::hypot(next_pose.pose.position.x, next_pose.pose.position.y);
 
-    // If this distance is greater than the dock_collision_threshold, check for collisions
+    // If this distance is greater than the dock_collision_threshold, check for collisions.
+    // The costmap and footprint are fetched for the first pose checked only
     if (use_collision_detection_ &&
-      dock_collision_distance > dock_collision_threshold_ &&
-      !collision_checker_->isCollisionFree(nav_2d_utils::poseToPose2D(local_pose.pose)))
+      dock_collision_distance > dock_collision_threshold_)
     {
-      RCLCPP_WARN(
-        logger_, "Collision detected at pose: (%.2f, %.2f, %.2f) in frame %s",
-        local_pose.pose.position.x, local_pose.pose.position.y, local_pose.pose.position.z,
-        local_pose.header.frame_id.c_str());
-      trajectory_pub_->publish(trajectory);
-      return false;
+      const bool collision_free = collision_checker_->isCollisionFree(
+        nav_2d_utils::poseToPose2D(local_pose.pose), fetch_costmap_and_footprint);
+      fetch_costmap_and_footprint = false;
+      if (!collision_free) {
+        RCLCPP_WARN(
+          logger_, "Collision detected at pose: (%.2f, %.2f, %.2f) in frame %s",
+          local_pose.pose.position.x, local_pose.pose.position.y, local_pose.pose.position.z,
+          local_pose.header.frame_id.c_str());
+        trajectory_pub_->publish(trajectory);
+        return false;
+      }
     }
 
     // Check if we reach the goal
@@ -232,6 +240,9 @@ void Controller::configureCollisionChecker(
     node, footprint_topic, *tf2_buffer_, base_frame_, transform_tolerance);
   collision_checker_ = std::make_shared<nav2_costmap_2d::CostmapTopicCollisionChecker>(
     *costmap_sub_, *footprint_sub_, node->get_name());
+  bool use_footprint_stencils = false;
+  node->get_parameter("controller.use_footprint_stencils", use_footprint_stencils);
+  collision_checker_->setUseFootprintStencils(use_footprint_stencils);
 }
 
 rcl_interfaces::msg::SetParametersResult
@@ -35,8 +35,10 @@
 #ifndef DWB_CRITICS__OBSTACLE_FOOTPRINT_HPP_
 #define DWB_CRITICS__OBSTACLE_FOOTPRINT_HPP_
 
+#include <memory>
 #include <vector>
 #include "dwb_critics/base_obstacle.hpp"
+#include "nav2_costmap_2d/footprint_stencil.hpp"
 
 namespace dwb_critics
 {
@@ -65,6 +67,7 @@ Footprint getOrientedFootprint(
 class ObstacleFootprintCritic : public BaseObstacleCritic
 {
 public:
+  void onInit() override;
   bool prepare(
     const geometry_msgs::msg::Pose2D & pose, const nav_2d_msgs::msg::Twist2D & vel,
     const geometry_msgs::msg::Pose2D & goal, const nav_2d_msgs::msg::Path2D & global_plan) override;
@@ -93,7 +96,17 @@ protected:
    */
   double pointCost(int x, int y);
 
+  /**
+   * @brief Score a pose from the cells of the footprint stencil
+   * @param pose Pose to check
+   * @return Largest cost of the cells of the footprint
+   */
+  double stencilCost(const geometry_msgs::msg::Pose2D & pose);
+
   Footprint footprint_spec_;
+  // Footprint rasterised ahead of time for quantised headings, if enabled
+  bool use_footprint_stencils_{false};
+  std::unique_ptr<nav2_costmap_2d::FootprintStencil> stencil_;
 };
 }  // namespace dwb_critics
 
@@ -34,11 +34,14 @@
 
 #include "dwb_critics/obstacle_footprint.hpp"
 #include <algorithm>
+#include <cmath>
+#include <memory>
 #include <vector>
 #include "dwb_critics/line_iterator.hpp"
 #include "dwb_core/exceptions.hpp"
 #include "pluginlib/class_list_macros.hpp"
 #include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_ros_common/node_utils.hpp"
 
 PLUGINLIB_EXPORT_CLASS(dwb_critics::ObstacleFootprintCritic, dwb_core::TrajectoryCritic)
 
@@ -60,6 +63,22 @@ Footprint getOrientedFootprint(
   return oriented_footprint;
 }
 
+void ObstacleFootprintCritic::onInit()
+{
+  BaseObstacleCritic::onInit();
+
+  auto node = node_.lock();
+  if (!node) {
+    throw std::runtime_error{"Failed to lock node"};
+  }
+
+  nav2::declare_parameter_if_not_declared(
+    node,
+    dwb_plugin_name_ + "." + name_ + ".use_footprint_stencils", rclcpp::ParameterValue(false));
+  node->get_parameter(
+    dwb_plugin_name_ + "." + name_ + ".use_footprint_stencils", use_footprint_stencils_);
+}
+
 bool ObstacleFootprintCritic::prepare(
   const geometry_msgs::msg::Pose2D &, const nav_2d_msgs::msg::Twist2D &,
   const geometry_msgs::msg::Pose2D &, const nav_2d_msgs::msg::Path2D &)
@@ -71,6 +90,15 @@ bool ObstacleFootprintCritic::prepare(
       "Footprint spec is empty, maybe missing call to setFootprint?");
     return false;
   }
+
+  // The footprint may change with dynamic footprints
+  if (use_footprint_stencils_ &&
+    (!stencil_ || !stencil_->isFor(footprint_spec_, costmap_->getResolution(), false)))
+  {
+    // scorePose() closes the footprint from its last point to its first
+    stencil_ = std::make_unique<nav2_costmap_2d::FootprintStencil>(
+      footprint_spec_, costmap_->getResolution(), false, 0, true);
+  }
   return true;
 }
 
@@ -81,9 +109,50 @@ double ObstacleFootprintCritic::scorePose(const geometry_msgs::msg::Pose2D & pos
     throw dwb_core::
           IllegalTrajectoryException(name_, "Trajectory Goes Off Grid.");
   }
+  if (stencil_ && use_footprint_stencils_) {
+    return stencilCost(pose);
+  }
   return scorePose(pose, getOrientedFootprint(pose, footprint_spec_));
 }
 
+double ObstacleFootprintCritic::stencilCost(const geometry_msgs::msg::Pose2D & pose)
+{
+  const double resolution = costmap_->getResolution();
+  const double gx = (pose.x - costmap_->getOriginX()) / resolution;
+  const double gy = (pose.y - costmap_->getOriginY()) / resolution;
+  const int size_x = static_cast<int>(costmap_->getSizeInCellsX());
+  const int size_y = static_cast<int>(costmap_->getSizeInCellsY());
+
+  // Away from the edges of the map, the whole footprint is on it. Near them, check
+  // its points as scorePose() does
+  const int radius = stencil_->getRadius() + 1;
+  const bool inside = gx >= radius && gy >= radius &&
+    gx < size_x - radius && gy < size_y - radius;
+  if (!inside) {
+    unsigned int x, y;
+    for (const auto & point : getOrientedFootprint(pose, footprint_spec_)) {
+      if (!costmap_->worldToMap(point.x, point.y, x, y)) {
+        throw dwb_core::
+              IllegalTrajectoryException(name_, "Footprint Goes Off Grid.");
+      }
+    }
+  }
+
+  const int cx = static_cast<int>(std::floor(gx));
+  const int cy = static_cast<int>(std::floor(gy));
+  double footprint_cost = 0.0;
+  for (const auto & cell : stencil_->getCells(pose.theta, gx - cx, gy - cy)) {
+    const int x = cx + cell.dx;
+    const int y = cy + cell.dy;
+    // Cells rounded off the map while the footprint is on it are skipped
+    if (!inside && (x < 0 || y < 0 || x >= size_x || y >= size_y)) {
+      continue;
+    }
+    footprint_cost = std::max(pointCost(x, y), footprint_cost);
+  }
+  return footprint_cost;
+}
+
 double ObstacleFootprintCritic::scorePose(
   const geometry_msgs::msg::Pose2D &,
   const Footprint & footprint)
@@ -18,12 +18,14 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "nav2_util/lifecycle_service_client.hpp"
+#include "nav2_util/thread_pool.hpp"
 #include "nav2_ros_common/node_thread.hpp"
 #include "nav2_ros_common/service_server.hpp"
 #include "rclcpp/rclcpp.hpp"
@@ -70,6 +72,21 @@ public:
    */
   ~LifecycleManager();
 
+  /**
+   * @brief Group nodes into stages to transition them in dependency order. Each node is
+   * placed in the stage after the last of its dependencies, so the nodes of a stage may be
+   * transitioned concurrently once all previous stages are done. Dependencies on nodes
+   * which are not in the list are ignored.
+   * @param node_names Names of the nodes, in the order of desired bring-up
+   * @param dependencies Names of the nodes each node depends on
+   * @param stages Output stages of node names, in the order of bring-up
+   * @return false if the dependencies are cyclic
+   */
+  static bool computeTransitionStages(
+    const std::vector<std::string> & node_names,
+    const std::map<std::string, std::vector<std::string>> & dependencies,
+    std::vector<std::vector<std::string>> & stages);
+
 protected:
   // Callback group used by services and timers
   rclcpp::CallbackGroup::SharedPtr callback_group_;
@@ -210,6 +227,23 @@ protected:
    */
   bool changeStateForAllNodes(std::uint8_t transition, bool hard_change = false);
 
+  /**
+   * @brief Transition the nodes one at a time, in the order of node_names_,
+   * or in reverse order for transitions towards shutdown
+   */
+  bool changeStateInOrder(std::uint8_t transition, bool hard_change);
+
+  /**
+   * @brief Transition the nodes of each stage of transition_stages_ concurrently,
+   * stage by stage, or in reverse stage order for transitions towards shutdown
+   */
+  bool changeStateInStages(std::uint8_t transition, bool hard_change);
+
+  /**
+   * @brief Log the total time of a transition of all nodes and the slowest nodes
+   */
+  void reportTransitionTimes(std::uint8_t transition, double total_time);
+
   // Convenience function to highlight the output on the console
   /**
    * @brief Helper function to highlight the output on the console
@@ -244,6 +278,7 @@ protected:
 
   // A map of all nodes to check bond connection
   std::map<std::string, std::shared_ptr<bond::Bond>> bond_map_;
+  std::mutex bond_mutex_;
 
   // A map of all nodes to be controlled
   std::map<std::string, std::shared_ptr<nav2_util::LifecycleServiceClient>> node_map_;
@@ -256,6 +291,16 @@ protected:
   // The names of the nodes to be managed, in the order of desired bring-up
   std::vector<std::string> node_names_;
 
+  // Whether to transition independent nodes concurrently, in stages of node_names_
+  // computed from the node dependencies
+  bool parallel_transitions_;
+  std::vector<std::vector<std::string>> transition_stages_;
+  std::unique_ptr<nav2_util::ThreadPool> transition_pool_;
+
+  // The duration of the last transition of each node, in seconds, by transition label
+  std::map<std::string, double> transition_times_;
+  std::mutex transition_times_mutex_;
+
   // Whether to automatically start up the system
   bool autostart_;
   bool attempt_respawn_reconnection_;
@@ -15,9 +15,15 @@
 
 #include "nav2_lifecycle_manager/lifecycle_manager.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <iomanip>
 #include <memory>
+#include <set>
+#include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "rclcpp/rclcpp.hpp"
@@ -45,6 +51,7 @@ LifecycleManager::LifecycleManager(const rclcpp::NodeOptions & options)
   declare_parameter("service_timeout", 5.0);
   declare_parameter("bond_respawn_max_duration", 10.0);
   declare_parameter("attempt_respawn_reconnection", true);
+  declare_parameter("parallel_transitions", false);
 
   registerRclPreshutdownCallback();
 
@@ -66,6 +73,39 @@ LifecycleManager::LifecycleManager(const rclcpp::NodeOptions & options)
 
   get_parameter("attempt_respawn_reconnection", attempt_respawn_reconnection_);
 
+  // Each node may list the nodes it depends on in node_dependencies.<node name>,
+  // nodes without dependencies are transitioned in the first stage
+  get_parameter("parallel_transitions", parallel_transitions_);
+  if (parallel_transitions_) {
+    std::map<std::string, std::vector<std::string>> dependencies;
+    for (const auto & node_name : node_names_) {
+      dependencies[node_name] = declare_parameter(
+        "node_dependencies." + node_name, std::vector<std::string>());
+      for (const auto & dependency : dependencies[node_name]) {
+        if (std::find(node_names_.begin(), node_names_.end(), dependency) == node_names_.end()) {
+          RCLCPP_WARN(
+            get_logger(), "Node %s depends on %s, which is not managed. Ignoring it.",
+            node_name.c_str(), dependency.c_str());
+        }
+      }
+    }
+
+    if (!computeTransitionStages(node_names_, dependencies, transition_stages_)) {
+      RCLCPP_ERROR(
+        get_logger(), "Node dependencies are cyclic, transitioning nodes one at a time instead.");
+      parallel_transitions_ = false;
+    } else {
+      std::size_t max_stage_size = 1;
+      for (const auto & stage : transition_stages_) {
+        max_stage_size = std::max(max_stage_size, stage.size());
+      }
+      RCLCPP_INFO(
+        get_logger(), "Transitioning %zu nodes in %zu stages of dependencies.",
+        node_names_.size(), transition_stages_.size());
+      transition_pool_ = std::make_unique<nav2_util::ThreadPool>(max_stage_size);
+    }
+  }
+
   callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive, false);
 
   transition_state_map_[Transition::TRANSITION_CONFIGURE] = State::PRIMARY_STATE_INACTIVE;
@@ -185,6 +225,11 @@ LifecycleManager::CreateDiagnostic(diagnostic_updater::DiagnosticStatusWrapper &
       break;
   }
   stat.summary(error_level, message);
+
+  std::lock_guard<std::mutex> lock(transition_times_mutex_);
+  for (const auto & transition_time : transition_times_) {
+    stat.add(transition_time.first + " time (s)", transition_time.second);
+  }
 }
 
 void
@@ -233,14 +278,21 @@ LifecycleManager::createBondConnection(const std::string & node_name)
     std::chrono::duration_cast<std::chrono::nanoseconds>(bond_timeout_).count();
   const double timeout_s = timeout_ns / 1e9;
 
-  if (bond_map_.find(node_name) == bond_map_.end() && bond_timeout_.count() > 0.0) {
-    bond_map_[node_name] =
-      std::make_shared<bond::Bond>("bond", node_name, shared_from_this());
-    bond_map_[node_name]->setHeartbeatTimeout(timeout_s);
-    bond_map_[node_name]->setHeartbeatPeriod(0.10);
-    bond_map_[node_name]->start();
+  std::shared_ptr<bond::Bond> bond;
+  {
+    std::lock_guard<std::mutex> lock(bond_mutex_);
+    if (bond_map_.find(node_name) == bond_map_.end() && bond_timeout_.count() > 0.0) {
+      bond = std::make_shared<bond::Bond>("bond", node_name, shared_from_this());
+      bond_map_[node_name] = bond;
+    }
+  }
+
+  if (bond) {
+    bond->setHeartbeatTimeout(timeout_s);
+    bond->setHeartbeatPeriod(0.10);
+    bond->start();
     if (
-      !bond_map_[node_name]->waitUntilFormed(
+      !bond->waitUntilFormed(
         rclcpp::Duration(rclcpp::Duration::from_nanoseconds(timeout_ns / 2))))
     {
       RCLCPP_ERROR(
@@ -259,27 +311,54 @@ LifecycleManager::createBondConnection(const std::string & node_name)
 bool
 LifecycleManager::changeStateForNode(const std::string & node_name, std::uint8_t transition)
 {
-  message(transition_label_map_[transition] + node_name);
-
-  if (!node_map_[node_name]->change_state(transition, std::chrono::milliseconds(-1),
-      service_timeout_) ||
-    !(node_map_[node_name]->get_state(service_timeout_) == transition_state_map_[transition]))
+  // Nodes may be transitioned concurrently, so only look up the maps here
+  const std::string & label = transition_label_map_.at(transition);
+  auto & client = node_map_.at(node_name);
+  message(label + node_name);
+  const auto start_time = std::chrono::steady_clock::now();
+
+  bool success = true;
+  if (!client->change_state(transition, std::chrono::milliseconds(-1), service_timeout_) ||
+    !(client->get_state(service_timeout_) == transition_state_map_.at(transition)))
   {
     RCLCPP_ERROR(get_logger(), "Failed to change state for node: %s", node_name.c_str());
-    return false;
-  }
-
-  if (transition == Transition::TRANSITION_ACTIVATE) {
-    return createBondConnection(node_name);
+    success = false;
+  } else if (transition == Transition::TRANSITION_ACTIVATE) {
+    success = createBondConnection(node_name);
   } else if (transition == Transition::TRANSITION_DEACTIVATE) {
+    std::lock_guard<std::mutex> lock(bond_mutex_);
     bond_map_.erase(node_name);
   }
 
-  return true;
+  const double duration =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+  std::lock_guard<std::mutex> lock(transition_times_mutex_);
+  transition_times_[label + node_name] = duration;
+  return success;
 }
 
 bool
 LifecycleManager::changeStateForAllNodes(std::uint8_t transition, bool hard_change)
+{
+  // Forget the times of the last such transition, so only nodes transitioned now are reported
+  {
+    std::lock_guard<std::mutex> lock(transition_times_mutex_);
+    for (const auto & node_name : node_names_) {
+      transition_times_.erase(transition_label_map_.at(transition) + node_name);
+    }
+  }
+
+  const auto start_time = std::chrono::steady_clock::now();
+  const bool success = parallel_transitions_ ?
+    changeStateInStages(transition, hard_change) : changeStateInOrder(transition, hard_change);
+  reportTransitionTimes(
+    transition,
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count());
+  return success;
+}
+
+bool
+LifecycleManager::changeStateInOrder(std::uint8_t transition, bool hard_change)
 {
   // Hard change will continue even if a node fails
   if (transition == Transition::TRANSITION_CONFIGURE ||
@@ -315,6 +394,114 @@ LifecycleManager::changeStateForAllNodes(std::uint8_t transition, bool hard_chan
   return true;
 }
 
+bool
+LifecycleManager::changeStateInStages(std::uint8_t transition, bool hard_change)
+{
+  // Hard change will continue even if a node fails, but not if a node throws
+  auto change_state_for_stage = [&](const std::vector<std::string> & stage) {
+      std::vector<std::uint8_t> succeeded(stage.size(), false);
+      std::atomic<bool> thrown{false};
+      transition_pool_->parallelFor(
+        stage.size(), [&](std::size_t i) {
+          try {
+            succeeded[i] = changeStateForNode(stage[i], transition);
+          } catch (const std::runtime_error & e) {
+            RCLCPP_ERROR(
+              get_logger(),
+              "Failed to change state for node: %s. Exception: %s.", stage[i].c_str(), e.what());
+            thrown = true;
+          }
+        });
+      return !thrown && (hard_change ||
+             std::all_of(succeeded.begin(), succeeded.end(), [](std::uint8_t s) {return s;}));
+    };
+
+  if (transition == Transition::TRANSITION_CONFIGURE ||
+    transition == Transition::TRANSITION_ACTIVATE)
+  {
+    for (const auto & stage : transition_stages_) {
+      if (!change_state_for_stage(stage)) {
+        return false;
+      }
+    }
+  } else {
+    for (auto rit = transition_stages_.rbegin(); rit != transition_stages_.rend(); ++rit) {
+      if (!change_state_for_stage(*rit)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool
+LifecycleManager::computeTransitionStages(
+  const std::vector<std::string> & node_names,
+  const std::map<std::string, std::vector<std::string>> & dependencies,
+  std::vector<std::vector<std::string>> & stages)
+{
+  stages.clear();
+  std::set<std::string> staged;
+  while (staged.size() < node_names.size()) {
+    // A node is ready once all of its managed dependencies are in previous stages
+    std::vector<std::string> stage;
+    for (const auto & node_name : node_names) {
+      if (staged.count(node_name)) {
+        continue;
+      }
+      bool ready = true;
+      auto it = dependencies.find(node_name);
+      if (it != dependencies.end()) {
+        for (const auto & dependency : it->second) {
+          if (!staged.count(dependency) &&
+            std::find(node_names.begin(), node_names.end(), dependency) != node_names.end())
+          {
+            ready = false;
+            break;
+          }
+        }
+      }
+      if (ready) {
+        stage.push_back(node_name);
+      }
+    }
+
+    if (stage.empty()) {
+      stages.clear();
+      return false;
+    }
+    staged.insert(stage.begin(), stage.end());
+    stages.push_back(std::move(stage));
+  }
+  return true;
+}
+
+void
+LifecycleManager::reportTransitionTimes(std::uint8_t transition, double total_time)
+{
+  const std::string & label = transition_label_map_.at(transition);
+  std::vector<std::pair<double, std::string>> node_times;
+  {
+    std::lock_guard<std::mutex> lock(transition_times_mutex_);
+    for (const auto & node_name : node_names_) {
+      auto it = transition_times_.find(label + node_name);
+      if (it != transition_times_.end()) {
+        node_times.emplace_back(it->second, node_name);
+      }
+    }
+  }
+  std::sort(node_times.rbegin(), node_times.rend());
+
+  std::ostringstream report;
+  report << std::fixed << std::setprecision(2) << label << "nodes took " << total_time << "s";
+  const std::size_t num_slowest = std::min<std::size_t>(node_times.size(), 3);
+  for (std::size_t i = 0; i < num_slowest; ++i) {
+    report << (i == 0 ? ", slowest: " : ", ") << node_times[i].second << " " <<
+      node_times[i].first << "s";
+  }
+  RCLCPP_INFO(get_logger(), "%s", report.str().c_str());
+}
+
 void
 LifecycleManager::shutdownAllNodes()
 {
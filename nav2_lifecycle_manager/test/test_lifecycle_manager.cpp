@@ -13,11 +13,15 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <map>
 #include <memory>
 #include <chrono>
+#include <string>
+#include <vector>
 #include "rclcpp/rclcpp.hpp"
 #include "nav2_ros_common/lifecycle_node.hpp"
 #include "nav2_ros_common/node_thread.hpp"
+#include "nav2_lifecycle_manager/lifecycle_manager.hpp"
 #include "nav2_lifecycle_manager/lifecycle_manager_client.hpp"
 
 using CallbackReturn = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
@@ -114,6 +118,37 @@ TEST(LifecycleClientTest, WithoutFixture)
     client.is_active(std::chrono::nanoseconds(1000)));
 }
 
+TEST(LifecycleManagerTest, TransitionStages)
+{
+  using Stages = std::vector<std::vector<std::string>>;
+  const std::vector<std::string> node_names =
+  {"map_server", "amcl", "planner_server", "controller_server", "bt_navigator"};
+  std::map<std::string, std::vector<std::string>> dependencies;
+  dependencies["amcl"] = {"map_server"};
+  dependencies["bt_navigator"] = {"planner_server", "controller_server", "not_managed"};
+
+  // Independent nodes share a stage, in the order of the node names
+  Stages stages;
+  EXPECT_TRUE(
+    nav2_lifecycle_manager::LifecycleManager::computeTransitionStages(
+      node_names, dependencies, stages));
+  EXPECT_EQ(
+    stages,
+    Stages({{"map_server", "planner_server", "controller_server"}, {"amcl", "bt_navigator"}}));
+
+  // Without dependencies, all nodes are transitioned at once
+  EXPECT_TRUE(
+    nav2_lifecycle_manager::LifecycleManager::computeTransitionStages(node_names, {}, stages));
+  EXPECT_EQ(stages, Stages({node_names}));
+
+  // Cyclic dependencies are rejected
+  dependencies["map_server"] = {"amcl"};
+  EXPECT_FALSE(
+    nav2_lifecycle_manager::LifecycleManager::computeTransitionStages(
+      node_names, dependencies, stages));
+  EXPECT_TRUE(stages.empty());
+}
+
 int main(int argc, char ** argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
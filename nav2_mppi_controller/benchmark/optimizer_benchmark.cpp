@@ -32,6 +32,7 @@
 #include "nav2_mppi_controller/optimizer.hpp"
 #include "nav2_mppi_controller/motion_models.hpp"
 
+#include "nav2_mppi_controller/tools/costmap_gather.hpp"
 #include "nav2_mppi_controller/tools/parameters_handler.hpp"
 
 #include "utils.hpp"
@@ -47,9 +48,9 @@ RosLockGuard g_rclcpp;
 
 void prepareAndRunBenchmark(
   bool consider_footprint, std::string motion_model,
-  std::vector<std::string> critics, benchmark::State & state)
+  std::vector<std::string> critics, benchmark::State & state,
+  int batch_size = 2000, int worker_threads = 1)
 {
-  int batch_size = 2000;
   int time_steps = 56;
   unsigned int path_points = 50u;
   int iteration_count = 2;
@@ -64,7 +65,7 @@ void prepareAndRunBenchmark(
 
   TestPathSettings path_settings{start_pose, path_points, path_step, path_step};
   TestOptimizerSettings optimizer_settings{batch_size, time_steps, iteration_count,
-    lookahead_distance, motion_model, consider_footprint};
+    lookahead_distance, motion_model, consider_footprint, worker_threads};
 
   unsigned int offset = 4;
   unsigned int obstacle_size = offset * 2;
@@ -138,6 +139,20 @@ static void BM_Ackermann(benchmark::State & state)
   prepareAndRunBenchmark(consider_footprint, motion_model, critics, state);
 }
 
+// Arguments are the batch size and the number of worker threads
+static void BM_DiffDriveThreads(benchmark::State & state)
+{
+  bool consider_footprint = true;
+  std::string motion_model = "DiffDrive";
+  std::vector<std::string> critics = {{"ConstraintCritic"}, {"CostCritic"}, {"GoalCritic"},
+    {"GoalAngleCritic"}, {"PathAlignCritic"}, {"PathFollowCritic"}, {"PathAngleCritic"},
+    {"PreferForwardCritic"}};
+
+  prepareAndRunBenchmark(
+    consider_footprint, motion_model, critics, state,
+    static_cast<int>(state.range(0)), static_cast<int>(state.range(1)));
+}
+
 static void BM_GoalCritic(benchmark::State & state)
 {
   bool consider_footprint = true;
@@ -156,6 +171,24 @@ static void BM_GoalAngleCritic(benchmark::State & state)
   prepareAndRunBenchmark(consider_footprint, motion_model, critics, state);
 }
 
+static void BM_CostCritic(benchmark::State & state)
+{
+  bool consider_footprint = true;
+  std::string motion_model = "Ackermann";
+  std::vector<std::string> critics = {{"CostCritic"}};
+
+  prepareAndRunBenchmark(consider_footprint, motion_model, critics, state);
+}
+
+static void BM_CostCriticPointFootprint(benchmark::State & state)
+{
+  bool consider_footprint = false;
+  std::string motion_model = "Ackermann";
+  std::vector<std::string> critics = {{"CostCritic"}};
+
+  prepareAndRunBenchmark(consider_footprint, motion_model, critics, state);
+}
+
 static void BM_ObstaclesCritic(benchmark::State & state)
 {
   bool consider_footprint = true;
@@ -192,6 +225,41 @@ static void BM_PathFollowCritic(benchmark::State & state)
   prepareAndRunBenchmark(consider_footprint, motion_model, critics, state);
 }
 
+// Gathers the costs of a batch_size x time_steps set of trajectories column by column,
+// either one point at a time (0) or with the vectorised gather of the CPU (1)
+static void BM_GatherCosts(benchmark::State & state)
+{
+  int batch_size = 2000;
+  int time_steps = 56;
+
+  TestCostmapSettings costmap_settings{};
+  auto costmap_ros = getDummyCostmapRos(costmap_settings);
+  auto costmap = costmap_ros->getCostmap();
+  mppi::utils::CostmapView view(*costmap);
+
+  auto [center_x, center_y] = costmap_settings.getCenterIJ();
+  addObstacle(costmap, {center_x - 4, center_y - 4, 8, 250});
+
+  TestPose center = costmap_settings.getCenterPose();
+  Eigen::ArrayXXf x = static_cast<float>(center.x) +
+    Eigen::ArrayXXf::Random(batch_size, time_steps) * 2.0f;
+  Eigen::ArrayXXf y = static_cast<float>(center.y) +
+    Eigen::ArrayXXf::Random(batch_size, time_steps) * 2.0f;
+  Eigen::ArrayXf costs(batch_size);
+
+  for (auto _ : state) {
+    for (int j = 0; j < time_steps; j++) {
+      if (state.range(0)) {
+        mppi::utils::gatherCosts(view, x.col(j).data(), y.col(j).data(), batch_size, costs.data());
+      } else {
+        mppi::utils::gatherCostsScalar(
+          view, x.col(j).data(), y.col(j).data(), batch_size, costs.data());
+      }
+      benchmark::DoNotOptimize(costs.data());
+    }
+  }
+}
+
 static void BM_PathAngleCritic(benchmark::State & state)
 {
   bool consider_footprint = true;
@@ -205,13 +273,19 @@ BENCHMARK(BM_DiffDrivePointFootprint)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_DiffDrive)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_Omni)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_Ackermann)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DiffDriveThreads)->ArgsProduct({{2000, 5000}, {1, 2, 4, 8}})
+->Unit(benchmark::kMillisecond)->UseRealTime();
 
 BENCHMARK(BM_GoalCritic)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_GoalAngleCritic)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_PathAngleCritic)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_PathFollowCritic)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CostCritic)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_CostCriticPointFootprint)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_ObstaclesCritic)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_ObstaclesCriticPointFootprint)->Unit(benchmark::kMillisecond);
 BENCHMARK(BM_TwilringCritic)->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_GatherCosts)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
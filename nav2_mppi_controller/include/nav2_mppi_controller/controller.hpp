@@ -126,6 +126,7 @@ protected:
 
   bool visualize_;
   bool publish_optimal_trajectory_;
+  bool use_costmap_snapshot_;
 };
 
 }  // namespace nav2_mppi_controller
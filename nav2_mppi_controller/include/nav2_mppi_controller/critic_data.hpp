@@ -22,6 +22,7 @@
 
 #include "geometry_msgs/msg/pose_stamped.hpp"
 #include "nav2_core/goal_checker.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
 #include "nav2_mppi_controller/models/state.hpp"
 #include "nav2_mppi_controller/models/trajectories.hpp"
 #include "nav2_mppi_controller/models/path.hpp"
@@ -51,6 +52,8 @@ struct CriticData
   std::shared_ptr<MotionModel> motion_model;
   std::optional<std::vector<bool>> path_pts_valid;
   std::optional<size_t> furthest_reached_path_point;
+  // Snapshot of the costmap to score against, if any, instead of the locked costmap
+  const nav2_costmap_2d::Costmap2D * costmap_snapshot{nullptr};
 };
 
 }  // namespace mppi
@@ -89,6 +89,34 @@ public:
     */
   virtual void score(CriticData & data) = 0;
 
+  /**
+    * @brief Whether the critic scores each trajectory independently of the others in
+    * the batch, so that disjoint chunks of the batch may be scored concurrently
+    * by scoreChunk() after a single call to prepareBatch()
+    * @return If the batch may be scored in chunks
+    */
+  virtual bool isBatchSeparable() const
+  {
+    return false;
+  }
+
+  /**
+    * @brief Update state shared by all chunks of the batch before they are scored,
+    * such as cached path information in the critic data
+    * @param data Critic data of the whole batch
+    */
+  virtual void prepareBatch(CriticData & /*data*/) {}
+
+  /**
+    * @brief Score a chunk of the batch, concurrently with the other chunks, so it must
+    * not modify the state of the critic
+    * @param data Critic data of the chunk
+    */
+  virtual void scoreChunk(CriticData & data)
+  {
+    score(data);
+  }
+
   /**
     * @brief Initialize critic
     */
@@ -24,12 +24,14 @@
 #include "geometry_msgs/msg/twist_stamped.hpp"
 
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
+#include "nav2_util/thread_pool.hpp"
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
 
 #include "nav2_mppi_controller/tools/parameters_handler.hpp"
 #include "nav2_mppi_controller/tools/utils.hpp"
 #include "nav2_mppi_controller/critic_data.hpp"
 #include "nav2_mppi_controller/critic_function.hpp"
+#include "nav2_mppi_controller/models/batch_chunk.hpp"
 
 namespace mppi
 {
@@ -70,6 +72,18 @@ public:
     */
   void evalTrajectoriesScores(CriticData & data) const;
 
+  /**
+    * @brief Score trajectories by the set of loaded critic functions, scoring chunks
+    * of the batch concurrently for the critics which allow it. Each chunk only writes
+    * its own rows of the costs, so the result does not depend on the scheduling of chunks.
+    * @param data Struct of necessary information to pass to the critic functions
+    * @param chunks Chunks of the batch, with the state and trajectories of data's rows
+    * @param thread_pool Thread pool to score the chunks on
+    */
+  void evalTrajectoriesScores(
+    CriticData & data, std::vector<models::BatchChunk> & chunks,
+    nav2_util::ThreadPool & thread_pool) const;
+
 protected:
   /**
     * @brief Get parameters (critics to load)
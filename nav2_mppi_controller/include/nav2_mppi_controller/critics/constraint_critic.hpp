@@ -41,6 +41,12 @@ public:
    */
   void score(CriticData & data) override;
 
+  /**
+    * @brief Trajectories are scored independently of each other
+    * @return true
+    */
+  bool isBatchSeparable() const override {return true;}
+
   float getMaxVelConstraint() {return max_vel_;}
   float getMinVelConstraint() {return min_vel_;}
 
@@ -47,6 +47,25 @@ public:
    */
   void score(CriticData & data) override;
 
+  /**
+    * @brief Trajectories are scored independently of each other
+    * @return true
+    */
+  bool isBatchSeparable() const override {return true;}
+
+  /**
+   * @brief Update the collision checking information shared by all chunks of the batch
+   * @param data Critic data of the whole batch
+   */
+  void prepareBatch(CriticData & data) override;
+
+  /**
+   * @brief Evaluate cost related to obstacle avoidance of a chunk of the batch
+   *
+   * @param costs [out] add obstacle cost values to this tensor
+   */
+  void scoreChunk(CriticData & data) override;
+
 protected:
   /**
     * @brief Checks if cost represents a collision
@@ -89,45 +108,12 @@ protected:
     */
   inline float findCircumscribedCost(std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap);
 
-  /**
-    * @brief An implementation of worldToMap fully using floats
-    * @param wx Float world X coord
-    * @param wy Float world Y coord
-    * @param mx unsigned int map X coord
-    * @param my unsigned into map Y coord
-    * @return if successful
-    */
-  inline bool worldToMapFloat(float wx, float wy, unsigned int & mx, unsigned int & my) const
-  {
-    if (wx < origin_x_ || wy < origin_y_) {
-      return false;
-    }
-
-    mx = static_cast<unsigned int>((wx - origin_x_) / resolution_);
-    my = static_cast<unsigned int>((wy - origin_y_) / resolution_);
-
-    if (mx < size_x_ && my < size_y_) {
-      return true;
-    }
-    return false;
-  }
-
-  /**
-    * @brief A local implementation of getIndex
-    * @param mx unsigned int map X coord
-    * @param my unsigned into map Y coord
-    * @return Index
-    */
-  inline unsigned int getIndex(unsigned int mx, unsigned int my) const
-  {
-    return my * size_x_ + mx;
-  }
-
-  nav2_costmap_2d::FootprintCollisionChecker<nav2_costmap_2d::Costmap2D *>
+  nav2_costmap_2d::FootprintCollisionChecker<const nav2_costmap_2d::Costmap2D *>
   collision_checker_{nullptr};
   float possible_collision_cost_;
 
   bool consider_footprint_{true};
+  bool use_footprint_stencils_{false};
   bool is_tracking_unknown_{true};
   float circumscribed_radius_{0.0f};
   float circumscribed_cost_{0.0f};
@@ -137,9 +123,6 @@ protected:
   float weight_{0};
   unsigned int trajectory_point_step_;
 
-  float origin_x_, origin_y_, resolution_;
-  unsigned int size_x_, size_y_;
-
   float near_goal_distance_;
   std::string inflation_layer_name_;
 
@@ -42,6 +42,12 @@ public:
    */
   void score(CriticData & data) override;
 
+  /**
+    * @brief Trajectories are scored independently of each other
+    * @return true
+    */
+  bool isBatchSeparable() const override {return true;}
+
 protected:
   unsigned int power_{0};
   float weight_{0};
@@ -67,11 +67,14 @@ protected:
   inline CollisionCost costAtPose(float x, float y, float theta);
 
   /**
-    * @brief Distance to obstacle from cost
-    * @param cost Costmap cost
-    * @return float Distance to the obstacle represented by cost
+    * @brief Distances to obstacles from costs of a batch of points
+    * @param costs Costmap costs
+    * @param using_footprint If each cost is of the footprint rather than the center point
+    * @param dists [out] Distances to the obstacles represented by costs
     */
-  inline float distanceToObstacle(const CollisionCost & cost);
+  inline void distanceToObstacle(
+    const Eigen::ArrayXf & costs, const Eigen::Array<bool, Eigen::Dynamic, 1> & using_footprint,
+    Eigen::ArrayXf & dists);
 
   /**
     * @brief Find the min cost of the inflation decay function for which the robot MAY be
@@ -83,10 +86,11 @@ protected:
   float findCircumscribedCost(std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap);
 
 protected:
-  nav2_costmap_2d::FootprintCollisionChecker<nav2_costmap_2d::Costmap2D *>
+  nav2_costmap_2d::FootprintCollisionChecker<const nav2_costmap_2d::Costmap2D *>
   collision_checker_{nullptr};
 
   bool consider_footprint_{true};
+  bool use_footprint_stencils_{false};
   float collision_cost_{0};
   float inflation_scale_factor_{0}, inflation_radius_{0};
 
@@ -44,6 +44,19 @@ public:
    */
   void score(CriticData & data) override;
 
+  /**
+    * @brief Trajectories are scored independently of each other
+    * @return true
+    */
+  bool isBatchSeparable() const override {return true;}
+
+  /**
+    * @brief Find the furthest reached path point and path point validity of the whole batch,
+    * shared by its chunks
+    * @param data Critic data of the whole batch
+    */
+  void prepareBatch(CriticData & data) override;
+
 protected:
   size_t offset_from_furthest_{0};
   int trajectory_point_step_{0};
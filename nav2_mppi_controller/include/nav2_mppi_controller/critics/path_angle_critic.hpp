@@ -71,6 +71,19 @@ public:
    */
   void score(CriticData & data) override;
 
+  /**
+    * @brief Trajectories are scored independently of each other
+    * @return true
+    */
+  bool isBatchSeparable() const override {return true;}
+
+  /**
+    * @brief Find the furthest reached path point of the whole batch,
+    * shared by its chunks
+    * @param data Critic data of the whole batch
+    */
+  void prepareBatch(CriticData & data) override;
+
 protected:
   float max_angle_to_furthest_{0};
   float threshold_to_consider_{0};
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_MPPI_CONTROLLER__MODELS__BATCH_CHUNK_HPP_
+#define NAV2_MPPI_CONTROLLER__MODELS__BATCH_CHUNK_HPP_
+
+#include <Eigen/Dense>
+
+#include "nav2_mppi_controller/models/state.hpp"
+#include "nav2_mppi_controller/models/trajectories.hpp"
+
+namespace mppi::models
+{
+
+/**
+ * @struct mppi::models::BatchChunk
+ * @brief Contiguous rows of the trajectory batch, propagated and scored together
+ * on a worker thread
+ */
+struct BatchChunk
+{
+  Eigen::Index offset{0};
+  Eigen::Index rows{0};
+
+  State state;
+  Trajectories trajectories;
+  Eigen::ArrayXf costs;
+
+  /**
+    * @brief Reset chunk data
+    * @param chunk_offset First row of the batch in the chunk
+    * @param chunk_rows Number of rows of the batch in the chunk
+    * @param time_steps Number of time steps of the trajectories
+    */
+  void reset(Eigen::Index chunk_offset, Eigen::Index chunk_rows, unsigned int time_steps)
+  {
+    offset = chunk_offset;
+    rows = chunk_rows;
+    state.reset(rows, time_steps);
+    trajectories.reset(rows, time_steps);
+    costs.setZero(rows);
+  }
+};
+
+}  // namespace mppi::models
+
+#endif  // NAV2_MPPI_CONTROLLER__MODELS__BATCH_CHUNK_HPP_
@@ -36,6 +36,7 @@ struct OptimizerSettings
   unsigned int batch_size{0u};
   unsigned int time_steps{0u};
   unsigned int iteration_count{0u};
+  unsigned int worker_threads{1u};
   bool shift_control_sequence{false};
   size_t retry_attempt_limit{0};
 };
@@ -19,18 +19,21 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
 
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
 #include "nav2_core/goal_checker.hpp"
 #include "nav2_core/controller_exceptions.hpp"
+#include "nav2_util/thread_pool.hpp"
 
 #include "geometry_msgs/msg/twist.hpp"
 #include "geometry_msgs/msg/pose_stamped.hpp"
 #include "geometry_msgs/msg/twist_stamped.hpp"
 #include "nav_msgs/msg/path.hpp"
 
+#include "nav2_mppi_controller/models/batch_chunk.hpp"
 #include "nav2_mppi_controller/models/optimizer_settings.hpp"
 #include "nav2_mppi_controller/motion_models.hpp"
 #include "nav2_mppi_controller/critic_manager.hpp"
@@ -86,12 +89,15 @@ public:
    * @param plan Path plan to track
    * @param goal Given Goal pose to reach.
    * @param goal_checker Object to check if goal is completed
+   * @param costmap_snapshot Snapshot of the costmap for the critics to score against,
+   * or nullptr if the costmap is locked instead
    * @return TwistStamped of the MPPI control
    */
   geometry_msgs::msg::TwistStamped evalControl(
     const geometry_msgs::msg::PoseStamped & robot_pose,
     const geometry_msgs::msg::Twist & robot_speed, const nav_msgs::msg::Path & plan,
-    const geometry_msgs::msg::Pose & goal, nav2_core::GoalChecker * goal_checker);
+    const geometry_msgs::msg::Pose & goal, nav2_core::GoalChecker * goal_checker,
+    const nav2_costmap_2d::Costmap2D * costmap_snapshot = nullptr);
 
   /**
    * @brief Get the trajectories generated in a cycle for visualization
@@ -271,6 +277,9 @@ protected:
   geometry_msgs::msg::Pose goal_;
   Eigen::ArrayXf costs_;
 
+  std::unique_ptr<nav2_util::ThreadPool> thread_pool_;
+  std::vector<models::BatchChunk> chunks_;
+
   CriticData critics_data_ = {
     state_, generated_trajectories_, path_, goal_,
     costs_, settings_.model_dt, false, nullptr, nullptr,
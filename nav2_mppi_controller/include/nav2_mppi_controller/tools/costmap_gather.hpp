@@ -0,0 +1,241 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_MPPI_CONTROLLER__TOOLS__COSTMAP_GATHER_HPP_
+#define NAV2_MPPI_CONTROLLER__TOOLS__COSTMAP_GATHER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define MPPI_COSTMAP_GATHER_AVX2
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define MPPI_COSTMAP_GATHER_NEON
+#endif
+
+#include "nav2_costmap_2d/costmap_2d.hpp"
+
+namespace mppi::utils
+{
+
+/**
+ * @struct mppi::utils::CostmapView
+ * @brief Float geometry and raw cost data of a costmap, as used to gather
+ * trajectory point costs in the float precision of the trajectories
+ */
+struct CostmapView
+{
+  CostmapView() = default;
+
+  /**
+   * @brief Constructor of mppi::utils::CostmapView
+   * @param costmap Costmap to view, which must outlive the view and not be resized
+   */
+  explicit CostmapView(const nav2_costmap_2d::Costmap2D & costmap)
+  : data(costmap.getCharMap()),
+    origin_x(static_cast<float>(costmap.getOriginX())),
+    origin_y(static_cast<float>(costmap.getOriginY())),
+    resolution(static_cast<float>(costmap.getResolution())),
+    size_x(costmap.getSizeInCellsX()),
+    size_y(costmap.getSizeInCellsY())
+  {}
+
+  const unsigned char * data{nullptr};
+  float origin_x{0.0f};
+  float origin_y{0.0f};
+  float resolution{1.0f};
+  unsigned int size_x{0};
+  unsigned int size_y{0};
+};
+
+/**
+ * @brief Gather the costs of a batch of points, one at a time
+ * @param view Costmap to gather costs from
+ * @param xs X coordinates of the points
+ * @param ys Y coordinates of the points
+ * @param n Number of points
+ * @param costs [out] Costs of the points, 255 (NO_INFORMATION) for points off the map
+ */
+inline void gatherCostsScalar(
+  const CostmapView & view, const float * xs, const float * ys, std::size_t n, float * costs)
+{
+  for (std::size_t i = 0; i < n; ++i) {
+    // Compared before the casts, so that NaN and overflowing points are off the map
+    const float fx = (xs[i] - view.origin_x) / view.resolution;
+    const float fy = (ys[i] - view.origin_y) / view.resolution;
+    if (fx >= 0.0f && fy >= 0.0f &&
+      fx < static_cast<float>(view.size_x) && fy < static_cast<float>(view.size_y))
+    {
+      const unsigned int mx = static_cast<unsigned int>(fx);
+      const unsigned int my = static_cast<unsigned int>(fy);
+      costs[i] = static_cast<float>(view.data[my * view.size_x + mx]);
+    } else {
+      costs[i] = 255.0f;
+    }
+  }
+}
+
+#if defined(MPPI_COSTMAP_GATHER_AVX2)
+
+/**
+ * @brief Gather the costs of a batch of points, 8 at a time using AVX2 gathers.
+ * Only called after checking that the CPU supports AVX2.
+ * @param view Costmap to gather costs from
+ * @param xs X coordinates of the points
+ * @param ys Y coordinates of the points
+ * @param n Number of points
+ * @param costs [out] Costs of the points, 255 (NO_INFORMATION) for points off the map
+ */
+__attribute__((target("avx2")))
+inline void gatherCostsAVX2(
+  const CostmapView & view, const float * xs, const float * ys, std::size_t n, float * costs)
+{
+  const __m256 origin_x = _mm256_set1_ps(view.origin_x);
+  const __m256 origin_y = _mm256_set1_ps(view.origin_y);
+  const __m256 resolution = _mm256_set1_ps(view.resolution);
+  const __m256i size_x = _mm256_set1_epi32(static_cast<int>(view.size_x));
+  const __m256i size_y = _mm256_set1_epi32(static_cast<int>(view.size_y));
+  const __m256i minus_one = _mm256_set1_epi32(-1);
+  const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+  const __m256i no_information = _mm256_set1_epi32(255);
+  // Gathers load 4 bytes per cell, so the last 3 cells of the map are read one by one
+  const __m256i gather_end = _mm256_set1_epi32(
+    static_cast<int>(view.size_x * view.size_y) - 3);
+  const int * base = reinterpret_cast<const int *>(view.data);
+
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const __m256 wx = _mm256_loadu_ps(xs + i);
+    const __m256 wy = _mm256_loadu_ps(ys + i);
+
+    // Points below the origin, or NaN, are off the map
+    const __m256 above_origin = _mm256_and_ps(
+      _mm256_cmp_ps(wx, origin_x, _CMP_GE_OQ), _mm256_cmp_ps(wy, origin_y, _CMP_GE_OQ));
+
+    // Truncation as in the scalar cast, overflows become negative and are masked out below
+    const __m256i mx = _mm256_cvttps_epi32(
+      _mm256_div_ps(_mm256_sub_ps(wx, origin_x), resolution));
+    const __m256i my = _mm256_cvttps_epi32(
+      _mm256_div_ps(_mm256_sub_ps(wy, origin_y), resolution));
+
+    const __m256i in_x = _mm256_and_si256(
+      _mm256_cmpgt_epi32(mx, minus_one), _mm256_cmpgt_epi32(size_x, mx));
+    const __m256i in_y = _mm256_and_si256(
+      _mm256_cmpgt_epi32(my, minus_one), _mm256_cmpgt_epi32(size_y, my));
+    const __m256i on_map = _mm256_and_si256(
+      _mm256_castps_si256(above_origin), _mm256_and_si256(in_x, in_y));
+
+    const __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(my, size_x), mx);
+    const __m256i gather = _mm256_and_si256(on_map, _mm256_cmpgt_epi32(gather_end, index));
+
+    __m256i cells = _mm256_mask_i32gather_epi32(
+      _mm256_setzero_si256(), base, index, gather, 1);
+    cells = _mm256_blendv_epi8(
+      no_information, _mm256_and_si256(cells, byte_mask), on_map);
+    _mm256_storeu_ps(costs + i, _mm256_cvtepi32_ps(cells));
+
+    const int tail = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(gather, on_map)));
+    if (tail) {
+      alignas(32) int32_t indices[8];
+      _mm256_store_si256(reinterpret_cast<__m256i *>(indices), index);
+      for (int k = 0; k < 8; ++k) {
+        if (tail & (1 << k)) {
+          costs[i + k] = static_cast<float>(view.data[indices[k]]);
+        }
+      }
+    }
+  }
+
+  gatherCostsScalar(view, xs + i, ys + i, n - i, costs + i);
+}
+
+#elif defined(MPPI_COSTMAP_GATHER_NEON)
+
+/**
+ * @brief Gather the costs of a batch of points, computing cells 4 at a time using NEON.
+ * NEON has no gather instruction, so the cells are loaded one by one.
+ * @param view Costmap to gather costs from
+ * @param xs X coordinates of the points
+ * @param ys Y coordinates of the points
+ * @param n Number of points
+ * @param costs [out] Costs of the points, 255 (NO_INFORMATION) for points off the map
+ */
+inline void gatherCostsNEON(
+  const CostmapView & view, const float * xs, const float * ys, std::size_t n, float * costs)
+{
+  const float32x4_t origin_x = vdupq_n_f32(view.origin_x);
+  const float32x4_t origin_y = vdupq_n_f32(view.origin_y);
+  const float32x4_t resolution = vdupq_n_f32(view.resolution);
+  const uint32x4_t size_x = vdupq_n_u32(view.size_x);
+  const uint32x4_t size_y = vdupq_n_u32(view.size_y);
+
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    const float32x4_t wx = vld1q_f32(xs + i);
+    const float32x4_t wy = vld1q_f32(ys + i);
+
+    // Points below the origin, or NaN, are off the map
+    const uint32x4_t above_origin = vandq_u32(vcgeq_f32(wx, origin_x), vcgeq_f32(wy, origin_y));
+
+    // Saturating truncation, so overflows stay off the map
+    const uint32x4_t mx = vcvtq_u32_f32(vdivq_f32(vsubq_f32(wx, origin_x), resolution));
+    const uint32x4_t my = vcvtq_u32_f32(vdivq_f32(vsubq_f32(wy, origin_y), resolution));
+    const uint32x4_t on_map = vandq_u32(
+      above_origin, vandq_u32(vcltq_u32(mx, size_x), vcltq_u32(my, size_y)));
+    const uint32x4_t index = vmlaq_u32(mx, my, size_x);
+
+    uint32_t indices[4], valid[4];
+    vst1q_u32(indices, index);
+    vst1q_u32(valid, on_map);
+    for (int k = 0; k < 4; ++k) {
+      costs[i + k] = valid[k] ? static_cast<float>(view.data[indices[k]]) : 255.0f;
+    }
+  }
+
+  gatherCostsScalar(view, xs + i, ys + i, n - i, costs + i);
+}
+
+#endif
+
+/**
+ * @brief Gather the costs of a batch of points, such as a column of trajectory points,
+ * using the widest vector instructions available on the CPU. Points are converted
+ * to cells in float precision, as Costmap2D::worldToMap does in double precision.
+ * @param view Costmap to gather costs from
+ * @param xs X coordinates of the points
+ * @param ys Y coordinates of the points
+ * @param n Number of points
+ * @param costs [out] Costs of the points, 255 (NO_INFORMATION) for points off the map
+ */
+inline void gatherCosts(
+  const CostmapView & view, const float * xs, const float * ys, std::size_t n, float * costs)
+{
+#if defined(MPPI_COSTMAP_GATHER_AVX2)
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  if (has_avx2 && view.size_x * view.size_y > 3) {
+    gatherCostsAVX2(view, xs, ys, n, costs);
+    return;
+  }
+#elif defined(MPPI_COSTMAP_GATHER_NEON)
+  gatherCostsNEON(view, xs, ys, n, costs);
+  return;
+#endif
+  gatherCostsScalar(view, xs, ys, n, costs);
+}
+
+}  // namespace mppi::utils
+
+#endif  // NAV2_MPPI_CONTROLLER__TOOLS__COSTMAP_GATHER_HPP_
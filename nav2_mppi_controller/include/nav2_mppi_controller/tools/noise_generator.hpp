@@ -22,9 +22,12 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <cstdint>
 #include <random>
+#include <vector>
 
 #include "nav2_ros_common/lifecycle_node.hpp"
+#include "nav2_util/thread_pool.hpp"
 #include "nav2_mppi_controller/models/optimizer_settings.hpp"
 #include "nav2_mppi_controller/tools/parameters_handler.hpp"
 #include "nav2_mppi_controller/models/control_sequence.hpp"
@@ -51,10 +54,12 @@ public:
    * @param is_holonomic If base is holonomic
    * @param name Namespace for configs
    * @param param_handler Get parameters util
+   * @param thread_pool Optional pool to generate philox noises on in parallel
    */
   void initialize(
     mppi::models::OptimizerSettings & settings,
-    bool is_holonomic, const std::string & name, ParametersHandler * param_handler);
+    bool is_holonomic, const std::string & name, ParametersHandler * param_handler,
+    nav2_util::ThreadPool * thread_pool = nullptr);
 
   /**
    * @brief Shutdown noise generator thread
@@ -63,7 +68,8 @@ public:
 
   /**
    * @brief Signal to the noise thread the controller is ready to generate a new
-   * noised control for the next iteration
+   * noised control for the next iteration, or rotate to the next pre-generated
+   * noise bank when noises are not regenerated
    */
   void generateNextNoises();
 
@@ -81,6 +87,26 @@ public:
   void reset(mppi::models::OptimizerSettings & settings, bool is_holonomic);
 
 protected:
+  /**
+   * @struct mppi::NoiseGenerator::NoiseBank
+   * @brief Noises of a batch of control sequences
+   */
+  struct NoiseBank
+  {
+    Eigen::ArrayXXf vx;
+    Eigen::ArrayXXf vy;
+    Eigen::ArrayXXf wz;
+  };
+
+  /**
+   * @brief Random number generators available to sample noises from
+   */
+  enum class NoiseRNG
+  {
+    DEFAULT,
+    PHILOX
+  };
+
   /**
    * @brief Thread to execute noise generation process
    */
@@ -89,15 +115,26 @@ protected:
   /**
    * @brief Generate random controls by gaussian noise with mean in
    * control_sequence_
-   *
-   * @return tensor of shape [ batch_size_, time_steps_, 2]
-   * where 2 stands for v, w
+   * @param bank [out] Noise bank to generate, of shape [batch_size_, time_steps_]
+   * for each of vx, vy, wz
    */
-  void generateNoisedControls();
+  void generateNoisedControls(NoiseBank & bank);
+
+  /**
+   * @brief Fill noises with the next philox stream, in parallel when a thread pool is set
+   * @param noises [out] Noises to fill, of shape [batch_size_, time_steps_]
+   * @param stddev Standard deviation of the noises
+   * @param stream Philox stream to sample the noises from
+   */
+  void fillPhiloxNoises(Eigen::ArrayXXf & noises, float stddev, uint64_t stream);
+
+  std::vector<NoiseBank> banks_;
+  std::size_t bank_{0};
 
-  Eigen::ArrayXXf noises_vx_;
-  Eigen::ArrayXXf noises_vy_;
-  Eigen::ArrayXXf noises_wz_;
+  NoiseRNG rng_{NoiseRNG::DEFAULT};
+  uint64_t seed_{0};
+  uint64_t generation_{0};
+  nav2_util::ThreadPool * thread_pool_{nullptr};
 
   std::default_random_engine generator_;
   std::normal_distribution<float> ndistribution_vx_;
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_MPPI_CONTROLLER__TOOLS__PHILOX_HPP_
+#define NAV2_MPPI_CONTROLLER__TOOLS__PHILOX_HPP_
+
+#include <Eigen/Dense>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace mppi::utils
+{
+
+/**
+ * @brief Philox4x32-10 counter based random number generator, from "Parallel Random
+ * Numbers: As Easy as 1, 2, 3" (Salmon et al., 2011). Each counter value is hashed
+ * independently into 4 random words, so any part of a random sequence can be generated
+ * without generating what comes before it.
+ * @param counter Counter, the position in the random sequence
+ * @param key Key, the seed of the random sequence
+ * @return 4 uniformly distributed random words
+ */
+inline std::array<uint32_t, 4> philox4x32(
+  std::array<uint32_t, 4> counter, std::array<uint32_t, 2> key)
+{
+  constexpr uint32_t kMul0 = 0xD2511F53;
+  constexpr uint32_t kMul1 = 0xCD9E8D57;
+  constexpr uint32_t kWeyl0 = 0x9E3779B9;
+  constexpr uint32_t kWeyl1 = 0xBB67AE85;
+
+  for (int round = 0; round < 10; ++round) {
+    const uint64_t product0 = static_cast<uint64_t>(kMul0) * counter[0];
+    const uint64_t product1 = static_cast<uint64_t>(kMul1) * counter[2];
+    counter = {
+      static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+      static_cast<uint32_t>(product1),
+      static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+      static_cast<uint32_t>(product0)};
+    key[0] += kWeyl0;
+    key[1] += kWeyl1;
+  }
+  return counter;
+}
+
+/**
+ * @brief Fill a range of a sequence of normally distributed samples, using the
+ * Box-Muller transform of Philox uniform samples. Sample i of the sequence only depends
+ * on the seed, the stream and i, so disjoint ranges may be filled concurrently and
+ * give the same sequence however they are split.
+ * @param samples [out] Sequence to fill the range of
+ * @param begin First sample of the range
+ * @param end Sample past the end of the range
+ * @param stddev Standard deviation of the samples, of zero mean
+ * @param seed Seed of the random sequence
+ * @param stream Index of the sequence among those of the same seed
+ */
+inline void fillNormalPhilox(
+  float * samples, std::size_t begin, std::size_t end, float stddev,
+  uint64_t seed, uint64_t stream)
+{
+  // Each Philox block gives 4 uniform samples, transformed in 2 pairs into 4 normal samples
+  constexpr std::size_t kBatchBlocks = 256;
+  constexpr std::size_t kPacketPad = 16;
+  constexpr float kTwoPi = 6.283185307179586f;
+  const std::array<uint32_t, 2> key = {
+    static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+
+  constexpr Eigen::Index kBatchPairs = 2 * kBatchBlocks;
+  Eigen::ArrayXf u1(kBatchPairs), u2(kBatchPairs);
+  Eigen::ArrayXf radius(kBatchPairs), cos_theta(kBatchPairs), sin_theta(kBatchPairs);
+
+  std::size_t block = begin / 4;
+  const std::size_t end_block = (end + 3) / 4;
+  while (block < end_block) {
+    const std::size_t blocks = std::min(kBatchBlocks, end_block - block);
+    for (std::size_t b = 0; b < blocks; ++b) {
+      const uint64_t index = block + b;
+      const std::array<uint32_t, 4> bits = philox4x32(
+        {static_cast<uint32_t>(index), static_cast<uint32_t>(index >> 32),
+          static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)}, key);
+      // Top 24 bits, centered in their interval so that uniforms are in (0, 1)
+      for (int pair = 0; pair < 2; ++pair) {
+        u1(2 * b + pair) = (static_cast<float>(bits[2 * pair] >> 8) + 0.5f) * 0x1.0p-24f;
+        u2(2 * b + pair) = (static_cast<float>(bits[2 * pair + 1] >> 8) + 0.5f) * 0x1.0p-24f;
+      }
+    }
+
+    // Transcendental functions are evaluated on whole arrays, by Eigen's vectorized kernels.
+    // Arrays are padded to whole packets, as the scalar remainder may round differently
+    // and samples must not depend on how the sequence is split in ranges.
+    const Eigen::Index pairs = static_cast<Eigen::Index>((2 * blocks + kPacketPad - 1) /
+      kPacketPad * kPacketPad);
+    u1.segment(2 * blocks, pairs - 2 * blocks).setConstant(0.5f);
+    u2.segment(2 * blocks, pairs - 2 * blocks).setConstant(0.5f);
+    radius.head(pairs) = (-2.0f * u1.head(pairs).log()).sqrt() * stddev;
+    cos_theta.head(pairs) = (kTwoPi * u2.head(pairs)).cos();
+    sin_theta.head(pairs) = (kTwoPi * u2.head(pairs)).sin();
+
+    const std::size_t first = block * 4;
+    const std::size_t from = std::max(begin, first);
+    const std::size_t to = std::min(end, first + 4 * blocks);
+    for (std::size_t i = from; i < to; ++i) {
+      const std::size_t pair = (i - first) / 2;
+      samples[i] = radius(pair) * ((i & 1) ? sin_theta(pair) : cos_theta(pair));
+    }
+    block += blocks;
+  }
+}
+
+}  // namespace mppi::utils
+
+#endif  // NAV2_MPPI_CONTROLLER__TOOLS__PHILOX_HPP_
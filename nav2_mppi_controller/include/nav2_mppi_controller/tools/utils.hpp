@@ -410,7 +410,8 @@ inline void findPathCosts(
   CriticData & data,
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros)
 {
-  auto * costmap = costmap_ros->getCostmap();
+  const nav2_costmap_2d::Costmap2D * costmap =
+    data.costmap_snapshot ? data.costmap_snapshot : costmap_ros->getCostmap();
   unsigned int map_x, map_y;
   const size_t path_segments_count = data.path.x.size() - 1;
   data.path_pts_valid = std::vector<bool>(path_segments_count, false);
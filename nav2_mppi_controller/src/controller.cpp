@@ -39,6 +39,7 @@ void MPPIController::configure(
   getParam(visualize_, "visualize", false);
 
   getParam(publish_optimal_trajectory_, "publish_optimal_trajectory", false);
+  getParam(use_costmap_snapshot_, "use_costmap_snapshot", false);
 
   // Configure composed objects
   optimizer_.initialize(parent_, name_, costmap_ros_, parameters_handler_.get());
@@ -103,11 +104,21 @@ geometry_msgs::msg::TwistStamped MPPIController::computeVelocityCommands(
 
   nav_msgs::msg::Path transformed_plan = path_handler_.transformPath(robot_pose);
 
+  // Score against a snapshot of the costmap if enabled, so that the costmap is not locked
+  // for the whole optimization, holding up its updates
+  std::shared_ptr<const nav2_costmap_2d::Costmap2D> costmap_snapshot;
+  if (use_costmap_snapshot_) {
+    costmap_snapshot = costmap_ros_->getCostmapSnapshot();
+  }
   nav2_costmap_2d::Costmap2D * costmap = costmap_ros_->getCostmap();
-  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> costmap_lock(*(costmap->getMutex()));
+  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> costmap_lock(
+    *(costmap->getMutex()), std::defer_lock);
+  if (!costmap_snapshot) {
+    costmap_lock.lock();
+  }
 
-  geometry_msgs::msg::TwistStamped cmd =
-    optimizer_.evalControl(robot_pose, robot_speed, transformed_plan, goal, goal_checker);
+  geometry_msgs::msg::TwistStamped cmd = optimizer_.evalControl(
+    robot_pose, robot_speed, transformed_plan, goal, goal_checker, costmap_snapshot.get());
 
 #ifdef BENCHMARK_TESTING
   auto end = std::chrono::system_clock::now();
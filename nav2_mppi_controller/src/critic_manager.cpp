@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+
 #include "nav2_mppi_controller/critic_manager.hpp"
 
 namespace mppi
@@ -75,4 +77,39 @@ void CriticManager::evalTrajectoriesScores(
   }
 }
 
+void CriticManager::evalTrajectoriesScores(
+  CriticData & data, std::vector<models::BatchChunk> & chunks,
+  nav2_util::ThreadPool & thread_pool) const
+{
+  std::vector<char> chunks_failed(chunks.size(), false);
+  for (const auto & critic : critics_) {
+    if (data.fail_flag) {
+      break;
+    }
+
+    if (!critic->isBatchSeparable() || chunks.empty()) {
+      critic->score(data);
+      continue;
+    }
+
+    critic->prepareBatch(data);
+    thread_pool.parallelFor(
+      chunks.size(), [&](std::size_t i) {
+        auto & chunk = chunks[i];
+        chunk.costs = data.costs.segment(chunk.offset, chunk.rows);
+        CriticData chunk_data = {
+          chunk.state, chunk.trajectories, data.path, data.goal,
+          chunk.costs, data.model_dt, false, data.goal_checker, data.motion_model,
+          data.path_pts_valid, data.furthest_reached_path_point, data.costmap_snapshot};
+        critic->scoreChunk(chunk_data);
+        data.costs.segment(chunk.offset, chunk.rows) = chunk.costs;
+        chunks_failed[i] = chunk_data.fail_flag;
+      });
+
+    // Critics flag a failure when all trajectories collide, so all chunks must have failed
+    data.fail_flag = std::all_of(
+      chunks_failed.begin(), chunks_failed.end(), [](char failed) {return failed;});
+  }
+}
+
 }  // namespace mppi
@@ -13,8 +13,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cmath>
 #include "nav2_mppi_controller/critics/cost_critic.hpp"
+#include "nav2_mppi_controller/tools/costmap_gather.hpp"
 #include "nav2_core/controller_exceptions.hpp"
 
 namespace mppi::critics
@@ -27,6 +29,7 @@ void CostCritic::initialize()
 
   auto getParam = parameters_handler_->getParamGetter(name_);
   getParam(consider_footprint_, "consider_footprint", false);
+  getParam(use_footprint_stencils_, "use_footprint_stencils", false);
   getParam(power_, "cost_power", 1);
   getParam(weight_, "cost_weight", 3.81f);
   getParam(critical_cost_, "critical_cost", 300.0f);
@@ -47,6 +50,7 @@ void CostCritic::initialize()
   parameters_handler_->addParamCallback(name_ + ".cost_weight", weightDynamicCb);
 
   collision_checker_.setCostmap(costmap_);
+  collision_checker_.setUseFootprintStencils(use_footprint_stencils_);
   possible_collision_cost_ = findCircumscribedCost(costmap_ros_);
 
   if (possible_collision_cost_ < 1.0f) {
@@ -135,22 +139,38 @@ void CostCritic::score(CriticData & data)
     return;
   }
 
-  geometry_msgs::msg::Pose goal = utils::getCriticGoal(data, enforce_path_inversion_);
+  prepareBatch(data);
+  scoreChunk(data);
+}
+
+void CostCritic::prepareBatch(CriticData & data)
+{
+  if (!enabled_) {
+    return;
+  }
+
+  collision_checker_.setCostmap(data.costmap_snapshot ? data.costmap_snapshot : costmap_);
 
   // Setup cost information for various parts of the critic
   is_tracking_unknown_ = costmap_ros_->getLayeredCostmap()->isTrackingUnknown();
-  auto * costmap = collision_checker_.getCostmap();
-  origin_x_ = static_cast<float>(costmap->getOriginX());
-  origin_y_ = static_cast<float>(costmap->getOriginY());
-  resolution_ = static_cast<float>(costmap->getResolution());
-  size_x_ = costmap->getSizeInCellsX();
-  size_y_ = costmap->getSizeInCellsY();
 
   if (consider_footprint_) {
     // footprint may have changed since initialization if user has dynamic footprints
     possible_collision_cost_ = findCircumscribedCost(costmap_ros_);
+    // Rasterised here, as the chunks of the batch are then checked concurrently
+    collision_checker_.updateFootprintStencil(costmap_ros_->getRobotFootprint());
+  }
+}
+
+void CostCritic::scoreChunk(CriticData & data)
+{
+  if (!enabled_) {
+    return;
   }
 
+  geometry_msgs::msg::Pose goal = utils::getCriticGoal(data, enforce_path_inversion_);
+  auto * costmap = collision_checker_.getCostmap();
+
   // If near the goal, don't apply the preferential term since the goal is near obstacles
   bool near_goal = false;
   if (utils::withinPositionGoalTolerance(near_goal_distance_, data.state.pose.pose, goal)) {
@@ -163,59 +183,56 @@ void CostCritic::score(CriticData & data)
 
   int strided_traj_cols = floor((data.trajectories.x.cols() - 1) / trajectory_point_step_) + 1;
   int strided_traj_rows = data.trajectories.x.rows();
-  int outer_stride = strided_traj_rows * trajectory_point_step_;
-
-  const auto traj_x = Eigen::Map<const Eigen::ArrayXXf, 0,
-      Eigen::Stride<-1, -1>>(data.trajectories.x.data(), strided_traj_rows, strided_traj_cols,
-      Eigen::Stride<-1, -1>(outer_stride, 1));
-  const auto traj_y = Eigen::Map<const Eigen::ArrayXXf, 0,
-      Eigen::Stride<-1, -1>>(data.trajectories.y.data(), strided_traj_rows, strided_traj_cols,
-      Eigen::Stride<-1, -1>(outer_stride, 1));
-  const auto traj_yaw = Eigen::Map<const Eigen::ArrayXXf, 0,
-      Eigen::Stride<-1, -1>>(data.trajectories.yaws.data(), strided_traj_rows, strided_traj_cols,
-      Eigen::Stride<-1, -1>(outer_stride, 1));
-
-  for (int i = 0; i < strided_traj_rows; ++i) {
-    bool trajectory_collide = false;
-    float pose_cost = 0.0f;
-    float & traj_cost = repulsive_cost(i);
-
-    for (int j = 0; j < strided_traj_cols; j++) {
-      float Tx = traj_x(i, j);
-      float Ty = traj_y(i, j);
-      unsigned int x_i = 0u, y_i = 0u;
-
-      // The getCost doesn't use orientation
-      // The footprintCostAtPose will always return "INSCRIBED" if footprint is over it
-      // So the center point has more information than the footprint
-      if (!worldToMapFloat(Tx, Ty, x_i, y_i)) {
-        pose_cost = 255.0f;  // NO_INFORMATION in float
-      } else {
-        pose_cost = static_cast<float>(costmap->getCost(getIndex(x_i, y_i)));
-        if (pose_cost < 1.0f) {
-          continue;  // In free space
-        }
-      }
-
-      if (inCollision(pose_cost, Tx, Ty, traj_yaw(i, j))) {
-        traj_cost = collision_cost_;
-        trajectory_collide = true;
-        break;
-      }
 
-      // Let near-collision trajectory points be punished severely
-      // Note that we collision check based on the footprint actual,
-      // but score based on the center-point cost regardless
-      if (pose_cost >= static_cast<float>(near_collision_cost_)) {
-        traj_cost += critical_cost_;
-      } else if (!near_goal) {  // Generally prefer trajectories further from obstacles
-        traj_cost += pose_cost;
+  // Lowest center point cost for which inCollision() may be true, lower costs are never
+  // in collision so only the few points above it are checked one by one
+  float check_cost = nav2_costmap_2d::INSCRIBED_INFLATED_OBSTACLE;
+  if (consider_footprint_) {
+    check_cost = possible_collision_cost_ < 1.0f ?
+      1.0f : std::min(possible_collision_cost_, check_cost + 1.0f);
+  }
+  // Free points add nothing, even with a near collision cost of 0
+  const float critical_threshold = std::max(static_cast<float>(near_collision_cost_), 1.0f);
+  const float non_critical_scale = near_goal ? 0.0f : 1.0f;
+
+  const utils::CostmapView costmap_view(*costmap);
+  Eigen::ArrayXf pose_costs(strided_traj_rows);
+  Eigen::Array<bool, Eigen::Dynamic, 1> collided =
+    Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(strided_traj_rows, false);
+
+  // Trajectories are stored column-major, so each time step is a contiguous column
+  // whose costs are gathered and scored for the whole batch at once
+  for (int j = 0; j < strided_traj_cols; j++) {
+    const int col = j * trajectory_point_step_;
+    utils::gatherCosts(
+      costmap_view, data.trajectories.x.col(col).data(), data.trajectories.y.col(col).data(),
+      strided_traj_rows, pose_costs.data());
+
+    // The getCost doesn't use orientation
+    // The footprintCostAtPose will always return "INSCRIBED" if footprint is over it
+    // So the center point has more information than the footprint
+    for (int i = 0; i < strided_traj_rows; ++i) {
+      if (pose_costs(i) >= check_cost && !collided(i) &&
+        inCollision(
+          pose_costs(i), data.trajectories.x(i, col), data.trajectories.y(i, col),
+          data.trajectories.yaws(i, col)))
+      {
+        collided(i) = true;
       }
     }
 
-    all_trajectories_collide &= trajectory_collide;
+    // Let near-collision trajectory points be punished severely
+    // Note that we collision check based on the footprint actual,
+    // but score based on the center-point cost regardless.
+    // Generally prefer trajectories further from obstacles unless near the goal.
+    // Points of trajectories in collision are overridden by the collision cost below
+    repulsive_cost += (pose_costs >= critical_threshold).select(
+      critical_cost_, pose_costs * non_critical_scale);
   }
 
+  repulsive_cost = collided.select(collision_cost_, repulsive_cost);
+  all_trajectories_collide = collided.all();
+
   if (power_ > 1u) {
     data.costs += (repulsive_cost *
       (weight_ / static_cast<float>(strided_traj_cols))).pow(power_);
@@ -15,6 +15,7 @@
 
 #include <cmath>
 #include "nav2_mppi_controller/critics/obstacles_critic.hpp"
+#include "nav2_mppi_controller/tools/costmap_gather.hpp"
 #include "nav2_costmap_2d/inflation_layer.hpp"
 #include "nav2_core/controller_exceptions.hpp"
 
@@ -28,6 +29,7 @@ void ObstaclesCritic::initialize()
 
   auto getParam = parameters_handler_->getParamGetter(name_);
   getParam(consider_footprint_, "consider_footprint", false);
+  getParam(use_footprint_stencils_, "use_footprint_stencils", false);
   getParam(power_, "cost_power", 1);
   getParam(repulsion_weight_, "repulsion_weight", 1.5f);
   getParam(critical_weight_, "critical_weight", 20.0f);
@@ -37,6 +39,7 @@ void ObstaclesCritic::initialize()
   getParam(inflation_layer_name_, "inflation_layer_name", std::string(""));
 
   collision_checker_.setCostmap(costmap_);
+  collision_checker_.setUseFootprintStencils(use_footprint_stencils_);
   possible_collision_cost_ = findCircumscribedCost(costmap_ros_);
 
   if (possible_collision_cost_ < 1.0f) {
@@ -104,19 +107,17 @@ float ObstaclesCritic::findCircumscribedCost(
   return circumscribed_cost_;
 }
 
-float ObstaclesCritic::distanceToObstacle(const CollisionCost & cost)
+void ObstaclesCritic::distanceToObstacle(
+  const Eigen::ArrayXf & costs, const Eigen::Array<bool, Eigen::Dynamic, 1> & using_footprint,
+  Eigen::ArrayXf & dists)
 {
   const float scale_factor = inflation_scale_factor_;
   const float min_radius = costmap_ros_->getLayeredCostmap()->getInscribedRadius();
-  float dist_to_obj = (scale_factor * min_radius - log(cost.cost) + log(253.0f)) / scale_factor;
+  dists = (scale_factor * min_radius - costs.log() + log(253.0f)) / scale_factor;
 
   // If not footprint collision checking, the cost is using the center point cost and
   // needs the radius subtracted to obtain the closest distance to the object
-  if (!cost.using_footprint) {
-    dist_to_obj -= min_radius;
-  }
-
-  return dist_to_obj;
+  dists -= using_footprint.select(0.0f, Eigen::ArrayXf::Constant(costs.size(), min_radius));
 }
 
 void ObstaclesCritic::score(CriticData & data)
@@ -125,6 +126,8 @@ void ObstaclesCritic::score(CriticData & data)
     return;
   }
 
+  collision_checker_.setCostmap(data.costmap_snapshot ? data.costmap_snapshot : costmap_);
+
   if (consider_footprint_) {
     // footprint may have changed since initialization if user has dynamic footprints
     possible_collision_cost_ = findCircumscribedCost(costmap_ros_);
@@ -143,47 +146,67 @@ void ObstaclesCritic::score(CriticData & data)
 
   const unsigned int traj_len = data.trajectories.x.cols();
   const unsigned int batch_size = data.trajectories.x.rows();
-  bool all_trajectories_collide = true;
-
-  for(unsigned int i = 0; i != batch_size; i++) {
-    bool trajectory_collide = false;
-    float traj_cost = 0.0f;
-    const auto & traj = data.trajectories;
-    CollisionCost pose_cost;
-    raw_cost(i) = 0.0f;
-    repulsive_cost(i) = 0.0f;
-
-    for(unsigned int j = 0; j != traj_len; j++) {
-      pose_cost = costAtPose(traj.x(i, j), traj.y(i, j), traj.yaws(i, j));
-      if (pose_cost.cost < 1.0f) {continue;}  // In free space
-
-      if (inCollision(pose_cost.cost)) {
-        trajectory_collide = true;
-        break;
-      }
-
-      // Cannot process repulsion if inflation layer does not exist
-      if (inflation_radius_ == 0.0f || inflation_scale_factor_ == 0.0f) {
+  const auto & traj = data.trajectories;
+
+  // Cannot process repulsion if inflation layer does not exist
+  const bool use_repulsion = inflation_radius_ != 0.0f && inflation_scale_factor_ != 0.0f;
+  const float repulsion_scale = near_goal ? 0.0f : 1.0f;
+
+  const utils::CostmapView costmap_view(*collision_checker_.getCostmap());
+  Eigen::ArrayXf pose_costs(batch_size);
+  Eigen::ArrayXf dist_to_obj(batch_size);
+  Eigen::Array<bool, Eigen::Dynamic, 1> collided =
+    Eigen::Array<bool, Eigen::Dynamic, 1>::Constant(batch_size, false);
+  Eigen::Array<bool, Eigen::Dynamic, 1> using_footprint(batch_size);
+  Eigen::Array<bool, Eigen::Dynamic, 1> active(batch_size);
+
+  // Without a circumscribed cost to bound it, the footprint may collide even when the center
+  // point is free, so every point has its footprint checked as costAtPose() does
+  const bool check_all_footprints = consider_footprint_ && possible_collision_cost_ < 1.0f;
+
+  // Trajectories are stored column-major, so each time step is a contiguous column
+  // whose costs are gathered and scored for the whole batch at once
+  for (unsigned int j = 0; j != traj_len; j++) {
+    utils::gatherCosts(
+      costmap_view, traj.x.col(j).data(), traj.y.col(j).data(), batch_size, pose_costs.data());
+    using_footprint.setConstant(false);
+
+    for (unsigned int i = 0; i != batch_size; i++) {
+      if (collided(i) || (pose_costs(i) < 1.0f && !check_all_footprints)) {
+        active(i) = false;
         continue;
       }
 
-      const float dist_to_obj = distanceToObstacle(pose_cost);
-
-      // Let near-collision trajectory points be punished severely
-      if (dist_to_obj < collision_margin_distance_) {
-        traj_cost += (collision_margin_distance_ - dist_to_obj);
+      // Only the few points which may be in collision need their footprint checked
+      if (consider_footprint_ &&
+        (pose_costs(i) >= possible_collision_cost_ || check_all_footprints))
+      {
+        const CollisionCost pose_cost = costAtPose(traj.x(i, j), traj.y(i, j), traj.yaws(i, j));
+        pose_costs(i) = pose_cost.cost;
+        using_footprint(i) = pose_cost.using_footprint;
       }
 
-      // Generally prefer trajectories further from obstacles
-      if (!near_goal) {
-        repulsive_cost[i] += inflation_radius_ - dist_to_obj;
-      }
+      collided(i) = inCollision(pose_costs(i));
+      active(i) = !collided(i) && pose_costs(i) >= 1.0f;
+    }
+
+    if (!use_repulsion) {
+      continue;
     }
 
-    if (!trajectory_collide) {all_trajectories_collide = false;}
-    raw_cost(i) = trajectory_collide ? collision_cost_ : traj_cost;
+    distanceToObstacle(pose_costs, using_footprint, dist_to_obj);
+
+    // Let near-collision trajectory points be punished severely
+    raw_cost += (active && dist_to_obj < collision_margin_distance_).select(
+      collision_margin_distance_ - dist_to_obj, 0.0f);
+
+    // Generally prefer trajectories further from obstacles
+    repulsive_cost += active.select((inflation_radius_ - dist_to_obj) * repulsion_scale, 0.0f);
   }
 
+  raw_cost = collided.select(collision_cost_, raw_cost);
+  const bool all_trajectories_collide = collided.all();
+
   // Normalize repulsive cost by trajectory length & lowest score to not overweight importance
   // This is a preferential cost, not collision cost, to be tuned relative to desired behaviors
   auto repulsive_cost_normalized = (repulsive_cost - repulsive_cost.minCoeff()) / traj_len;
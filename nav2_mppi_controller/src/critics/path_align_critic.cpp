@@ -40,6 +40,18 @@ void PathAlignCritic::initialize()
     power_, weight_);
 }
 
+void PathAlignCritic::prepareBatch(CriticData & data)
+{
+  if (!enabled_) {
+    return;
+  }
+
+  utils::setPathFurthestPointIfNotSet(data);
+  if (data.path.x.size() >= 2) {
+    utils::setPathCostsIfNotSet(data, costmap_ros_);
+  }
+}
+
 void PathAlignCritic::score(CriticData & data)
 {
   if (!enabled_) {
@@ -60,6 +60,15 @@ void PathAngleCritic::initialize()
     power_, weight_, modeToStr(mode_).c_str());
 }
 
+void PathAngleCritic::prepareBatch(CriticData & data)
+{
+  if (!enabled_) {
+    return;
+  }
+
+  utils::setPathFurthestPointIfNotSet(data);
+}
+
 void PathAngleCritic::score(CriticData & data)
 {
   if (!enabled_) {
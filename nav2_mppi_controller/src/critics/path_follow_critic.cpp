@@ -34,6 +34,18 @@ void PathFollowCritic::initialize()
   getParam(weight_, "cost_weight", 5.0f);
 }
 
+void PathFollowCritic::prepareBatch(CriticData & data)
+{
+  if (!enabled_) {
+    return;
+  }
+
+  utils::setPathFurthestPointIfNotSet(data);
+  if (data.path.x.size() >= 2) {
+    utils::setPathCostsIfNotSet(data, costmap_ros_);
+  }
+}
+
 void PathFollowCritic::score(CriticData & data)
 {
   if (!enabled_) {
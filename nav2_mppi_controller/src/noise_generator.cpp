@@ -14,18 +14,23 @@
 
 #include "nav2_mppi_controller/tools/noise_generator.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 
+#include "nav2_mppi_controller/tools/philox.hpp"
+
 namespace mppi
 {
 
 void NoiseGenerator::initialize(
   mppi::models::OptimizerSettings & settings, bool is_holonomic,
-  const std::string & name, ParametersHandler * param_handler)
+  const std::string & name, ParametersHandler * param_handler,
+  nav2_util::ThreadPool * thread_pool)
 {
   settings_ = settings;
   is_holonomic_ = is_holonomic;
+  thread_pool_ = thread_pool;
   active_ = true;
 
   ndistribution_vx_ = std::normal_distribution(0.0f, settings_.sampling_std.vx);
@@ -35,10 +40,31 @@ void NoiseGenerator::initialize(
   auto getParam = param_handler->getParamGetter(name);
   getParam(regenerate_noises_, "regenerate_noises", false);
 
+  std::string rng;
+  int seed, banks;
+  getParam(rng, "noise_rng", std::string("default"), ParameterType::Static);
+  getParam(seed, "noise_seed", 0, ParameterType::Static);
+  getParam(banks, "noise_banks", 1, ParameterType::Static);
+  if (rng == "philox") {
+    rng_ = NoiseRNG::PHILOX;
+  } else if (rng != "default") {
+    RCLCPP_WARN(
+      rclcpp::get_logger("MPPIController"),
+      "Unknown noise_rng %s, using the default noise generator", rng.c_str());
+  }
+  seed_ = static_cast<uint64_t>(seed);
+  generation_ = 0;
+
+  // Banks are only rotated through when noises are not regenerated every iteration
+  banks_.resize(regenerate_noises_ ? 1 : static_cast<std::size_t>(std::max(banks, 1)));
+  bank_ = 0;
+
   if (regenerate_noises_) {
     noise_thread_ = std::thread(std::bind(&NoiseGenerator::noiseThread, this));
   } else {
-    generateNoisedControls();
+    for (auto & bank : banks_) {
+      generateNoisedControls(bank);
+    }
   }
 }
 
@@ -59,6 +85,7 @@ void NoiseGenerator::generateNextNoises()
   {
     std::unique_lock<std::mutex> guard(noise_lock_);
     ready_ = true;
+    bank_ = (bank_ + 1) % banks_.size();
   }
   noise_cond_.notify_all();
 }
@@ -69,9 +96,10 @@ void NoiseGenerator::setNoisedControls(
 {
   std::unique_lock<std::mutex> guard(noise_lock_);
 
-  state.cvx = noises_vx_.rowwise() + control_sequence.vx.transpose();
-  state.cvy = noises_vy_.rowwise() + control_sequence.vy.transpose();
-  state.cwz = noises_wz_.rowwise() + control_sequence.wz.transpose();
+  const NoiseBank & bank = banks_[bank_];
+  state.cvx = bank.vx.rowwise() + control_sequence.vx.transpose();
+  state.cvy = bank.vy.rowwise() + control_sequence.vy.transpose();
+  state.cwz = bank.wz.rowwise() + control_sequence.wz.transpose();
 }
 
 void NoiseGenerator::reset(mppi::models::OptimizerSettings & settings, bool is_holonomic)
@@ -82,16 +110,21 @@ void NoiseGenerator::reset(mppi::models::OptimizerSettings & settings, bool is_h
   // Recompute the noises on reset, initialization, and fallback
   {
     std::unique_lock<std::mutex> guard(noise_lock_);
-    noises_vx_.setZero(settings_.batch_size, settings_.time_steps);
-    noises_vy_.setZero(settings_.batch_size, settings_.time_steps);
-    noises_wz_.setZero(settings_.batch_size, settings_.time_steps);
+    for (auto & bank : banks_) {
+      bank.vx.setZero(settings_.batch_size, settings_.time_steps);
+      bank.vy.setZero(settings_.batch_size, settings_.time_steps);
+      bank.wz.setZero(settings_.batch_size, settings_.time_steps);
+    }
+    bank_ = 0;
     ready_ = true;
   }
 
   if (regenerate_noises_) {
     noise_cond_.notify_all();
   } else {
-    generateNoisedControls();
+    for (auto & bank : banks_) {
+      generateNoisedControls(bank);
+    }
   }
 }
 
@@ -101,21 +134,54 @@ void NoiseGenerator::noiseThread()
     std::unique_lock<std::mutex> guard(noise_lock_);
     noise_cond_.wait(guard, [this]() {return ready_;});
     ready_ = false;
-    generateNoisedControls();
+    generateNoisedControls(banks_[0]);
   } while (active_);
 }
 
-void NoiseGenerator::generateNoisedControls()
+void NoiseGenerator::generateNoisedControls(NoiseBank & bank)
 {
   auto & s = settings_;
-  noises_vx_ = Eigen::ArrayXXf::NullaryExpr(
+  if (rng_ == NoiseRNG::PHILOX) {
+    // Each generation samples its own streams, so noises are reproducible from the seed
+    const uint64_t stream = 3 * generation_++;
+    fillPhiloxNoises(bank.vx, s.sampling_std.vx, stream);
+    fillPhiloxNoises(bank.wz, s.sampling_std.wz, stream + 1);
+    if(is_holonomic_) {
+      fillPhiloxNoises(bank.vy, s.sampling_std.vy, stream + 2);
+    }
+    return;
+  }
+
+  bank.vx = Eigen::ArrayXXf::NullaryExpr(
     s.batch_size, s.time_steps, [&] () {return ndistribution_vx_(generator_);});
-  noises_wz_ = Eigen::ArrayXXf::NullaryExpr(
+  bank.wz = Eigen::ArrayXXf::NullaryExpr(
     s.batch_size, s.time_steps, [&] () {return ndistribution_wz_(generator_);});
   if(is_holonomic_) {
-    noises_vy_ = Eigen::ArrayXXf::NullaryExpr(
+    bank.vy = Eigen::ArrayXXf::NullaryExpr(
       s.batch_size, s.time_steps, [&] () {return ndistribution_vy_(generator_);});
   }
 }
 
+void NoiseGenerator::fillPhiloxNoises(Eigen::ArrayXXf & noises, float stddev, uint64_t stream)
+{
+  // Samples only depend on their index, so the split in ranges does not change the noises
+  constexpr std::size_t kRange = 16384;
+  noises.resize(settings_.batch_size, settings_.time_steps);
+  const std::size_t size = static_cast<std::size_t>(noises.size());
+  const std::size_t ranges = (size + kRange - 1) / kRange;
+  auto fill = [&](std::size_t range) {
+      utils::fillNormalPhilox(
+        noises.data(), range * kRange, std::min(size, (range + 1) * kRange),
+        stddev, seed_, stream);
+    };
+
+  if (thread_pool_ && ranges > 1) {
+    thread_pool_->parallelFor(ranges, fill);
+  } else {
+    for (std::size_t range = 0; range < ranges; ++range) {
+      fill(range);
+    }
+  }
+}
+
 }  // namespace mppi
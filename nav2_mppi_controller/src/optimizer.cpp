@@ -15,6 +15,7 @@
 
 #include "nav2_mppi_controller/optimizer.hpp"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <stdexcept>
@@ -46,7 +47,8 @@ void Optimizer::initialize(
   getParams();
 
   critic_manager_.on_configure(parent_, name_, costmap_ros_, parameters_handler_);
-  noise_generator_.initialize(settings_, isHolonomic(), name_, parameters_handler_);
+  noise_generator_.initialize(
+    settings_, isHolonomic(), name_, parameters_handler_, thread_pool_.get());
 
   reset();
 }
@@ -82,6 +84,7 @@ void Optimizer::getParams()
   getParam(s.sampling_std.vy, "vy_std", 0.2f);
   getParam(s.sampling_std.wz, "wz_std", 0.4f);
   getParam(s.retry_attempt_limit, "retry_attempt_limit", 1);
+  getParam(s.worker_threads, "worker_threads", 1, ParameterType::Static);
 
   s.base_constraints.ax_max = fabs(s.base_constraints.ax_max);
   if (s.base_constraints.ax_min > 0.0) {
@@ -101,6 +104,14 @@ void Optimizer::getParams()
 
   getParam(motion_model_name, "motion_model", std::string("DiffDrive"));
 
+  // Batches are split in chunks propagated and scored on a worker pool,
+  // or processed whole on the controller thread with the default of a single thread
+  thread_pool_.reset();
+  if (s.worker_threads != 1u) {
+    thread_pool_ = std::make_unique<nav2_util::ThreadPool>(s.worker_threads);
+    RCLCPP_INFO(logger_, "Processing trajectory batches on %u threads", thread_pool_->size());
+  }
+
   s.constraints = s.base_constraints;
 
   setMotionModel(motion_model_name);
@@ -148,6 +159,20 @@ void Optimizer::reset(bool reset_dynamic_speed_limits)
   costs_.setZero(settings_.batch_size);
   generated_trajectories_.reset(settings_.batch_size, settings_.time_steps);
 
+  chunks_.clear();
+  if (thread_pool_) {
+    // One chunk per thread, with the remainder of the batch spread over the first chunks
+    const Eigen::Index batch_size = settings_.batch_size;
+    const Eigen::Index chunks = std::min<Eigen::Index>(thread_pool_->size(), batch_size);
+    Eigen::Index offset = 0;
+    chunks_.resize(chunks);
+    for (Eigen::Index i = 0; i < chunks; ++i) {
+      const Eigen::Index rows = batch_size / chunks + (i < batch_size % chunks ? 1 : 0);
+      chunks_[i].reset(offset, rows, settings_.time_steps);
+      offset += rows;
+    }
+  }
+
   noise_generator_.reset(settings_, isHolonomic());
   motion_model_->initialize(settings_.constraints, settings_.model_dt);
 
@@ -164,9 +189,11 @@ geometry_msgs::msg::TwistStamped Optimizer::evalControl(
   const geometry_msgs::msg::Twist & robot_speed,
   const nav_msgs::msg::Path & plan,
   const geometry_msgs::msg::Pose & goal,
-  nav2_core::GoalChecker * goal_checker)
+  nav2_core::GoalChecker * goal_checker,
+  const nav2_costmap_2d::Costmap2D * costmap_snapshot)
 {
   prepare(robot_pose, robot_speed, plan, goal, goal_checker);
+  critics_data_.costmap_snapshot = costmap_snapshot;
 
   do {
     optimize();
@@ -186,7 +213,11 @@ void Optimizer::optimize()
 {
   for (size_t i = 0; i < settings_.iteration_count; ++i) {
     generateNoisedTrajectories();
-    critic_manager_.evalTrajectoriesScores(critics_data_);
+    if (thread_pool_) {
+      critic_manager_.evalTrajectoriesScores(critics_data_, chunks_, *thread_pool_);
+    } else {
+      critic_manager_.evalTrajectoriesScores(critics_data_);
+    }
     updateControlSequence();
   }
 }
@@ -248,8 +279,39 @@ void Optimizer::generateNoisedTrajectories()
 {
   noise_generator_.setNoisedControls(state_, control_sequence_);
   noise_generator_.generateNextNoises();
-  updateStateVelocities(state_);
-  integrateStateVelocities(generated_trajectories_, state_);
+
+  if (!thread_pool_) {
+    updateStateVelocities(state_);
+    integrateStateVelocities(generated_trajectories_, state_);
+    return;
+  }
+
+  // Each chunk is propagated and integrated on its own, as rows of the batch are independent.
+  // They are gathered back into the whole batch for the control sequence update, visualization
+  // and critics which score the batch as a whole.
+  thread_pool_->parallelFor(
+    chunks_.size(), [this](std::size_t i) {
+      auto & chunk = chunks_[i];
+      models::State & state = chunk.state;
+      state.pose = state_.pose;
+      state.speed = state_.speed;
+      state.cvx = state_.cvx.middleRows(chunk.offset, chunk.rows);
+      state.cvy = state_.cvy.middleRows(chunk.offset, chunk.rows);
+      state.cwz = state_.cwz.middleRows(chunk.offset, chunk.rows);
+
+      updateStateVelocities(state);
+      integrateStateVelocities(chunk.trajectories, state);
+
+      state_.vx.middleRows(chunk.offset, chunk.rows) = state.vx;
+      state_.vy.middleRows(chunk.offset, chunk.rows) = state.vy;
+      state_.wz.middleRows(chunk.offset, chunk.rows) = state.wz;
+      state_.cvx.middleRows(chunk.offset, chunk.rows) = state.cvx;
+      state_.cvy.middleRows(chunk.offset, chunk.rows) = state.cvy;
+      state_.cwz.middleRows(chunk.offset, chunk.rows) = state.cwz;
+      generated_trajectories_.x.middleRows(chunk.offset, chunk.rows) = chunk.trajectories.x;
+      generated_trajectories_.y.middleRows(chunk.offset, chunk.rows) = chunk.trajectories.y;
+      generated_trajectories_.yaws.middleRows(chunk.offset, chunk.rows) = chunk.trajectories.yaws;
+    });
 }
 
 void Optimizer::applyControlSequenceConstraints()
@@ -12,8 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <chrono>
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "rclcpp/rclcpp.hpp"
@@ -76,6 +79,72 @@ public:
   }
 };
 
+class SeparableDummyCritic : public CriticFunction
+{
+public:
+  virtual void initialize() {}
+  virtual void score(CriticData & data)
+  {
+    data.costs += data.trajectories.x.rowwise().sum() * data.state.vx.col(0);
+    data.fail_flag = (data.trajectories.x < 0.0f).all();
+  }
+  bool isBatchSeparable() const override {return true;}
+};
+
+class SnapshotDummyCritic : public CriticFunction
+{
+public:
+  virtual void initialize() {}
+  virtual void score(CriticData & data)
+  {
+    if (data.costmap_snapshot != nullptr && data.costmap_snapshot == expected_snapshot_) {
+      chunks_with_snapshot_++;
+    }
+  }
+  bool isBatchSeparable() const override {return true;}
+  const nav2_costmap_2d::Costmap2D * expected_snapshot_{nullptr};
+  std::atomic<unsigned int> chunks_with_snapshot_{0};
+};
+
+class WholeBatchDummyCritic : public CriticFunction
+{
+public:
+  virtual void initialize() {}
+  virtual void score(CriticData & data) {data.costs -= data.costs.minCoeff();}
+};
+
+class CriticManagerWrapperChunks : public CriticManager
+{
+public:
+  virtual void loadCritics()
+  {
+    critics_.clear();
+    critics_.push_back(std::make_unique<SeparableDummyCritic>());
+    critics_.push_back(std::make_unique<WholeBatchDummyCritic>());
+    critics_.push_back(std::make_unique<SeparableDummyCritic>());
+    for (auto & critic : critics_) {
+      critic->on_configure(parent_, name_, name_ + ".Dummy", costmap_ros_, parameters_handler_);
+    }
+  }
+};
+
+class CriticManagerWrapperSnapshot : public CriticManager
+{
+public:
+  virtual void loadCritics()
+  {
+    critics_.clear();
+    critics_.push_back(std::make_unique<SnapshotDummyCritic>());
+    critics_.back()->on_configure(
+      parent_, name_, name_ + ".Dummy", costmap_ros_, parameters_handler_);
+  }
+
+  SnapshotDummyCritic * getSnapshotCritic()
+  {
+    return dynamic_cast<SnapshotDummyCritic *>(critics_[0].get());
+  }
+};
+
 class CriticManagerWrapperEnum : public CriticManager
 {
 public:
@@ -146,6 +215,119 @@ TEST(CriticManagerTests, CriticLoadingTest)
   EXPECT_EQ(critic_manager.getCriticNum(), 2u);
 }
 
+TEST(CriticManagerTests, ChunkedScoringTest)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("my_node");
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>(
+    "dummy_costmap", "", true);
+  std::string name = "test";
+  ParametersHandler param_handler(node, name);
+  rclcpp_lifecycle::State lstate;
+  costmap_ros->on_configure(lstate);
+
+  CriticManagerWrapperChunks critic_manager;
+  critic_manager.on_configure(node, "critic_manager", costmap_ros, &param_handler);
+
+  const unsigned int batch_size = 10, time_steps = 5;
+  models::State state;
+  state.reset(batch_size, time_steps);
+  state.vx.setRandom();
+  models::Trajectories trajectories;
+  trajectories.reset(batch_size, time_steps);
+  trajectories.x.setRandom();
+  models::Path path;
+  geometry_msgs::msg::Pose goal;
+  float model_dt = 0.1;
+
+  // Chunks of 4, 3 and 3 rows with copies of the rows of the batch
+  std::vector<models::BatchChunk> chunks(3);
+  Eigen::Index offset = 0;
+  for (Eigen::Index i = 0; i < 3; ++i) {
+    const Eigen::Index rows = i == 0 ? 4 : 3;
+    chunks[i].reset(offset, rows, time_steps);
+    chunks[i].state.vx = state.vx.middleRows(offset, rows);
+    chunks[i].trajectories.x = trajectories.x.middleRows(offset, rows);
+    offset += rows;
+  }
+
+  // Scoring chunks on any number of threads should match scoring the whole batch,
+  // up to the rounding of vectorized and scalar rows
+  Eigen::ArrayXf costs = Eigen::ArrayXf::Zero(batch_size);
+  CriticData data = {state, trajectories, path, goal, costs, model_dt, false, nullptr, nullptr,
+    std::nullopt, std::nullopt};
+  critic_manager.evalTrajectoriesScores(data);
+  EXPECT_FALSE(data.fail_flag);
+
+  for (unsigned int threads : {1u, 2u, 4u}) {
+    nav2_util::ThreadPool thread_pool(threads);
+    Eigen::ArrayXf chunked_costs = Eigen::ArrayXf::Zero(batch_size);
+    CriticData chunked_data = {state, trajectories, path, goal, chunked_costs, model_dt, false,
+      nullptr, nullptr, std::nullopt, std::nullopt};
+    critic_manager.evalTrajectoriesScores(chunked_data, chunks, thread_pool);
+    EXPECT_FALSE(chunked_data.fail_flag);
+    for (unsigned int i = 0; i < batch_size; ++i) {
+      EXPECT_NEAR(chunked_costs(i), costs(i), 1e-5);
+    }
+  }
+
+  // Failing requires all trajectories of all chunks to fail
+  chunks[0].trajectories.x.setConstant(-1.0f);
+  chunks[1].trajectories.x.setConstant(-1.0f);
+  nav2_util::ThreadPool thread_pool(2);
+  Eigen::ArrayXf chunked_costs = Eigen::ArrayXf::Zero(batch_size);
+  CriticData chunked_data = {state, trajectories, path, goal, chunked_costs, model_dt, false,
+    nullptr, nullptr, std::nullopt, std::nullopt};
+  critic_manager.evalTrajectoriesScores(chunked_data, chunks, thread_pool);
+  EXPECT_FALSE(chunked_data.fail_flag);
+
+  chunks[2].trajectories.x.setConstant(-1.0f);
+  critic_manager.evalTrajectoriesScores(chunked_data, chunks, thread_pool);
+  EXPECT_TRUE(chunked_data.fail_flag);
+}
+
+TEST(CriticManagerTests, ChunkedScoringSnapshotTest)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("my_node");
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>(
+    "dummy_costmap", "", true);
+  std::string name = "test";
+  ParametersHandler param_handler(node, name);
+  rclcpp_lifecycle::State lstate;
+  costmap_ros->on_configure(lstate);
+
+  CriticManagerWrapperSnapshot critic_manager;
+  critic_manager.on_configure(node, "critic_manager", costmap_ros, &param_handler);
+  SnapshotDummyCritic * critic = critic_manager.getSnapshotCritic();
+  ASSERT_NE(critic, nullptr);
+
+  const unsigned int batch_size = 10, time_steps = 5;
+  models::State state;
+  state.reset(batch_size, time_steps);
+  models::Trajectories trajectories;
+  trajectories.reset(batch_size, time_steps);
+  models::Path path;
+  geometry_msgs::msg::Pose goal;
+  float model_dt = 0.1;
+
+  std::vector<models::BatchChunk> chunks(3);
+  Eigen::Index offset = 0;
+  for (Eigen::Index i = 0; i < 3; ++i) {
+    const Eigen::Index rows = i == 0 ? 4 : 3;
+    chunks[i].reset(offset, rows, time_steps);
+    offset += rows;
+  }
+
+  // Every chunk is scored against the snapshot of the whole batch
+  nav2_costmap_2d::Costmap2D snapshot(10, 10, 0.05, 0.0, 0.0);
+  critic->expected_snapshot_ = &snapshot;
+  nav2_util::ThreadPool thread_pool(2);
+  Eigen::ArrayXf costs = Eigen::ArrayXf::Zero(batch_size);
+  CriticData data = {state, trajectories, path, goal, costs, model_dt, false, nullptr, nullptr,
+    std::nullopt, std::nullopt, &snapshot};
+  critic_manager.evalTrajectoriesScores(data, chunks, thread_pool);
+  EXPECT_EQ(critic->chunks_with_snapshot_.load(), chunks.size());
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
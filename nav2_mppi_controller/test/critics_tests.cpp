@@ -166,6 +166,61 @@ TEST(CriticTests, ObstacleCriticAlignedParams) {
   EXPECT_EQ(critic.getName(), "critic");
 }
 
+TEST(CriticTests, ObstacleCriticFootprintWithoutInflation) {
+  auto node = std::make_shared<nav2::LifecycleNode>("my_node");
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>(
+    "dummy_costmap", "", true);
+  // No inflation layer, so no circumscribed cost tells which points may be in collision
+  costmap_ros->set_parameter(rclcpp::Parameter("plugins", std::vector<std::string>{}));
+  costmap_ros->set_parameter(
+    rclcpp::Parameter("footprint", "[[0.5, 0.2], [0.5, -0.2], [-0.5, -0.2], [-0.5, 0.2]]"));
+  std::string name = "test";
+  ParametersHandler param_handler(node, name);
+  auto getParam = param_handler.getParamGetter("critic");
+  bool consider_footprint;
+  getParam(consider_footprint, "consider_footprint", true);
+
+  rclcpp_lifecycle::State lstate;
+  costmap_ros->on_configure(lstate);
+
+  models::State state;
+  models::ControlSequence control_sequence;
+  models::Trajectories generated_trajectories;
+  generated_trajectories.reset(1000, 30);
+  models::Path path;
+  geometry_msgs::msg::Pose goal;
+  path.reset(10);
+  Eigen::ArrayXf costs = Eigen::ArrayXf::Zero(1000);
+  float model_dt = 0.1;
+  CriticData data =
+  {state, generated_trajectories, path, goal, costs, model_dt,
+    false, nullptr, nullptr, std::nullopt, std::nullopt};
+  data.motion_model = std::make_shared<DiffDriveMotionModel>();
+
+  ObstaclesCritic critic;
+  critic.on_configure(node, "mppi", "critic", costmap_ros, &param_handler);
+
+  // Trajectories staying at (1.0, 1.0), facing along x, in free space
+  generated_trajectories.x.setConstant(1.0f);
+  generated_trajectories.y.setConstant(1.0f);
+  generated_trajectories.yaws.setConstant(0.0f);
+  goal.position.x = 4.0;
+  critic.score(data);
+  EXPECT_NEAR(costs.sum(), 0.0, 1e-6);
+  EXPECT_FALSE(data.fail_flag);
+
+  // A lethal wall under the front of the footprint, the center cell staying free
+  auto * costmap = costmap_ros->getCostmap();
+  for (unsigned int j = 0; j < costmap->getSizeInCellsY(); ++j) {
+    costmap->setCost(14, j, nav2_costmap_2d::LETHAL_OBSTACLE);
+  }
+  ASSERT_EQ(costmap->getCost(10, 10), nav2_costmap_2d::FREE_SPACE);
+
+  critic.score(data);
+  EXPECT_GT(costs.minCoeff(), 0.0f);
+  EXPECT_TRUE(data.fail_flag);
+}
+
 
 TEST(CriticTests, CostCriticMisAlignedParams) {
   // Standard preamble
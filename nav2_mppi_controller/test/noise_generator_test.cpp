@@ -13,12 +13,15 @@
 // limitations under the License.
 
 #include <chrono>
+#include <cmath>
 #include <thread>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "rclcpp/rclcpp.hpp"
 #include "rclcpp_lifecycle/lifecycle_node.hpp"
 #include "nav2_mppi_controller/tools/noise_generator.hpp"
+#include "nav2_mppi_controller/tools/philox.hpp"
 #include "nav2_mppi_controller/tools/parameters_handler.hpp"
 #include "nav2_mppi_controller/models/optimizer_settings.hpp"
 #include "nav2_mppi_controller/models/state.hpp"
@@ -204,6 +207,99 @@ ParametersHandler handler(node, name);
   generator.shutdown();
 }
 
+TEST(NoiseGeneratorTest, PhiloxKnownAnswers)
+{
+  // Known answer vectors of the Random123 reference implementation
+  auto zeros = utils::philox4x32({0, 0, 0, 0}, {0, 0});
+  EXPECT_EQ(zeros[0], 0x6627e8d5u);
+  EXPECT_EQ(zeros[1], 0xe169c58du);
+  EXPECT_EQ(zeros[2], 0xbc57ac4cu);
+  EXPECT_EQ(zeros[3], 0x9b00dbd8u);
+
+  auto pi = utils::philox4x32(
+    {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0});
+  EXPECT_EQ(pi[0], 0xd16cfe09u);
+  EXPECT_EQ(pi[1], 0x94fdccebu);
+  EXPECT_EQ(pi[2], 0x5001e420u);
+  EXPECT_EQ(pi[3], 0x24126ea1u);
+}
+
+TEST(NoiseGeneratorTest, PhiloxNormalSamples)
+{
+  // Samples are the same however the sequence is split, as when filled in parallel
+  std::vector<float> whole(10007), split(10007);
+  utils::fillNormalPhilox(whole.data(), 0, whole.size(), 0.5f, 42u, 3u);
+  for (size_t begin = 0; begin < split.size(); begin += 333) {
+    utils::fillNormalPhilox(
+      split.data(), begin, std::min(split.size(), begin + 333), 0.5f, 42u, 3u);
+  }
+  EXPECT_EQ(whole, split);
+
+  double mean = 0.0, variance = 0.0;
+  for (float sample : whole) {
+    mean += sample;
+    variance += sample * sample;
+  }
+  mean /= whole.size();
+  variance = variance / whole.size() - mean * mean;
+  EXPECT_NEAR(mean, 0.0, 0.02);
+  EXPECT_NEAR(std::sqrt(variance), 0.5, 0.02);
+
+  // Other streams and seeds give other sequences
+  std::vector<float> other(10007);
+  utils::fillNormalPhilox(other.data(), 0, other.size(), 0.5f, 42u, 4u);
+  EXPECT_NE(whole, other);
+  utils::fillNormalPhilox(other.data(), 0, other.size(), 0.5f, 43u, 3u);
+  EXPECT_NE(whole, other);
+}
+
+TEST(NoiseGeneratorTest, NoiseGeneratorPhiloxSeeded)
+{
+  // Generators of the same seed give the same noises, whatever their thread pools
+  auto node = std::make_shared<nav2::LifecycleNode>("node");
+  node->declare_parameter("test_name.regenerate_noises", rclcpp::ParameterValue(false));
+  node->declare_parameter("test_name.noise_rng", rclcpp::ParameterValue("philox"));
+  node->declare_parameter("test_name.noise_seed", rclcpp::ParameterValue(7));
+  node->declare_parameter("test_name.noise_banks", rclcpp::ParameterValue(2));
+  std::string name = "test";
+  ParametersHandler handler(node, name);
+  mppi::models::OptimizerSettings settings;
+  settings.batch_size = 1000;
+  settings.time_steps = 56;
+
+  mppi::models::ControlSequence control_sequence;
+  control_sequence.reset(settings.time_steps);
+  mppi::models::State state_a, state_b;
+  state_a.reset(settings.batch_size, settings.time_steps);
+  state_b.reset(settings.batch_size, settings.time_steps);
+
+  nav2_util::ThreadPool pool(4);
+  NoiseGenerator generator_a, generator_b;
+  generator_a.initialize(settings, true, "test_name", &handler);
+  generator_b.initialize(settings, true, "test_name", &handler, &pool);
+  generator_a.reset(settings, true);
+  generator_b.reset(settings, true);
+
+  generator_a.setNoisedControls(state_a, control_sequence);
+  generator_b.setNoisedControls(state_b, control_sequence);
+  EXPECT_TRUE((state_a.cvx == state_b.cvx).all());
+  EXPECT_TRUE((state_a.cvy == state_b.cvy).all());
+  EXPECT_TRUE((state_a.cwz == state_b.cwz).all());
+  EXPECT_FALSE((state_a.cvx == state_a.cwz).all());
+
+  // Without regeneration, the noise banks are rotated through
+  Eigen::ArrayXXf first_cvx = state_a.cvx;
+  generator_a.generateNextNoises();
+  generator_a.setNoisedControls(state_a, control_sequence);
+  EXPECT_FALSE((state_a.cvx == first_cvx).all());
+  generator_a.generateNextNoises();
+  generator_a.setNoisedControls(state_a, control_sequence);
+  EXPECT_TRUE((state_a.cvx == first_cvx).all());
+
+  generator_a.shutdown();
+  generator_b.shutdown();
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -31,10 +31,10 @@
 // Smoke tests the optimizer
 
 class OptimizerSuite : public ::testing::TestWithParam<std::tuple<std::string,
-    std::vector<std::string>, bool>> {};
+    std::vector<std::string>, bool, int>> {};
 
 TEST_P(OptimizerSuite, OptimizerTest) {
-  auto [motion_model, critics, consider_footprint] = GetParam();
+  auto [motion_model, critics, consider_footprint, worker_threads] = GetParam();
 
   int batch_size = 400;
   int time_steps = 15;
@@ -51,7 +51,7 @@ TEST_P(OptimizerSuite, OptimizerTest) {
 
   TestPathSettings path_settings{start_pose, path_points, path_step, path_step};
   TestOptimizerSettings optimizer_settings{batch_size, time_steps, iteration_count,
-    lookahead_distance, motion_model, consider_footprint};
+    lookahead_distance, motion_model, consider_footprint, worker_threads};
 
   unsigned int offset = 4;
   unsigned int obstacle_size = offset * 2;
@@ -89,19 +89,31 @@ INSTANTIATE_TEST_SUITE_P(
       std::vector<std::string>(
         {{"GoalCritic"}, {"GoalAngleCritic"}, {"ObstaclesCritic"}, {"PathAlignCritic"},
           {"TwirlingCritic"}, {"PathFollowCritic"}, {"PreferForwardCritic"}}),
-      true),
+      true, 1),
     std::make_tuple(
       "DiffDrive",
       std::vector<std::string>(
         {{"GoalCritic"}, {"GoalAngleCritic"}, {"CostCritic"},
           {"PathAngleCritic"}, {"PathFollowCritic"}, {"PreferForwardCritic"}}),
-      true),
+      true, 1),
     std::make_tuple(
       "Ackermann",
       std::vector<std::string>(
         {{"GoalCritic"}, {"GoalAngleCritic"}, {"ObstaclesCritic"},
           {"PathAngleCritic"}, {"PathFollowCritic"}, {"PreferForwardCritic"}}),
-      true))
+      true, 1),
+    std::make_tuple(
+      "Omni",
+      std::vector<std::string>(
+        {{"GoalCritic"}, {"GoalAngleCritic"}, {"ObstaclesCritic"}, {"PathAlignCritic"},
+          {"TwirlingCritic"}, {"PathFollowCritic"}, {"PreferForwardCritic"}}),
+      true, 3),
+    std::make_tuple(
+      "DiffDrive",
+      std::vector<std::string>(
+        {{"GoalCritic"}, {"GoalAngleCritic"}, {"CostCritic"},
+          {"PathAngleCritic"}, {"PathFollowCritic"}, {"PreferForwardCritic"}}),
+      true, 4))
 );
 
 int main(int argc, char **argv)
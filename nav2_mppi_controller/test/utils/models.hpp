@@ -26,6 +26,7 @@ struct TestOptimizerSettings
   double lookahead_distance;
   std::string motion_model;
   bool consider_footprint;
+  int worker_threads{1};
 };
 
 struct TestPose
@@ -14,10 +14,13 @@
 
 #include <chrono>
 #include <thread>
+#include <limits>
 #include <random>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "rclcpp/rclcpp.hpp"
+#include "nav2_mppi_controller/tools/costmap_gather.hpp"
 #include "nav2_mppi_controller/tools/utils.hpp"
 #include "nav2_mppi_controller/models/path.hpp"
 
@@ -705,6 +708,49 @@ TEST(UtilsTests, getCriticGoalTest)
   EXPECT_NEAR(target_goal.orientation.w, 1.0, 1e-3);
 }
 
+TEST(UtilsTests, GatherCostsTest)
+{
+  // 33 x 21 cells at 0.1m, with origin (-1.0, 2.0)
+  nav2_costmap_2d::Costmap2D costmap(33, 21, 0.1, -1.0, 2.0, 0);
+  for (unsigned int my = 0; my < 21; my++) {
+    for (unsigned int mx = 0; mx < 33; mx++) {
+      costmap.setCost(mx, my, static_cast<unsigned char>((mx * 7 + my * 13) % 256));
+    }
+  }
+  utils::CostmapView view(costmap);
+
+  // Points over the map, around it, and at its last cells which cannot be gathered 4 bytes wide
+  std::vector<float> xs, ys;
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<float> x_dist(-1.5f, 2.8f), y_dist(1.5f, 4.6f);
+  for (unsigned int i = 0; i < 1003; i++) {
+    xs.push_back(x_dist(generator));
+    ys.push_back(y_dist(generator));
+  }
+  for (unsigned int mx = 28; mx < 33; mx++) {
+    xs.push_back(-1.0f + 0.1f * mx + 0.05f);
+    ys.push_back(2.0f + 0.1f * 20 + 0.05f);
+  }
+  xs.push_back(std::numeric_limits<float>::quiet_NaN());
+  ys.push_back(3.0f);
+  xs.push_back(1.0e12f);
+  ys.push_back(3.0f);
+
+  std::vector<float> costs(xs.size()), expected(xs.size());
+  utils::gatherCosts(view, xs.data(), ys.data(), xs.size(), costs.data());
+  utils::gatherCostsScalar(view, xs.data(), ys.data(), xs.size(), expected.data());
+
+  for (unsigned int i = 0; i < xs.size(); i++) {
+    EXPECT_EQ(costs[i], expected[i]) << "at point " << i;
+  }
+
+  // Check against the costmap itself for points away from the cell borders
+  EXPECT_EQ(costs[1003 + 4], static_cast<float>(costmap.getCost(32, 20)));
+  EXPECT_EQ(costs[1003], static_cast<float>(costmap.getCost(28, 20)));
+  EXPECT_EQ(costs[1008], 255.0f);
+  EXPECT_EQ(costs[1009], 255.0f);
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
@@ -16,6 +16,7 @@
 #define NAV2_PLANNER__PLANNER_SERVER_HPP_
 
 #include <chrono>
+#include <functional>
 #include <string>
 #include <memory>
 #include <vector>
@@ -30,6 +31,7 @@
 #include "nav2_msgs/action/compute_path_through_poses.hpp"
 #include "nav2_msgs/msg/costmap.hpp"
 #include "nav2_util/robot_utils.hpp"
+#include "nav2_util/thread_pool.hpp"
 #include "nav2_ros_common/simple_action_server.hpp"
 #include "nav2_ros_common/service_server.hpp"
 #include "tf2_ros/transform_listener.h"
@@ -199,6 +201,44 @@ protected:
    */
   void computePlanThroughPoses();
 
+  /**
+   * @brief Plan every leg of a ComputePathThroughPoses goal concurrently on the leg
+   * thread pool, with each thread using its own set of planner instances. Leg i is planned
+   * from viapoint i - 1 rather than from the end of the path of the preceding leg.
+   * A failing leg cancels the legs still in flight and the failure of the lowest leg is
+   * rethrown, so that errors are reported as if the legs were planned in order.
+   * @param start Starting pose of the first leg
+   * @param goal ComputePathThroughPoses goal
+   * @param cancel_checker A function to check if the action has been canceled
+   * @param curr_start Set to the start of the failed leg on failure
+   * @param curr_goal Set to the goal of the failed leg on failure
+   * @param leg_planning_times Filled with the time spent planning each leg
+   * @return Path The concatenated path through all of the viapoints
+   */
+  nav_msgs::msg::Path planLegsInParallel(
+    const geometry_msgs::msg::PoseStamped & start,
+    const std::shared_ptr<const ActionThroughPoses::Goal> & goal,
+    std::function<bool()> cancel_checker,
+    geometry_msgs::msg::PoseStamped & curr_start,
+    geometry_msgs::msg::PoseStamped & curr_goal,
+    std::vector<builtin_interfaces::msg::Duration> & leg_planning_times);
+
+  /**
+   * @brief Method to get plan from the desired plugin of a set of planners
+   * @param start starting pose
+   * @param goal goal request
+   * @param planner_id The planner to plan with
+   * @param cancel_checker A function to check if the action has been canceled
+   * @param planners Planner instances to plan with
+   * @return Path
+   */
+  nav_msgs::msg::Path getPlan(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal,
+    const std::string & planner_id,
+    std::function<bool()> cancel_checker,
+    PlannerMap & planners);
+
   /**
    * @brief The service callback to determine if the path is still valid
    * @param request to the service
@@ -248,6 +288,12 @@ protected:
   rclcpp::Duration costmap_update_timeout_;
   std::string planner_ids_concat_;
 
+  // Parallel planning of ComputePathThroughPoses legs, the extra planner instances are
+  // used alongside planners_ by the threads of the pool
+  int max_parallel_legs_;
+  std::vector<PlannerMap> leg_planners_;
+  std::unique_ptr<nav2_util::ThreadPool> leg_thread_pool_;
+
   // TF buffer
   std::shared_ptr<tf2_ros::Buffer> tf_;
 
@@ -255,7 +301,7 @@ protected:
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros_;
   std::unique_ptr<nav2::NodeThread> costmap_thread_;
   nav2_costmap_2d::Costmap2D * costmap_;
-  std::unique_ptr<nav2_costmap_2d::FootprintCollisionChecker<nav2_costmap_2d::Costmap2D *>>
+  std::unique_ptr<nav2_costmap_2d::FootprintCollisionChecker<const nav2_costmap_2d::Costmap2D *>>
   collision_checker_;
 
   // Publishers for the path
@@ -13,12 +13,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <limits>
 #include <iterator>
+#include <mutex>
 #include <memory>
 #include <string>
 #include <vector>
@@ -45,6 +47,7 @@ PlannerServer::PlannerServer(const rclcpp::NodeOptions & options)
   default_ids_{"GridBased"},
   default_types_{"nav2_navfn_planner::NavfnPlanner"},
   costmap_update_timeout_(1s),
+  max_parallel_legs_(1),
   costmap_(nullptr)
 {
   RCLCPP_INFO(get_logger(), "Creating");
@@ -53,6 +56,7 @@ PlannerServer::PlannerServer(const rclcpp::NodeOptions & options)
   declare_parameter("planner_plugins", default_ids_);
   declare_parameter("expected_planner_frequency", 1.0);
   declare_parameter("costmap_update_timeout", 1.0);
+  declare_parameter("max_parallel_legs", 1);
 
   get_parameter("planner_plugins", planner_ids_);
   if (planner_ids_ == default_ids_) {
@@ -73,6 +77,8 @@ PlannerServer::~PlannerServer()
    * Backstop ensuring this state is destroyed, even if deactivate/cleanup are
    * never called.
    */
+  leg_thread_pool_.reset();
+  leg_planners_.clear();
   planners_.clear();
   costmap_thread_.reset();
 }
@@ -86,9 +92,8 @@ PlannerServer::on_configure(const rclcpp_lifecycle::State & state)
   costmap_ = costmap_ros_->getCostmap();
 
   if (!costmap_ros_->getUseRadius()) {
-    collision_checker_ =
-      std::make_unique<nav2_costmap_2d::FootprintCollisionChecker<nav2_costmap_2d::Costmap2D *>>(
-      costmap_);
+    collision_checker_ = std::make_unique<
+      nav2_costmap_2d::FootprintCollisionChecker<const nav2_costmap_2d::Costmap2D *>>(costmap_);
   }
 
   // Launch a thread to run the costmap node
@@ -124,6 +129,33 @@ PlannerServer::on_configure(const rclcpp_lifecycle::State & state)
     }
   }
 
+  // Each additional thread planning ComputePathThroughPoses legs needs its own instance
+  // of every planner, configured under the same name so it shares its parameters
+  get_parameter("max_parallel_legs", max_parallel_legs_);
+  if (max_parallel_legs_ > 1) {
+    leg_planners_.resize(max_parallel_legs_ - 1);
+    for (auto & planners : leg_planners_) {
+      for (size_t i = 0; i != planner_ids_.size(); i++) {
+        try {
+          nav2_core::GlobalPlanner::Ptr planner =
+            gp_loader_.createUniqueInstance(planner_types_[i]);
+          planner->configure(node, planner_ids_[i], tf_, costmap_ros_);
+          planners.insert({planner_ids_[i], planner});
+        } catch (const std::exception & ex) {
+          RCLCPP_FATAL(
+            get_logger(), "Failed to create global planner for parallel legs. Exception: %s",
+            ex.what());
+          on_cleanup(state);
+          return nav2::CallbackReturn::FAILURE;
+        }
+      }
+    }
+    leg_thread_pool_ = std::make_unique<nav2_util::ThreadPool>(max_parallel_legs_);
+    RCLCPP_INFO(
+      get_logger(), "Planning up to %i legs of a path through poses in parallel.",
+      max_parallel_legs_);
+  }
+
   for (size_t i = 0; i != planner_ids_.size(); i++) {
     planner_ids_concat_ += planner_ids_[i] + std::string(" ");
   }
@@ -186,6 +218,11 @@ PlannerServer::on_activate(const rclcpp_lifecycle::State & /*state*/)
   for (it = planners_.begin(); it != planners_.end(); ++it) {
     it->second->activate();
   }
+  for (auto & planners : leg_planners_) {
+    for (it = planners.begin(); it != planners.end(); ++it) {
+      it->second->activate();
+    }
+  }
 
   is_path_valid_service_ = create_service<nav2_msgs::srv::IsPathValid>(
     "is_path_valid",
@@ -224,6 +261,11 @@ PlannerServer::on_deactivate(const rclcpp_lifecycle::State & /*state*/)
   for (it = planners_.begin(); it != planners_.end(); ++it) {
     it->second->deactivate();
   }
+  for (auto & planners : leg_planners_) {
+    for (it = planners.begin(); it != planners.end(); ++it) {
+      it->second->deactivate();
+    }
+  }
 
   dyn_params_handler_.reset();
 
@@ -250,7 +292,14 @@ PlannerServer::on_cleanup(const rclcpp_lifecycle::State & /*state*/)
   for (it = planners_.begin(); it != planners_.end(); ++it) {
     it->second->cleanup();
   }
+  for (auto & planners : leg_planners_) {
+    for (it = planners.begin(); it != planners.end(); ++it) {
+      it->second->cleanup();
+    }
+  }
 
+  leg_thread_pool_.reset();
+  leg_planners_.clear();
   planners_.clear();
   costmap_thread_.reset();
   costmap_ = nullptr;
@@ -401,37 +450,45 @@ void PlannerServer::computePlanThroughPoses()
         return action_server_poses_->is_cancel_requested();
       };
 
-    // Get consecutive paths through these points
-    for (unsigned int i = 0; i != goal->goals.goals.size(); i++) {
-      // Get starting point
-      if (i == 0) {
-        curr_start = start;
-      } else {
-        // pick the end of the last planning task as the start for the next one
-        // to allow for path tolerance deviations
-        curr_start = concat_path.poses.back();
-        curr_start.header = concat_path.header;
-      }
-      curr_goal = goal->goals.goals[i];
+    if (leg_thread_pool_ && goal->goals.goals.size() > 1) {
+      concat_path = planLegsInParallel(
+        start, goal, cancel_checker, curr_start, curr_goal, result->leg_planning_times);
+    } else {
+      // Get consecutive paths through these points
+      for (unsigned int i = 0; i != goal->goals.goals.size(); i++) {
+        // Get starting point
+        if (i == 0) {
+          curr_start = start;
+        } else {
+          // pick the end of the last planning task as the start for the next one
+          // to allow for path tolerance deviations
+          curr_start = concat_path.poses.back();
+          curr_start.header = concat_path.header;
+        }
+        curr_goal = goal->goals.goals[i];
 
-      // Transform them into the global frame
-      if (!transformPosesToGlobalFrame(curr_start, curr_goal)) {
-        throw nav2_core::PlannerTFError("Unable to transform poses to global frame");
-      }
+        // Transform them into the global frame
+        if (!transformPosesToGlobalFrame(curr_start, curr_goal)) {
+          throw nav2_core::PlannerTFError("Unable to transform poses to global frame");
+        }
 
-      // Get plan from start -> goal
-      nav_msgs::msg::Path curr_path = getPlan(
-        curr_start, curr_goal, goal->planner_id,
-        cancel_checker);
+        // Get plan from start -> goal
+        const auto leg_start_time = std::chrono::steady_clock::now();
+        nav_msgs::msg::Path curr_path = getPlan(
+          curr_start, curr_goal, goal->planner_id,
+          cancel_checker);
+        result->leg_planning_times.push_back(
+          rclcpp::Duration(std::chrono::steady_clock::now() - leg_start_time));
 
-      if (!validatePath<ActionThroughPoses>(curr_goal, curr_path, goal->planner_id)) {
-        throw nav2_core::NoValidPathCouldBeFound(goal->planner_id + " generated a empty path");
-      }
+        if (!validatePath<ActionThroughPoses>(curr_goal, curr_path, goal->planner_id)) {
+          throw nav2_core::NoValidPathCouldBeFound(goal->planner_id + " generated a empty path");
+        }
 
-      // Concatenate paths together
-      concat_path.poses.insert(
-        concat_path.poses.end(), curr_path.poses.begin(), curr_path.poses.end());
-      concat_path.header = curr_path.header;
+        // Concatenate paths together
+        concat_path.poses.insert(
+          concat_path.poses.end(), curr_path.poses.begin(), curr_path.poses.end());
+        concat_path.header = curr_path.header;
+      }
     }
 
     // Publish the plan for visualization purposes
@@ -598,27 +655,138 @@ PlannerServer::computePlan()
   }
 }
 
+nav_msgs::msg::Path
+PlannerServer::planLegsInParallel(
+  const geometry_msgs::msg::PoseStamped & start,
+  const std::shared_ptr<const ActionThroughPoses::Goal> & goal,
+  std::function<bool()> cancel_checker,
+  geometry_msgs::msg::PoseStamped & curr_start,
+  geometry_msgs::msg::PoseStamped & curr_goal,
+  std::vector<builtin_interfaces::msg::Duration> & leg_planning_times)
+{
+  const size_t num_legs = goal->goals.goals.size();
+
+  // The path of the preceding leg isn't known yet, so each leg starts at the preceding
+  // viapoint rather than at the end of the preceding path
+  std::vector<geometry_msgs::msg::PoseStamped> leg_starts(num_legs), leg_goals(num_legs);
+  for (size_t i = 0; i != num_legs; i++) {
+    leg_starts[i] = i == 0 ? start : goal->goals.goals[i - 1];
+    leg_goals[i] = goal->goals.goals[i];
+    if (!transformPosesToGlobalFrame(leg_starts[i], leg_goals[i])) {
+      curr_start = leg_starts[i];
+      curr_goal = leg_goals[i];
+      throw nav2_core::PlannerTFError("Unable to transform poses to global frame");
+    }
+  }
+
+  // Once a leg failed, the remaining legs are cancelled as the goal is going to fail anyway
+  std::atomic<bool> leg_failed{false};
+  auto leg_cancel_checker = [&]() {
+      return leg_failed.load() || cancel_checker();
+    };
+
+  // Threads of the pool take a set of planners when starting a leg and return it after
+  std::mutex free_planners_mutex;
+  std::vector<PlannerMap *> free_planners{&planners_};
+  for (auto & planners : leg_planners_) {
+    free_planners.push_back(&planners);
+  }
+
+  std::vector<nav_msgs::msg::Path> paths(num_legs);
+  std::vector<std::exception_ptr> errors(num_legs);
+  std::vector<char> cancelled(num_legs, false);
+  std::vector<rclcpp::Duration> durations(num_legs, rclcpp::Duration(0, 0));
+
+  leg_thread_pool_->parallelFor(
+    num_legs, [&](size_t i) {
+      PlannerMap * planners;
+      {
+        std::lock_guard<std::mutex> lock(free_planners_mutex);
+        planners = free_planners.back();
+        free_planners.pop_back();
+      }
+
+      const auto leg_start_time = std::chrono::steady_clock::now();
+      try {
+        paths[i] = getPlan(
+          leg_starts[i], leg_goals[i], goal->planner_id, leg_cancel_checker, *planners);
+        if (!validatePath<ActionThroughPoses>(leg_goals[i], paths[i], goal->planner_id)) {
+          throw nav2_core::NoValidPathCouldBeFound(goal->planner_id + " generated a empty path");
+        }
+      } catch (nav2_core::PlannerCancelled &) {
+        errors[i] = std::current_exception();
+        cancelled[i] = true;
+      } catch (...) {
+        errors[i] = std::current_exception();
+        leg_failed = true;
+      }
+      durations[i] = rclcpp::Duration(std::chrono::steady_clock::now() - leg_start_time);
+
+      std::lock_guard<std::mutex> lock(free_planners_mutex);
+      free_planners.push_back(planners);
+    });
+
+  for (size_t i = 0; i != num_legs; i++) {
+    RCLCPP_DEBUG(
+      get_logger(), "Leg %zu of the path through poses was planned in %.4f s.",
+      i, durations[i].seconds());
+    leg_planning_times.push_back(durations[i]);
+  }
+
+  // Report the failure of the lowest leg, legs cancelled due to it are not failures
+  for (size_t i = 0; i != num_legs; i++) {
+    if (errors[i] && !cancelled[i]) {
+      curr_start = leg_starts[i];
+      curr_goal = leg_goals[i];
+      std::rethrow_exception(errors[i]);
+    }
+  }
+  for (size_t i = 0; i != num_legs; i++) {
+    if (errors[i]) {
+      std::rethrow_exception(errors[i]);
+    }
+  }
+
+  nav_msgs::msg::Path concat_path;
+  for (size_t i = 0; i != num_legs; i++) {
+    concat_path.poses.insert(concat_path.poses.end(), paths[i].poses.begin(), paths[i].poses.end());
+    concat_path.header = paths[i].header;
+  }
+  return concat_path;
+}
+
 nav_msgs::msg::Path
 PlannerServer::getPlan(
   const geometry_msgs::msg::PoseStamped & start,
   const geometry_msgs::msg::PoseStamped & goal,
   const std::string & planner_id,
   std::function<bool()> cancel_checker)
+{
+  return getPlan(start, goal, planner_id, cancel_checker, planners_);
+}
+
+nav_msgs::msg::Path
+PlannerServer::getPlan(
+  const geometry_msgs::msg::PoseStamped & start,
+  const geometry_msgs::msg::PoseStamped & goal,
+  const std::string & planner_id,
+  std::function<bool()> cancel_checker,
+  PlannerMap & planners)
 {
   RCLCPP_DEBUG(
     get_logger(), "Attempting to a find path from (%.2f, %.2f) to "
     "(%.2f, %.2f).", start.pose.position.x, start.pose.position.y,
     goal.pose.position.x, goal.pose.position.y);
 
-  if (planners_.find(planner_id) != planners_.end()) {
-    return planners_[planner_id]->createPlan(start, goal, cancel_checker);
+  if (planners.find(planner_id) != planners.end()) {
+    return planners[planner_id]->createPlan(start, goal, cancel_checker);
   } else {
-    if (planners_.size() == 1 && planner_id.empty()) {
+    if (planners.size() == 1 && planner_id.empty()) {
       RCLCPP_WARN_ONCE(
         get_logger(), "No planners specified in action call. "
         "Server will use only plugin %s in server."
         " This warning will appear once.", planner_ids_concat_.c_str());
-      return planners_[planners_.begin()->first]->createPlan(start, goal, cancel_checker);
+      return planners.begin()->second->createPlan(start, goal, cancel_checker);
     } else {
       RCLCPP_ERROR(
         get_logger(), "planner %s is not a valid planner. "
@@ -674,9 +842,20 @@ void PlannerServer::isPathValid(
     /**
      * The lethal check starts at the closest point to avoid points that have already been passed
      * and may have become occupied. The method for collision detection is based on the shape of
-     * the footprint.
+     * the footprint. A snapshot of the costmap is checked if there is one, so that neither
+     * this nor the costmap updates wait for the other, otherwise the costmap is locked.
      */
-    std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(*(costmap_->getMutex()));
+    std::shared_ptr<const nav2_costmap_2d::Costmap2D> snapshot =
+      costmap_ros_->getCostmapSnapshot();
+    std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(
+      *(costmap_->getMutex()), std::defer_lock);
+    if (!snapshot) {
+      lock.lock();
+    }
+    const nav2_costmap_2d::Costmap2D * costmap = snapshot ? snapshot.get() : costmap_;
+    if (collision_checker_) {
+      collision_checker_->setCostmap(costmap);
+    }
     unsigned int mx = 0;
     unsigned int my = 0;
 
@@ -686,8 +865,8 @@ void PlannerServer::isPathValid(
     for (unsigned int i = closest_point_index; i < request->path.poses.size(); ++i) {
       auto & position = request->path.poses[i].pose.position;
       if (use_radius) {
-        if (costmap_->worldToMap(position.x, position.y, mx, my)) {
-          cost = costmap_->getCost(mx, my);
+        if (costmap->worldToMap(position.x, position.y, mx, my)) {
+          cost = costmap->getCost(mx, my);
         } else {
           cost = nav2_costmap_2d::LETHAL_OBSTACLE;
         }
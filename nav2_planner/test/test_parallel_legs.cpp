@@ -0,0 +1,310 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_core/global_planner.hpp"
+#include "nav2_core/planner_exceptions.hpp"
+#include "nav2_planner/planner_server.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+using namespace std::chrono_literals;  // NOLINT
+
+/*
+ * @struct LegScript
+ * @brief What the fake planner does when planning a leg
+ */
+struct LegScript
+{
+  // Time spent planning the leg
+  std::chrono::milliseconds delay{0};
+  // Plan until cancelled rather than returning a path
+  bool wait_for_cancel{false};
+  // Throws the failure of the leg, if any
+  std::function<void()> fail;
+  // Return an empty path
+  bool empty_path{false};
+};
+
+/*
+ * @struct LegScripts
+ * @brief Scripts of the legs of a goal, shared by all of the fake planner instances
+ */
+struct LegScripts
+{
+  std::vector<LegScript> legs;
+  std::atomic<int> started{0};
+  std::atomic<int> cancelled{0};
+};
+
+// Goal of leg i is at x = i + 1, so that planner instances can tell which leg they plan
+geometry_msgs::msg::PoseStamped legGoal(size_t i)
+{
+  geometry_msgs::msg::PoseStamped pose;
+  pose.pose.position.x = i + 1.0;
+  pose.pose.position.y = 0.5 * i;
+  return pose;
+}
+
+class FakePlanner : public nav2_core::GlobalPlanner
+{
+public:
+  explicit FakePlanner(std::shared_ptr<LegScripts> scripts)
+  : scripts_(scripts)
+  {
+  }
+
+  void configure(
+    const nav2::LifecycleNode::WeakPtr &, std::string,
+    std::shared_ptr<tf2_ros::Buffer>, std::shared_ptr<nav2_costmap_2d::Costmap2DROS>) override
+  {
+  }
+
+  void cleanup() override {}
+
+  void activate() override {}
+
+  void deactivate() override {}
+
+  nav_msgs::msg::Path createPlan(
+    const geometry_msgs::msg::PoseStamped & start,
+    const geometry_msgs::msg::PoseStamped & goal,
+    std::function<bool()> cancel_checker) override
+  {
+    const LegScript & leg = scripts_->legs[std::lround(goal.pose.position.x) - 1];
+    scripts_->started++;
+    std::this_thread::sleep_for(leg.delay);
+
+    if (leg.wait_for_cancel) {
+      const auto timeout = std::chrono::steady_clock::now() + 10s;
+      while (std::chrono::steady_clock::now() < timeout) {
+        if (cancel_checker()) {
+          scripts_->cancelled++;
+          throw nav2_core::PlannerCancelled("Planner was cancelled");
+        }
+        std::this_thread::sleep_for(1ms);
+      }
+    }
+
+    if (leg.fail) {
+      leg.fail();
+    }
+
+    nav_msgs::msg::Path path;
+    path.header.frame_id = "map";
+    if (!leg.empty_path) {
+      path.poses = {start, goal};
+    }
+    return path;
+  }
+
+protected:
+  std::shared_ptr<LegScripts> scripts_;
+};
+
+class ParallelLegsShim : public nav2_planner::PlannerServer
+{
+public:
+  ParallelLegsShim()
+  : nav2_planner::PlannerServer(rclcpp::NodeOptions())
+  {
+  }
+
+  // Since we cannot call configure/activate due to costmaps requiring TF, set up the
+  // planner instances and the thread pool of the legs as configuring would
+  void setupLegs(int max_parallel_legs, std::shared_ptr<LegScripts> scripts)
+  {
+    max_parallel_legs_ = max_parallel_legs;
+    planners_ = {{"Fake", std::make_shared<FakePlanner>(scripts)}};
+    leg_planners_.assign(max_parallel_legs - 1, PlannerMap());
+    for (auto & planners : leg_planners_) {
+      planners.insert({"Fake", std::make_shared<FakePlanner>(scripts)});
+    }
+    leg_thread_pool_ = std::make_unique<nav2_util::ThreadPool>(max_parallel_legs);
+  }
+
+  // The poses are in the empty frame, which is the global frame of the unconfigured costmap
+  nav_msgs::msg::Path planLegs(
+    size_t num_legs, std::function<bool()> cancel_checker,
+    geometry_msgs::msg::PoseStamped & curr_start,
+    geometry_msgs::msg::PoseStamped & curr_goal,
+    std::vector<builtin_interfaces::msg::Duration> & leg_planning_times)
+  {
+    auto goal = std::make_shared<ActionThroughPoses::Goal>();
+    goal->planner_id = "Fake";
+    for (size_t i = 0; i != num_legs; i++) {
+      goal->goals.goals.push_back(legGoal(i));
+    }
+    return planLegsInParallel(
+      start_, goal, cancel_checker, curr_start, curr_goal, leg_planning_times);
+  }
+
+  geometry_msgs::msg::PoseStamped start_;
+};
+
+std::function<bool()> neverCancel()
+{
+  return []() {return false;};
+}
+
+TEST(ParallelLegsTest, test_legs_joined_in_order)
+{
+  auto planner = std::make_shared<ParallelLegsShim>();
+  auto scripts = std::make_shared<LegScripts>();
+  // Later legs finish first
+  const size_t num_legs = 6;
+  scripts->legs.resize(num_legs);
+  for (size_t i = 0; i != num_legs; i++) {
+    scripts->legs[i].delay = std::chrono::milliseconds(10 * (num_legs - i));
+  }
+  planner->setupLegs(3, scripts);
+
+  geometry_msgs::msg::PoseStamped curr_start, curr_goal;
+  std::vector<builtin_interfaces::msg::Duration> leg_planning_times;
+  auto path = planner->planLegs(
+    num_legs, neverCancel(), curr_start, curr_goal, leg_planning_times);
+
+  // Each leg is planned from the preceding viapoint
+  ASSERT_EQ(path.poses.size(), 2 * num_legs);
+  for (size_t i = 0; i != num_legs; i++) {
+    const auto leg_start = i == 0 ? planner->start_ : legGoal(i - 1);
+    EXPECT_EQ(path.poses[2 * i].pose.position, leg_start.pose.position);
+    EXPECT_EQ(path.poses[2 * i + 1].pose.position, legGoal(i).pose.position);
+  }
+  EXPECT_EQ(path.header.frame_id, "map");
+
+  // Each leg is timed, in the order of the legs
+  ASSERT_EQ(leg_planning_times.size(), num_legs);
+  for (size_t i = 0; i != num_legs; i++) {
+    EXPECT_GE(
+      rclcpp::Duration(leg_planning_times[i]).nanoseconds(),
+      std::chrono::nanoseconds(scripts->legs[i].delay).count());
+  }
+  EXPECT_EQ(scripts->started.load(), static_cast<int>(num_legs));
+  EXPECT_EQ(scripts->cancelled.load(), 0);
+}
+
+TEST(ParallelLegsTest, test_lowest_failing_leg_reported)
+{
+  auto planner = std::make_shared<ParallelLegsShim>();
+  auto scripts = std::make_shared<LegScripts>();
+  // Leg 3 fails before leg 1, which is still reported
+  scripts->legs.resize(5);
+  scripts->legs[1].delay = 100ms;
+  scripts->legs[1].fail = []() {throw nav2_core::GoalOccupied("Goal of leg 1 is occupied");};
+  scripts->legs[3].fail = []() {throw nav2_core::StartOccupied("Start of leg 3 is occupied");};
+  scripts->legs[4].empty_path = true;
+  planner->setupLegs(4, scripts);
+
+  geometry_msgs::msg::PoseStamped curr_start, curr_goal;
+  std::vector<builtin_interfaces::msg::Duration> leg_planning_times;
+  EXPECT_THROW(
+    planner->planLegs(5, neverCancel(), curr_start, curr_goal, leg_planning_times),
+    nav2_core::GoalOccupied);
+  EXPECT_EQ(curr_start.pose.position, legGoal(0).pose.position);
+  EXPECT_EQ(curr_goal.pose.position, legGoal(1).pose.position);
+  EXPECT_EQ(leg_planning_times.size(), 5u);
+
+  // An empty path is a failure of its leg
+  scripts->legs[1] = LegScript();
+  scripts->legs[3] = LegScript();
+  leg_planning_times.clear();
+  EXPECT_THROW(
+    planner->planLegs(5, neverCancel(), curr_start, curr_goal, leg_planning_times),
+    nav2_core::NoValidPathCouldBeFound);
+  EXPECT_EQ(curr_start.pose.position, legGoal(3).pose.position);
+  EXPECT_EQ(curr_goal.pose.position, legGoal(4).pose.position);
+  EXPECT_EQ(leg_planning_times.size(), 5u);
+}
+
+TEST(ParallelLegsTest, test_failure_cancels_legs_in_flight)
+{
+  auto planner = std::make_shared<ParallelLegsShim>();
+  auto scripts = std::make_shared<LegScripts>();
+  // Leg 0 plans until cancelled, which the failure of leg 2 does. Being cancelled due to
+  // the failure, leg 0 isn't reported as the failing leg.
+  scripts->legs.resize(3);
+  scripts->legs[0].wait_for_cancel = true;
+  scripts->legs[2].delay = 20ms;
+  scripts->legs[2].fail = []() {
+      throw nav2_core::NoValidPathCouldBeFound("No path for leg 2");
+    };
+  planner->setupLegs(3, scripts);
+
+  geometry_msgs::msg::PoseStamped curr_start, curr_goal;
+  std::vector<builtin_interfaces::msg::Duration> leg_planning_times;
+  EXPECT_THROW(
+    planner->planLegs(3, neverCancel(), curr_start, curr_goal, leg_planning_times),
+    nav2_core::NoValidPathCouldBeFound);
+  EXPECT_EQ(scripts->cancelled.load(), 1);
+  EXPECT_EQ(curr_start.pose.position, legGoal(1).pose.position);
+  EXPECT_EQ(curr_goal.pose.position, legGoal(2).pose.position);
+  EXPECT_EQ(leg_planning_times.size(), 3u);
+}
+
+TEST(ParallelLegsTest, test_cancel_reaches_legs_in_flight)
+{
+  auto planner = std::make_shared<ParallelLegsShim>();
+  auto scripts = std::make_shared<LegScripts>();
+  const int num_legs = 4;
+  scripts->legs.resize(num_legs);
+  for (auto & leg : scripts->legs) {
+    leg.wait_for_cancel = true;
+  }
+  planner->setupLegs(num_legs, scripts);
+
+  // Cancel the goal once all of the legs are being planned
+  std::atomic<bool> cancel_requested{false};
+  std::thread canceller([&]() {
+      const auto timeout = std::chrono::steady_clock::now() + 10s;
+      while (scripts->started < num_legs && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::sleep_for(1ms);
+      }
+      cancel_requested = true;
+    });
+
+  geometry_msgs::msg::PoseStamped curr_start, curr_goal;
+  std::vector<builtin_interfaces::msg::Duration> leg_planning_times;
+  EXPECT_THROW(
+    planner->planLegs(
+      num_legs, [&]() {return cancel_requested.load();}, curr_start, curr_goal,
+      leg_planning_times),
+    nav2_core::PlannerCancelled);
+  canceller.join();
+
+  EXPECT_EQ(scripts->started.load(), num_legs);
+  EXPECT_EQ(scripts->cancelled.load(), num_legs);
+  EXPECT_EQ(leg_planning_times.size(), static_cast<size_t>(num_legs));
+}
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+
+  rclcpp::init(0, nullptr);
+
+  int result = RUN_ALL_TESTS();
+
+  rclcpp::shutdown();
+
+  return result;
+}
@@ -61,6 +61,7 @@ struct Parameters
   double max_robot_pose_search_dist;
   bool interpolate_curvature_after_goal;
   bool use_collision_detection;
+  bool use_footprint_stencils;
   double transform_tolerance;
   bool stateful;
 };
@@ -53,6 +53,8 @@ bool CollisionChecker::isCollisionImminent(
   // Note(stevemacenski): This may be a bit unusual, but the robot_pose is in
   // odom frame and the carrot_pose is in robot base frame. Just how the data comes to us
 
+  footprint_collision_checker_->setUseFootprintStencils(params_->use_footprint_stencils);
+
   // check current point is OK
   if (inCollision(
       robot_pose.pose.position.x, robot_pose.pose.position.y,
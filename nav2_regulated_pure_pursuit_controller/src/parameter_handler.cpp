@@ -104,6 +104,9 @@ ParameterHandler::ParameterHandler(
   declare_parameter_if_not_declared(
     node, plugin_name_ + ".use_collision_detection",
     rclcpp::ParameterValue(true));
+  declare_parameter_if_not_declared(
+    node, plugin_name_ + ".use_footprint_stencils",
+    rclcpp::ParameterValue(false));
   declare_parameter_if_not_declared(
       node, plugin_name_ + ".stateful", rclcpp::ParameterValue(true));
 
@@ -189,6 +192,9 @@ ParameterHandler::ParameterHandler(
   node->get_parameter(
     plugin_name_ + ".use_collision_detection",
     params_.use_collision_detection);
+  node->get_parameter(
+    plugin_name_ + ".use_footprint_stencils",
+    params_.use_footprint_stencils);
   node->get_parameter(plugin_name_ + ".stateful", params_.stateful);
 
   if (params_.inflation_cost_scaling_factor <= 0.0) {
@@ -323,6 +329,8 @@ ParameterHandler::updateParametersCallback(
         params_.use_cost_regulated_linear_velocity_scaling = parameter.as_bool();
       } else if (param_name == plugin_name_ + ".use_collision_detection") {
         params_.use_collision_detection = parameter.as_bool();
+      } else if (param_name == plugin_name_ + ".use_footprint_stencils") {
+        params_.use_footprint_stencils = parameter.as_bool();
       } else if (param_name == plugin_name_ + ".stateful") {
         params_.stateful = parameter.as_bool();
       } else if (param_name == plugin_name_ + ".use_rotate_to_heading") {
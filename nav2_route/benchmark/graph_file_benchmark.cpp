@@ -0,0 +1,147 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "rclcpp/rclcpp.hpp"
+#include "nav2_ros_common/lifecycle_node.hpp"
+#include "nav2_route/types.hpp"
+#include "nav2_route/plugins/graph_file_loaders/binary_graph_file_loader.hpp"
+#include "nav2_route/plugins/graph_file_loaders/geojson_graph_file_loader.hpp"
+#include "nav2_route/plugins/graph_file_savers/binary_graph_file_saver.hpp"
+#include "nav2_route/plugins/graph_file_savers/geojson_graph_file_saver.hpp"
+
+using namespace nav2_route;  // NOLINT
+
+class RosLockGuard
+{
+public:
+  RosLockGuard() {rclcpp::init(0, nullptr);}
+  ~RosLockGuard() {rclcpp::shutdown();}
+};
+
+RosLockGuard g_rclcpp;
+
+// Side length of the synthetic grid graph, with metadata on every edge
+// (e.g. 300 x 300 = 90,000 nodes and ~360,000 edges)
+const unsigned int GRID_DIM = 300;
+
+inline Graph createGridGraph()
+{
+  Graph graph(GRID_DIM * GRID_DIM);
+  for (unsigned int j = 0; j != GRID_DIM; j++) {
+    for (unsigned int i = 0; i != GRID_DIM; i++) {
+      Node & node = graph[j * GRID_DIM + i];
+      node.nodeid = j * GRID_DIM + i + 1;
+      node.coords.x = i;
+      node.coords.y = j;
+    }
+  }
+
+  unsigned int edgeid = graph.size() + 1;
+  EdgeCost cost;
+  Metadata metadata;
+  float speed_limit = 50.0f;
+  std::string semantic_class = "aisle";
+  metadata.setValue("speed_limit", speed_limit);
+  metadata.setValue("class", semantic_class);
+  auto add_edges = [&](unsigned int a, unsigned int b) {
+      graph[a].addEdge(cost, &graph[b], edgeid++, metadata);
+      graph[b].addEdge(cost, &graph[a], edgeid++, metadata);
+    };
+  for (unsigned int j = 0; j != GRID_DIM; j++) {
+    for (unsigned int i = 0; i != GRID_DIM; i++) {
+      const unsigned int idx = j * GRID_DIM + i;
+      if (i + 1 < GRID_DIM) {
+        add_edges(idx, idx + 1);
+      }
+      if (j + 1 < GRID_DIM) {
+        add_edges(idx, idx + GRID_DIM);
+      }
+    }
+  }
+  return graph;
+}
+
+inline std::string saveGraph(GraphFileSaver & saver, const std::string & extension)
+{
+  const std::string filepath =
+    (std::filesystem::temp_directory_path() / ("route_benchmark_graph" + extension)).string();
+  Graph graph = createGridGraph();
+  if (!saver.saveGraphToFile(graph, filepath)) {
+    throw std::runtime_error("Failed to save " + filepath);
+  }
+  return filepath;
+}
+
+static void BM_LoadGeoJsonGraph(benchmark::State & state)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("route_benchmark");
+  GeoJsonGraphFileSaver saver;
+  GeoJsonGraphFileLoader loader;
+  saver.configure(node);
+  loader.configure(node);
+  const std::string filepath = saveGraph(saver, ".geojson");
+
+  for (auto _ : state) {
+    Graph graph;
+    GraphToIDMap graph_to_id_map;
+    loader.loadGraphFromFile(graph, graph_to_id_map, filepath);
+    benchmark::DoNotOptimize(graph.data());
+  }
+  state.counters["file_MB"] = std::filesystem::file_size(filepath) / 1e6;
+}
+
+static void BM_LoadBinaryGraph(benchmark::State & state)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("route_benchmark");
+  BinaryGraphFileSaver saver;
+  BinaryGraphFileLoader loader;
+  saver.configure(node);
+  loader.configure(node);
+  const std::string filepath = saveGraph(saver, ".navgraph");
+
+  for (auto _ : state) {
+    Graph graph;
+    GraphToIDMap graph_to_id_map;
+    loader.loadGraphFromFile(graph, graph_to_id_map, filepath);
+    benchmark::DoNotOptimize(graph.data());
+  }
+  state.counters["file_MB"] = std::filesystem::file_size(filepath) / 1e6;
+}
+
+static void BM_SaveBinaryGraph(benchmark::State & state)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("route_benchmark");
+  BinaryGraphFileSaver saver;
+  saver.configure(node);
+  Graph graph = createGridGraph();
+  const std::string filepath =
+    (std::filesystem::temp_directory_path() / "route_benchmark_save.navgraph").string();
+
+  for (auto _ : state) {
+    saver.saveGraphToFile(graph, filepath);
+  }
+  std::filesystem::remove(filepath);
+}
+
+BENCHMARK(BM_LoadGeoJsonGraph)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadBinaryGraph)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SaveBinaryGraph)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
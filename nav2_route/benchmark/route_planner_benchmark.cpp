@@ -0,0 +1,252 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+#include "nav2_ros_common/lifecycle_node.hpp"
+#include "nav2_route/types.hpp"
+#include "nav2_route/route_planner.hpp"
+#include "nav2_route/node_spatial_tree.hpp"
+#include "nav2_route/plugins/graph_file_loaders/geojson_graph_file_loader.hpp"
+
+using namespace nav2_route;  // NOLINT
+
+class RosLockGuard
+{
+public:
+  RosLockGuard() {rclcpp::init(0, nullptr);}
+  ~RosLockGuard() {rclcpp::shutdown();}
+};
+
+RosLockGuard g_rclcpp;
+
+const std::vector<std::string> SEARCH_MODES = {
+  "dijkstra", "a_star", "alt", "contraction_hierarchy"};
+
+// Side length of the synthetic site graph of aisles between intersections,
+// with the number of nodes along each aisle (e.g. 70 x 70 x 12 = ~120,000 nodes)
+const unsigned int SITE_DIM = 70;
+const unsigned int SITE_AISLE_NODES = 12;
+// Number of random routes per benchmark iteration
+const unsigned int NUM_ROUTES = 100;
+
+inline Graph loadGraph(const std::string & name)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("route_benchmark_loader");
+  GeoJsonGraphFileLoader loader;
+  loader.configure(node);
+  Graph graph;
+  GraphToIDMap graph_to_id_map;
+  if (!loader.loadGraphFromFile(graph, graph_to_id_map, std::string(GRAPHS_DIR) + "/" + name)) {
+    throw std::runtime_error("Failed to load graph " + name);
+  }
+  return graph;
+}
+
+inline Graph createSiteGraph()
+{
+  // Intersections on a grid, joined by aisles of nodes
+  Graph graph;
+  graph.reserve(SITE_DIM * SITE_DIM + 2 * SITE_DIM * (SITE_DIM - 1) * SITE_AISLE_NODES);
+  graph.resize(SITE_DIM * SITE_DIM);
+  for (unsigned int j = 0; j != SITE_DIM; j++) {
+    for (unsigned int i = 0; i != SITE_DIM; i++) {
+      Node & node = graph[j * SITE_DIM + i];
+      node.nodeid = j * SITE_DIM + i + 1;
+      node.coords.x = i * (SITE_AISLE_NODES + 1);
+      node.coords.y = j * (SITE_AISLE_NODES + 1);
+    }
+  }
+
+  unsigned int edgeid = 1;
+  EdgeCost cost;
+  auto add_edges = [&](unsigned int a, unsigned int b) {
+      graph[a].addEdge(cost, &graph[b], edgeid++);
+      graph[b].addEdge(cost, &graph[a], edgeid++);
+    };
+  auto add_aisle = [&](unsigned int a, unsigned int b) {
+      unsigned int previous = a;
+      for (unsigned int k = 1; k <= SITE_AISLE_NODES; k++) {
+        const float t = static_cast<float>(k) / static_cast<float>(SITE_AISLE_NODES + 1);
+        graph.emplace_back();
+        graph.back().nodeid = static_cast<unsigned int>(graph.size());
+        graph.back().coords.x = graph[a].coords.x + (graph[b].coords.x - graph[a].coords.x) * t;
+        graph.back().coords.y = graph[a].coords.y + (graph[b].coords.y - graph[a].coords.y) * t;
+        add_edges(previous, static_cast<unsigned int>(graph.size() - 1));
+        previous = static_cast<unsigned int>(graph.size() - 1);
+      }
+      add_edges(previous, b);
+    };
+  for (unsigned int j = 0; j != SITE_DIM; j++) {
+    for (unsigned int i = 0; i != SITE_DIM; i++) {
+      const unsigned int idx = j * SITE_DIM + i;
+      if (i + 1 < SITE_DIM) {
+        add_aisle(idx, idx + 1);
+      }
+      if (j + 1 < SITE_DIM) {
+        add_aisle(idx, idx + SITE_DIM);
+      }
+    }
+  }
+  return graph;
+}
+
+inline Graph getGraph(const std::string & name)
+{
+  Graph graph = name == "site" ? createSiteGraph() : loadGraph(name);
+
+  // Use static edge costs for all search modes, varying along the aisles
+  // so that routes are unique, as the contraction hierarchy needs static costs
+  unsigned int seed = 1u;
+  for (auto & node : graph) {
+    for (auto & edge : node.neighbors) {
+      edge.edge_cost.cost = edge.getEdgeLength() *
+        (1.0f + static_cast<float>(rand_r(&seed) % 100) / 200.0f);
+      edge.edge_cost.overridable = false;
+    }
+  }
+  return graph;
+}
+
+inline std::unique_ptr<RoutePlanner> createPlanner(const std::string & search_mode)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("route_benchmark");
+  node->declare_parameter("search_mode", rclcpp::ParameterValue(search_mode));
+  node->declare_parameter(
+    "edge_cost_functions", rclcpp::ParameterValue(std::vector<std::string>{}));
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer;
+  std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> costmap_subscriber;
+  auto planner = std::make_unique<RoutePlanner>();
+  planner->configure(node, tf_buffer, costmap_subscriber);
+  return planner;
+}
+
+static void BM_FindRoute(benchmark::State & state, const std::string & graph_name)
+{
+  const std::string & search_mode = SEARCH_MODES[state.range(0)];
+  Graph graph = getGraph(graph_name);
+  auto planner = createPlanner(search_mode);
+  planner->prepareGraph(graph);
+
+  unsigned int seed = 2u;
+  std::vector<std::pair<unsigned int, unsigned int>> routes;
+  for (unsigned int i = 0; i != NUM_ROUTES; i++) {
+    routes.emplace_back(rand_r(&seed) % graph.size(), rand_r(&seed) % graph.size());
+  }
+
+  std::vector<unsigned int> blocked_ids;
+  RouteRequest route_request;
+  for (auto _ : state) {
+    for (const auto & [start, goal] : routes) {
+      try {
+        Route route = planner->findRoute(graph, start, goal, blocked_ids, route_request);
+        benchmark::DoNotOptimize(route.route_cost);
+      } catch (const nav2_core::NoValidRouteCouldBeFound &) {
+      }
+    }
+  }
+  state.SetLabel(search_mode + ", " + std::to_string(graph.size()) + " nodes");
+  state.SetItemsProcessed(state.iterations() * NUM_ROUTES);
+}
+
+static void BM_PrepareGraph(benchmark::State & state, const std::string & graph_name)
+{
+  const std::string & search_mode = SEARCH_MODES[state.range(0)];
+  Graph graph = getGraph(graph_name);
+  auto planner = createPlanner(search_mode);
+  for (auto _ : state) {
+    planner->prepareGraph(graph);
+  }
+  state.SetLabel(search_mode + ", " + std::to_string(graph.size()) + " nodes");
+}
+
+static void BM_RerouteScored(benchmark::State & state)
+{
+  // Repeated routes with edge costs from the default scoring plugins, as when
+  // rerouting while tracking a route, with or without caching the edge scores
+  const bool cache_edge_scores = state.range(0) != 0;
+  Graph graph = createSiteGraph();
+  auto node = std::make_shared<nav2::LifecycleNode>("route_benchmark");
+  node->declare_parameter("cache_edge_scores", rclcpp::ParameterValue(cache_edge_scores));
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer;
+  std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> costmap_subscriber;
+  RoutePlanner planner;
+  planner.configure(node, tf_buffer, costmap_subscriber);
+  planner.prepareGraph(graph);
+
+  unsigned int seed = 2u;
+  std::vector<std::pair<unsigned int, unsigned int>> routes;
+  for (unsigned int i = 0; i != NUM_ROUTES; i++) {
+    routes.emplace_back(rand_r(&seed) % graph.size(), rand_r(&seed) % graph.size());
+  }
+
+  std::vector<unsigned int> blocked_ids;
+  RouteRequest route_request;
+  for (auto _ : state) {
+    for (const auto & [start, goal] : routes) {
+      Route route = planner.findRoute(graph, start, goal, blocked_ids, route_request);
+      benchmark::DoNotOptimize(route.route_cost);
+    }
+  }
+  state.SetLabel(std::string(cache_edge_scores ? "cached" : "uncached") + " scores");
+  state.SetItemsProcessed(state.iterations() * NUM_ROUTES);
+}
+
+static void BM_FindNearestNodes(benchmark::State & state)
+{
+  // Random lookups in the K-d tree of the graph nodes
+  Graph graph = getGraph("site");
+  NodeSpatialTree kd_tree;
+  kd_tree.computeTree(graph);
+
+  const float size = static_cast<float>((SITE_DIM - 1) * (SITE_AISLE_NODES + 1));
+  unsigned int seed = 1u;
+  for (auto _ : state) {
+    std::vector<unsigned int> kd_tree_idxs;
+    geometry_msgs::msg::PoseStamped pose;
+    pose.pose.position.x = size * static_cast<float>(rand_r(&seed)) / RAND_MAX;
+    pose.pose.position.y = size * static_cast<float>(rand_r(&seed)) / RAND_MAX;
+    kd_tree.findNearestGraphNodesToPose(pose, kd_tree_idxs);
+    benchmark::DoNotOptimize(kd_tree_idxs);
+  }
+}
+
+BENCHMARK_CAPTURE(BM_FindRoute, sample_graph, std::string("sample_graph.geojson"))
+->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_FindRoute, turtlebot3_graph, std::string("turtlebot3_graph.geojson"))
+->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_FindRoute, turtlebot4_graph, std::string("turtlebot4_graph.geojson"))
+->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_FindRoute, aws_graph, std::string("aws_graph.geojson"))
+->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_FindRoute, site_graph, std::string("site"))
+->DenseRange(0, 3)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_PrepareGraph, aws_graph, std::string("aws_graph.geojson"))
+->DenseRange(0, 3)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_PrepareGraph, site_graph, std::string("site"))
+->DenseRange(0, 3)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_RerouteScored)->DenseRange(0, 1)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_FindNearestNodes)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,165 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_ROUTE__BINARY_GRAPH_FORMAT_HPP_
+#define NAV2_ROUTE__BINARY_GRAPH_FORMAT_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace nav2_route
+{
+
+/**
+ * @brief Layout of the binary route graph file format, shared by the binary graph
+ * file loader and saver. The file is a header followed by sections of fixed size
+ * records, each aligned to 8 bytes so that the file may be memory mapped and read
+ * in place. The edges are stored in compressed sparse rows by their start node.
+ * Strings (frames, metadata keys and values, operation types) are interned in a
+ * string table and referenced by index. Metadata objects are ranges of typed values.
+ * All records are in the byte order of the machine writing the file, which is
+ * checked on load.
+ */
+namespace binary_graph
+{
+
+constexpr char kMagic[8] = {'N', 'A', 'V', '2', 'G', 'R', 'P', 'H'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kByteOrderMark = 0x01020304;
+constexpr uint32_t kNone = std::numeric_limits<uint32_t>::max();
+constexpr uint64_t kSectionAlignment = 8;
+
+/**
+ * @enum nav2_route::binary_graph::ValueType
+ * @brief Types of metadata values
+ */
+enum class ValueType : uint32_t
+{
+  INT = 0,
+  UINT = 1,
+  FLOAT = 2,
+  BOOL = 3,
+  STRING = 4,    // Data is a string index
+  METADATA = 5,  // Data is a metadata index
+  ARRAY = 6      // Data is the first value of the elements
+};
+
+/**
+ * @struct nav2_route::binary_graph::Section
+ * @brief Location of a section of records in the file
+ */
+struct Section
+{
+  uint64_t offset;  // Bytes from the start of the file
+  uint64_t count;   // Number of records
+};
+
+/**
+ * @struct nav2_route::binary_graph::Header
+ * @brief Header at the start of the file
+ */
+struct Header
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  Section strings;       // StringRecord
+  Section characters;    // char, the contents of the strings
+  Section nodes;         // NodeRecord
+  Section edge_offsets;  // uint32_t, first edge of each node and the number of edges last
+  Section edges;         // EdgeRecord
+  Section operations;    // OperationRecord
+  Section metadata;      // MetadataRecord
+  Section values;        // ValueRecord
+};
+
+/**
+ * @struct nav2_route::binary_graph::StringRecord
+ * @brief An interned string
+ */
+struct StringRecord
+{
+  uint32_t offset;  // First character in the characters
+  uint32_t size;
+};
+
+/**
+ * @struct nav2_route::binary_graph::NodeRecord
+ * @brief A node, with its edges in the edge offsets at the same index
+ */
+struct NodeRecord
+{
+  uint32_t nodeid;
+  uint32_t frame;           // String index
+  float x;
+  float y;
+  uint32_t metadata;        // Metadata index, or kNone if empty
+  uint32_t operations;      // First operation index
+  uint32_t num_operations;
+};
+
+/**
+ * @struct nav2_route::binary_graph::EdgeRecord
+ * @brief An edge, starting from the node whose row it is in
+ */
+struct EdgeRecord
+{
+  uint32_t edgeid;
+  uint32_t end;             // Node index
+  float cost;
+  uint32_t overridable;
+  uint32_t metadata;        // Metadata index, or kNone if empty
+  uint32_t operations;      // First operation index
+  uint32_t num_operations;
+};
+
+/**
+ * @struct nav2_route::binary_graph::OperationRecord
+ * @brief An operation of a node or edge
+ */
+struct OperationRecord
+{
+  uint32_t type;            // String index
+  uint32_t trigger;         // OperationTrigger
+  uint32_t metadata;        // Metadata index, or kNone if empty
+};
+
+/**
+ * @struct nav2_route::binary_graph::MetadataRecord
+ * @brief A metadata object, as a range of keyed values
+ */
+struct MetadataRecord
+{
+  uint32_t values;          // First value index
+  uint32_t num_values;
+};
+
+/**
+ * @struct nav2_route::binary_graph::ValueRecord
+ * @brief A typed metadata value. Nested metadata and array elements are always stored
+ * after the value referencing them, so that a valid file has no reference cycles.
+ */
+struct ValueRecord
+{
+  uint32_t key;             // String index, or kNone for array elements
+  ValueType type;
+  uint32_t data;            // Value bits, or index depending on the type
+  uint32_t size;            // Number of elements of arrays
+};
+
+}  // namespace binary_graph
+
+}  // namespace nav2_route
+
+#endif  // NAV2_ROUTE__BINARY_GRAPH_FORMAT_HPP_
@@ -0,0 +1,201 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_ROUTE__CONTRACTION_HIERARCHY_HPP_
+#define NAV2_ROUTE__CONTRACTION_HIERARCHY_HPP_
+
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "nav2_route/types.hpp"
+
+namespace nav2_route
+{
+
+/**
+ * @class nav2_route::ContractionHierarchy
+ * @brief A contraction hierarchy of a graph with static edge costs (Geisberger et al., 2008).
+ * Nodes are contracted in order of importance, adding shortcut arcs that preserve the
+ * shortest paths between the remaining nodes. Queries are then a bidirectional search
+ * only moving up the hierarchy, which settles a small fraction of the nodes of
+ * Dijkstra's algorithm. The hierarchy is invalid once edge costs change.
+ */
+class ContractionHierarchy
+{
+public:
+  typedef std::function<float(const DirectionalEdge &)> EdgeCostFn;
+
+  /**
+   * @brief A constructor for nav2_route::ContractionHierarchy
+   */
+  ContractionHierarchy() = default;
+
+  /**
+   * @brief Contract the graph into a hierarchy
+   * @param graph Graph to contract, which must outlive the hierarchy
+   * @param edge_cost Static traversal cost of an edge, positive
+   */
+  void compute(Graph & graph, const EdgeCostFn & edge_cost);
+
+  /**
+   * @brief Find the shortest path between two nodes
+   * @param start Graph index of the start node
+   * @param goal Graph index of the goal node
+   * @param edges [out] Graph edges of the path, from start to goal
+   * @return If the goal is reachable from the start
+   */
+  bool findPath(unsigned int start, unsigned int goal, EdgePtrVector & edges);
+
+  /**
+   * @brief Clear the hierarchy
+   */
+  void clear();
+
+  /**
+   * @brief Whether the hierarchy is empty
+   * @return If there is no hierarchy to query
+   */
+  bool empty() const;
+
+  /**
+   * @brief Get the number of shortcut arcs added by the contraction
+   * @return Number of shortcuts
+   */
+  unsigned int getNumShortcuts() const;
+
+protected:
+  static constexpr unsigned int kNone = std::numeric_limits<unsigned int>::max();
+  static constexpr float kUnreachable = std::numeric_limits<float>::max();
+
+  /**
+   * @struct nav2_route::ContractionHierarchy::Arc
+   * @brief An arc of the hierarchy, either a graph edge or a shortcut over two arcs
+   */
+  struct Arc
+  {
+    unsigned int source;
+    unsigned int target;
+    float cost;
+    EdgePtr edge{nullptr};       // Graph edge, if not a shortcut
+    unsigned int first{kNone};   // Arc from the source to the contracted node, if a shortcut
+    unsigned int second{kNone};  // Arc from the contracted node to the target, if a shortcut
+  };
+
+  typedef std::pair<float, unsigned int> QueueElement;
+  typedef std::priority_queue<QueueElement, std::vector<QueueElement>,
+      std::greater<QueueElement>> Queue;
+
+  /**
+   * @brief Contract a node, or only count the shortcuts its contraction needs
+   * @param node Node to contract
+   * @param simulate Whether to only count the shortcuts, without adding them
+   * @return Number of shortcuts needed
+   */
+  int contract(unsigned int node, bool simulate);
+
+  /**
+   * @brief Local Dijkstra's search over the remaining nodes, avoiding a node being
+   * contracted, to find witness paths that make shortcuts unnecessary
+   * @param source Node to search from
+   * @param avoid Node being contracted
+   * @param max_cost Cost beyond which the search stops
+   * @param target_arcs Arcs from the node being contracted to the targets to find witnesses of
+   */
+  void findWitnesses(
+    unsigned int source, unsigned int avoid, float max_cost,
+    const std::vector<unsigned int> & target_arcs);
+
+  /**
+   * @brief Contraction priority of a node, lower being contracted first
+   * @param node Node to find the priority of
+   * @return Priority
+   */
+  int getPriority(unsigned int node);
+
+  /**
+   * @brief Build the upward and downward arcs of the nodes for queries
+   */
+  void buildSearchGraph();
+
+  /**
+   * @brief Search step of one direction of a query
+   * @param queue Queue of the direction
+   * @param costs Costs of the direction
+   * @param parents Arcs to the nodes of the direction
+   * @param other_costs Costs of the other direction
+   * @param offsets Offsets of the nodes in the arcs to search
+   * @param arcs Arcs to search
+   * @param stall_offsets Offsets of the nodes in the arcs from higher ranked nodes
+   * @param stall_arcs Arcs from higher ranked nodes, to stall the search with
+   * @param forward Whether the arcs are followed from source to target
+   * @param best_cost [in, out] Cost of the best path found
+   * @param meeting_node [in, out] Node of the best path found in both directions
+   */
+  void searchStep(
+    Queue & queue, std::vector<float> & costs, std::vector<unsigned int> & parents,
+    const std::vector<float> & other_costs, const std::vector<unsigned int> & offsets,
+    const std::vector<unsigned int> & arcs, const std::vector<unsigned int> & stall_offsets,
+    const std::vector<unsigned int> & stall_arcs, bool forward,
+    float & best_cost, unsigned int & meeting_node);
+
+  /**
+   * @brief Append the graph edges of an arc, unpacking shortcuts
+   * @param arc Arc to unpack
+   * @param edges [out] Edges to append to
+   */
+  void unpackArc(unsigned int arc, EdgePtrVector & edges) const;
+
+  /**
+   * @brief Reset the query state of a node, if not yet reached in the current query
+   * @param node Node to reset the state of
+   */
+  inline void touch(unsigned int node)
+  {
+    if (stamps_[node] != query_) {
+      stamps_[node] = query_;
+      forward_costs_[node] = kUnreachable;
+      backward_costs_[node] = kUnreachable;
+    }
+  }
+
+  std::vector<Arc> arcs_;
+  unsigned int num_shortcuts_{0};
+
+  // Contraction state
+  std::vector<std::vector<unsigned int>> out_arcs_, in_arcs_;
+  std::vector<unsigned int> ranks_;
+  std::vector<unsigned int> contracted_neighbors_;
+  std::vector<float> witness_costs_;
+  std::vector<unsigned int> witness_stamps_;
+  std::vector<unsigned int> witness_targets_;
+  unsigned int witness_search_{0};
+
+  // Search graph, in compressed rows by node: arcs to higher ranked nodes, from the
+  // source for the forward search and from the target for the backward search
+  std::vector<unsigned int> up_offsets_, up_arcs_;
+  std::vector<unsigned int> down_offsets_, down_arcs_;
+
+  // Query state, reset lazily by stamping nodes with the query reaching them
+  std::vector<float> forward_costs_, backward_costs_;
+  std::vector<unsigned int> forward_parents_, backward_parents_;
+  std::vector<unsigned int> stamps_;
+  unsigned int query_{0};
+};
+
+}  // namespace nav2_route
+
+#endif  // NAV2_ROUTE__CONTRACTION_HIERARCHY_HPP_
@@ -59,7 +59,13 @@ public:
   ~EdgeScorer() = default;
 
   /**
-   * @brief Score the edge with the set of plugins
+   * @brief Prepare the plugins for a new search, invalidating cached scores made
+   * stale by changes to the data they score with
+   */
+  void prepare();
+
+  /**
+   * @brief Score the edge with the set of freshly prepared plugins, bypassing the cache
    * @param edge Ptr to edge for scoring
    * @param goal_pose Pose Stamped of desired goal
    * @param score of edge
@@ -71,6 +77,25 @@ public:
     const EdgeType & edge_type,
     float & score);
 
+  /**
+   * @brief Score a batch of edges with the set of plugins prepared by prepare(),
+   * reusing the cached scores of cacheable plugins for edges scored before
+   * @param edges Edges for scoring
+   * @param route_request Route request of the search
+   * @param edge_types The type of each edge
+   * @param scores The score of each edge
+   * @param valid Whether each edge is valid
+   */
+  void scoreBatch(
+    const EdgePtrVector & edges, const RouteRequest & route_request,
+    const std::vector<EdgeType> & edge_types, std::vector<float> & scores,
+    std::vector<bool> & valid);
+
+  /**
+   * @brief Clear the cached scores, to call when the graph changes
+   */
+  void clearCache();
+
   /**
    * @brief Provide the number of plugisn in the scorer loaded
    * @return Number of scoring plugins
@@ -78,8 +103,28 @@ public:
   int numPlugins() const;
 
 protected:
+  /**
+   * @brief Remove the cached scores of an invalidation
+   * @param invalidation Stale scores to remove
+   */
+  void invalidate(const ScoreInvalidation & invalidation);
+
   pluginlib::ClassLoader<EdgeCostFunction> plugin_loader_;
   std::vector<EdgeCostFunction::Ptr> plugins_;
+  std::vector<EdgeCostFunction::Ptr> cached_plugins_;
+  std::vector<EdgeCostFunction::Ptr> uncached_plugins_;
+  bool cache_scores_{true};
+
+  // Scores of the cacheable plugins are cached in the edges, valid if of this generation
+  unsigned int cache_generation_{0};
+  EdgePtrVector cached_edges_;
+
+  // Scratch space for the batch of uncached edges, reused between batches
+  EdgePtrVector miss_edges_;
+  std::vector<EdgeType> miss_edge_types_;
+  std::vector<float> miss_scores_;
+  std::vector<bool> miss_valid_;
+  std::vector<unsigned int> miss_indices_;
 };
 
 }  // namespace nav2_route
@@ -0,0 +1,126 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_ROUTE__GRAPH_LANDMARKS_HPP_
+#define NAV2_ROUTE__GRAPH_LANDMARKS_HPP_
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "nav2_route/types.hpp"
+
+namespace nav2_route
+{
+
+/**
+ * @class nav2_route::GraphLandmarks
+ * @brief Lower bounds of the traversal cost between graph nodes, from the triangle
+ * inequality over precomputed costs to and from a set of landmark nodes (ALT search,
+ * Goldberg & Harrelson, 2005). The bounds are admissible and consistent for any
+ * traversal cost at least the edge cost used to compute the landmark costs.
+ */
+class GraphLandmarks
+{
+public:
+  typedef std::function<float(const DirectionalEdge &)> EdgeCostFn;
+
+  /**
+   * @brief A constructor for nav2_route::GraphLandmarks
+   */
+  GraphLandmarks() = default;
+
+  /**
+   * @brief Select landmarks and compute the costs to and from them for all nodes
+   * @param graph Graph to compute the landmarks of
+   * @param num_landmarks Number of landmarks to select
+   * @param edge_cost Lower bound of the traversal cost of an edge, non-negative
+   */
+  void compute(const Graph & graph, unsigned int num_landmarks, const EdgeCostFn & edge_cost);
+
+  /**
+   * @brief Lower bound of the traversal cost between two nodes
+   * @param start Graph index of the node to start from
+   * @param goal Graph index of the node to reach
+   * @return Lower bound of the cost, 0 if there are no landmarks
+   */
+  inline float lowerBound(unsigned int start, unsigned int goal) const
+  {
+    const unsigned int n = static_cast<unsigned int>(landmarks_.size());
+    const float * from_start = costs_from_.data() + start * n;
+    const float * from_goal = costs_from_.data() + goal * n;
+    const float * to_start = costs_to_.data() + start * n;
+    const float * to_goal = costs_to_.data() + goal * n;
+    float bound = 0.0f;
+    for (unsigned int i = 0; i != n; i++) {
+      // Unreachable pairs are infinite and give no information
+      if (from_start[i] != kUnreachable && from_goal[i] != kUnreachable) {
+        bound = std::max(bound, from_goal[i] - from_start[i]);
+      }
+      if (to_start[i] != kUnreachable && to_goal[i] != kUnreachable) {
+        bound = std::max(bound, to_start[i] - to_goal[i]);
+      }
+    }
+    return bound;
+  }
+
+  /**
+   * @brief Get the graph indices of the selected landmarks
+   * @return Landmark graph indices
+   */
+  const std::vector<unsigned int> & getLandmarks() const;
+
+  /**
+   * @brief Clear the landmarks
+   */
+  void clear();
+
+  /**
+   * @brief Whether there are landmarks to compute lower bounds with
+   * @return If there are no landmarks
+   */
+  bool empty() const;
+
+protected:
+  typedef std::vector<std::vector<std::pair<unsigned int, float>>> Adjacency;
+
+  /**
+   * @brief Select landmarks spread over the graph by farthest point sampling of the
+   * node coordinates, so that most searches head towards or away from one
+   * @param graph Graph to select landmarks in
+   * @param num_landmarks Number of landmarks to select
+   */
+  void selectLandmarks(const Graph & graph, unsigned int num_landmarks);
+
+  /**
+   * @brief Dijkstra's algorithm from a landmark over an adjacency, storing the cost of
+   * each node in a strided column of the costs
+   * @param adjacency Adjacency of the graph to search
+   * @param landmark Index of the landmark among the landmarks
+   * @param costs Node major costs to store the column in
+   */
+  void computeCosts(const Adjacency & adjacency, unsigned int landmark, std::vector<float> & costs);
+
+  static constexpr float kUnreachable = std::numeric_limits<float>::max();
+
+  std::vector<unsigned int> landmarks_;
+  std::vector<float> costs_from_;  // Cost from each landmark to a node, node major
+  std::vector<float> costs_to_;    // Cost from a node to each landmark, node major
+};
+
+}  // namespace nav2_route
+
+#endif  // NAV2_ROUTE__GRAPH_LANDMARKS_HPP_
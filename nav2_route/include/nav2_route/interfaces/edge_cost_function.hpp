@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "tf2_ros/buffer.h"
 #include "nav2_ros_common/lifecycle_node.hpp"
@@ -28,6 +29,27 @@
 namespace nav2_route
 {
 
+/**
+ * @struct nav2_route::ScoreRegion
+ * @brief An axis-aligned region of the graph's frame
+ */
+struct ScoreRegion
+{
+  float min_x, min_y, max_x, max_y;
+};
+
+/**
+ * @struct nav2_route::ScoreInvalidation
+ * @brief The cached scores made stale by changes to the data a plugin scores with:
+ * all of them, those of particular edges or those of edges within regions
+ */
+struct ScoreInvalidation
+{
+  bool all{false};
+  std::vector<unsigned int> edgeids;
+  std::vector<ScoreRegion> regions;
+};
+
 /**
  * @class EdgeCostFunction
  * @brief A plugin interface to score edges during graph search to modify
@@ -69,6 +91,30 @@ public:
     const EdgePtr edge, const RouteRequest & route_request,
     const EdgeType & edge_type, float & cost) = 0;
 
+  /**
+   * @brief Score a batch of edges, such as all those leaving a node in the search,
+   * which plugins may override to share work between edges
+   * @param edges The edge pointers to score
+   * @param edge_types The type of each edge
+   * @param costs The costs of the edges, to add the scores of this plugin to
+   * @param valid Whether each edge is valid, edges already invalid need not be scored
+   */
+  virtual void scoreBatch(
+    const EdgePtrVector & edges, const RouteRequest & route_request,
+    const std::vector<EdgeType> & edge_types, std::vector<float> & costs,
+    std::vector<bool> & valid)
+  {
+    float cost = 0.0;
+    for (unsigned int i = 0; i != edges.size(); i++) {
+      cost = 0.0;
+      if (valid[i] && score(edges[i], route_request, edge_types[i], cost)) {
+        costs[i] += cost;
+      } else {
+        valid[i] = false;
+      }
+    }
+  }
+
   /**
    * @brief Get name of the plugin for parameter scope mapping
    * @return Name
@@ -80,6 +126,19 @@ public:
    * to use for all immediate requests, or otherwise prepare for scoring
    */
   virtual void prepare() {}
+
+  /**
+   * @brief Whether scores only depend on the edge and data grabbed in prepare(), not on
+   * the route request or edge type, so may be cached between searches until invalidated
+   * @return If scores may be cached
+   */
+  virtual bool isCacheable() {return false;}
+
+  /**
+   * @brief Report the cached scores made stale by the data grabbed in the last prepare()
+   * @param invalidation Invalidation to add the stale scores of this plugin to
+   */
+  virtual void getInvalidatedScores(ScoreInvalidation & /* invalidation */) {}
 };
 
 }  // namespace nav2_route
@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "nav2_ros_common/lifecycle_node.hpp"
 #include "nav2_route/interfaces/edge_cost_function.hpp"
@@ -65,6 +66,14 @@ public:
     const EdgePtr edge, const RouteRequest & route_request,
     const EdgeType & edge_type, float & cost) override;
 
+  /**
+   * @brief Score a batch of edges, holding the costmap's lock once
+   */
+  void scoreBatch(
+    const EdgePtrVector & edges, const RouteRequest & route_request,
+    const std::vector<EdgeType> & edge_types, std::vector<float> & costs,
+    std::vector<bool> & valid) override;
+
   /**
    * @brief Get name of the plugin for parameter scope mapping
    * @return Name
@@ -77,6 +86,19 @@ public:
    */
   void prepare() override;
 
+  /**
+   * @brief Scores only depend on the edge and the costmap, so may be cached
+   * @return If scores may be cached
+   */
+  bool isCacheable() override {return true;}
+
+  /**
+   * @brief Report the regions of the costmap changed since the last call, found by
+   * comparing the costmap with a copy of it from then
+   * @param invalidation Invalidation to add the changed regions to
+   */
+  void getInvalidatedScores(ScoreInvalidation & invalidation) override;
+
 protected:
   rclcpp::Logger logger_{rclcpp::get_logger("CostmapScorer")};
   rclcpp::Clock::SharedPtr clock_;
@@ -86,6 +108,11 @@ protected:
   std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> costmap_subscriber_;
   std::shared_ptr<nav2_costmap_2d::Costmap2D> costmap_{nullptr};
   unsigned int check_resolution_ {1u};
+
+  // The costmap as of the last invalidation, to find the regions changed since
+  std::vector<unsigned char> scored_costs_;
+  unsigned int scored_size_x_{0}, scored_size_y_{0};
+  double scored_resolution_{0.0}, scored_origin_x_{0.0}, scored_origin_y_{0.0};
 };
 
 }  // namespace nav2_route
@@ -69,6 +69,12 @@ public:
    */
   std::string getName() override;
 
+  /**
+   * @brief Scores only depend on the edge length and speed limit metadata, so may be cached
+   * @return If scores may be cached
+   */
+  bool isCacheable() override {return true;}
+
 protected:
   std::string name_;
   std::string speed_tag_;
@@ -16,9 +16,11 @@
 #define NAV2_ROUTE__PLUGINS__EDGE_COST_FUNCTIONS__DYNAMIC_EDGES_SCORER_HPP_
 
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <set>
+#include <vector>
 
 #include "nav2_ros_common/lifecycle_node.hpp"
 #include "nav2_route/interfaces/edge_cost_function.hpp"
@@ -67,12 +69,32 @@ public:
     const EdgePtr edge, const RouteRequest & route_request,
     const EdgeType & edge_type, float & cost) override;
 
+  /**
+   * @brief Score a batch of edges, holding the lock on the edge changes once
+   */
+  void scoreBatch(
+    const EdgePtrVector & edges, const RouteRequest & route_request,
+    const std::vector<EdgeType> & edge_types, std::vector<float> & costs,
+    std::vector<bool> & valid) override;
+
   /**
    * @brief Get name of the plugin for parameter scope mapping
    * @return Name
    */
   std::string getName() override;
 
+  /**
+   * @brief Scores only depend on the edge changes requested, so may be cached
+   * @return If scores may be cached
+   */
+  bool isCacheable() override {return true;}
+
+  /**
+   * @brief Report the edges closed, opened or adjusted since the last call
+   * @param invalidation Invalidation to add the changed edges to
+   */
+  void getInvalidatedScores(ScoreInvalidation & invalidation) override;
+
   /**
    * @brief Service callback to process edge changes
    * @param request Service request containing newly closed edges or opened edges
@@ -84,10 +106,21 @@ public:
     std::shared_ptr<nav2_msgs::srv::DynamicEdges::Response> response);
 
 protected:
+  /**
+   * @brief Score an edge, with the lock on the edge changes held
+   * @param edge The edge pointer to score
+   * @param cost of the edge scored
+   * @return bool if this edge is open valid to traverse
+   */
+  bool scoreEdge(const EdgePtr edge, float & cost);
+
   rclcpp::Logger logger_{rclcpp::get_logger("DynamicEdgesScorer")};
   std::string name_;
   std::set<unsigned int> closed_edges_;
   std::unordered_map<unsigned int, float> dynamic_penalties_;
+  std::vector<unsigned int> changed_edges_;
+  bool report_changes_{false};
+  std::mutex mutex_;
   nav2::ServiceServer<nav2_msgs::srv::DynamicEdges>::SharedPtr service_;
 };
 
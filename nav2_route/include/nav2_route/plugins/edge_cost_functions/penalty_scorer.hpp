@@ -68,6 +68,12 @@ public:
    */
   std::string getName() override;
 
+  /**
+   * @brief Scores only depend on the edge penalty metadata, so may be cached
+   * @return If scores may be cached
+   */
+  bool isCacheable() override {return true;}
+
 protected:
   std::string name_;
   std::string penalty_tag_;
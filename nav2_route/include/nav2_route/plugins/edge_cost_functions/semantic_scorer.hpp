@@ -84,6 +84,12 @@ public:
    */
   std::string getName() override;
 
+  /**
+   * @brief Scores only depend on the edge and end node metadata, so may be cached
+   * @return If scores may be cached
+   */
+  bool isCacheable() override {return true;}
+
 protected:
   std::string name_, key_;
   std::unordered_map<std::string, float> semantic_info_;
@@ -0,0 +1,150 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "nav2_core/route_exceptions.hpp"
+#include "nav2_route/binary_graph_format.hpp"
+#include "nav2_route/interfaces/graph_file_loader.hpp"
+#include "nav2_ros_common/lifecycle_node.hpp"
+
+#ifndef NAV2_ROUTE__PLUGINS__GRAPH_FILE_LOADERS__BINARY_GRAPH_FILE_LOADER_HPP_
+#define NAV2_ROUTE__PLUGINS__GRAPH_FILE_LOADERS__BINARY_GRAPH_FILE_LOADER_HPP_
+
+namespace nav2_route
+{
+
+/**
+ * @class nav2_route::BinaryGraphFileLoader
+ * @brief A GraphFileLoader plugin to load the binary graph representation of
+ * binary_graph_format.hpp. The file is memory mapped and its records are read in
+ * place, without any parsing.
+ */
+class BinaryGraphFileLoader : public GraphFileLoader
+{
+public:
+  /**
+   * @brief Constructor
+   */
+  BinaryGraphFileLoader() = default;
+
+  /**
+   * @brief Destructor
+   */
+  ~BinaryGraphFileLoader() = default;
+
+  /**
+   * @brief Configure, but do not store the node
+   * @param parent pointer to user's node
+   */
+  void configure(
+    const nav2::LifecycleNode::SharedPtr node) override;
+
+  /**
+   * @brief Loads the binary file into the graph
+   * @param graph The graph to be populated by the binary file
+   * @param graph_to_id_map A map of node id's to the graph index
+   * @param filepath The path of the file to load
+   * @return True if the graph was successfully loaded
+   */
+  bool loadGraphFromFile(
+    Graph & graph,
+    GraphToIDMap & graph_to_id_map,
+    std::string filepath) override;
+
+protected:
+  /**
+   * @struct nav2_route::BinaryGraphFileLoader::FileView
+   * @brief The validated sections of a mapped file
+   */
+  struct FileView
+  {
+    const char * characters{nullptr};
+    size_t num_characters{0};
+    const binary_graph::StringRecord * strings{nullptr};
+    size_t num_strings{0};
+    const binary_graph::NodeRecord * nodes{nullptr};
+    size_t num_nodes{0};
+    const uint32_t * edge_offsets{nullptr};
+    const binary_graph::EdgeRecord * edges{nullptr};
+    size_t num_edges{0};
+    const binary_graph::OperationRecord * operations{nullptr};
+    size_t num_operations{0};
+    const binary_graph::MetadataRecord * metadata{nullptr};
+    size_t num_metadata{0};
+    const binary_graph::ValueRecord * values{nullptr};
+    size_t num_values{0};
+  };
+
+  /**
+   * @brief Checks the header of a mapped file and finds its sections
+   * @param data The mapped file
+   * @param size The size of the file
+   * @param view [out] The sections of the file
+   * @return True if the file is a binary graph file of a supported version
+   */
+  bool readHeader(const char * data, size_t size, FileView & view);
+
+  /**
+   * @brief Add nodes and edges into the graph
+   * @param view The sections of the file
+   * @param[out] graph The graph to populate
+   * @param[out] graph_to_id_map A map of node id to the graph index
+   */
+  void addGraphElements(const FileView & view, Graph & graph, GraphToIDMap & graph_to_id_map);
+
+  /**
+   * @brief Converts an interned string
+   * @param view The sections of the file
+   * @param idx The string index
+   * @return The string
+   */
+  std::string convertString(const FileView & view, uint32_t idx);
+
+  /**
+   * @brief Converts a metadata record into the metadata type
+   * @param view The sections of the file
+   * @param idx The metadata index, or kNone for empty metadata
+   * @return The converted metadata
+   */
+  Metadata convertMetadata(const FileView & view, uint32_t idx);
+
+  /**
+   * @brief Converts a metadata value into its type
+   * @param view The sections of the file
+   * @param idx The value index
+   * @param metadata_idx The index of the metadata containing the value
+   * @return The converted value
+   */
+  std::any convertValue(const FileView & view, uint32_t idx, uint32_t metadata_idx);
+
+  /**
+   * @brief Converts a range of operation records into the operations type
+   * @param view The sections of the file
+   * @param first The first operation index
+   * @param count The number of operations
+   * @return The converted operations
+   */
+  Operations convertOperations(const FileView & view, uint32_t first, uint32_t count);
+
+  rclcpp::Logger logger_{rclcpp::get_logger("BinaryGraphFileLoader")};
+};
+
+}  // namespace nav2_route
+
+#endif  // NAV2_ROUTE__PLUGINS__GRAPH_FILE_LOADERS__BINARY_GRAPH_FILE_LOADER_HPP_
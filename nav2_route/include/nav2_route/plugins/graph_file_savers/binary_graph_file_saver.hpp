@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <any>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "nav2_core/route_exceptions.hpp"
+#include "nav2_route/binary_graph_format.hpp"
+#include "nav2_route/interfaces/graph_file_saver.hpp"
+#include "nav2_ros_common/lifecycle_node.hpp"
+
+#ifndef NAV2_ROUTE__PLUGINS__GRAPH_FILE_SAVERS__BINARY_GRAPH_FILE_SAVER_HPP_
+#define NAV2_ROUTE__PLUGINS__GRAPH_FILE_SAVERS__BINARY_GRAPH_FILE_SAVER_HPP_
+
+namespace nav2_route
+{
+
+/**
+ * @class nav2_route::BinaryGraphFileSaver
+ * @brief A GraphFileSaver plugin to save the binary graph representation of
+ * binary_graph_format.hpp
+ */
+class BinaryGraphFileSaver : public GraphFileSaver
+{
+public:
+  /**
+   * @brief Constructor
+   */
+  BinaryGraphFileSaver() = default;
+
+  /**
+   * @brief Destructor
+   */
+  ~BinaryGraphFileSaver() = default;
+
+  /**
+   * @brief Configure, but do not store the node
+   * @param parent pointer to user's node
+   */
+  void configure(
+    const nav2::LifecycleNode::SharedPtr node) override;
+
+  /**
+   * @brief Saves the graph to a binary file
+   * @param graph The graph to save to the binary file
+   * @param filepath The path to save the graph to
+   * @return True if successful
+   */
+  bool saveGraphToFile(
+    Graph & graph,
+    std::string filepath) override;
+
+protected:
+  /**
+   * @struct nav2_route::BinaryGraphFileSaver::FileContents
+   * @brief The sections of a file being written
+   */
+  struct FileContents
+  {
+    std::unordered_map<std::string, uint32_t> string_ids;
+    std::string characters;
+    std::vector<binary_graph::StringRecord> strings;
+    std::vector<binary_graph::NodeRecord> nodes;
+    std::vector<uint32_t> edge_offsets;
+    std::vector<binary_graph::EdgeRecord> edges;
+    std::vector<binary_graph::OperationRecord> operations;
+    std::vector<binary_graph::MetadataRecord> metadata;
+    std::vector<binary_graph::ValueRecord> values;
+  };
+
+  /**
+   * @brief Add the nodes and edges of the graph to the file contents
+   * @param graph The graph to convert
+   * @param[out] contents The file contents
+   */
+  void convertGraph(const Graph & graph, FileContents & contents);
+
+  /**
+   * @brief Intern a string in the file contents
+   * @param str The string
+   * @param[out] contents The file contents
+   * @return The string index
+   */
+  uint32_t convertString(const std::string & str, FileContents & contents);
+
+  /**
+   * @brief Add metadata to the file contents
+   * @param metadata Metadata from a node, edge or operation in the graph
+   * @param[out] contents The file contents
+   * @return The metadata index, or kNone if empty
+   */
+  uint32_t convertMetadata(const Metadata & metadata, FileContents & contents);
+
+  /**
+   * @brief Convert a metadata value, adding any nested metadata or array elements
+   * to the file contents
+   * @param value The metadata value
+   * @param[out] contents The file contents
+   * @return The value record, without its key
+   */
+  binary_graph::ValueRecord convertValue(const std::any & value, FileContents & contents);
+
+  /**
+   * @brief Add operations to the file contents
+   * @param operations Operations of a node or edge in the graph
+   * @param[out] contents The file contents
+   * @return The first operation index
+   */
+  uint32_t convertOperations(const Operations & operations, FileContents & contents);
+
+  /**
+   * @brief Write the file contents to a file
+   * @param contents The file contents
+   * @param filepath The path to write to
+   */
+  void writeFile(const FileContents & contents, const std::string & filepath);
+
+  rclcpp::Logger logger_{rclcpp::get_logger("BinaryGraphFileSaver")};
+};
+}  // namespace nav2_route
+
+#endif  // NAV2_ROUTE__PLUGINS__GRAPH_FILE_SAVERS__BINARY_GRAPH_FILE_SAVER_HPP_
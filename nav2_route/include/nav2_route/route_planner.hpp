@@ -27,6 +27,8 @@
 #include "nav2_route/types.hpp"
 #include "nav2_route/utils.hpp"
 #include "nav2_route/edge_scorer.hpp"
+#include "nav2_route/graph_landmarks.hpp"
+#include "nav2_route/contraction_hierarchy.hpp"
 #include "nav2_core/route_exceptions.hpp"
 #include "geometry_msgs/msg/pose_stamped.hpp"
 #include "nav2_ros_common/lifecycle_node.hpp"
@@ -35,7 +37,10 @@ namespace nav2_route
 {
 /**
  * @class nav2_route::RoutePlanner
- * @brief An optimal planner to compute a route from a start to a goal in an arbitrary graph
+ * @brief An optimal planner to compute a route from a start to a goal in an arbitrary graph.
+ * Searches with Dijkstra's algorithm, or are goal directed by admissible heuristics (A* with
+ * the Euclidean distance, ALT with landmark lower bounds), or query a contraction hierarchy
+ * of the static edge costs of the graph.
  */
 class RoutePlanner
 {
@@ -74,6 +79,13 @@ public:
     const std::vector<unsigned int> & blocked_ids,
     const RouteRequest & route_request);
 
+  /**
+   * @brief Precompute the heuristics or hierarchy of the search mode for a graph,
+   * to call when a graph is loaded or its static edge costs change
+   * @param graph Graph to prepare searches on
+   */
+  void prepareGraph(Graph & graph);
+
 protected:
   /**
    * @brief Reset the search state of the graph nodes
@@ -82,7 +94,51 @@ protected:
   inline void resetSearchStates(Graph & graph);
 
   /**
-   * @brief Dikstra's algorithm search on the graph
+   * @brief Start a new search, whose node search states are reset lazily when first reached
+   * @param graph Graph to search
+   * @param start_node Start node pointer
+   * @param goal_node Goal node pointer
+   */
+  void startSearch(Graph & graph, const NodePtr start_node, const NodePtr goal_node);
+
+  /**
+   * @brief Gets the search state of a node, reset if stale from a previous search
+   * @param node Node pointer to get the state of
+   * @return Search state of the node in the current search
+   */
+  inline SearchState & getSearchState(const NodePtr node);
+
+  /**
+   * @brief Gets the lower bound of the cost from a node to the goal of the search
+   * @param node Node pointer to find heuristic cost for
+   * @return Heuristic cost
+   */
+  inline float getHeuristicCost(const NodePtr node);
+
+  /**
+   * @brief Gets a lower bound of the traversal cost of an edge for any edge scoring
+   * @param edge Edge to find the lower bound cost of
+   * @return Lower bound cost
+   */
+  float getLowerBoundCost(const DirectionalEdge & edge);
+
+  /**
+   * @brief Whether the graph was prepared for searches with prepareGraph()
+   * @param graph Graph to check
+   * @return If the graph is prepared
+   */
+  bool isPrepared(const Graph & graph);
+
+  /**
+   * @brief Query the contraction hierarchy for the route, storing it in the search states
+   * @param graph Graph to search
+   * @param start Start Node pointer
+   * @param goal Goal node pointer
+   */
+  void findContractedTraversal(Graph & graph, const NodePtr start_node, const NodePtr goal_node);
+
+  /**
+   * @brief Graph search on the graph, with Dijkstra's algorithm or A* if there is a heuristic
    * @param graph Graph to search
    * @param start Start Node pointer
    * @param goal Goal node pointer
@@ -94,14 +150,14 @@ protected:
     const RouteRequest & route_request);
 
   /**
-   * @brief Gets the traversal cost for an edge using edge scorers
-   * @param edge Edge pointer to find traversal cost for
-   * @param travel cost
+   * @brief Gets the traversal costs for the edges leaving a node, scoring them in a batch
+   * using edge scorers, stored in edge_costs_ and edge_valid_
+   * @param edges Edges to find traversal costs for
    * @param blocked_ids A set of blocked node and edge IDs not to traverse
-   * @return if this edge is valid for search
+   * @param route_request Route request of the search
    */
-  inline bool getTraversalCost(
-    const EdgePtr edge, float & score, const std::vector<unsigned int> & blocked_ids,
+  inline void getTraversalCosts(
+    EdgeVector & edges, const std::vector<unsigned int> & blocked_ids,
     const RouteRequest & route_request);
 
   /**
@@ -153,7 +209,30 @@ protected:
   int max_iterations_{0};
   unsigned int start_id_{0};
   unsigned int goal_id_{0};
+  unsigned int search_id_{0};
+  NodePtr goal_node_{nullptr};
+  const Node * graph_data_{nullptr};
   NodeQueue queue_;
+
+  // Traversal costs of the edges being expanded and the batch of them to score
+  std::vector<float> edge_costs_;
+  std::vector<bool> edge_valid_;
+  EdgePtrVector batch_edges_;
+  std::vector<EdgeType> batch_edge_types_;
+  std::vector<unsigned int> batch_indices_;
+  std::vector<float> batch_costs_;
+  std::vector<bool> batch_valid_;
+
+  SearchMode search_mode_{SearchMode::DIJKSTRA};
+  float min_cost_per_meter_{1.0};
+  float heuristic_cost_per_meter_{0.0};
+  unsigned int num_landmarks_{8};
+  GraphLandmarks landmarks_;
+  ContractionHierarchy contraction_hierarchy_;
+  const Node * prepared_graph_{nullptr};
+  size_t prepared_graph_size_{0};
+  rclcpp::Logger logger_{rclcpp::get_logger("RoutePlanner")};
+
   std::unique_ptr<EdgeScorer> edge_scorer_;
   std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
 };
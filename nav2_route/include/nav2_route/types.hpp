@@ -126,6 +126,18 @@ struct OperationsResult
   std::vector<unsigned int> blocked_ids;
 };
 
+/**
+ * @struct nav2_route::ScoreCache
+ * @brief An object to store the score of an edge cached by the edge scorer
+ * This is an internal class users should not modify.
+ */
+struct ScoreCache
+{
+  float score{0.0};
+  bool valid{false};
+  unsigned int generation{0};  // Cache generation the score belongs to, 0 if none
+};
+
 /**
  * @struct nav2_route::DirectionalEdge
  * @brief An object representing edges between nodes
@@ -138,6 +150,7 @@ struct DirectionalEdge
   EdgeCost edge_cost;      // Cost information associated with edge
   Metadata metadata;       // Any metadata stored in the graph file of interest
   Operations operations;   // Operations to perform related to the edge
+  ScoreCache score_cache;  // Score cached by the edge scorer
 
   float getEdgeLength();
 };
@@ -156,11 +169,14 @@ struct SearchState
   EdgePtr parent_edge{nullptr};
   float integrated_cost{std::numeric_limits<float>::max()};
   float traversal_cost{std::numeric_limits<float>::max()};
+  float heuristic_cost{0.0};  // Lower bound of the cost to the goal of the search
+  unsigned int search_id{0};  // Search this state belongs to, to reset stale states lazily
 
   void reset()
   {
     integrated_cost = std::numeric_limits<float>::max();
     traversal_cost = std::numeric_limits<float>::max();
+    heuristic_cost = 0.0;
     parent_edge = nullptr;
   }
 };
@@ -192,7 +208,7 @@ struct Node
     EdgeCost & cost, NodePtr node, unsigned int edgeid, Metadata meta_data = {},
     Operations operations_data = {})
   {
-    neighbors.push_back({edgeid, this, node, cost, meta_data, operations_data});
+    neighbors.push_back({edgeid, this, node, cost, meta_data, operations_data, {}});
   }
 };
 
@@ -297,6 +313,18 @@ struct ReroutingState
   }
 };
 
+/**
+ * @enum nav2_route::SearchMode
+ * @brief The graph search algorithms of the route planner
+ */
+enum class SearchMode
+{
+  DIJKSTRA = 0,
+  A_STAR = 1,
+  ALT = 2,
+  CONTRACTION_HIERARCHY = 3
+};
+
 /**
  * @enum nav2_route::EdgeType
  * @brief An enum class describing what type of edge connecting two nodes is
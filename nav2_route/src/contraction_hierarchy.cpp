@@ -0,0 +1,432 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "nav2_route/contraction_hierarchy.hpp"
+
+namespace nav2_route
+{
+
+// Witness searches are bounded to keep the contraction fast on large graphs,
+// at the expense of some unnecessary shortcuts
+static constexpr unsigned int kWitnessSettleLimit = 128;
+// Nodes are left uncontracted in the core of the hierarchy once the remaining graph
+// is this densely connected, as contracting them would add shortcuts quadratically
+static constexpr unsigned int kMaxContractionDegree = 32;
+
+void ContractionHierarchy::compute(Graph & graph, const EdgeCostFn & edge_cost)
+{
+  clear();
+  const unsigned int num_nodes = static_cast<unsigned int>(graph.size());
+  if (num_nodes == 0) {
+    return;
+  }
+
+  // Arcs of the graph edges, keeping the lowest cost of parallel edges
+  out_arcs_.assign(num_nodes, {});
+  in_arcs_.assign(num_nodes, {});
+  Node * first = graph.data();
+  for (unsigned int i = 0; i != num_nodes; i++) {
+    std::unordered_map<unsigned int, unsigned int> arc_to_target;
+    for (DirectionalEdge & edge : graph[i].neighbors) {
+      const unsigned int target = static_cast<unsigned int>(edge.end - first);
+      if (target == i) {
+        continue;
+      }
+
+      const float cost = edge_cost(edge);
+      auto it = arc_to_target.find(target);
+      if (it == arc_to_target.end()) {
+        arc_to_target[target] = static_cast<unsigned int>(arcs_.size());
+        out_arcs_[i].push_back(static_cast<unsigned int>(arcs_.size()));
+        in_arcs_[target].push_back(static_cast<unsigned int>(arcs_.size()));
+        arcs_.push_back({i, target, cost, &edge});
+      } else if (cost < arcs_[it->second].cost) {
+        arcs_[it->second].cost = cost;
+        arcs_[it->second].edge = &edge;
+      }
+    }
+  }
+
+  // Contract nodes by priority, updating the priority of a node lazily when it is next
+  contracted_neighbors_.assign(num_nodes, 0);
+  ranks_.assign(num_nodes, kNone);
+  witness_costs_.assign(num_nodes, kUnreachable);
+  witness_stamps_.assign(num_nodes, 0);
+  witness_targets_.assign(num_nodes, 0);
+  witness_search_ = 0;
+
+  typedef std::pair<int, unsigned int> PriorityElement;
+  std::priority_queue<PriorityElement, std::vector<PriorityElement>,
+    std::greater<PriorityElement>> priorities;
+  for (unsigned int i = 0; i != num_nodes; i++) {
+    priorities.emplace(getPriority(i), i);
+  }
+
+  unsigned int rank = 0;
+  while (!priorities.empty()) {
+    const unsigned int node = priorities.top().second;
+    priorities.pop();
+    const int priority = getPriority(node);
+    if (!priorities.empty() && priority > priorities.top().first) {
+      priorities.emplace(priority, node);
+      continue;
+    }
+    if (in_arcs_[node].size() + out_arcs_[node].size() > kMaxContractionDegree) {
+      break;
+    }
+
+    contract(node, false);
+    ranks_[node] = rank++;
+
+    // Remove the arcs of the node from the remaining graph
+    auto remove_arc = [](std::vector<unsigned int> & arcs, unsigned int arc) {
+        arcs.erase(std::find(arcs.begin(), arcs.end(), arc));
+      };
+    for (unsigned int arc : out_arcs_[node]) {
+      contracted_neighbors_[arcs_[arc].target]++;
+      remove_arc(in_arcs_[arcs_[arc].target], arc);
+    }
+    for (unsigned int arc : in_arcs_[node]) {
+      contracted_neighbors_[arcs_[arc].source]++;
+      remove_arc(out_arcs_[arcs_[arc].source], arc);
+    }
+    out_arcs_[node] = {};
+    in_arcs_[node] = {};
+  }
+
+  buildSearchGraph();
+
+  // Contraction state is not needed for queries
+  out_arcs_ = {};
+  in_arcs_ = {};
+  contracted_neighbors_ = {};
+  witness_costs_ = {};
+  witness_stamps_ = {};
+  witness_targets_ = {};
+  ranks_ = {};
+
+  forward_costs_.assign(num_nodes, kUnreachable);
+  backward_costs_.assign(num_nodes, kUnreachable);
+  forward_parents_.assign(num_nodes, kNone);
+  backward_parents_.assign(num_nodes, kNone);
+  stamps_.assign(num_nodes, 0);
+  query_ = 0;
+}
+
+int ContractionHierarchy::contract(unsigned int node, bool simulate)
+{
+  // Lowest cost arcs from and to each remaining neighbor
+  std::vector<unsigned int> in_arcs, out_arcs;
+  auto add_lowest = [&](std::vector<unsigned int> & lowest, unsigned int arc, bool source) {
+      const unsigned int neighbor = source ? arcs_[arc].source : arcs_[arc].target;
+      for (unsigned int & other : lowest) {
+        if ((source ? arcs_[other].source : arcs_[other].target) == neighbor) {
+          if (arcs_[arc].cost < arcs_[other].cost) {
+            other = arc;
+          }
+          return;
+        }
+      }
+      lowest.push_back(arc);
+    };
+  for (unsigned int arc : in_arcs_[node]) {
+    add_lowest(in_arcs, arc, true);
+  }
+  for (unsigned int arc : out_arcs_[node]) {
+    add_lowest(out_arcs, arc, false);
+  }
+
+  int shortcuts = 0;
+  for (unsigned int in_arc : in_arcs) {
+    const unsigned int source = arcs_[in_arc].source;
+    float max_cost = -1.0f;
+    for (unsigned int out_arc : out_arcs) {
+      if (arcs_[out_arc].target != source) {
+        max_cost = std::max(max_cost, arcs_[in_arc].cost + arcs_[out_arc].cost);
+      }
+    }
+    if (max_cost < 0.0f) {
+      continue;
+    }
+
+    findWitnesses(source, node, max_cost, out_arcs);
+    for (unsigned int out_arc : out_arcs) {
+      const unsigned int target = arcs_[out_arc].target;
+      const float cost = arcs_[in_arc].cost + arcs_[out_arc].cost;
+      if (target == source ||
+        (witness_stamps_[target] == witness_search_ && witness_costs_[target] <= cost))
+      {
+        continue;
+      }
+
+      shortcuts++;
+      if (!simulate) {
+        const unsigned int arc = static_cast<unsigned int>(arcs_.size());
+        arcs_.push_back({source, target, cost, nullptr, in_arc, out_arc});
+        out_arcs_[source].push_back(arc);
+        in_arcs_[target].push_back(arc);
+        num_shortcuts_++;
+      }
+    }
+  }
+
+  return shortcuts;
+}
+
+void ContractionHierarchy::findWitnesses(
+  unsigned int source, unsigned int avoid, float max_cost,
+  const std::vector<unsigned int> & target_arcs)
+{
+  witness_search_++;
+  Queue queue;
+  witness_stamps_[source] = witness_search_;
+  witness_costs_[source] = 0.0f;
+  queue.emplace(0.0f, source);
+
+  // Targets are settled once all of them are at their lowest cost
+  unsigned int targets = static_cast<unsigned int>(target_arcs.size());
+  for (unsigned int arc : target_arcs) {
+    witness_targets_[arcs_[arc].target] = witness_search_;
+  }
+
+  unsigned int settled = 0;
+  while (!queue.empty() && settled < kWitnessSettleLimit && targets > 0) {
+    auto [cost, node] = queue.top();
+    queue.pop();
+    if (cost != witness_costs_[node]) {
+      continue;
+    }
+    if (cost > max_cost) {
+      return;
+    }
+    settled++;
+    if (witness_targets_[node] == witness_search_) {
+      witness_targets_[node] = 0;
+      targets--;
+    }
+
+    for (unsigned int arc : out_arcs_[node]) {
+      const unsigned int target = arcs_[arc].target;
+      if (target == avoid) {
+        continue;
+      }
+
+      const float potential_cost = cost + arcs_[arc].cost;
+      if (witness_stamps_[target] != witness_search_ || potential_cost < witness_costs_[target]) {
+        witness_stamps_[target] = witness_search_;
+        witness_costs_[target] = potential_cost;
+        queue.emplace(potential_cost, target);
+      }
+    }
+  }
+}
+
+int ContractionHierarchy::getPriority(unsigned int node)
+{
+  // Edge difference, with the contracted neighbors to spread contraction uniformly
+  const int removed_arcs = static_cast<int>(in_arcs_[node].size() + out_arcs_[node].size());
+  return contract(node, true) - removed_arcs + static_cast<int>(contracted_neighbors_[node]);
+}
+
+void ContractionHierarchy::buildSearchGraph()
+{
+  const unsigned int num_nodes = static_cast<unsigned int>(ranks_.size());
+  up_offsets_.assign(num_nodes + 1, 0);
+  down_offsets_.assign(num_nodes + 1, 0);
+  // Arcs between core nodes, of the same rank, are searched in both directions
+  for (const Arc & arc : arcs_) {
+    if (ranks_[arc.source] <= ranks_[arc.target]) {
+      up_offsets_[arc.source + 1]++;
+    }
+    if (ranks_[arc.source] >= ranks_[arc.target]) {
+      down_offsets_[arc.target + 1]++;
+    }
+  }
+  for (unsigned int i = 0; i != num_nodes; i++) {
+    up_offsets_[i + 1] += up_offsets_[i];
+    down_offsets_[i + 1] += down_offsets_[i];
+  }
+
+  up_arcs_.resize(up_offsets_.back());
+  down_arcs_.resize(down_offsets_.back());
+  std::vector<unsigned int> up_fill(up_offsets_.begin(), up_offsets_.end() - 1);
+  std::vector<unsigned int> down_fill(down_offsets_.begin(), down_offsets_.end() - 1);
+  for (unsigned int i = 0; i != arcs_.size(); i++) {
+    if (ranks_[arcs_[i].source] <= ranks_[arcs_[i].target]) {
+      up_arcs_[up_fill[arcs_[i].source]++] = i;
+    }
+    if (ranks_[arcs_[i].source] >= ranks_[arcs_[i].target]) {
+      down_arcs_[down_fill[arcs_[i].target]++] = i;
+    }
+  }
+}
+
+bool ContractionHierarchy::findPath(unsigned int start, unsigned int goal, EdgePtrVector & edges)
+{
+  edges.clear();
+  if (empty()) {
+    return false;
+  }
+
+  if (++query_ == 0) {
+    std::fill(stamps_.begin(), stamps_.end(), 0);
+    query_ = 1;
+  }
+
+  Queue forward_queue, backward_queue;
+  touch(start);
+  forward_costs_[start] = 0.0f;
+  forward_parents_[start] = kNone;
+  forward_queue.emplace(0.0f, start);
+  touch(goal);
+  backward_costs_[goal] = 0.0f;
+  backward_parents_[goal] = kNone;
+  backward_queue.emplace(0.0f, goal);
+
+  float best_cost = kUnreachable;
+  unsigned int meeting_node = kNone;
+  while (!forward_queue.empty() || !backward_queue.empty()) {
+    const float forward_cost = forward_queue.empty() ? kUnreachable : forward_queue.top().first;
+    const float backward_cost = backward_queue.empty() ? kUnreachable : backward_queue.top().first;
+    if (std::min(forward_cost, backward_cost) >= best_cost) {
+      break;
+    }
+
+    if (forward_cost <= backward_cost) {
+      searchStep(
+        forward_queue, forward_costs_, forward_parents_, backward_costs_,
+        up_offsets_, up_arcs_, down_offsets_, down_arcs_, true, best_cost, meeting_node);
+    } else {
+      searchStep(
+        backward_queue, backward_costs_, backward_parents_, forward_costs_,
+        down_offsets_, down_arcs_, up_offsets_, up_arcs_, false, best_cost, meeting_node);
+    }
+  }
+
+  if (meeting_node == kNone) {
+    return false;
+  }
+
+  // Arcs from the start up to the meeting node, then down to the goal
+  std::vector<unsigned int> path_arcs;
+  for (unsigned int node = meeting_node; node != start; ) {
+    path_arcs.push_back(forward_parents_[node]);
+    node = arcs_[forward_parents_[node]].source;
+  }
+  std::reverse(path_arcs.begin(), path_arcs.end());
+  for (unsigned int node = meeting_node; node != goal; ) {
+    path_arcs.push_back(backward_parents_[node]);
+    node = arcs_[backward_parents_[node]].target;
+  }
+
+  for (unsigned int arc : path_arcs) {
+    unpackArc(arc, edges);
+  }
+  return true;
+}
+
+void ContractionHierarchy::searchStep(
+  Queue & queue, std::vector<float> & costs, std::vector<unsigned int> & parents,
+  const std::vector<float> & other_costs, const std::vector<unsigned int> & offsets,
+  const std::vector<unsigned int> & arcs, const std::vector<unsigned int> & stall_offsets,
+  const std::vector<unsigned int> & stall_arcs, bool forward,
+  float & best_cost, unsigned int & meeting_node)
+{
+  auto [cost, node] = queue.top();
+  queue.pop();
+  if (cost != costs[node]) {
+    return;
+  }
+
+  // Nodes reached from both directions join a path from start to goal
+  if (other_costs[node] != kUnreachable && cost + other_costs[node] < best_cost) {
+    best_cost = cost + other_costs[node];
+    meeting_node = node;
+  }
+
+  // Stall on demand: a node reached at a lower cost from a higher ranked node
+  // is not on a shortest path, so the search does not continue from it
+  for (unsigned int i = stall_offsets[node]; i != stall_offsets[node + 1]; i++) {
+    const Arc & arc = arcs_[stall_arcs[i]];
+    const unsigned int previous = forward ? arc.source : arc.target;
+    if (stamps_[previous] == query_ && costs[previous] != kUnreachable &&
+      costs[previous] + arc.cost < cost)
+    {
+      return;
+    }
+  }
+
+  for (unsigned int i = offsets[node]; i != offsets[node + 1]; i++) {
+    const Arc & arc = arcs_[arcs[i]];
+    const unsigned int next = forward ? arc.target : arc.source;
+    const float potential_cost = cost + arc.cost;
+    touch(next);
+    if (potential_cost < costs[next]) {
+      costs[next] = potential_cost;
+      parents[next] = arcs[i];
+      queue.emplace(potential_cost, next);
+    }
+  }
+}
+
+void ContractionHierarchy::unpackArc(unsigned int arc, EdgePtrVector & edges) const
+{
+  std::vector<unsigned int> stack{arc};
+  while (!stack.empty()) {
+    const Arc & top = arcs_[stack.back()];
+    stack.pop_back();
+    if (top.edge) {
+      edges.push_back(top.edge);
+    } else {
+      stack.push_back(top.second);
+      stack.push_back(top.first);
+    }
+  }
+}
+
+void ContractionHierarchy::clear()
+{
+  arcs_.clear();
+  num_shortcuts_ = 0;
+  up_offsets_.clear();
+  up_arcs_.clear();
+  down_offsets_.clear();
+  down_arcs_.clear();
+  forward_costs_.clear();
+  backward_costs_.clear();
+  forward_parents_.clear();
+  backward_parents_.clear();
+  stamps_.clear();
+}
+
+bool ContractionHierarchy::empty() const
+{
+  return up_offsets_.empty();
+}
+
+unsigned int ContractionHierarchy::getNumShortcuts() const
+{
+  return num_shortcuts_;
+}
+
+}  // namespace nav2_route
@@ -13,8 +13,11 @@
 // limitations under the License.
 
 
+#include <algorithm>
+#include <atomic>
 #include <string>
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include "nav2_route/edge_scorer.hpp"
@@ -22,6 +25,9 @@
 namespace nav2_route
 {
 
+// Generations are unique between scorers, as scores are cached in the graph edges
+std::atomic<unsigned int> g_cache_generation{0};
+
 EdgeScorer::EdgeScorer(
   nav2::LifecycleNode::SharedPtr node,
   const std::shared_ptr<tf2_ros::Buffer> tf_buffer,
@@ -37,6 +43,11 @@ EdgeScorer::EdgeScorer(
     node, "edge_cost_functions", rclcpp::ParameterValue(default_plugin_ids));
   auto edge_cost_function_ids = node->get_parameter("edge_cost_functions").as_string_array();
 
+  nav2::declare_parameter_if_not_declared(
+    node, "cache_edge_scores", rclcpp::ParameterValue(true));
+  cache_scores_ = node->get_parameter("cache_edge_scores").as_bool();
+  clearCache();
+
   if (edge_cost_function_ids == default_plugin_ids) {
     for (unsigned int i = 0; i != edge_cost_function_ids.size(); i++) {
       nav2::declare_parameter_if_not_declared(
@@ -53,6 +64,11 @@ EdgeScorer::EdgeScorer(
         node->get_logger(), "Created edge cost function plugin %s of type %s",
         edge_cost_function_ids[i].c_str(), type.c_str());
       scorer->configure(node, tf_buffer, costmap_subscriber, edge_cost_function_ids[i]);
+      if (cache_scores_ && scorer->isCacheable()) {
+        cached_plugins_.push_back(scorer);
+      } else {
+        uncached_plugins_.push_back(scorer);
+      }
       plugins_.push_back(std::move(scorer));
     } catch (const pluginlib::PluginlibException & ex) {
       RCLCPP_FATAL(
@@ -63,6 +79,19 @@ EdgeScorer::EdgeScorer(
   }
 }
 
+void EdgeScorer::prepare()
+{
+  for (auto & plugin : plugins_) {
+    plugin->prepare();
+  }
+
+  ScoreInvalidation invalidation;
+  for (auto & plugin : cached_plugins_) {
+    plugin->getInvalidatedScores(invalidation);
+  }
+  invalidate(invalidation);
+}
+
 bool EdgeScorer::score(
   const EdgePtr edge, const RouteRequest & route_request,
   const EdgeType & edge_type, float & total_score)
@@ -70,9 +99,7 @@ bool EdgeScorer::score(
   total_score = 0.0;
   float curr_score = 0.0;
 
-  for (auto & plugin : plugins_) {
-    plugin->prepare();
-  }
+  prepare();
 
   for (auto & plugin : plugins_) {
     curr_score = 0.0;
@@ -86,6 +113,105 @@ bool EdgeScorer::score(
   return true;
 }
 
+void EdgeScorer::scoreBatch(
+  const EdgePtrVector & edges, const RouteRequest & route_request,
+  const std::vector<EdgeType> & edge_types, std::vector<float> & scores,
+  std::vector<bool> & valid)
+{
+  scores.assign(edges.size(), 0.0f);
+  valid.assign(edges.size(), true);
+
+  // Reuse the cached scores of the cacheable plugins, scoring and caching any other edges
+  if (!cached_plugins_.empty()) {
+    miss_edges_.clear();
+    miss_edge_types_.clear();
+    miss_indices_.clear();
+    for (unsigned int i = 0; i != edges.size(); i++) {
+      const ScoreCache & cache = edges[i]->score_cache;
+      if (cache.generation == cache_generation_) {
+        scores[i] = cache.score;
+        valid[i] = cache.valid;
+      } else {
+        miss_edges_.push_back(edges[i]);
+        miss_edge_types_.push_back(edge_types[i]);
+        miss_indices_.push_back(i);
+      }
+    }
+
+    if (!miss_edges_.empty()) {
+      miss_scores_.assign(miss_edges_.size(), 0.0f);
+      miss_valid_.assign(miss_edges_.size(), true);
+      for (auto & plugin : cached_plugins_) {
+        plugin->scoreBatch(miss_edges_, route_request, miss_edge_types_, miss_scores_, miss_valid_);
+      }
+
+      for (unsigned int j = 0; j != miss_edges_.size(); j++) {
+        scores[miss_indices_[j]] = miss_scores_[j];
+        valid[miss_indices_[j]] = miss_valid_[j];
+        ScoreCache & cache = miss_edges_[j]->score_cache;
+        cache.score = miss_scores_[j];
+        cache.valid = miss_valid_[j];
+        cache.generation = cache_generation_;
+        cached_edges_.push_back(miss_edges_[j]);
+      }
+    }
+  }
+
+  for (auto & plugin : uncached_plugins_) {
+    plugin->scoreBatch(edges, route_request, edge_types, scores, valid);
+  }
+}
+
+void EdgeScorer::clearCache()
+{
+  cached_edges_.clear();
+  cache_generation_ = ++g_cache_generation;
+  while (cache_generation_ == 0) {
+    cache_generation_ = ++g_cache_generation;
+  }
+}
+
+void EdgeScorer::invalidate(const ScoreInvalidation & invalidation)
+{
+  if (invalidation.all) {
+    clearCache();
+    return;
+  }
+
+  if (cached_edges_.empty() || (invalidation.edgeids.empty() && invalidation.regions.empty())) {
+    return;
+  }
+
+  // Remove scores of invalidated edges, or of edges whose bounds overlap an invalidated region
+  const std::unordered_set<unsigned int> edgeids(
+    invalidation.edgeids.begin(), invalidation.edgeids.end());
+  auto is_stale = [&](const EdgePtr edge) {
+      if (edgeids.find(edge->edgeid) != edgeids.end()) {
+        return true;
+      }
+      const Coordinates & start = edge->start->coords;
+      const Coordinates & end = edge->end->coords;
+      for (const ScoreRegion & region : invalidation.regions) {
+        if (std::max(start.x, end.x) >= region.min_x && std::min(start.x, end.x) <= region.max_x &&
+          std::max(start.y, end.y) >= region.min_y && std::min(start.y, end.y) <= region.max_y)
+        {
+          return true;
+        }
+      }
+      return false;
+    };
+
+  unsigned int num_cached = 0;
+  for (const EdgePtr edge : cached_edges_) {
+    if (is_stale(edge)) {
+      edge->score_cache.generation = 0;
+    } else {
+      cached_edges_[num_cached++] = edge;
+    }
+  }
+  cached_edges_.resize(num_cached);
+}
+
 int EdgeScorer::numPlugins() const
 {
   return plugins_.size();
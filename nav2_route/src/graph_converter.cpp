@@ -0,0 +1,131 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rclcpp/rclcpp.hpp"
+#include "nav2_ros_common/lifecycle_node.hpp"
+#include "nav2_route/plugins/graph_file_loaders/binary_graph_file_loader.hpp"
+#include "nav2_route/plugins/graph_file_loaders/geojson_graph_file_loader.hpp"
+#include "nav2_route/plugins/graph_file_savers/binary_graph_file_saver.hpp"
+#include "nav2_route/plugins/graph_file_savers/geojson_graph_file_saver.hpp"
+
+using namespace nav2_route;  // NOLINT
+
+const char * USAGE_STRING{
+  "Usage:\n"
+  "  graph_converter <input_file> <output_file> [--ros-args ROS remapping args]\n"
+  "\n"
+  "Converts a route graph between formats, chosen by the file extensions:\n"
+  "  .geojson, .json  GeoJSON graph\n"
+  "  .navgraph        Binary graph, for fast loading\n"
+  "\n"
+  "NOTE: --ros-args should be passed at the end of command line"};
+
+bool isBinaryGraphFile(const std::string & filepath)
+{
+  return std::filesystem::path(filepath).extension() == ".navgraph";
+}
+
+bool isGeoJsonGraphFile(const std::string & filepath)
+{
+  const auto extension = std::filesystem::path(filepath).extension();
+  return extension == ".geojson" || extension == ".json";
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  auto logger = rclcpp::get_logger("graph_converter");
+
+  std::vector<std::string> arguments;
+  for (int i = 1; i < argc && std::string(argv[i]) != "--ros-args"; i++) {
+    arguments.emplace_back(argv[i]);
+  }
+
+  if (arguments.size() == 1 && (arguments[0] == "-h" || arguments[0] == "--help")) {
+    std::cout << USAGE_STRING << std::endl;
+    rclcpp::shutdown();
+    return 0;
+  }
+
+  if (arguments.size() != 2) {
+    RCLCPP_ERROR(logger, "Expected an input and an output file");
+    std::cout << USAGE_STRING << std::endl;
+    rclcpp::shutdown();
+    return -1;
+  }
+
+  const std::string & input = arguments[0];
+  const std::string & output = arguments[1];
+  for (const auto & filepath : arguments) {
+    if (!isBinaryGraphFile(filepath) && !isGeoJsonGraphFile(filepath)) {
+      RCLCPP_ERROR(logger, "Unknown graph file format of %s", filepath.c_str());
+      rclcpp::shutdown();
+      return -1;
+    }
+  }
+
+  auto node = std::make_shared<nav2::LifecycleNode>("graph_converter");
+  GraphFileLoader::Ptr loader;
+  if (isBinaryGraphFile(input)) {
+    loader = std::make_shared<BinaryGraphFileLoader>();
+  } else {
+    loader = std::make_shared<GeoJsonGraphFileLoader>();
+  }
+  GraphFileSaver::Ptr saver;
+  if (isBinaryGraphFile(output)) {
+    saver = std::make_shared<BinaryGraphFileSaver>();
+  } else {
+    saver = std::make_shared<GeoJsonGraphFileSaver>();
+  }
+  loader->configure(node);
+  saver->configure(node);
+
+  int retcode = 0;
+  Graph graph;
+  GraphToIDMap graph_to_id_map;
+  try {
+    auto start = std::chrono::steady_clock::now();
+    if (!loader->loadGraphFromFile(graph, graph_to_id_map, input)) {
+      throw std::runtime_error("Failed to load " + input);
+    }
+    auto loaded = std::chrono::steady_clock::now();
+    if (!saver->saveGraphToFile(graph, output)) {
+      throw std::runtime_error("Failed to save " + output);
+    }
+    auto saved = std::chrono::steady_clock::now();
+
+    unsigned int num_edges = 0;
+    for (const auto & graph_node : graph) {
+      num_edges += graph_node.neighbors.size();
+    }
+    RCLCPP_INFO(
+      logger, "Converted %s to %s (%zu nodes, %u edges), loading took %.3f s, saving %.3f s",
+      input.c_str(), output.c_str(), graph.size(), num_edges,
+      std::chrono::duration<double>(loaded - start).count(),
+      std::chrono::duration<double>(saved - loaded).count());
+  } catch (std::exception & e) {
+    RCLCPP_ERROR(logger, "Failed to convert the graph: %s", e.what());
+    retcode = -1;
+  }
+
+  rclcpp::shutdown();
+  return retcode;
+}
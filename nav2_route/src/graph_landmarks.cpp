@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "nav2_route/graph_landmarks.hpp"
+
+namespace nav2_route
+{
+
+void GraphLandmarks::compute(
+  const Graph & graph, unsigned int num_landmarks, const EdgeCostFn & edge_cost)
+{
+  clear();
+  if (graph.empty() || num_landmarks == 0) {
+    return;
+  }
+
+  // Forward and reverse adjacency by graph index, nodes are contiguous in the graph
+  const Node * first = graph.data();
+  Adjacency forward(graph.size()), reverse(graph.size());
+  for (unsigned int i = 0; i != graph.size(); i++) {
+    for (const DirectionalEdge & edge : graph[i].neighbors) {
+      const unsigned int end = static_cast<unsigned int>(edge.end - first);
+      const float cost = std::max(edge_cost(edge), 0.0f);
+      forward[i].emplace_back(end, cost);
+      reverse[end].emplace_back(i, cost);
+    }
+  }
+
+  selectLandmarks(graph, num_landmarks);
+  costs_from_.assign(graph.size() * landmarks_.size(), kUnreachable);
+  costs_to_.assign(graph.size() * landmarks_.size(), kUnreachable);
+  for (unsigned int i = 0; i != landmarks_.size(); i++) {
+    computeCosts(forward, i, costs_from_);
+    computeCosts(reverse, i, costs_to_);
+  }
+}
+
+void GraphLandmarks::selectLandmarks(const Graph & graph, unsigned int num_landmarks)
+{
+  num_landmarks = std::min(num_landmarks, static_cast<unsigned int>(graph.size()));
+
+  // Start from the node farthest from the centroid, on the periphery of the graph
+  double cx = 0.0, cy = 0.0;
+  for (const Node & node : graph) {
+    cx += node.coords.x;
+    cy += node.coords.y;
+  }
+  cx /= static_cast<double>(graph.size());
+  cy /= static_cast<double>(graph.size());
+
+  std::vector<double> sq_dists(graph.size());
+  for (unsigned int i = 0; i != graph.size(); i++) {
+    sq_dists[i] = std::pow(graph[i].coords.x - cx, 2) + std::pow(graph[i].coords.y - cy, 2);
+  }
+
+  while (landmarks_.size() < num_landmarks) {
+    const unsigned int next = static_cast<unsigned int>(
+      std::max_element(sq_dists.begin(), sq_dists.end()) - sq_dists.begin());
+    if (!landmarks_.empty() && sq_dists[next] <= 0.0) {
+      break;  // Remaining nodes are coincident with landmarks
+    }
+    landmarks_.push_back(next);
+
+    // Keep each node's squared distance to its nearest landmark
+    for (unsigned int i = 0; i != graph.size(); i++) {
+      const double sq_dist = std::pow(graph[i].coords.x - graph[next].coords.x, 2) +
+        std::pow(graph[i].coords.y - graph[next].coords.y, 2);
+      sq_dists[i] = landmarks_.size() == 1 ? sq_dist : std::min(sq_dists[i], sq_dist);
+    }
+  }
+}
+
+void GraphLandmarks::computeCosts(
+  const Adjacency & adjacency, unsigned int landmark, std::vector<float> & costs)
+{
+  typedef std::pair<float, unsigned int> Element;
+  std::priority_queue<Element, std::vector<Element>, std::greater<Element>> queue;
+  const unsigned int stride = static_cast<unsigned int>(landmarks_.size());
+
+  costs[landmarks_[landmark] * stride + landmark] = 0.0f;
+  queue.emplace(0.0f, landmarks_[landmark]);
+  while (!queue.empty()) {
+    auto [cost, node] = queue.top();
+    queue.pop();
+    if (cost != costs[node * stride + landmark]) {
+      continue;
+    }
+
+    for (const auto & [neighbor, edge_cost] : adjacency[node]) {
+      float & neighbor_cost = costs[neighbor * stride + landmark];
+      const float potential_cost = cost + edge_cost;
+      if (potential_cost < neighbor_cost) {
+        neighbor_cost = potential_cost;
+        queue.emplace(potential_cost, neighbor);
+      }
+    }
+  }
+}
+
+const std::vector<unsigned int> & GraphLandmarks::getLandmarks() const
+{
+  return landmarks_;
+}
+
+void GraphLandmarks::clear()
+{
+  landmarks_.clear();
+  costs_from_.clear();
+  costs_to_.clear();
+}
+
+bool GraphLandmarks::empty() const
+{
+  return landmarks_.empty();
+}
+
+}  // namespace nav2_route
@@ -12,8 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "nav2_route/plugins/edge_cost_functions/costmap_scorer.hpp"
 
@@ -141,6 +146,112 @@ bool CostmapScorer::score(
   return true;
 }
 
+void CostmapScorer::scoreBatch(
+  const EdgePtrVector & edges, const RouteRequest & route_request,
+  const std::vector<EdgeType> & edge_types, std::vector<float> & costs,
+  std::vector<bool> & valid)
+{
+  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock;
+  if (costmap_) {
+    lock = std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t>(*costmap_->getMutex());
+  }
+  EdgeCostFunction::scoreBatch(edges, route_request, edge_types, costs, valid);
+}
+
+void CostmapScorer::getInvalidatedScores(ScoreInvalidation & invalidation)
+{
+  // Edges are invalid without a costmap, to rescore once one is received
+  if (!costmap_) {
+    invalidation.all = invalidation.all || !scored_costs_.empty();
+    scored_costs_.clear();
+    return;
+  }
+
+  std::lock_guard<nav2_costmap_2d::Costmap2D::mutex_t> lock(*costmap_->getMutex());
+  const unsigned int size_x = costmap_->getSizeInCellsX();
+  const unsigned int size_y = costmap_->getSizeInCellsY();
+  const double resolution = costmap_->getResolution();
+  const double origin_x = costmap_->getOriginX();
+  const double origin_y = costmap_->getOriginY();
+  const unsigned char * costs = costmap_->getCharMap();
+
+  if (scored_costs_.empty() || size_x != scored_size_x_ || size_y != scored_size_y_ ||
+    resolution != scored_resolution_ || origin_x != scored_origin_x_ ||
+    origin_y != scored_origin_y_)
+  {
+    invalidation.all = true;
+    scored_costs_.assign(costs, costs + size_x * size_y);
+    scored_size_x_ = size_x;
+    scored_size_y_ = size_y;
+    scored_resolution_ = resolution;
+    scored_origin_x_ = origin_x;
+    scored_origin_y_ = origin_y;
+    return;
+  }
+
+  // Find the bounds of each band of consecutive changed rows, to invalidate distant
+  // changes separately. If there are too many bands, invalidate their bounds at once.
+  const unsigned int max_regions = 32;
+  std::vector<ScoreRegion> regions;
+  ScoreRegion bounds{
+    std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+    std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+  unsigned int min_x = 0, max_x = 0, min_y = 0;
+  bool in_band = false;
+  auto add_region = [&](unsigned int end_y) {
+      ScoreRegion region{
+        static_cast<float>(origin_x + min_x * resolution),
+        static_cast<float>(origin_y + min_y * resolution),
+        static_cast<float>(origin_x + (max_x + 1) * resolution),
+        static_cast<float>(origin_y + end_y * resolution)};
+      bounds.min_x = std::min(bounds.min_x, region.min_x);
+      bounds.min_y = std::min(bounds.min_y, region.min_y);
+      bounds.max_x = std::max(bounds.max_x, region.max_x);
+      bounds.max_y = std::max(bounds.max_y, region.max_y);
+      regions.push_back(region);
+      in_band = false;
+    };
+
+  for (unsigned int y = 0; y != size_y; y++) {
+    const unsigned char * row = costs + y * size_x;
+    unsigned char * scored_row = scored_costs_.data() + y * size_x;
+    if (std::memcmp(row, scored_row, size_x) == 0) {
+      if (in_band) {
+        add_region(y);
+      }
+      continue;
+    }
+
+    unsigned int row_min_x = 0, row_max_x = size_x - 1;
+    while (row[row_min_x] == scored_row[row_min_x]) {
+      row_min_x++;
+    }
+    while (row[row_max_x] == scored_row[row_max_x]) {
+      row_max_x--;
+    }
+    std::memcpy(scored_row + row_min_x, row + row_min_x, row_max_x - row_min_x + 1);
+
+    if (!in_band) {
+      in_band = true;
+      min_y = y;
+      min_x = row_min_x;
+      max_x = row_max_x;
+    } else {
+      min_x = std::min(min_x, row_min_x);
+      max_x = std::max(max_x, row_max_x);
+    }
+  }
+  if (in_band) {
+    add_region(size_y);
+  }
+
+  if (regions.size() > max_regions) {
+    invalidation.regions.push_back(bounds);
+  } else {
+    invalidation.regions.insert(invalidation.regions.end(), regions.begin(), regions.end());
+  }
+}
+
 std::string CostmapScorer::getName()
 {
   return name_;
@@ -13,7 +13,9 @@
 // limitations under the License.
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 #include "nav2_route/plugins/edge_cost_functions/dynamic_edges_scorer.hpp"
 
@@ -45,6 +47,18 @@ void DynamicEdgesScorer::closedEdgesCb(
   std::shared_ptr<nav2_msgs::srv::DynamicEdges::Response> response)
 {
   RCLCPP_INFO(logger_, "Edge closure and cost adjustment in progress!");
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Cached scores of the changed edges are stale, once they are being cached
+  if (report_changes_) {
+    changed_edges_.insert(
+      changed_edges_.end(), request->closed_edges.begin(), request->closed_edges.end());
+    changed_edges_.insert(
+      changed_edges_.end(), request->opened_edges.begin(), request->opened_edges.end());
+    for (auto & edge : request->adjust_edges) {
+      changed_edges_.push_back(edge.edgeid);
+    }
+  }
 
   // Add new closed edges
   for (unsigned int edge : request->closed_edges) {
@@ -70,6 +84,38 @@ bool DynamicEdgesScorer::score(
   const EdgePtr edge,
   const RouteRequest & /* route_request */,
   const EdgeType & /* edge_type */, float & cost)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return scoreEdge(edge, cost);
+}
+
+void DynamicEdgesScorer::scoreBatch(
+  const EdgePtrVector & edges, const RouteRequest & /* route_request */,
+  const std::vector<EdgeType> & /* edge_types */, std::vector<float> & costs,
+  std::vector<bool> & valid)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  float cost = 0.0;
+  for (unsigned int i = 0; i != edges.size(); i++) {
+    cost = 0.0;
+    if (valid[i] && scoreEdge(edges[i], cost)) {
+      costs[i] += cost;
+    } else {
+      valid[i] = false;
+    }
+  }
+}
+
+void DynamicEdgesScorer::getInvalidatedScores(ScoreInvalidation & invalidation)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  report_changes_ = true;
+  invalidation.edgeids.insert(
+    invalidation.edgeids.end(), changed_edges_.begin(), changed_edges_.end());
+  changed_edges_.clear();
+}
+
+bool DynamicEdgesScorer::scoreEdge(const EdgePtr edge, float & cost)
 {
   // Find if this edge is in the closed set of edges
   if (closed_edges_.find(edge->edgeid) != closed_edges_.end()) {
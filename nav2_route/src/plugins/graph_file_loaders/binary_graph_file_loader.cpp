@@ -0,0 +1,336 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nav2_route/plugins/graph_file_loaders/binary_graph_file_loader.hpp"
+
+namespace nav2_route
+{
+
+namespace
+{
+
+/**
+ * @class MappedFile
+ * @brief A read-only memory mapping of a file, unmapped on destruction
+ */
+class MappedFile
+{
+public:
+  explicit MappedFile(const std::string & filepath)
+  {
+    const int fd = open(filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      return;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+      void * data = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED) {
+        data_ = static_cast<const char *>(data);
+        size_ = static_cast<size_t>(file_stat.st_size);
+        // Records are read front to back, so read ahead aggressively
+        madvise(data, size_, MADV_SEQUENTIAL);
+      }
+    }
+    close(fd);
+  }
+
+  ~MappedFile()
+  {
+    if (data_) {
+      munmap(const_cast<char *>(data_), size_);
+    }
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile & operator=(const MappedFile &) = delete;
+
+  const char * data() const {return data_;}
+  size_t size() const {return size_;}
+
+private:
+  const char * data_{nullptr};
+  size_t size_{0};
+};
+
+/**
+ * @brief Find the records of a section, if it lies within the file and is aligned
+ */
+template<typename T>
+bool getSection(
+  const char * data, size_t size, const binary_graph::Section & section,
+  const T * & records, size_t & count)
+{
+  if (section.offset % alignof(T) != 0 || section.offset > size ||
+    section.count > (size - section.offset) / sizeof(T))
+  {
+    return false;
+  }
+  records = reinterpret_cast<const T *>(data + section.offset);
+  count = static_cast<size_t>(section.count);
+  return true;
+}
+
+}  // namespace
+
+void BinaryGraphFileLoader::configure(
+  const nav2::LifecycleNode::SharedPtr node)
+{
+  RCLCPP_INFO(node->get_logger(), "Configuring binary graph file loader");
+  logger_ = node->get_logger();
+}
+
+bool BinaryGraphFileLoader::loadGraphFromFile(
+  Graph & graph, GraphToIDMap & graph_to_id_map, std::string filepath)
+{
+  if (!std::filesystem::exists(filepath)) {
+    RCLCPP_ERROR(logger_, "The filepath %s does not exist", filepath.c_str());
+    return false;
+  }
+
+  MappedFile file(filepath);
+  if (!file.data()) {
+    RCLCPP_ERROR(logger_, "Failed to map %s: %s", filepath.c_str(), strerror(errno));
+    return false;
+  }
+
+  FileView view;
+  if (!readHeader(file.data(), file.size(), view)) {
+    RCLCPP_ERROR(
+      logger_, "%s is not a binary graph file of version %u",
+      filepath.c_str(), binary_graph::kVersion);
+    return false;
+  }
+
+  if (view.num_nodes == 0 || view.num_edges == 0) {
+    RCLCPP_ERROR(
+      logger_, "The graph is malformed. It does not contain nodes or edges. Please check %s",
+      filepath.c_str());
+    return false;
+  }
+
+  // Populate a new graph, so the graph is left untouched if the file is corrupt
+  Graph new_graph;
+  GraphToIDMap new_graph_to_id_map;
+  try {
+    addGraphElements(view, new_graph, new_graph_to_id_map);
+  } catch (const nav2_core::NoValidGraph & ex) {
+    RCLCPP_ERROR(logger_, "Failed to load %s, file is corrupt: %s", filepath.c_str(), ex.what());
+    return false;
+  }
+
+  // Swapping keeps the node addresses the edges point to
+  graph.swap(new_graph);
+  graph_to_id_map.swap(new_graph_to_id_map);
+  return true;
+}
+
+bool BinaryGraphFileLoader::readHeader(const char * data, size_t size, FileView & view)
+{
+  if (size < sizeof(binary_graph::Header)) {
+    return false;
+  }
+
+  binary_graph::Header header;
+  std::memcpy(&header, data, sizeof(header));
+  if (std::memcmp(header.magic, binary_graph::kMagic, sizeof(header.magic)) != 0 ||
+    header.version != binary_graph::kVersion ||
+    header.byte_order != binary_graph::kByteOrderMark)
+  {
+    return false;
+  }
+
+  size_t num_edge_offsets = 0;
+  return getSection(data, size, header.characters, view.characters, view.num_characters) &&
+         getSection(data, size, header.strings, view.strings, view.num_strings) &&
+         getSection(data, size, header.nodes, view.nodes, view.num_nodes) &&
+         getSection(data, size, header.edge_offsets, view.edge_offsets, num_edge_offsets) &&
+         getSection(data, size, header.edges, view.edges, view.num_edges) &&
+         getSection(data, size, header.operations, view.operations, view.num_operations) &&
+         getSection(data, size, header.metadata, view.metadata, view.num_metadata) &&
+         getSection(data, size, header.values, view.values, view.num_values) &&
+         num_edge_offsets == view.num_nodes + 1;
+}
+
+void BinaryGraphFileLoader::addGraphElements(
+  const FileView & view, Graph & graph, GraphToIDMap & graph_to_id_map)
+{
+  if (view.edge_offsets[0] != 0 || view.edge_offsets[view.num_nodes] != view.num_edges) {
+    throw nav2_core::NoValidGraph("Edge offsets do not cover the edges");
+  }
+
+  // Nodes must all exist before edges point to them
+  graph.resize(view.num_nodes);
+  graph_to_id_map.reserve(view.num_nodes);
+  for (unsigned int idx = 0; idx != view.num_nodes; idx++) {
+    const binary_graph::NodeRecord & record = view.nodes[idx];
+    Node & node = graph[idx];
+    node.nodeid = record.nodeid;
+    graph_to_id_map[node.nodeid] = idx;
+    node.coords.frame_id = convertString(view, record.frame);
+    node.coords.x = record.x;
+    node.coords.y = record.y;
+    node.metadata = convertMetadata(view, record.metadata);
+    node.operations = convertOperations(view, record.operations, record.num_operations);
+  }
+
+  for (unsigned int idx = 0; idx != view.num_nodes; idx++) {
+    const uint32_t first = view.edge_offsets[idx];
+    const uint32_t last = view.edge_offsets[idx + 1];
+    if (first > last || last > view.num_edges) {
+      throw nav2_core::NoValidGraph("Edge offsets are not increasing");
+    }
+
+    Node & node = graph[idx];
+    node.neighbors.reserve(last - first);
+    for (uint32_t edge_idx = first; edge_idx != last; edge_idx++) {
+      const binary_graph::EdgeRecord & record = view.edges[edge_idx];
+      if (record.end >= view.num_nodes) {
+        throw nav2_core::NoValidGraph("End node of edge does not exist");
+      }
+      EdgeCost edge_cost;
+      edge_cost.cost = record.cost;
+      edge_cost.overridable = record.overridable != 0;
+      node.neighbors.push_back(
+        {record.edgeid, &node, &graph[record.end], edge_cost,
+          convertMetadata(view, record.metadata),
+          convertOperations(view, record.operations, record.num_operations)});
+    }
+  }
+}
+
+std::string BinaryGraphFileLoader::convertString(const FileView & view, uint32_t idx)
+{
+  if (idx >= view.num_strings) {
+    throw nav2_core::NoValidGraph("String does not exist");
+  }
+  const binary_graph::StringRecord & record = view.strings[idx];
+  if (record.offset > view.num_characters || record.size > view.num_characters - record.offset) {
+    throw nav2_core::NoValidGraph("String is out of bounds");
+  }
+  return std::string(view.characters + record.offset, record.size);
+}
+
+Metadata BinaryGraphFileLoader::convertMetadata(const FileView & view, uint32_t idx)
+{
+  Metadata metadata;
+  if (idx == binary_graph::kNone) {
+    return metadata;
+  }
+  if (idx >= view.num_metadata) {
+    throw nav2_core::NoValidGraph("Metadata does not exist");
+  }
+
+  const binary_graph::MetadataRecord & record = view.metadata[idx];
+  if (record.values > view.num_values || record.num_values > view.num_values - record.values) {
+    throw nav2_core::NoValidGraph("Metadata values are out of bounds");
+  }
+  metadata.data.reserve(record.num_values);
+  for (uint32_t value_idx = record.values; value_idx != record.values + record.num_values;
+    value_idx++)
+  {
+    metadata.data.emplace(
+      convertString(view, view.values[value_idx].key), convertValue(view, value_idx, idx));
+  }
+  return metadata;
+}
+
+std::any BinaryGraphFileLoader::convertValue(
+  const FileView & view, uint32_t idx, uint32_t metadata_idx)
+{
+  const binary_graph::ValueRecord & record = view.values[idx];
+  switch (record.type) {
+    case binary_graph::ValueType::INT:
+      return static_cast<int>(record.data);
+    case binary_graph::ValueType::UINT:
+      return static_cast<unsigned int>(record.data);
+    case binary_graph::ValueType::FLOAT:
+      {
+        float value;
+        std::memcpy(&value, &record.data, sizeof(value));
+        return value;
+      }
+    case binary_graph::ValueType::BOOL:
+      return record.data != 0;
+    case binary_graph::ValueType::STRING:
+      return convertString(view, record.data);
+    case binary_graph::ValueType::METADATA:
+      // References only go forward, so that corrupt files cannot recurse forever
+      if (record.data <= metadata_idx) {
+        throw nav2_core::NoValidGraph("Nested metadata is out of order");
+      }
+      return convertMetadata(view, record.data);
+    case binary_graph::ValueType::ARRAY:
+      {
+        if (record.data <= idx || record.data > view.num_values ||
+          record.size > view.num_values - record.data)
+        {
+          throw nav2_core::NoValidGraph("Array elements are out of bounds");
+        }
+        std::vector<std::any> array;
+        array.reserve(record.size);
+        for (uint32_t element_idx = record.data; element_idx != record.data + record.size;
+          element_idx++)
+        {
+          array.push_back(convertValue(view, element_idx, metadata_idx));
+        }
+        return array;
+      }
+  }
+  throw nav2_core::NoValidGraph("Unknown metadata value type");
+}
+
+Operations BinaryGraphFileLoader::convertOperations(
+  const FileView & view, uint32_t first, uint32_t count)
+{
+  Operations operations;
+  if (count == 0) {
+    return operations;
+  }
+  if (first > view.num_operations || count > view.num_operations - first) {
+    throw nav2_core::NoValidGraph("Operations are out of bounds");
+  }
+
+  operations.reserve(count);
+  for (uint32_t idx = first; idx != first + count; idx++) {
+    const binary_graph::OperationRecord & record = view.operations[idx];
+    if (record.trigger > static_cast<uint32_t>(OperationTrigger::ON_EXIT)) {
+      throw nav2_core::NoValidGraph("Unknown operation trigger");
+    }
+    Operation operation;
+    operation.type = convertString(view, record.type);
+    operation.trigger = static_cast<OperationTrigger>(record.trigger);
+    operation.metadata = convertMetadata(view, record.metadata);
+    operations.push_back(std::move(operation));
+  }
+  return operations;
+}
+
+}  // namespace nav2_route
+
+#include "pluginlib/class_list_macros.hpp"
+PLUGINLIB_EXPORT_CLASS(nav2_route::BinaryGraphFileLoader, nav2_route::GraphFileLoader)
@@ -0,0 +1,267 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "nav2_route/plugins/graph_file_savers/binary_graph_file_saver.hpp"
+
+namespace nav2_route
+{
+
+namespace
+{
+
+/**
+ * @brief Check that a count fits in the 32 bit indices of the file
+ */
+inline uint32_t toIndex(size_t count)
+{
+  if (count >= binary_graph::kNone) {
+    throw std::runtime_error("Graph is too large for the binary graph format");
+  }
+  return static_cast<uint32_t>(count);
+}
+
+/**
+ * @brief Append a section to the file buffer, aligned, recording its location
+ */
+template<typename T>
+void appendSection(
+  const T * records, size_t count, std::vector<char> & buffer, binary_graph::Section & section)
+{
+  buffer.resize(
+    (buffer.size() + binary_graph::kSectionAlignment - 1) /
+    binary_graph::kSectionAlignment * binary_graph::kSectionAlignment, 0);
+  section.offset = buffer.size();
+  section.count = count;
+  buffer.resize(buffer.size() + count * sizeof(T));
+  if (count > 0) {
+    std::memcpy(buffer.data() + section.offset, records, count * sizeof(T));
+  }
+}
+
+}  // namespace
+
+void BinaryGraphFileSaver::configure(
+  const nav2::LifecycleNode::SharedPtr node)
+{
+  RCLCPP_INFO(node->get_logger(), "Configuring binary graph file saver");
+  logger_ = node->get_logger();
+}
+
+bool BinaryGraphFileSaver::saveGraphToFile(
+  Graph & graph, std::string filepath)
+{
+  if (filepath.empty()) {
+    RCLCPP_ERROR(logger_, "File path is empty");
+    return false;
+  }
+
+  try {
+    FileContents contents;
+    convertGraph(graph, contents);
+    writeFile(contents, filepath);
+  } catch (const std::exception & e) {
+    RCLCPP_ERROR(logger_, "An error occurred: %s", e.what());
+    return false;
+  }
+  return true;
+}
+
+void BinaryGraphFileSaver::convertGraph(const Graph & graph, FileContents & contents)
+{
+  // File indices of the graph nodes, skipping "deleted" nodes
+  std::vector<uint32_t> node_indices(graph.size(), binary_graph::kNone);
+  uint32_t num_nodes = 0;
+  for (unsigned int i = 0; i != graph.size(); i++) {
+    if (graph[i].nodeid != std::numeric_limits<int>::max()) {
+      node_indices[i] = num_nodes++;
+    }
+  }
+
+  contents.nodes.reserve(num_nodes);
+  contents.edge_offsets.reserve(num_nodes + 1);
+  for (unsigned int i = 0; i != graph.size(); i++) {
+    if (node_indices[i] == binary_graph::kNone) {
+      continue;
+    }
+
+    const Node & node = graph[i];
+    binary_graph::NodeRecord node_record;
+    node_record.nodeid = node.nodeid;
+    node_record.frame = convertString(node.coords.frame_id, contents);
+    node_record.x = node.coords.x;
+    node_record.y = node.coords.y;
+    node_record.metadata = convertMetadata(node.metadata, contents);
+    node_record.operations = convertOperations(node.operations, contents);
+    node_record.num_operations = toIndex(node.operations.size());
+    contents.nodes.push_back(node_record);
+
+    contents.edge_offsets.push_back(toIndex(contents.edges.size()));
+    for (const auto & edge : node.neighbors) {
+      const size_t end = static_cast<size_t>(edge.end - graph.data());
+      if (edge.end < graph.data() || end >= graph.size()) {
+        throw std::runtime_error("Edge " + std::to_string(edge.edgeid) + " ends outside the graph");
+      }
+      if (node_indices[end] == binary_graph::kNone) {
+        continue;  // Ends at a "deleted" node
+      }
+
+      binary_graph::EdgeRecord edge_record;
+      edge_record.edgeid = edge.edgeid;
+      edge_record.end = node_indices[end];
+      edge_record.cost = edge.edge_cost.cost;
+      edge_record.overridable = edge.edge_cost.overridable;
+      edge_record.metadata = convertMetadata(edge.metadata, contents);
+      edge_record.operations = convertOperations(edge.operations, contents);
+      edge_record.num_operations = toIndex(edge.operations.size());
+      contents.edges.push_back(edge_record);
+    }
+  }
+  contents.edge_offsets.push_back(toIndex(contents.edges.size()));
+}
+
+uint32_t BinaryGraphFileSaver::convertString(const std::string & str, FileContents & contents)
+{
+  auto it = contents.string_ids.find(str);
+  if (it != contents.string_ids.end()) {
+    return it->second;
+  }
+
+  const uint32_t idx = toIndex(contents.strings.size());
+  contents.strings.push_back({toIndex(contents.characters.size()), toIndex(str.size())});
+  contents.characters += str;
+  contents.string_ids.emplace(str, idx);
+  return idx;
+}
+
+uint32_t BinaryGraphFileSaver::convertMetadata(const Metadata & metadata, FileContents & contents)
+{
+  if (metadata.data.empty()) {
+    return binary_graph::kNone;
+  }
+
+  // Reserve the values first, so any nested metadata and arrays are stored after them
+  const uint32_t idx = toIndex(contents.metadata.size());
+  const uint32_t first = toIndex(contents.values.size());
+  const uint32_t count = toIndex(metadata.data.size());
+  contents.metadata.push_back({first, count});
+  contents.values.resize(first + count);
+
+  uint32_t value_idx = first;
+  for (const auto & [key, value] : metadata.data) {
+    binary_graph::ValueRecord record = convertValue(value, contents);
+    record.key = convertString(key, contents);
+    contents.values[value_idx++] = record;
+  }
+  return idx;
+}
+
+binary_graph::ValueRecord BinaryGraphFileSaver::convertValue(
+  const std::any & value, FileContents & contents)
+{
+  binary_graph::ValueRecord record{binary_graph::kNone, binary_graph::ValueType::INT, 0, 0};
+  if (value.type() == typeid(int)) {
+    record.data = static_cast<uint32_t>(std::any_cast<int>(value));
+  } else if (value.type() == typeid(unsigned int)) {
+    record.type = binary_graph::ValueType::UINT;
+    record.data = std::any_cast<unsigned int>(value);
+  } else if (value.type() == typeid(float)) {
+    record.type = binary_graph::ValueType::FLOAT;
+    const float data = std::any_cast<float>(value);
+    std::memcpy(&record.data, &data, sizeof(data));
+  } else if (value.type() == typeid(bool)) {
+    record.type = binary_graph::ValueType::BOOL;
+    record.data = std::any_cast<bool>(value);
+  } else if (value.type() == typeid(std::string)) {
+    record.type = binary_graph::ValueType::STRING;
+    record.data = convertString(std::any_cast<const std::string &>(value), contents);
+  } else if (value.type() == typeid(Metadata)) {
+    record.type = binary_graph::ValueType::METADATA;
+    record.data = convertMetadata(std::any_cast<const Metadata &>(value), contents);
+  } else if (value.type() == typeid(std::vector<std::any>)) {
+    // Reserve the elements first, so any nested arrays are stored after them
+    const auto & array = std::any_cast<const std::vector<std::any> &>(value);
+    record.type = binary_graph::ValueType::ARRAY;
+    record.data = toIndex(contents.values.size());
+    record.size = toIndex(array.size());
+    contents.values.resize(record.data + record.size);
+    for (uint32_t i = 0; i != record.size; i++) {
+      contents.values[record.data + i] = convertValue(array[i], contents);
+    }
+  } else {
+    // If we have an unknown type, store its name as the geojson format does
+    record.type = binary_graph::ValueType::STRING;
+    record.data = convertString(value.type().name(), contents);
+  }
+  return record;
+}
+
+uint32_t BinaryGraphFileSaver::convertOperations(
+  const Operations & operations, FileContents & contents)
+{
+  const uint32_t first = toIndex(contents.operations.size());
+  contents.operations.resize(first + operations.size());
+  for (unsigned int i = 0; i != operations.size(); i++) {
+    binary_graph::OperationRecord record;
+    record.type = convertString(operations[i].type, contents);
+    record.trigger = static_cast<uint32_t>(operations[i].trigger);
+    record.metadata = convertMetadata(operations[i].metadata, contents);
+    contents.operations[first + i] = record;
+  }
+  return first;
+}
+
+void BinaryGraphFileSaver::writeFile(const FileContents & contents, const std::string & filepath)
+{
+  binary_graph::Header header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, binary_graph::kMagic, sizeof(header.magic));
+  header.version = binary_graph::kVersion;
+  header.byte_order = binary_graph::kByteOrderMark;
+
+  std::vector<char> buffer(sizeof(header));
+  auto & c = contents;
+  appendSection(c.strings.data(), c.strings.size(), buffer, header.strings);
+  appendSection(c.characters.data(), c.characters.size(), buffer, header.characters);
+  appendSection(c.nodes.data(), c.nodes.size(), buffer, header.nodes);
+  appendSection(c.edge_offsets.data(), c.edge_offsets.size(), buffer, header.edge_offsets);
+  appendSection(c.edges.data(), c.edges.size(), buffer, header.edges);
+  appendSection(c.operations.data(), c.operations.size(), buffer, header.operations);
+  appendSection(c.metadata.data(), c.metadata.size(), buffer, header.metadata);
+  appendSection(c.values.data(), c.values.size(), buffer, header.values);
+  std::memcpy(buffer.data(), &header, sizeof(header));
+
+  // Replace the file at once, as a route server may be reading it
+  const std::string tmp_filepath = filepath + ".tmp";
+  std::ofstream file(tmp_filepath, std::ios::binary | std::ios::trunc);
+  file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  file.close();
+  if (!file) {
+    std::filesystem::remove(tmp_filepath);
+    throw std::runtime_error("Failed to write " + tmp_filepath);
+  }
+  std::filesystem::rename(tmp_filepath, filepath);
+}
+
+}  // namespace nav2_route
+
+#include "pluginlib/class_list_macros.hpp"
+PLUGINLIB_EXPORT_CLASS(nav2_route::BinaryGraphFileSaver, nav2_route::GraphFileSaver)
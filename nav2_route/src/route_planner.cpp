@@ -18,12 +18,21 @@
 #include <vector>
 #include <mutex>
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
 
 #include "nav2_route/route_planner.hpp"
 
 namespace nav2_route
 {
 
+namespace
+{
+// Search identifiers are unique across planners, which may share a graph
+std::atomic<unsigned int> g_search_id{0};
+}  // namespace
+
 void RoutePlanner::configure(
   nav2::LifecycleNode::SharedPtr node,
   const std::shared_ptr<tf2_ros::Buffer> tf_buffer,
@@ -37,9 +46,104 @@ void RoutePlanner::configure(
     max_iterations_ = std::numeric_limits<int>::max();
   }
 
+  nav2::declare_parameter_if_not_declared(
+    node, "search_mode", rclcpp::ParameterValue(std::string("dijkstra")));
+  std::string search_mode = node->get_parameter("search_mode").as_string();
+  if (search_mode == "dijkstra") {
+    search_mode_ = SearchMode::DIJKSTRA;
+  } else if (search_mode == "a_star") {
+    search_mode_ = SearchMode::A_STAR;
+  } else if (search_mode == "alt") {
+    search_mode_ = SearchMode::ALT;
+  } else if (search_mode == "contraction_hierarchy") {
+    search_mode_ = SearchMode::CONTRACTION_HIERARCHY;
+  } else {
+    throw std::runtime_error(
+            "Invalid search mode " + search_mode +
+            ", valid options are dijkstra, a_star, alt and contraction_hierarchy!");
+  }
+
+  nav2::declare_parameter_if_not_declared(
+    node, "min_cost_per_meter", rclcpp::ParameterValue(1.0));
+  min_cost_per_meter_ = std::max(
+    static_cast<float>(node->get_parameter("min_cost_per_meter").as_double()), 0.0f);
+
+  nav2::declare_parameter_if_not_declared(
+    node, "num_landmarks", rclcpp::ParameterValue(8));
+  num_landmarks_ = static_cast<unsigned int>(
+    std::max<int64_t>(node->get_parameter("num_landmarks").as_int(), 0));
+
+  logger_ = node->get_logger();
   edge_scorer_ = std::make_unique<EdgeScorer>(node, tf_buffer, costmap_subscriber);
 }
 
+void RoutePlanner::prepareGraph(Graph & graph)
+{
+  prepared_graph_ = graph.data();
+  prepared_graph_size_ = graph.size();
+  edge_scorer_->clearCache();
+  heuristic_cost_per_meter_ = 0.0;
+  landmarks_.clear();
+  contraction_hierarchy_.clear();
+  if (search_mode_ == SearchMode::DIJKSTRA || graph.empty()) {
+    return;
+  }
+
+  // The Euclidean heuristic scales distance by the lowest cost per meter of any edge
+  float cost_per_meter = std::numeric_limits<float>::max();
+  bool static_costs = true, valid_costs = true;
+  for (Node & node : graph) {
+    for (DirectionalEdge & edge : node.neighbors) {
+      const float length = edge.getEdgeLength();
+      if (length > 0.0f) {
+        cost_per_meter = std::min(cost_per_meter, getLowerBoundCost(edge) / length);
+      }
+      static_costs &= !edge.edge_cost.overridable || edge_scorer_->numPlugins() == 0;
+      valid_costs &= edge.edge_cost.cost > 0.0;
+    }
+  }
+  if (cost_per_meter != std::numeric_limits<float>::max()) {
+    heuristic_cost_per_meter_ = cost_per_meter;
+  }
+
+  if (search_mode_ == SearchMode::ALT) {
+    landmarks_.compute(
+      graph, num_landmarks_,
+      [this](const DirectionalEdge & edge) {return getLowerBoundCost(edge);});
+  }
+
+  if (search_mode_ == SearchMode::CONTRACTION_HIERARCHY) {
+    if (!static_costs || !valid_costs) {
+      RCLCPP_WARN(
+        logger_, "Graph edge costs are not all static and valid, so no contraction hierarchy "
+        "is computed and routes are found with Dijkstra's algorithm.");
+      return;
+    }
+
+    contraction_hierarchy_.compute(
+      graph, [](const DirectionalEdge & edge) {return edge.edge_cost.cost;});
+    RCLCPP_INFO(
+      logger_, "Computed a contraction hierarchy of the graph with %u shortcuts.",
+      contraction_hierarchy_.getNumShortcuts());
+  }
+}
+
+bool RoutePlanner::isPrepared(const Graph & graph)
+{
+  return prepared_graph_ == graph.data() && prepared_graph_size_ == graph.size();
+}
+
+float RoutePlanner::getLowerBoundCost(const DirectionalEdge & edge)
+{
+  // Edge costs that cannot be overridden are exact, scored costs are bounded by their length
+  if (!edge.edge_cost.overridable || edge_scorer_->numPlugins() == 0) {
+    return std::max(edge.edge_cost.cost, 0.0f);
+  }
+  return min_cost_per_meter_ * hypotf(
+    edge.end->coords.x - edge.start->coords.x,
+    edge.end->coords.y - edge.start->coords.y);
+}
+
 Route RoutePlanner::findRoute(
   Graph & graph, unsigned int start_index, unsigned int goal_index,
   const std::vector<unsigned int> & blocked_ids,
@@ -54,9 +158,19 @@ Route RoutePlanner::findRoute(
   // is valid when this function goes out of scope
   const NodePtr & start_node = &graph.at(start_index);
   const NodePtr & goal_node = &graph.at(goal_index);
-  findShortestGraphTraversal(graph, start_node, goal_node, blocked_ids, route_request);
+  if (!isPrepared(graph)) {
+    prepareGraph(graph);
+  }
 
-  EdgePtr & parent_edge = goal_node->search_state.parent_edge;
+  // The contraction hierarchy is of static costs, so cannot route around blocked IDs
+  if (!contraction_hierarchy_.empty() && blocked_ids.empty()) {
+    findContractedTraversal(graph, start_node, goal_node);
+  } else {
+    edge_scorer_->prepare();
+    findShortestGraphTraversal(graph, start_node, goal_node, blocked_ids, route_request);
+  }
+
+  EdgePtr & parent_edge = getSearchState(goal_node).parent_edge;
   if (!parent_edge) {
     throw nav2_core::NoValidRouteCouldBeFound("Could not find a route to the requested goal!");
   }
@@ -80,7 +194,53 @@ void RoutePlanner::resetSearchStates(Graph & graph)
   // is neglibably different to allocating & deallocating the complimentary blocks of memory
   for (unsigned int i = 0; i != graph.size(); i++) {
     graph[i].search_state.reset();
+    graph[i].search_state.search_id = 0;
+  }
+}
+
+void RoutePlanner::startSearch(Graph & graph, const NodePtr start_node, const NodePtr goal_node)
+{
+  // Rather than resetting every node, nodes are reset when first reached by the search.
+  // Identifiers only repeat once they wrap around, when all nodes are reset instead.
+  search_id_ = ++g_search_id;
+  while (search_id_ == 0) {
+    resetSearchStates(graph);
+    search_id_ = ++g_search_id;
+  }
+
+  graph_data_ = graph.data();
+  goal_node_ = goal_node;
+  start_id_ = start_node->nodeid;
+  goal_id_ = goal_node->nodeid;
+}
+
+SearchState & RoutePlanner::getSearchState(const NodePtr node)
+{
+  SearchState & state = node->search_state;
+  if (state.search_id != search_id_) {
+    state.reset();
+    state.search_id = search_id_;
+    state.heuristic_cost = getHeuristicCost(node);
   }
+  return state;
+}
+
+float RoutePlanner::getHeuristicCost(const NodePtr node)
+{
+  // The contraction hierarchy falls back to Dijkstra's algorithm when it cannot be used
+  if (search_mode_ != SearchMode::A_STAR && search_mode_ != SearchMode::ALT) {
+    return 0.0;
+  }
+
+  float cost = heuristic_cost_per_meter_ * hypotf(
+    goal_node_->coords.x - node->coords.x, goal_node_->coords.y - node->coords.y);
+  if (!landmarks_.empty()) {
+    cost = std::max(
+      cost, landmarks_.lowerBound(
+        static_cast<unsigned int>(node - graph_data_),
+        static_cast<unsigned int>(goal_node_ - graph_data_)));
+  }
+  return cost;
 }
 
 void RoutePlanner::findShortestGraphTraversal(
@@ -88,12 +248,13 @@ void RoutePlanner::findShortestGraphTraversal(
   const std::vector<unsigned int> & blocked_ids,
   const RouteRequest & route_request)
 {
-  // Setup the Dijkstra's search
-  resetSearchStates(graph);
-  start_id_ = start_node->nodeid;
-  goal_id_ = goal_node->nodeid;
-  start_node->search_state.integrated_cost = 0.0;
-  addNode(0.0, start_node);
+  // Setup the search, which is Dijkstra's algorithm if the heuristic costs are all zero.
+  // Nodes are queued by their cost plus heuristic cost, which is consistent, so a node
+  // is expanded at most once and the goal has its lowest cost when expanded.
+  startSearch(graph, start_node, goal_node);
+  SearchState & start_state = getSearchState(start_node);
+  start_state.integrated_cost = 0.0;
+  addNode(start_state.heuristic_cost, start_node);
 
   NodePtr neighbor{nullptr};
   EdgePtr edge{nullptr};
@@ -103,12 +264,14 @@ void RoutePlanner::findShortestGraphTraversal(
     iterations++;
 
     // Get the next lowest cost node
-    auto [curr_cost, node] = getNextNode();
+    auto [curr_priority, node] = getNextNode();
 
     // This has been visited, thus already lowest cost
-    if (curr_cost != node->search_state.integrated_cost) {
+    const SearchState & state = node->search_state;
+    if (curr_priority != state.integrated_cost + state.heuristic_cost) {
       continue;
     }
+    const float curr_cost = state.integrated_cost;
 
     // We have the shortest path
     if (isGoal(node)) {
@@ -117,23 +280,25 @@ void RoutePlanner::findShortestGraphTraversal(
       return;
     }
 
-    // Expand to connected nodes
+    // Expand to connected nodes, scoring their edges at once
     EdgeVector & edges = getEdges(node);
+    getTraversalCosts(edges, blocked_ids, route_request);
     for (unsigned int edge_num = 0; edge_num != edges.size(); edge_num++) {
-      edge = &edges[edge_num];
-      neighbor = edge->end;
-
       // If edge is invalid (lane closed, occupied, etc), don't expand
-      if (!getTraversalCost(edge, traversal_cost, blocked_ids, route_request)) {
+      if (!edge_valid_[edge_num]) {
         continue;
       }
 
+      edge = &edges[edge_num];
+      neighbor = edge->end;
+      traversal_cost = edge_costs_[edge_num];
       potential_cost = curr_cost + traversal_cost;
-      if (potential_cost < neighbor->search_state.integrated_cost) {
-        neighbor->search_state.parent_edge = edge;
-        neighbor->search_state.integrated_cost = potential_cost;
-        neighbor->search_state.traversal_cost = traversal_cost;
-        addNode(potential_cost, neighbor);
+      SearchState & neighbor_state = getSearchState(neighbor);
+      if (potential_cost < neighbor_state.integrated_cost) {
+        neighbor_state.parent_edge = edge;
+        neighbor_state.integrated_cost = potential_cost;
+        neighbor_state.traversal_cost = traversal_cost;
+        addNode(potential_cost + neighbor_state.heuristic_cost, neighbor);
       }
     }
   }
@@ -145,31 +310,80 @@ void RoutePlanner::findShortestGraphTraversal(
   }
 }
 
-bool RoutePlanner::getTraversalCost(
-  const EdgePtr edge, float & score, const std::vector<unsigned int> & blocked_ids,
+void RoutePlanner::findContractedTraversal(
+  Graph & graph, const NodePtr start_node, const NodePtr goal_node)
+{
+  startSearch(graph, start_node, goal_node);
+  getSearchState(start_node).integrated_cost = 0.0;
+
+  EdgePtrVector edges;
+  if (!contraction_hierarchy_.findPath(
+      static_cast<unsigned int>(start_node - graph_data_),
+      static_cast<unsigned int>(goal_node - graph_data_), edges))
+  {
+    return;
+  }
+
+  // Store the route in the search states, as the graph search would
+  float cost = 0.0;
+  for (const EdgePtr & edge : edges) {
+    SearchState & state = getSearchState(edge->end);
+    cost += edge->edge_cost.cost;
+    state.parent_edge = edge;
+    state.integrated_cost = cost;
+    state.traversal_cost = edge->edge_cost.cost;
+  }
+}
+
+void RoutePlanner::getTraversalCosts(
+  EdgeVector & edges, const std::vector<unsigned int> & blocked_ids,
   const RouteRequest & route_request)
 {
-  // If edge or node is in the blocked list, don't expand
-  auto is_blocked = std::find_if(
-    blocked_ids.begin(), blocked_ids.end(),
-    [&](unsigned int id) {return id == edge->edgeid || id == edge->end->nodeid;});
-  if (is_blocked != blocked_ids.end()) {
-    return false;
-  }
-
-  // If an edge's cost is marked as not to be overridden by scoring plugins
-  // Or there are no scoring plugins, use the edge's cost, if it is valid (positive)
-  if (!edge->edge_cost.overridable || edge_scorer_->numPlugins() == 0) {
-    if (edge->edge_cost.cost <= 0.0) {
-      throw nav2_core::NoValidGraph(
-              "Edge " + std::to_string(edge->edgeid) +
-              " doesn't contain and cannot compute a valid edge cost!");
+  edge_costs_.resize(edges.size());
+  edge_valid_.assign(edges.size(), true);
+  batch_edges_.clear();
+  batch_edge_types_.clear();
+  batch_indices_.clear();
+
+  for (unsigned int i = 0; i != edges.size(); i++) {
+    EdgePtr edge = &edges[i];
+
+    // If edge or node is in the blocked list, don't expand
+    auto is_blocked = std::find_if(
+      blocked_ids.begin(), blocked_ids.end(),
+      [&](unsigned int id) {return id == edge->edgeid || id == edge->end->nodeid;});
+    if (is_blocked != blocked_ids.end()) {
+      edge_valid_[i] = false;
+      continue;
+    }
+
+    // If an edge's cost is marked as not to be overridden by scoring plugins
+    // Or there are no scoring plugins, use the edge's cost, if it is valid (positive)
+    if (!edge->edge_cost.overridable || edge_scorer_->numPlugins() == 0) {
+      if (edge->edge_cost.cost <= 0.0) {
+        throw nav2_core::NoValidGraph(
+                "Edge " + std::to_string(edge->edgeid) +
+                " doesn't contain and cannot compute a valid edge cost!");
+      }
+      edge_costs_[i] = edge->edge_cost.cost;
+      continue;
     }
-    score = edge->edge_cost.cost;
-    return true;
+
+    batch_edges_.push_back(edge);
+    batch_edge_types_.push_back(classifyEdge(edge));
+    batch_indices_.push_back(i);
+  }
+
+  if (batch_edges_.empty()) {
+    return;
   }
 
-  return edge_scorer_->score(edge, route_request, classifyEdge(edge), score);
+  edge_scorer_->scoreBatch(
+    batch_edges_, route_request, batch_edge_types_, batch_costs_, batch_valid_);
+  for (unsigned int j = 0; j != batch_edges_.size(); j++) {
+    edge_costs_[batch_indices_[j]] = batch_costs_[j];
+    edge_valid_[batch_indices_[j]] = batch_valid_[j];
+  }
 }
 
 NodeElement RoutePlanner::getNextNode()
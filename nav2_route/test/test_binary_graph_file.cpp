@@ -0,0 +1,279 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <ament_index_cpp/get_package_share_directory.hpp>
+
+#include "nav2_ros_common/node_utils.hpp"
+#include "nav2_route/plugins/graph_file_loaders/binary_graph_file_loader.hpp"
+#include "nav2_route/plugins/graph_file_loaders/geojson_graph_file_loader.hpp"
+#include "nav2_route/plugins/graph_file_savers/binary_graph_file_saver.hpp"
+
+class RclCppFixture
+{
+public:
+  RclCppFixture() {rclcpp::init(0, nullptr);}
+  ~RclCppFixture() {rclcpp::shutdown();}
+};
+RclCppFixture g_rclcppfixture;
+
+using namespace nav2_route; // NOLINT
+
+Graph createTestGraph()
+{
+  Graph graph(3);
+  for (unsigned int i = 0; i != graph.size(); i++) {
+    graph[i].nodeid = 10 + i;
+    graph[i].coords.x = 1.5f * i;
+    graph[i].coords.y = -2.0f * i;
+  }
+  graph[2].coords.frame_id = "odom";
+
+  Metadata nested;
+  std::string name = "josh";
+  int altitude = -10;
+  nested.setValue("name", name);
+  nested.setValue("altitude", altitude);
+
+  Metadata node_metadata;
+  float speed_limit = 0.85f;
+  bool can_drive = true;
+  unsigned int count = 7u;
+  std::vector<std::any> array = {0.5f, 1, std::string("b"), false};
+  node_metadata.setValue("speed_limit", speed_limit);
+  node_metadata.setValue("can_drive", can_drive);
+  node_metadata.setValue("count", count);
+  node_metadata.setValue("array", array);
+  node_metadata.setValue("person", nested);
+  graph[0].metadata = node_metadata;
+
+  Operation operation;
+  operation.type = "open_door";
+  operation.trigger = OperationTrigger::ON_EXIT;
+  operation.metadata = nested;
+  graph[1].operations.push_back(operation);
+
+  EdgeCost cost;
+  cost.cost = 6.0f;
+  cost.overridable = false;
+  Metadata edge_metadata;
+  edge_metadata.setValue("speed_limit", speed_limit);
+  graph[0].addEdge(cost, &graph[1], 20, edge_metadata, {operation});
+  EdgeCost default_cost;
+  graph[1].addEdge(default_cost, &graph[2], 21);
+  graph[2].addEdge(default_cost, &graph[0], 22);
+  return graph;
+}
+
+void expectMetadataEq(const Metadata & a, const Metadata & b)
+{
+  ASSERT_EQ(a.data.size(), b.data.size());
+  for (const auto & [key, value] : a.data) {
+    auto it = b.data.find(key);
+    ASSERT_NE(it, b.data.end());
+    ASSERT_EQ(value.type(), it->second.type());
+  }
+}
+
+void expectGraphEq(const Graph & a, const Graph & b)
+{
+  ASSERT_EQ(a.size(), b.size());
+  for (unsigned int i = 0; i != a.size(); i++) {
+    EXPECT_EQ(a[i].nodeid, b[i].nodeid);
+    EXPECT_EQ(a[i].coords.frame_id, b[i].coords.frame_id);
+    EXPECT_EQ(a[i].coords.x, b[i].coords.x);
+    EXPECT_EQ(a[i].coords.y, b[i].coords.y);
+    expectMetadataEq(a[i].metadata, b[i].metadata);
+    ASSERT_EQ(a[i].operations.size(), b[i].operations.size());
+    ASSERT_EQ(a[i].neighbors.size(), b[i].neighbors.size());
+    for (unsigned int j = 0; j != a[i].neighbors.size(); j++) {
+      const DirectionalEdge & edge_a = a[i].neighbors[j];
+      const DirectionalEdge & edge_b = b[i].neighbors[j];
+      EXPECT_EQ(edge_a.edgeid, edge_b.edgeid);
+      EXPECT_EQ(edge_b.start, &b[i]);
+      EXPECT_EQ(edge_a.end->nodeid, edge_b.end->nodeid);
+      EXPECT_EQ(edge_a.edge_cost.cost, edge_b.edge_cost.cost);
+      EXPECT_EQ(edge_a.edge_cost.overridable, edge_b.edge_cost.overridable);
+      expectMetadataEq(edge_a.metadata, edge_b.metadata);
+      EXPECT_EQ(edge_a.operations.size(), edge_b.operations.size());
+    }
+  }
+}
+
+TEST(BinaryGraphFile, test_file_empty)
+{
+  Graph graph;
+  BinaryGraphFileSaver saver;
+  EXPECT_FALSE(saver.saveGraphToFile(graph, ""));
+
+  GraphToIDMap graph_to_id_map;
+  BinaryGraphFileLoader loader;
+  EXPECT_FALSE(loader.loadGraphFromFile(graph, graph_to_id_map, "does_not_exist.navgraph"));
+}
+
+TEST(BinaryGraphFile, test_round_trip)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("graph_file_test");
+  BinaryGraphFileSaver saver;
+  BinaryGraphFileLoader loader;
+  saver.configure(node);
+  loader.configure(node);
+
+  Graph graph = createTestGraph();
+  ASSERT_TRUE(saver.saveGraphToFile(graph, "graph.navgraph"));
+
+  Graph loaded_graph;
+  GraphToIDMap graph_to_id_map;
+  ASSERT_TRUE(loader.loadGraphFromFile(loaded_graph, graph_to_id_map, "graph.navgraph"));
+  expectGraphEq(graph, loaded_graph);
+  EXPECT_EQ(graph_to_id_map.size(), 3u);
+  EXPECT_EQ(graph_to_id_map[12], 2u);
+
+  // Check the metadata values and operations in detail
+  const Metadata & metadata = loaded_graph[0].metadata;
+  float default_float = 0.0f;
+  bool default_bool = false;
+  unsigned int default_uint = 0u;
+  EXPECT_EQ(metadata.getValue<float>("speed_limit", default_float), 0.85f);
+  EXPECT_TRUE(metadata.getValue<bool>("can_drive", default_bool));
+  EXPECT_EQ(metadata.getValue<unsigned int>("count", default_uint), 7u);
+  auto array = std::any_cast<std::vector<std::any>>(metadata.data.at("array"));
+  ASSERT_EQ(array.size(), 4u);
+  EXPECT_EQ(std::any_cast<float>(array[0]), 0.5f);
+  EXPECT_EQ(std::any_cast<int>(array[1]), 1);
+  EXPECT_EQ(std::any_cast<std::string>(array[2]), "b");
+  EXPECT_FALSE(std::any_cast<bool>(array[3]));
+  Metadata person = std::any_cast<Metadata>(metadata.data.at("person"));
+  std::string default_string;
+  int default_int = 0;
+  EXPECT_EQ(person.getValue<std::string>("name", default_string), "josh");
+  EXPECT_EQ(person.getValue<int>("altitude", default_int), -10);
+
+  const Operation & operation = loaded_graph[0].neighbors[0].operations[0];
+  EXPECT_EQ(operation.type, "open_door");
+  EXPECT_EQ(operation.trigger, OperationTrigger::ON_EXIT);
+  EXPECT_EQ(operation.metadata.data.size(), 2u);
+}
+
+TEST(BinaryGraphFile, test_deleted_nodes)
+{
+  BinaryGraphFileSaver saver;
+  BinaryGraphFileLoader loader;
+
+  // "Deleted" nodes and the edges to them are not saved
+  Graph graph = createTestGraph();
+  graph[2].nodeid = std::numeric_limits<int>::max();
+  ASSERT_TRUE(saver.saveGraphToFile(graph, "graph.navgraph"));
+
+  Graph loaded_graph;
+  GraphToIDMap graph_to_id_map;
+  ASSERT_TRUE(loader.loadGraphFromFile(loaded_graph, graph_to_id_map, "graph.navgraph"));
+  ASSERT_EQ(loaded_graph.size(), 2u);
+  EXPECT_EQ(loaded_graph[0].neighbors.size(), 1u);
+  EXPECT_TRUE(loaded_graph[1].neighbors.empty());
+}
+
+TEST(BinaryGraphFile, test_corrupt_files)
+{
+  BinaryGraphFileSaver saver;
+  BinaryGraphFileLoader loader;
+  Graph graph = createTestGraph();
+  ASSERT_TRUE(saver.saveGraphToFile(graph, "graph.navgraph"));
+
+  std::ifstream file("graph.navgraph", std::ios::binary);
+  std::vector<char> contents((std::istreambuf_iterator<char>(file)), {});
+  file.close();
+
+  auto write = [](const std::vector<char> & data) {
+      std::ofstream corrupt_file("corrupt.navgraph", std::ios::binary | std::ios::trunc);
+      corrupt_file.write(data.data(), data.size());
+    };
+
+  // The graph is left untouched on failure
+  Graph loaded_graph = createTestGraph();
+  GraphToIDMap graph_to_id_map;
+
+  // Not a binary graph file
+  std::vector<char> bad_magic = contents;
+  bad_magic[0] = 'X';
+  write(bad_magic);
+  EXPECT_FALSE(loader.loadGraphFromFile(loaded_graph, graph_to_id_map, "corrupt.navgraph"));
+
+  // Unsupported version
+  std::vector<char> bad_version = contents;
+  bad_version[offsetof(binary_graph::Header, version)]++;
+  write(bad_version);
+  EXPECT_FALSE(loader.loadGraphFromFile(loaded_graph, graph_to_id_map, "corrupt.navgraph"));
+
+  // Truncated sections
+  write(std::vector<char>(contents.begin(), contents.end() - 8));
+  EXPECT_FALSE(loader.loadGraphFromFile(loaded_graph, graph_to_id_map, "corrupt.navgraph"));
+
+  // Edge ending at a node that does not exist
+  binary_graph::Header header;
+  std::memcpy(&header, contents.data(), sizeof(header));
+  std::vector<char> bad_edge = contents;
+  binary_graph::EdgeRecord edge;
+  std::memcpy(&edge, bad_edge.data() + header.edges.offset, sizeof(edge));
+  edge.end = 100;
+  std::memcpy(bad_edge.data() + header.edges.offset, &edge, sizeof(edge));
+  write(bad_edge);
+  EXPECT_FALSE(loader.loadGraphFromFile(loaded_graph, graph_to_id_map, "corrupt.navgraph"));
+
+  // Nested metadata referring back to itself
+  std::vector<char> bad_metadata = contents;
+  for (unsigned int i = 0; i != header.values.count; i++) {
+    binary_graph::ValueRecord value;
+    char * ptr = bad_metadata.data() + header.values.offset + i * sizeof(value);
+    std::memcpy(&value, ptr, sizeof(value));
+    if (value.type == binary_graph::ValueType::METADATA) {
+      value.data = 0;
+      std::memcpy(ptr, &value, sizeof(value));
+    }
+  }
+  write(bad_metadata);
+  EXPECT_FALSE(loader.loadGraphFromFile(loaded_graph, graph_to_id_map, "corrupt.navgraph"));
+
+  EXPECT_EQ(loaded_graph.size(), 3u);
+  EXPECT_TRUE(graph_to_id_map.empty());
+}
+
+TEST(BinaryGraphFile, test_sample_graph)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("graph_file_test");
+  GeoJsonGraphFileLoader geojson_loader;
+  BinaryGraphFileSaver saver;
+  BinaryGraphFileLoader loader;
+  geojson_loader.configure(node);
+  saver.configure(node);
+  loader.configure(node);
+
+  // Converted graphs load identically to the geojson graph
+  for (const std::string name : {"sample_graph", "aws_graph", "turtlebot4_graph"}) {
+    Graph graph, loaded_graph;
+    GraphToIDMap graph_to_id_map, loaded_graph_to_id_map;
+    const std::string filepath =
+      ament_index_cpp::get_package_share_directory("nav2_route") + "/graphs/" + name + ".geojson";
+    ASSERT_TRUE(geojson_loader.loadGraphFromFile(graph, graph_to_id_map, filepath));
+    ASSERT_TRUE(saver.saveGraphToFile(graph, name + ".navgraph"));
+    ASSERT_TRUE(loader.loadGraphFromFile(loaded_graph, loaded_graph_to_id_map, name + ".navgraph"));
+    expectGraphEq(graph, loaded_graph);
+    EXPECT_EQ(graph_to_id_map, loaded_graph_to_id_map);
+  }
+}
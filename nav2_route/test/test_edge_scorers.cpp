@@ -957,3 +957,181 @@ TEST(EdgeScorersTest, test_start_pose_orientation_scoring)
       &edge, route_request, edge_type,
       traversal_cost), nav2_core::InvalidEdgeScorerUse);
 }
+
+TEST(EdgeScorersTest, test_batch_scoring_cache)
+{
+  // Test the cached batch scoring of the DistanceScorer, invalidated per edge
+  // by the DynamicEdgesScorer when edges are closed or adjusted
+  auto node = std::make_shared<nav2::LifecycleNode>("route_server");
+  auto node_thread = std::make_unique<nav2::NodeThread>(node);
+  auto node2 = std::make_shared<rclcpp::Node>("my_node2");
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer;
+  std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> costmap_subscriber;
+  EdgeScorer scorer(node, tf_buffer, costmap_subscriber);
+  EXPECT_EQ(scorer.numPlugins(), 2);  // default DistanceScorer, AdjustEdgesScorer
+
+  // Create edges of lengths 1, 2 and 3 to score
+  Node n1, n2, n3, n4;
+  n2.coords.x = 1.0;
+  n3.coords.x = 3.0;
+  n4.coords.x = 6.0;
+  std::vector<DirectionalEdge> edges(3);
+  edges[0].start = &n1;
+  edges[0].end = &n2;
+  edges[1].start = &n2;
+  edges[1].end = &n3;
+  edges[2].start = &n3;
+  edges[2].end = &n4;
+  EdgePtrVector edge_ptrs;
+  for (unsigned int i = 0; i != edges.size(); i++) {
+    edges[i].edgeid = 10 + i;
+    edge_ptrs.push_back(&edges[i]);
+  }
+
+  RouteRequest route_request;
+  std::vector<EdgeType> edge_types(edges.size(), EdgeType::NONE);
+  std::vector<float> scores;
+  std::vector<bool> valid;
+  scorer.prepare();
+  scorer.scoreBatch(edge_ptrs, route_request, edge_types, scores, valid);
+  ASSERT_EQ(scores.size(), 3u);
+  for (unsigned int i = 0; i != edges.size(); i++) {
+    EXPECT_TRUE(valid[i]);
+    EXPECT_NEAR(scores[i], i + 1.0, 1e-4);
+  }
+
+  // Scores are cached, so moving a node keeps the scores until the cache is cleared
+  n4.coords.x = 7.0;
+  scorer.prepare();
+  scorer.scoreBatch(edge_ptrs, route_request, edge_types, scores, valid);
+  EXPECT_NEAR(scores[2], 3.0, 1e-4);
+  scorer.clearCache();
+  scorer.prepare();
+  scorer.scoreBatch(edge_ptrs, route_request, edge_types, scores, valid);
+  EXPECT_NEAR(scores[2], 4.0, 1e-4);
+
+  // Close and adjust edges, which only invalidates their cached scores
+  n4.coords.x = 6.0;
+  auto srv_client =
+    nav2::ServiceClient<nav2_msgs::srv::DynamicEdges>(
+    "route_server/DynamicEdgesScorer/adjust_edges", node2);
+  auto req = std::make_shared<nav2_msgs::srv::DynamicEdges::Request>();
+  req->closed_edges.push_back(10u);
+  req->adjust_edges.resize(1);
+  req->adjust_edges[0].edgeid = 11u;
+  req->adjust_edges[0].cost = 42.0;
+  auto resp = srv_client.invoke(req, std::chrono::nanoseconds(1000000000));
+  EXPECT_TRUE(resp->success);
+
+  scorer.prepare();
+  scorer.scoreBatch(edge_ptrs, route_request, edge_types, scores, valid);
+  EXPECT_FALSE(valid[0]);
+  EXPECT_TRUE(valid[1]);
+  EXPECT_NEAR(scores[1], 44.0, 1e-4);
+  EXPECT_TRUE(valid[2]);
+  EXPECT_NEAR(scores[2], 4.0, 1e-4);
+
+  // Scoring a single edge bypasses the cache
+  float traversal_cost = -1;
+  EXPECT_TRUE(scorer.score(&edges[2], route_request, EdgeType::NONE, traversal_cost));
+  EXPECT_NEAR(traversal_cost, 3.0, 1e-4);
+
+  // Re-open the closed edge
+  auto req2 = std::make_shared<nav2_msgs::srv::DynamicEdges::Request>();
+  req2->opened_edges.push_back(10u);
+  auto resp2 = srv_client.invoke(req2, std::chrono::nanoseconds(1000000000));
+  EXPECT_TRUE(resp2->success);
+
+  scorer.prepare();
+  scorer.scoreBatch(edge_ptrs, route_request, edge_types, scores, valid);
+  EXPECT_TRUE(valid[0]);
+  EXPECT_NEAR(scores[0], 1.0, 1e-4);
+
+  node_thread.reset();
+}
+
+TEST(EdgeScorersTest, test_costmap_scoring_cache)
+{
+  // Test that cached costmap scores are invalidated only within changed regions
+  auto node = std::make_shared<nav2::LifecycleNode>("edge_scorer_test");
+  node->declare_parameter("costmap_topic", "dummy_topic");
+  auto node_thread = std::make_unique<nav2::NodeThread>(node);
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer;
+
+  node->declare_parameter(
+    "edge_cost_functions", rclcpp::ParameterValue(std::vector<std::string>{"CostmapScorer"}));
+  nav2::declare_parameter_if_not_declared(
+    node, "CostmapScorer.plugin",
+    rclcpp::ParameterValue(std::string{"nav2_route::CostmapScorer"}));
+
+  std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> costmap_subscriber;
+  EdgeScorer scorer(node, tf_buffer, costmap_subscriber);
+
+  // Create edges along the bottom and top of the costmap
+  Node n1, n2, n3, n4;
+  n1.coords.x = 1.0;
+  n1.coords.y = 1.0;
+  n2.coords.x = 9.0;
+  n2.coords.y = 1.0;
+  n3.coords.x = 1.0;
+  n3.coords.y = 9.0;
+  n4.coords.x = 9.0;
+  n4.coords.y = 9.0;
+  std::vector<DirectionalEdge> edges(2);
+  edges[0].edgeid = 10;
+  edges[0].start = &n1;
+  edges[0].end = &n2;
+  edges[1].edgeid = 11;
+  edges[1].start = &n3;
+  edges[1].end = &n4;
+  EdgePtrVector edge_ptrs{&edges[0], &edges[1]};
+
+  RouteRequest route_request;
+  std::vector<EdgeType> edge_types(edges.size(), EdgeType::NONE);
+  std::vector<float> scores;
+  std::vector<bool> valid;
+
+  // Without a costmap, edges are invalid
+  scorer.prepare();
+  scorer.scoreBatch(edge_ptrs, route_request, edge_types, scores, valid);
+  EXPECT_FALSE(valid[0]);
+  EXPECT_FALSE(valid[1]);
+
+  // Create a demo costmap, free but for a row of cost 100 between the edges
+  nav2_costmap_2d::Costmap2D * costmap =
+    new nav2_costmap_2d::Costmap2D(100, 100, 0.1, 0.0, 0.0, 0);
+  for (unsigned int i = 0; i != 100; i++) {
+    costmap->setCost(i, 50, 100);
+  }
+  nav2_costmap_2d::Costmap2DPublisher publisher(
+    node, costmap, "map", "global_costmap/costmap", true);
+  publisher.on_activate();
+  publisher.publishCostmap();
+  rclcpp::Rate r(10);
+  r.sleep();
+
+  // Once received, all edges are rescored
+  scorer.prepare();
+  scorer.scoreBatch(edge_ptrs, route_request, edge_types, scores, valid);
+  EXPECT_TRUE(valid[0]);
+  EXPECT_TRUE(valid[1]);
+  EXPECT_EQ(scores[0], 0.0);
+  EXPECT_EQ(scores[1], 0.0);
+
+  // Raise the cost along the bottom edge. Also move the top edge onto the unchanged
+  // row of cost 100, which is not rescored as its cached score is not invalidated.
+  for (unsigned int i = 0; i != 100; i++) {
+    costmap->setCost(i, 10, 100);
+  }
+  publisher.publishCostmap();
+  r.sleep();
+  n3.coords.y = 5.05;
+  n4.coords.y = 5.05;
+
+  scorer.prepare();
+  scorer.scoreBatch(edge_ptrs, route_request, edge_types, scores, valid);
+  EXPECT_NEAR(scores[0], 100.0 / 253.0, 0.01);
+  EXPECT_EQ(scores[1], 0.0);
+
+  node_thread.reset();
+}
@@ -224,3 +224,234 @@ TEST(RoutePlannerTest, test_route_planner_negative)
       graph, start, goal, blocked_ids,
       route_request), nav2_core::NoValidGraph);
 }
+
+inline Graph createGridGraph(unsigned int dim)
+{
+  // A grid of bidirectional edges with varying static costs and some missing or
+  // one directional edges, so that searches have unique and non-trivial routes
+  Graph graph;
+  graph.resize(dim * dim);
+  for (unsigned int j = 0; j != dim; j++) {
+    for (unsigned int i = 0; i != dim; i++) {
+      Node & node = graph[j * dim + i];
+      node.nodeid = j * dim + i + 1;
+      node.coords.x = i;
+      node.coords.y = j;
+    }
+  }
+
+  unsigned int edgeid = dim * dim + 1;
+  auto add_edge = [&](unsigned int from, unsigned int to) {
+      EdgeCost cost;
+      cost.cost = 1.0 + static_cast<float>((from * 7 + to * 13) % 10) / 10.0;
+      graph[from].addEdge(cost, &graph[to], edgeid++);
+    };
+  for (unsigned int j = 0; j != dim; j++) {
+    for (unsigned int i = 0; i != dim; i++) {
+      const unsigned int idx = j * dim + i;
+      if (i + 1 < dim && (i + j) % 7 != 3) {
+        add_edge(idx, idx + 1);
+        if ((i * j) % 5 != 1) {
+          add_edge(idx + 1, idx);
+        }
+      }
+      if (j + 1 < dim && (i + 2 * j) % 9 != 4) {
+        add_edge(idx, idx + dim);
+        add_edge(idx + dim, idx);
+      }
+    }
+  }
+  return graph;
+}
+
+TEST(RoutePlannerTest, test_search_modes)
+{
+  RouteRequest route_request;
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer;
+  std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> collision_checker;
+  const std::vector<std::string> modes = {"dijkstra", "a_star", "alt", "contraction_hierarchy"};
+
+  // Score edges by the default edge scorers and by their static costs alone
+  for (bool use_scorers : {true, false}) {
+    std::vector<std::unique_ptr<RoutePlanner>> planners;
+    for (const auto & mode : modes) {
+      auto node = std::make_shared<nav2::LifecycleNode>("router_test");
+      node->declare_parameter("search_mode", rclcpp::ParameterValue(mode));
+      if (!use_scorers) {
+        node->declare_parameter(
+          "edge_cost_functions", rclcpp::ParameterValue(std::vector<std::string>{}));
+      }
+      planners.push_back(std::make_unique<RoutePlanner>());
+      planners.back()->configure(node, tf_buffer, collision_checker);
+    }
+
+    Graph graph = createGridGraph(15);
+    for (auto & planner : planners) {
+      planner->prepareGraph(graph);
+    }
+
+    // All modes find routes of the same optimal cost, with and without blocked IDs
+    unsigned int seed = 1u;
+    for (unsigned int i = 0; i != 100; i++) {
+      unsigned int start = rand_r(&seed) % graph.size();
+      unsigned int goal = rand_r(&seed) % graph.size();
+      if (start == goal) {
+        continue;
+      }
+      std::vector<unsigned int> blocked_ids;
+      if (i % 2 == 0) {
+        blocked_ids.push_back(graph[rand_r(&seed) % graph.size()].nodeid);
+        const auto & edges = graph[rand_r(&seed) % (graph.size() - 1)].neighbors;
+        if (!edges.empty()) {
+          blocked_ids.push_back(edges.front().edgeid);
+        }
+      }
+
+      bool found = true;
+      float cost = 0.0;
+      try {
+        cost = planners[0]->findRoute(
+          graph, start, goal, blocked_ids, route_request).route_cost;
+      } catch (nav2_core::NoValidRouteCouldBeFound &) {
+        found = false;
+      }
+
+      for (unsigned int j = 1; j != planners.size(); j++) {
+        if (!found) {
+          EXPECT_THROW(
+            planners[j]->findRoute(graph, start, goal, blocked_ids, route_request),
+            nav2_core::NoValidRouteCouldBeFound);
+          continue;
+        }
+
+        Route route = planners[j]->findRoute(graph, start, goal, blocked_ids, route_request);
+        EXPECT_NEAR(route.route_cost, cost, 1e-3);
+        ASSERT_FALSE(route.edges.empty());
+        EXPECT_EQ(route.edges.front()->start, &graph[start]);
+        EXPECT_EQ(route.edges.back()->end, &graph[goal]);
+        for (unsigned int k = 1; k < route.edges.size(); k++) {
+          EXPECT_EQ(route.edges[k - 1]->end, route.edges[k]->start);
+        }
+      }
+    }
+  }
+}
+
+TEST(RoutePlannerTest, test_graph_landmarks)
+{
+  Graph graph = createGridGraph(10);
+  auto static_cost = [](const DirectionalEdge & edge) {return edge.edge_cost.cost;};
+  GraphLandmarks landmarks;
+  EXPECT_TRUE(landmarks.empty());
+  landmarks.compute(graph, 4, static_cost);
+  EXPECT_EQ(landmarks.getLandmarks().size(), 4u);
+
+  // Landmarks are spread out, the first being a corner of the grid
+  const unsigned int corner = landmarks.getLandmarks().front();
+  EXPECT_TRUE(corner == 0u || corner == 9u || corner == 90u || corner == 99u);
+
+  // Lower bounds are admissible, exact to and from landmarks
+  auto node = std::make_shared<nav2::LifecycleNode>("router_test");
+  node->declare_parameter(
+    "edge_cost_functions", rclcpp::ParameterValue(std::vector<std::string>{}));
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer;
+  std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> collision_checker;
+  RoutePlanner planner;
+  planner.configure(node, tf_buffer, collision_checker);
+  RouteRequest route_request;
+  std::vector<unsigned int> blocked_ids;
+  for (unsigned int goal = 0; goal != graph.size(); goal++) {
+    if (goal == corner) {
+      continue;
+    }
+    try {
+      Route route = planner.findRoute(graph, corner, goal, blocked_ids, route_request);
+      EXPECT_NEAR(landmarks.lowerBound(corner, goal), route.route_cost, 1e-3);
+    } catch (nav2_core::NoValidRouteCouldBeFound &) {
+    }
+  }
+
+  landmarks.clear();
+  EXPECT_TRUE(landmarks.empty());
+  EXPECT_EQ(landmarks.lowerBound(0, 99), 0.0);
+}
+
+TEST(RoutePlannerTest, test_contraction_hierarchy)
+{
+  Graph graph = create4x4Graph();
+  for (auto & node : graph) {
+    for (auto & edge : node.neighbors) {
+      edge.edge_cost.cost = 1.0;
+    }
+  }
+
+  ContractionHierarchy hierarchy;
+  EdgePtrVector edges;
+  EXPECT_TRUE(hierarchy.empty());
+  EXPECT_FALSE(hierarchy.findPath(0, 15, edges));
+
+  hierarchy.compute(graph, [](const DirectionalEdge & edge) {return edge.edge_cost.cost;});
+  EXPECT_FALSE(hierarchy.empty());
+
+  // Shortcuts are unpacked into the graph edges of the route
+  EXPECT_TRUE(hierarchy.findPath(0, 15, edges));
+  EXPECT_EQ(edges.size(), 6u);
+  EXPECT_EQ(edges.front()->start, &graph[0]);
+  EXPECT_EQ(edges.back()->end, &graph[15]);
+  for (unsigned int i = 1; i < edges.size(); i++) {
+    EXPECT_EQ(edges[i - 1]->end, edges[i]->start);
+  }
+
+  // Node 16 is only reachable in one direction
+  EXPECT_FALSE(hierarchy.findPath(15, 0, edges));
+  EXPECT_TRUE(edges.empty());
+
+  hierarchy.clear();
+  EXPECT_TRUE(hierarchy.empty());
+}
+
+TEST(RoutePlannerTest, test_contraction_hierarchy_fallback)
+{
+  RouteRequest route_request;
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer;
+  std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> collision_checker;
+  auto node = std::make_shared<nav2::LifecycleNode>("router_test");
+  node->declare_parameter("search_mode", rclcpp::ParameterValue("contraction_hierarchy"));
+  node->declare_parameter("max_iterations", rclcpp::ParameterValue(5));
+  RoutePlanner planner;
+  planner.configure(node, tf_buffer, collision_checker);
+  std::vector<unsigned int> blocked_ids;
+
+  // With the default scorers, edges are scored dynamically so Dijkstra's algorithm is used,
+  // which runs out of iterations
+  Graph graph = create4x4Graph();
+  EXPECT_THROW(
+    planner.findRoute(graph, 0u, 15u, blocked_ids, route_request), nav2_core::TimedOut);
+
+  // With static edge costs, the hierarchy is used regardless of the iterations
+  for (auto & graph_node : graph) {
+    for (auto & edge : graph_node.neighbors) {
+      edge.edge_cost.cost = 1.0;
+      edge.edge_cost.overridable = false;
+    }
+  }
+  planner.prepareGraph(graph);
+  Route route = planner.findRoute(graph, 0u, 15u, blocked_ids, route_request);
+  EXPECT_NEAR(route.route_cost, 6.0, 0.001);
+  EXPECT_EQ(route.edges.size(), 6u);
+
+  // But not with blocked IDs, as the hierarchy cannot route around them
+  blocked_ids.push_back(19u);
+  EXPECT_THROW(
+    planner.findRoute(graph, 0u, 15u, blocked_ids, route_request), nav2_core::TimedOut);
+}
+
+TEST(RoutePlannerTest, test_invalid_search_mode)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("router_test");
+  node->declare_parameter("search_mode", rclcpp::ParameterValue("bfs"));
+  std::shared_ptr<tf2_ros::Buffer> tf_buffer;
+  std::shared_ptr<nav2_costmap_2d::CostmapSubscriber> collision_checker;
+  RoutePlanner planner;
+  EXPECT_THROW(planner.configure(node, tf_buffer, collision_checker), std::runtime_error);
+}
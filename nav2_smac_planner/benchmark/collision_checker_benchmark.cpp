@@ -0,0 +1,233 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ament_index_cpp/get_package_share_directory.hpp"
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_costmap_2d/costmap_2d_ros.hpp"
+#include "nav2_costmap_2d/inflation_layer.hpp"
+#include "nav2_ros_common/lifecycle_node.hpp"
+#include "nav2_smac_planner/a_star.hpp"
+#include "nav2_smac_planner/collision_checker.hpp"
+#include "nav2_smac_planner/utils.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+class RosLockGuard
+{
+public:
+  RosLockGuard() {rclcpp::init(0, nullptr);}
+  ~RosLockGuard() {rclcpp::shutdown();}
+};
+
+RosLockGuard g_rclcpp;
+
+// 50m x 50m warehouse at 5cm resolution, with rows of racks between 1.1m wide aisles
+// that leave a 0.9m x 0.5m robot 0.3m to either side
+constexpr unsigned int kSize = 1000;
+constexpr double kResolution = 0.05;
+constexpr unsigned int kRackWidth = 20;
+constexpr unsigned int kAisleWidth = 22;
+constexpr unsigned int kCrossAisle = 100;
+
+bool inRack(const unsigned int & x, const unsigned int & y)
+{
+  // Racks with a cross aisle through their middle
+  const bool in_cross_aisle = x > kSize / 2 - kCrossAisle / 2 && x < kSize / 2 + kCrossAisle / 2;
+  return x >= kCrossAisle && x < kSize - kCrossAisle && !in_cross_aisle &&
+         y % (kRackWidth + kAisleWidth) < kRackWidth;
+}
+
+float aisleCenter(const unsigned int & aisle)
+{
+  return static_cast<float>(aisle * (kRackWidth + kAisleWidth) + kRackWidth + kAisleWidth / 2);
+}
+
+nav2_costmap_2d::Footprint makeFootprint()
+{
+  nav2_costmap_2d::Footprint footprint(4);
+  footprint[0].x = 0.45;
+  footprint[0].y = 0.25;
+  footprint[1].x = 0.45;
+  footprint[1].y = -0.25;
+  footprint[2].x = -0.45;
+  footprint[2].y = -0.25;
+  footprint[3].x = -0.45;
+  footprint[3].y = 0.25;
+  return footprint;
+}
+
+std::shared_ptr<nav2_costmap_2d::Costmap2DROS> makeNarrowAisles()
+{
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->set_parameter(rclcpp::Parameter("resolution", kResolution));
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  auto inflation_layer = nav2_costmap_2d::InflationLayer::getInflationLayer(costmap_ros);
+
+  // Inflate the racks from the cells at their edges, as the inflation layer would
+  nav2_costmap_2d::Costmap2D warehouse(kSize, kSize, kResolution, 0.0, 0.0, 0);
+  const int radius = static_cast<int>(inflation_layer->getInflationRadius() / kResolution);
+  auto in_rack = [](int x, int y) {
+      return x < 0 || y < 0 || x >= static_cast<int>(kSize) || y >= static_cast<int>(kSize) ||
+             inRack(x, y);
+    };
+  for (int y = 0; y < static_cast<int>(kSize); ++y) {
+    for (int x = 0; x < static_cast<int>(kSize); ++x) {
+      if (!inRack(x, y)) {
+        continue;
+      }
+      warehouse.setCost(x, y, nav2_costmap_2d::LETHAL_OBSTACLE);
+      if (in_rack(x - 1, y) && in_rack(x + 1, y) && in_rack(x, y - 1) && in_rack(x, y + 1)) {
+        continue;
+      }
+      for (int dy = -radius; dy <= radius; ++dy) {
+        for (int dx = -radius; dx <= radius; ++dx) {
+          const double distance = std::hypot(dx, dy);
+          if (distance > radius || in_rack(x + dx, y + dy)) {
+            continue;
+          }
+          const unsigned char cost = inflation_layer->computeCost(distance);
+          if (cost > warehouse.getCost(x + dx, y + dy)) {
+            warehouse.setCost(x + dx, y + dy, cost);
+          }
+        }
+      }
+    }
+  }
+
+  *costmap_ros->getCostmap() = warehouse;
+  return costmap_ros;
+}
+
+std::unique_ptr<nav2_smac_planner::GridCollisionChecker> makeCollisionChecker(
+  std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros,
+  const nav2::LifecycleNode::SharedPtr & node, const bool & use_footprint_circles)
+{
+  // The circumscribed cost of the footprint, rather than of the costmap's default footprint
+  const nav2_costmap_2d::Footprint footprint = makeFootprint();
+  double circumscribed_radius = 0.0;
+  for (const auto & point : footprint) {
+    circumscribed_radius = std::max(circumscribed_radius, std::hypot(point.x, point.y));
+  }
+  auto inflation_layer = nav2_costmap_2d::InflationLayer::getInflationLayer(costmap_ros);
+  const double possible_collision_cost = inflation_layer->computeCost(
+    circumscribed_radius / kResolution);
+
+  auto checker = std::make_unique<nav2_smac_planner::GridCollisionChecker>(costmap_ros, 72, node);
+  checker->setFootprint(
+    footprint, false, possible_collision_cost,
+    use_footprint_circles ?
+    nav2_smac_planner::findObstacleDistances(costmap_ros) : std::vector<float>());
+  return checker;
+}
+
+// Arguments are if the footprint's circles are checked before the full footprint
+static void BM_InCollision(benchmark::State & state)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("collision_checker_benchmark");
+  auto costmap_ros = makeNarrowAisles();
+  auto checker = makeCollisionChecker(costmap_ros, node, state.range(0));
+
+  // Poses anywhere in the aisles, at any heading, as expanded by a search through them
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> x_dist(kCrossAisle, kSize - kCrossAisle);
+  std::uniform_real_distribution<float> y_dist(
+    -static_cast<float>(kAisleWidth) / 2.0f, static_cast<float>(kAisleWidth) / 2.0f);
+  std::uniform_int_distribution<unsigned int> aisle_dist(0, kSize / (kRackWidth + kAisleWidth) - 2);
+  std::uniform_int_distribution<unsigned int> bin_dist(0, 71);
+  std::vector<std::array<float, 3>> poses(4096);
+  for (auto & pose : poses) {
+    pose = {x_dist(generator), aisleCenter(aisle_dist(generator)) + y_dist(generator),
+      static_cast<float>(bin_dist(generator))};
+  }
+
+  std::size_t i = 0;
+  int collisions = 0;
+  for (auto _ : state) {
+    const auto & pose = poses[i++ % poses.size()];
+    const bool in_collision = checker->inCollision(pose[0], pose[1], pose[2], true);
+    collisions += in_collision;
+    benchmark::DoNotOptimize(in_collision);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.counters["collisions"] = benchmark::Counter(
+    collisions, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_InCollision)->Arg(0)->Arg(1);
+
+template<typename NodeT>
+void plan(
+  benchmark::State & state, const nav2_smac_planner::SearchInfo & info,
+  const nav2_smac_planner::MotionModel & motion_model, const unsigned int & dim_3_size)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("collision_checker_benchmark");
+  auto costmap_ros = makeNarrowAisles();
+  auto checker = makeCollisionChecker(costmap_ros, node, state.range(0));
+
+  nav2_smac_planner::AStarAlgorithm<NodeT> a_star(motion_model, info);
+  int max_iterations = std::numeric_limits<int>::max();
+  a_star.initialize(true, max_iterations, 1000, 5000, 120.0, 401, dim_3_size);
+
+  auto cancel_checker = []() {return false;};
+  int iterations = 0;
+  for (auto _ : state) {
+    // Out of an aisle on one side of the cross aisle and into another on the other side
+    a_star.setCollisionChecker(checker.get());
+    a_star.setStart(kSize / 4.0f, aisleCenter(2), 0u);
+    a_star.setGoal(3.0f * kSize / 4.0f, aisleCenter(17), 0u);
+    typename NodeT::CoordinateVector path;
+    iterations = 0;
+    if (!a_star.createPath(path, iterations, 0.0, cancel_checker)) {
+      state.SkipWithError("Failed to find a path");
+      break;
+    }
+  }
+  state.counters["expansions"] = iterations;
+}
+
+// Arguments are if the footprint's circles are checked before the full footprint
+static void BM_PlanHybrid(benchmark::State & state)
+{
+  nav2_smac_planner::SearchInfo info;
+  info.minimum_turning_radius = 10;  // in grid coordinates, 0.5m
+  info.analytic_expansion_max_length = 60;  // in grid coordinates, 3m
+  plan<nav2_smac_planner::NodeHybrid>(
+    state, info, nav2_smac_planner::MotionModel::DUBIN, 72);
+}
+BENCHMARK(BM_PlanHybrid)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_PlanLattice(benchmark::State & state)
+{
+  nav2_smac_planner::SearchInfo info;
+  info.lattice_filepath =
+    ament_index_cpp::get_package_share_directory("nav2_smac_planner") +
+    "/sample_primitives/5cm_resolution/0.5m_turning_radius/ackermann/output.json";
+  info.minimum_turning_radius = 10;  // in grid coordinates, 0.5m
+  info.analytic_expansion_max_length = 60;  // in grid coordinates, 3m
+  plan<nav2_smac_planner::NodeLattice>(
+    state, info, nav2_smac_planner::MotionModel::STATE_LATTICE, 16);
+}
+BENCHMARK(BM_PlanLattice)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "ament_index_cpp/get_package_share_directory.hpp"
+#include "nav2_costmap_2d/cost_values.hpp"
+#include "nav2_costmap_2d/costmap_2d.hpp"
+#include "nav2_costmap_2d/costmap_2d_ros.hpp"
+#include "nav2_ros_common/lifecycle_node.hpp"
+#include "nav2_smac_planner/a_star.hpp"
+#include "nav2_smac_planner/collision_checker.hpp"
+#include "rclcpp/rclcpp.hpp"
+
+class RosLockGuard
+{
+public:
+  RosLockGuard() {rclcpp::init(0, nullptr);}
+  ~RosLockGuard() {rclcpp::shutdown();}
+};
+
+RosLockGuard g_rclcpp;
+
+// 50m x 50m warehouse at 5cm resolution, with rows of racks between 1.5m wide aisles
+constexpr unsigned int kSize = 1000;
+constexpr double kResolution = 0.05;
+constexpr unsigned int kRackWidth = 20;
+constexpr unsigned int kAisleWidth = 30;
+constexpr unsigned int kCrossAisle = 100;
+
+std::shared_ptr<nav2_costmap_2d::Costmap2DROS> makeWarehouse()
+{
+  nav2_costmap_2d::Costmap2D warehouse(kSize, kSize, kResolution, 0.0, 0.0, 0);
+  for (unsigned int x = kCrossAisle; x < kSize - kCrossAisle; ++x) {
+    for (unsigned int y = 0; y < kSize; ++y) {
+      // Racks with a cross aisle through their middle
+      const bool in_rack = (y % (kRackWidth + kAisleWidth)) < kRackWidth;
+      const bool in_cross_aisle = x > kSize / 2 - kCrossAisle / 4 &&
+        x < kSize / 2 + kCrossAisle / 4;
+      if (in_rack && !in_cross_aisle) {
+        warehouse.setCost(x, y, nav2_costmap_2d::LETHAL_OBSTACLE);
+      } else if (in_rack || y % (kRackWidth + kAisleWidth) < kRackWidth + 5) {
+        // Some cost near the racks
+        warehouse.setCost(x, y, 100);
+      }
+    }
+  }
+
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  *costmap_ros->getCostmap() = warehouse;
+  return costmap_ros;
+}
+
+template<typename NodeT>
+void plan(
+  benchmark::State & state, nav2_smac_planner::SearchInfo info,
+  const nav2_smac_planner::MotionModel & motion_model, const unsigned int & dim_3_size)
+{
+  info.open_set_type = state.range(0) ?
+    nav2_smac_planner::OpenSetType::RADIX_HEAP : nav2_smac_planner::OpenSetType::BINARY_HEAP;
+
+  auto node = std::make_shared<nav2::LifecycleNode>("smac_planner_benchmark");
+  auto costmap_ros = makeWarehouse();
+  nav2_smac_planner::GridCollisionChecker checker(costmap_ros, dim_3_size, node);
+  checker.setFootprint(nav2_costmap_2d::Footprint(), true, 0.0);
+
+  nav2_smac_planner::AStarAlgorithm<NodeT> a_star(motion_model, info);
+  int max_iterations = std::numeric_limits<int>::max();
+  a_star.initialize(false, max_iterations, 1000, 5000, 120.0, 401, dim_3_size);
+
+  auto cancel_checker = []() {return false;};
+  int iterations = 0;
+  for (auto _ : state) {
+    // From the bottom left to the top right corner, across all of the racks
+    a_star.setCollisionChecker(&checker);
+    a_star.setStart(50.0f, 10.0f, 0u);
+    a_star.setGoal(kSize - 50.0f, kSize - 10.0f, 0u);
+    typename NodeT::CoordinateVector path;
+    iterations = 0;
+    if (!a_star.createPath(path, iterations, 0.0, cancel_checker)) {
+      state.SkipWithError("Failed to find a path");
+      break;
+    }
+  }
+  state.counters["expansions"] = iterations;
+}
+
+// Arguments are if the radix heap is used as the open set instead of the binary heap
+static void BM_Plan2D(benchmark::State & state)
+{
+  nav2_smac_planner::SearchInfo info;
+  info.cost_penalty = 2.0;
+  plan<nav2_smac_planner::Node2D>(state, info, nav2_smac_planner::MotionModel::TWOD, 1);
+}
+BENCHMARK(BM_Plan2D)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_PlanHybrid(benchmark::State & state)
+{
+  nav2_smac_planner::SearchInfo info;
+  info.minimum_turning_radius = 10;  // in grid coordinates, 0.5m
+  info.analytic_expansion_max_length = 60;  // in grid coordinates, 3m
+  plan<nav2_smac_planner::NodeHybrid>(
+    state, info, nav2_smac_planner::MotionModel::DUBIN, 72);
+}
+BENCHMARK(BM_PlanHybrid)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_PlanLattice(benchmark::State & state)
+{
+  nav2_smac_planner::SearchInfo info;
+  info.lattice_filepath =
+    ament_index_cpp::get_package_share_directory("nav2_smac_planner") +
+    "/sample_primitives/5cm_resolution/0.5m_turning_radius/ackermann/output.json";
+  info.minimum_turning_radius = 10;  // in grid coordinates, 0.5m
+  info.analytic_expansion_max_length = 60;  // in grid coordinates, 3m
+  plan<nav2_smac_planner::NodeLattice>(
+    state, info, nav2_smac_planner::MotionModel::STATE_LATTICE, 16);
+}
+BENCHMARK(BM_PlanLattice)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
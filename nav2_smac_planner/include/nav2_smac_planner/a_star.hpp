@@ -26,12 +26,13 @@
 #include "nav2_costmap_2d/costmap_2d.hpp"
 #include "nav2_core/planner_exceptions.hpp"
 
-#include "nav2_smac_planner/thirdparty/robin_hood.h"
 #include "nav2_smac_planner/analytic_expansion.hpp"
 #include "nav2_smac_planner/node_2d.hpp"
 #include "nav2_smac_planner/node_hybrid.hpp"
 #include "nav2_smac_planner/node_lattice.hpp"
 #include "nav2_smac_planner/node_basic.hpp"
+#include "nav2_smac_planner/node_arena.hpp"
+#include "nav2_smac_planner/radix_heap.hpp"
 #include "nav2_smac_planner/goal_manager.hpp"
 #include "nav2_smac_planner/types.hpp"
 #include "nav2_smac_planner/constants.hpp"
@@ -48,7 +49,7 @@ class AStarAlgorithm
 {
 public:
   typedef NodeT * NodePtr;
-  typedef robin_hood::unordered_node_map<uint64_t, NodeT> Graph;
+  typedef NodeArena<NodeT> Graph;
   typedef std::vector<NodePtr> NodeVector;
   typedef std::pair<float, NodeBasic<NodeT>> NodeElement;
   typedef typename NodeT::Coordinates Coordinates;
@@ -71,6 +72,7 @@ public:
   };
 
   typedef std::priority_queue<NodeElement, std::vector<NodeElement>, NodeComparator> NodeQueue;
+  typedef RadixHeap<NodeBasic<NodeT>> NodeRadixQueue;
 
   /**
    * @brief A constructor for nav2_smac_planner::AStarAlgorithm
@@ -205,6 +207,12 @@ public:
    */
   GoalManagerT getGoalManager();
 
+  /**
+   * @brief Get the motion model and heuristic tables of this planner
+   * @return Reference to search context
+   */
+  typename NodeT::SearchContext & getSearchContext();
+
 protected:
   /**
    * @brief Get pointer to next goal in open set
@@ -243,6 +251,12 @@ protected:
    */
   inline void clearQueue();
 
+  /**
+   * @brief Check if the heuristic queue of nodes to search is empty
+   * @return If empty
+   */
+  inline bool isQueueEmpty();
+
   /**
    * @brief Clear graph of nodes searched
    */
@@ -275,17 +289,19 @@ protected:
   unsigned int _dim3_size;
   unsigned int _coarse_search_resolution;
   SearchInfo _search_info;
+  typename NodeT::SearchContext _search_context;
 
   NodePtr _start;
   GoalManagerT _goal_manager;
   Graph _graph;
   NodeQueue _queue;
+  NodeRadixQueue _radix_queue;
 
   MotionModel _motion_model;
   NodeHeuristicPair _best_heuristic_node;
 
   GridCollisionChecker * _collision_checker;
-  nav2_costmap_2d::Costmap2D * _costmap;
+  const nav2_costmap_2d::Costmap2D * _costmap;
   std::unique_ptr<AnalyticExpansion<NodeT>> _expander;
 };
 
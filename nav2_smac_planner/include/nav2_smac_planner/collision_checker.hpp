@@ -31,7 +31,7 @@ namespace nav2_smac_planner
  * @brief A costmap grid collision checker
  */
 class GridCollisionChecker
-  : public nav2_costmap_2d::FootprintCollisionChecker<nav2_costmap_2d::Costmap2D *>
+  : public nav2_costmap_2d::FootprintCollisionChecker<const nav2_costmap_2d::Costmap2D *>
 {
 public:
   /**
@@ -62,11 +62,17 @@ public:
    * @brief Set the footprint to use with collision checker
    * @param footprint The footprint to collision check against
    * @param radius Whether or not the footprint is a circle and use radius collision checking
+   * @param possible_collision_cost Cost below which the robot cannot be in collision
+   * @param obstacle_distances Least distance to a lethal obstacle of a cell of each cost,
+   * in meters, such as from findObstacleDistances(). If set, the footprint is checked with
+   * its decomposition into circles before the full footprint, which is only exact if every
+   * lethal cell of the costmap is inflated. Empty to only check the full footprint.
    */
   void setFootprint(
     const nav2_costmap_2d::Footprint & footprint,
     const bool & radius,
-    const double & possible_collision_cost);
+    const double & possible_collision_cost,
+    const std::vector<float> & obstacle_distances = std::vector<float>());
 
   /**
    * @brief Check if in collision with costmap and footprint at pose
@@ -113,6 +119,26 @@ public:
    */
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> getCostmapROS() {return costmap_ros_;}
 
+  /**
+   * @brief Check against a costmap snapshot, or the live costmap of costmap ros if null.
+   * The snapshot is held until the next call, so it stays valid for the search.
+   * @param snapshot Costmap snapshot to collision check against
+   */
+  void setCostmapSnapshot(std::shared_ptr<const nav2_costmap_2d::Costmap2D> snapshot);
+
+  /**
+   * @brief Get the full resolution costmap that planning is based on, the costmap
+   * snapshot if one is set or the live costmap otherwise
+   * @return Source costmap
+   */
+  const nav2_costmap_2d::Costmap2D * getSourceCostmap() const
+  {
+    if (snapshot_) {
+      return snapshot_.get();
+    }
+    return costmap_ros_ ? costmap_ros_->getCostmap() : nullptr;
+  }
+
   /**
    * @brief Check if value outside the range
    * @param min Minimum value of the range
@@ -123,13 +149,53 @@ public:
   bool outsideRange(const unsigned int & max, const float & value);
 
 protected:
+  /**
+   * @struct nav2_smac_planner::GridCollisionChecker::FootprintCircle
+   * @brief A circle of the decomposition of the footprint, relative to the robot pose
+   */
+  struct FootprintCircle
+  {
+    float x;
+    float y;
+    // Radius of the circle covering its part of the footprint
+    float radius;
+  };
+
+  /**
+   * @brief Decompose the footprint into circles, covering slices of it along its longest
+   * side that are no longer than half of its width
+   * @param footprint Footprint to decompose
+   * @return Circles of the footprint
+   */
+  static std::vector<FootprintCircle> decomposeFootprint(
+    const nav2_costmap_2d::Footprint & footprint);
+
+  /**
+   * @brief Check the circles of the footprint at a pose against the obstacle distances
+   * of the costs at their centers
+   * @param x X coordinate of pose to check against
+   * @param y Y coordinate of pose to check against
+   * @param angle_bin Angle bin number of pose to check against
+   * @return Whether the footprint is clear of obstacles, else the full footprint must
+   * be checked
+   */
+  bool footprintCirclesClear(
+    const float & x,
+    const float & y,
+    const float & angle_bin);
+
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros_;
+  std::shared_ptr<const nav2_costmap_2d::Costmap2D> snapshot_;
   std::vector<nav2_costmap_2d::Footprint> oriented_footprints_;
   nav2_costmap_2d::Footprint unoriented_footprint_;
   float center_cost_;
   bool footprint_is_radius_{false};
   std::vector<float> angles_;
   float possible_collision_cost_{-1};
+  std::vector<std::vector<FootprintCircle>> oriented_circles_;
+  // Furthest extent of the circles from the robot pose, in meters
+  float circles_extent_{0.0f};
+  std::vector<float> obstacle_distances_;
   rclcpp::Logger logger_{rclcpp::get_logger("SmacPlannerCollisionChecker")};
   rclcpp::Clock::SharedPtr clock_;
 };
@@ -36,6 +36,13 @@ enum class GoalHeadingMode
   ALL_DIRECTION = 3,
 };
 
+enum class OpenSetType
+{
+  UNKNOWN = 0,
+  BINARY_HEAP = 1,
+  RADIX_HEAP = 2,
+};
+
 inline std::string toString(const MotionModel & n)
 {
   switch (n) {
@@ -94,6 +101,29 @@ inline GoalHeadingMode fromStringToGH(const std::string & n)
   }
 }
 
+inline std::string toString(const OpenSetType & n)
+{
+  switch (n) {
+    case OpenSetType::BINARY_HEAP:
+      return "BINARY_HEAP";
+    case OpenSetType::RADIX_HEAP:
+      return "RADIX_HEAP";
+    default:
+      return "Unknown";
+  }
+}
+
+inline OpenSetType fromStringToOST(const std::string & n)
+{
+  if (n == "BINARY_HEAP") {
+    return OpenSetType::BINARY_HEAP;
+  } else if (n == "RADIX_HEAP") {
+    return OpenSetType::RADIX_HEAP;
+  } else {
+    return OpenSetType::UNKNOWN;
+  }
+}
+
 const float UNKNOWN_COST = 255.0;
 const float OCCUPIED_COST = 254.0;
 const float INSCRIBED_COST = 253.0;
@@ -54,7 +54,7 @@ public:
     const nav2::LifecycleNode::WeakPtr & node,
     const std::string & global_frame,
     const std::string & topic_name,
-    nav2_costmap_2d::Costmap2D * const costmap,
+    const nav2_costmap_2d::Costmap2D * costmap,
     const unsigned int & downsampling_factor,
     const bool & use_min_cost_neighbor = false);
 
@@ -73,6 +73,15 @@ public:
    */
   void on_cleanup();
 
+  /**
+   * @brief Set the costmap to downsample, such as a costmap snapshot
+   * @param costmap Costmap to downsample
+   */
+  void setCostmap(const nav2_costmap_2d::Costmap2D * costmap)
+  {
+    _costmap = costmap;
+  }
+
   /**
    * @brief Downsample the given costmap by the downsampling factor, and publish the downsampled costmap
    * @param downsampling_factor Multiplier for the costmap resolution
@@ -107,7 +116,7 @@ protected:
   unsigned int _downsampling_factor;
   bool _use_min_cost_neighbor;
   float _downsampled_resolution;
-  nav2_costmap_2d::Costmap2D * _costmap;
+  const nav2_costmap_2d::Costmap2D * _costmap;
   std::unique_ptr<nav2_costmap_2d::Costmap2D> _downsampled_costmap;
   std::unique_ptr<nav2_costmap_2d::Costmap2DPublisher> _downsampled_costmap_pub;
 };
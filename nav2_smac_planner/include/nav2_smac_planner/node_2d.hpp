@@ -28,6 +28,18 @@
 namespace nav2_smac_planner
 {
 
+/**
+ * @struct nav2_smac_planner::Node2DSearchContext
+ * @brief Neighborhood and cost settings of a single planner instance. Owned by the
+ * AStarAlgorithm and referenced by the nodes of its graph.
+ */
+struct Node2DSearchContext
+{
+  float cost_travel_multiplier{2.0f};
+  std::vector<int> neighbors_grid_offsets;
+  unsigned int size_x{0};
+};
+
 /**
  * @class nav2_smac_planner::Node2D
  * @brief Node2D implementation for graph
@@ -38,6 +50,7 @@ public:
   typedef Node2D * NodePtr;
   typedef std::unique_ptr<std::vector<Node2D>> Graph;
   typedef std::vector<NodePtr> NodeVector;
+  typedef Node2DSearchContext SearchContext;
 
   /**
    * @class nav2_smac_planner::Node2D::Coordinates
@@ -67,8 +80,9 @@ public:
   /**
    * @brief A constructor for nav2_smac_planner::Node2D
    * @param index The index of this node for self-reference
+   * @param search_context Settings of the planner this node belongs to
    */
-  explicit Node2D(const uint64_t index);
+  Node2D(const uint64_t index, SearchContext * search_context);
 
   /**
    * @brief A destructor for nav2_smac_planner::Node2D
@@ -229,25 +243,37 @@ public:
    * @param Index Index of point
    * @return coordinates of point
    */
-  static inline Coordinates getCoords(const uint64_t & index)
+  inline Coordinates getCoords(const uint64_t & index) const
   {
-    const unsigned int & size_x = _neighbors_grid_offsets[3];
+    const unsigned int & size_x = _search_context->size_x;
     return Coordinates(index % size_x, index / size_x);
   }
 
+  /**
+   * @brief Gets the search context of the planner this node belongs to
+   * @return Pointer to search context
+   */
+  inline SearchContext * getSearchContext() const
+  {
+    return _search_context;
+  }
+
   /**
    * @brief Get cost of heuristic of node
+   * @param context Search context to use, unused by 2D node
    * @param node Node index current
    * @param node Node index of new
    * @return Heuristic cost between the nodes
    */
   static float getHeuristicCost(
+    SearchContext & context,
     const Coordinates & node_coords,
     const CoordinateVector & goals_coords);
 
   /**
    * @brief Initialize the neighborhood to be used in A*
    * We support 4-connect (VON_NEUMANN) and 8-connect (MOORE)
+   * @param context Search context to initialize
    * @param neighborhood The desired neighborhood type
    * @param x_size_uint The total x size to find neighbors
    * @param y_size The total y size to find neighbors
@@ -255,6 +281,7 @@ public:
    * @param search_info Search parameters, unused by 2D node
    */
   static void initMotionModel(
+    SearchContext & context,
     const MotionModel & motion_model,
     unsigned int & size_x,
     unsigned int & size_y,
@@ -284,10 +311,9 @@ public:
 
   Node2D * parent;
   Coordinates pose;
-  static float cost_travel_multiplier;
-  static std::vector<int> _neighbors_grid_offsets;
 
 private:
+  SearchContext * _search_context;
   float _cell_cost;
   float _accumulated_cost;
   uint64_t _index;
@@ -0,0 +1,167 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_SMAC_PLANNER__NODE_ARENA_HPP_
+#define NAV2_SMAC_PLANNER__NODE_ARENA_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace nav2_smac_planner
+{
+
+/**
+ * @class nav2_smac_planner::NodeArena
+ * @brief Graph of search nodes indexed by node index, reused across planning requests.
+ * Nodes are kept in a pool which is never shrunk, so that their addresses stay valid
+ * and their memory is reused by later searches. The index lookup is split in pages which are
+ * only allocated when a node in them is first used. Clearing the graph increments a
+ * generation counter instead of touching the nodes, pages of a previous generation are
+ * reset lazily when accessed again.
+ */
+template<typename NodeT>
+class NodeArena
+{
+public:
+  typedef typename NodeT::SearchContext SearchContext;
+
+  /**
+   * @brief A constructor for nav2_smac_planner::NodeArena
+   * @param search_context Search context to construct nodes with
+   */
+  explicit NodeArena(SearchContext * search_context)
+  : _search_context(search_context),
+    _size(0),
+    _generation(1)
+  {
+  }
+
+  /**
+   * @brief Get a node of the graph, adding it if not yet in the graph
+   * @param index Node index
+   * @return Node pointer, valid until the graph is cleared
+   */
+  inline NodeT * add(const uint64_t & index)
+  {
+    NodeT * & slot = getSlot(index);
+    if (slot) {
+      return slot;
+    }
+
+    if (_size < _nodes.size()) {
+      _nodes[_size] = NodeT(index, _search_context);
+    } else {
+      _nodes.emplace_back(index, _search_context);
+    }
+    slot = &_nodes[_size++];
+    return slot;
+  }
+
+  /**
+   * @brief Get a node of the graph
+   * @param index Node index
+   * @return Node pointer, or nullptr if the node is not in the graph
+   */
+  inline NodeT * find(const uint64_t & index)
+  {
+    const uint64_t page = index >> kPageBits;
+    if (page >= _pages.size() || !_pages[page] || _pages[page]->generation != _generation) {
+      return nullptr;
+    }
+    return _pages[page]->slots[index & kPageMask];
+  }
+
+  /**
+   * @brief Remove all nodes from the graph, keeping their memory for reuse
+   */
+  void clear()
+  {
+    _size = 0;
+    if (++_generation == 0) {
+      // Wrapped around, so generations of pages could be mistaken for the current one
+      for (auto & page : _pages) {
+        if (page) {
+          page->generation = 0;
+        }
+      }
+      _generation = 1;
+    }
+  }
+
+  /**
+   * @brief Get if the graph is empty
+   * @return If empty
+   */
+  inline bool empty() const
+  {
+    return _size == 0;
+  }
+
+  /**
+   * @brief Get the number of nodes in the graph
+   * @return Number of nodes
+   */
+  inline std::size_t size() const
+  {
+    return _size;
+  }
+
+protected:
+  static constexpr unsigned int kPageBits = 10;
+  static constexpr uint64_t kPageSize = 1u << kPageBits;
+  static constexpr uint64_t kPageMask = kPageSize - 1;
+
+  struct Page
+  {
+    uint32_t generation{0};
+    std::array<NodeT *, kPageSize> slots;
+  };
+
+  /**
+   * @brief Get the lookup slot of an index, allocating or resetting its page if required
+   * @param index Node index
+   * @return Reference to the node pointer of the index, nullptr if not in the graph
+   */
+  inline NodeT * & getSlot(const uint64_t & index)
+  {
+    const uint64_t page_index = index >> kPageBits;
+    if (page_index >= _pages.size()) {
+      _pages.resize(page_index + 1);
+    }
+
+    std::unique_ptr<Page> & page = _pages[page_index];
+    if (!page) {
+      page = std::make_unique<Page>();
+    }
+    if (page->generation != _generation) {
+      page->slots.fill(nullptr);
+      page->generation = _generation;
+    }
+    return page->slots[index & kPageMask];
+  }
+
+  SearchContext * _search_context;
+  std::vector<std::unique_ptr<Page>> _pages;
+  std::deque<NodeT> _nodes;
+  std::size_t _size;
+  uint32_t _generation;
+};
+
+}  // namespace nav2_smac_planner
+
+#endif  // NAV2_SMAC_PLANNER__NODE_ARENA_HPP_
@@ -15,6 +15,7 @@
 #ifndef NAV2_SMAC_PLANNER__NODE_HYBRID_HPP_
 #define NAV2_SMAC_PLANNER__NODE_HYBRID_HPP_
 
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -117,18 +118,18 @@ struct HybridMotionTable
 
   MotionModel motion_model = MotionModel::UNKNOWN;
   MotionPoses projections;
-  unsigned int size_x;
-  unsigned int num_angle_quantization;
-  float num_angle_quantization_float;
-  float min_turning_radius;
-  float bin_size;
-  float change_penalty;
-  float non_straight_penalty;
-  float cost_penalty;
-  float reverse_penalty;
-  float travel_distance_reward;
-  bool downsample_obstacle_heuristic;
-  bool use_quadratic_cost_penalty;
+  unsigned int size_x{0};
+  unsigned int num_angle_quantization{0};
+  float num_angle_quantization_float{0.0f};
+  float min_turning_radius{0.0f};
+  float bin_size{0.0f};
+  float change_penalty{0.0f};
+  float non_straight_penalty{0.0f};
+  float cost_penalty{0.0f};
+  float reverse_penalty{0.0f};
+  float travel_distance_reward{0.0f};
+  bool downsample_obstacle_heuristic{false};
+  bool use_quadratic_cost_penalty{false};
   ompl::base::StateSpacePtr state_space;
   std::vector<std::vector<double>> delta_xs;
   std::vector<std::vector<double>> delta_ys;
@@ -136,6 +137,38 @@ struct HybridMotionTable
   std::vector<float> travel_costs;
 };
 
+/**
+ * @struct nav2_smac_planner::ObstacleHeuristicTable
+ * @brief Wavefront lookup and queue of the obstacle heuristic, continued to expand
+ * as needed during a search. Shared between Hybrid-A* and State Lattice.
+ */
+struct ObstacleHeuristicTable
+{
+  LookupTable lookup_table;
+  ObstacleHeuristicQueue queue;
+  std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros;
+  // Costmap snapshot being planned on, the live costmap of costmap_ros if null
+  const nav2_costmap_2d::Costmap2D * costmap{nullptr};
+  bool downsample{false};
+  bool use_quadratic_cost_penalty{false};
+};
+
+/**
+ * @struct nav2_smac_planner::HybridSearchContext
+ * @brief Motion model and heuristic tables of a single planner instance. Owned by the
+ * AStarAlgorithm and referenced by the nodes of its graph, so that independent planners
+ * can search concurrently without sharing state.
+ */
+struct HybridSearchContext
+{
+  HybridMotionTable motion_table;
+  float travel_distance_cost{sqrtf(2.0f)};
+  ObstacleHeuristicTable obstacle_heuristic;
+  // Dubin / Reeds-Shepp lookup and size for dereferencing
+  LookupTable dist_heuristic_lookup_table;
+  float size_lookup{25.0f};
+};
+
 /**
  * @class nav2_smac_planner::NodeHybrid
  * @brief NodeHybrid implementation for graph, Hybrid-A*
@@ -146,6 +179,7 @@ public:
   typedef NodeHybrid * NodePtr;
   typedef std::unique_ptr<std::vector<NodeHybrid>> Graph;
   typedef std::vector<NodePtr> NodeVector;
+  typedef HybridSearchContext SearchContext;
 
   /**
    * @class nav2_smac_planner::NodeHybrid::Coordinates
@@ -186,8 +220,9 @@ public:
   /**
    * @brief A constructor for nav2_smac_planner::NodeHybrid
    * @param index The index of this node for self-reference
+   * @param search_context Tables of the planner this node belongs to
    */
-  explicit NodeHybrid(const uint64_t index);
+  NodeHybrid(const uint64_t index, SearchContext * search_context);
 
   /**
    * @brief A destructor for nav2_smac_planner::NodeHybrid
@@ -299,6 +334,15 @@ public:
     return _index;
   }
 
+  /**
+   * @brief Gets the search context of the planner this node belongs to
+   * @return Pointer to search context
+   */
+  inline SearchContext * getSearchContext() const
+  {
+    return _search_context;
+  }
+
   /**
    * @brief Check if this node is valid
    * @param traverse_unknown If we can explore unknown nodes on the graph
@@ -337,17 +381,19 @@ public:
 
   /**
    * @brief Get index at coordinates
+   * @param context Search context to get the graph dimensions from
    * @param x X coordinate of point
    * @param y Y coordinate of point
    * @param angle Theta coordinate of point
    * @return Index
    */
   static inline uint64_t getIndex(
+    const SearchContext & context,
     const unsigned int & x, const unsigned int & y, const unsigned int & angle)
   {
     return getIndex(
-      x, y, angle, motion_table.size_x,
-      motion_table.num_angle_quantization);
+      x, y, angle, context.motion_table.size_x,
+      context.motion_table.num_angle_quantization);
   }
 
   /**
@@ -369,16 +415,19 @@ public:
 
   /**
    * @brief Get cost of heuristic of node
+   * @param context Search context to use
    * @param node Node index current
    * @param node Node index of new
    * @return Heuristic cost between the nodes
    */
   static float getHeuristicCost(
+    SearchContext & context,
     const Coordinates & node_coords,
     const CoordinateVector & goals_coords);
 
   /**
    * @brief Initialize motion models
+   * @param context Search context to initialize
    * @param motion_model Motion model enum to use
    * @param size_x Size of X of graph
    * @param size_y Size of y of graph
@@ -386,6 +435,7 @@ public:
    * @param search_info Search info to use
    */
   static void initMotionModel(
+    SearchContext & context,
     const MotionModel & motion_model,
     unsigned int & size_x,
     unsigned int & size_y,
@@ -394,6 +444,7 @@ public:
 
   /**
    * @brief Compute the SE2 distance heuristic
+   * @param context Search context to populate
    * @param lookup_table_dim Size, in costmap pixels, of the
    * each lookup table dimension to populate
    * @param motion_model Motion model to use for state space
@@ -401,6 +452,7 @@ public:
    * @param search_info Info containing minimum radius to use
    */
   static void precomputeDistanceHeuristic(
+    SearchContext & context,
     const float & lookup_table_dim,
     const MotionModel & motion_model,
     const unsigned int & dim_3_size,
@@ -408,17 +460,20 @@ public:
 
   /**
    * @brief Compute the Obstacle heuristic
+   * @param table Obstacle heuristic table to expand
    * @param node_coords Coordinates to get heuristic at
    * @param goal_coords Coordinates to compute heuristic to
    * @return heuristic Heuristic value
    */
   static float getObstacleHeuristic(
+    ObstacleHeuristicTable & table,
     const Coordinates & node_coords,
     const Coordinates & goal_coords,
     const float & cost_penalty);
 
   /**
    * @brief Compute the Distance heuristic
+   * @param context Search context to use
    * @param node_coords Coordinates to get heuristic at
    * @param goal_coords Coordinates to compute heuristic to
    * @param obstacle_heuristic Value of the obstacle heuristic to compute
@@ -426,16 +481,19 @@ public:
    * @return heuristic Heuristic value
    */
   static float getDistanceHeuristic(
+    const SearchContext & context,
     const Coordinates & node_coords,
     const Coordinates & goal_coords,
     const float & obstacle_heuristic);
 
   /**
    * @brief reset the obstacle heuristic state
+   * @param table Obstacle heuristic table to reset
    * @param costmap_ros Costmap to use
    * @param goal_coords Coordinates to start heuristic expansion at
    */
   static void resetObstacleHeuristic(
+    ObstacleHeuristicTable & table,
     std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros,
     const unsigned int & start_x, const unsigned int & start_y,
     const unsigned int & goal_x, const unsigned int & goal_y);
@@ -461,31 +519,11 @@ public:
    */
   bool backtracePath(CoordinateVector & path);
 
-  /**
-    * @brief Destroy shared pointer assets at the end of the process that don't
-    * require normal destruction handling
-    */
-  static void destroyStaticAssets()
-  {
-    costmap_ros.reset();
-  }
-
   NodeHybrid * parent;
   Coordinates pose;
 
-  // Constants required across all nodes but don't want to allocate more than once
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static float travel_distance_cost;
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static HybridMotionTable motion_table;
-  // Wavefront lookup and queue for continuing to expand as needed
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static LookupTable obstacle_heuristic_lookup_table;
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static ObstacleHeuristicQueue obstacle_heuristic_queue;
-
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros;
-  // Dubin / Reeds-Shepp lookup and size for dereferencing
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static LookupTable dist_heuristic_lookup_table;
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static float size_lookup;
-
 private:
+  SearchContext * _search_context;
   float _cell_cost;
   float _accumulated_cost;
   uint64_t _index;
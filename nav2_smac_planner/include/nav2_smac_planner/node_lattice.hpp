@@ -96,16 +96,16 @@ struct LatticeMotionTable
    */
   double getAngle(const double & theta);
 
-  unsigned int size_x;
-  unsigned int num_angle_quantization;
-  float change_penalty;
-  float non_straight_penalty;
-  float cost_penalty;
-  float reverse_penalty;
-  float travel_distance_reward;
-  float rotation_penalty;
-  float min_turning_radius;
-  bool allow_reverse_expansion;
+  unsigned int size_x{0};
+  unsigned int num_angle_quantization{0};
+  float change_penalty{0.0f};
+  float non_straight_penalty{0.0f};
+  float cost_penalty{0.0f};
+  float reverse_penalty{0.0f};
+  float travel_distance_reward{0.0f};
+  float rotation_penalty{0.0f};
+  float min_turning_radius{0.0f};
+  bool allow_reverse_expansion{false};
   std::vector<std::vector<MotionPrimitive>> motion_primitives;
   ompl::base::StateSpacePtr state_space;
   std::vector<TrigValues> trig_values;
@@ -114,6 +114,20 @@ struct LatticeMotionTable
   MotionModel motion_model = MotionModel::UNKNOWN;
 };
 
+/**
+ * @struct nav2_smac_planner::LatticeSearchContext
+ * @brief Motion primitives and heuristic tables of a single planner instance. Owned by
+ * the AStarAlgorithm and referenced by the nodes of its graph.
+ */
+struct LatticeSearchContext
+{
+  LatticeMotionTable motion_table;
+  ObstacleHeuristicTable obstacle_heuristic;
+  // Dubin / Reeds-Shepp lookup and size for dereferencing
+  LookupTable dist_heuristic_lookup_table;
+  float size_lookup{25.0f};
+};
+
 /**
  * @class nav2_smac_planner::NodeLattice
  * @brief NodeLattice implementation for graph, Hybrid-A*
@@ -126,12 +140,14 @@ public:
   typedef std::vector<NodePtr> NodeVector;
   typedef NodeHybrid::Coordinates Coordinates;
   typedef NodeHybrid::CoordinateVector CoordinateVector;
+  typedef LatticeSearchContext SearchContext;
 
   /**
    * @brief A constructor for nav2_smac_planner::NodeLattice
    * @param index The index of this node for self-reference
+   * @param search_context Tables of the planner this node belongs to
    */
-  explicit NodeLattice(const uint64_t index);
+  NodeLattice(const uint64_t index, SearchContext * search_context);
 
   /**
    * @brief A destructor for nav2_smac_planner::NodeLattice
@@ -233,6 +249,15 @@ public:
     return _index;
   }
 
+  /**
+   * @brief Gets the search context of the planner this node belongs to
+   * @return Pointer to search context
+   */
+  inline SearchContext * getSearchContext() const
+  {
+    return _search_context;
+  }
+
   /**
    * @brief Sets that this primitive is moving in reverse
    */
@@ -275,18 +300,20 @@ public:
 
   /**
    * @brief Get index at coordinates
+   * @param context Search context to get the graph dimensions from
    * @param x X coordinate of point
    * @param y Y coordinate of point
    * @param angle Theta coordinate of point
    * @return Index
    */
   static inline uint64_t getIndex(
+    const SearchContext & context,
     const unsigned int & x, const unsigned int & y, const unsigned int & angle)
   {
     // Hybrid-A* and State Lattice share a coordinate system
     return NodeHybrid::getIndex(
-      x, y, angle, motion_table.size_x,
-      motion_table.num_angle_quantization);
+      x, y, angle, context.motion_table.size_x,
+      context.motion_table.num_angle_quantization);
   }
 
   /**
@@ -309,16 +336,19 @@ public:
 
   /**
    * @brief Get cost of heuristic of node
+   * @param context Search context to use
    * @param node Node index current
    * @param node Node index of new
    * @return Heuristic cost between the nodes
    */
   static float getHeuristicCost(
+    SearchContext & context,
     const Coordinates & node_coords,
     const CoordinateVector & goals_coords);
 
   /**
    * @brief Initialize motion models
+   * @param context Search context to initialize
    * @param motion_model Motion model enum to use
    * @param size_x Size of X of graph
    * @param size_y Size of y of graph
@@ -326,6 +356,7 @@ public:
    * @param search_info Search info to use
    */
   static void initMotionModel(
+    SearchContext & context,
     const MotionModel & motion_model,
     unsigned int & size_x,
     unsigned int & size_y,
@@ -334,6 +365,7 @@ public:
 
   /**
    * @brief Compute the SE2 distance heuristic
+   * @param context Search context to populate
    * @param lookup_table_dim Size, in costmap pixels, of the
    * each lookup table dimension to populate
    * @param motion_model Motion model to use for state space
@@ -341,6 +373,7 @@ public:
    * @param search_info Info containing minimum radius to use
    */
   static void precomputeDistanceHeuristic(
+    SearchContext & context,
     const float & lookup_table_dim,
     const MotionModel & motion_model,
     const unsigned int & dim_3_size,
@@ -348,34 +381,39 @@ public:
 
   /**
    * @brief Compute the wavefront heuristic
+   * @param table Obstacle heuristic table to reset
    * @param costmap Costmap to use
    * @param goal_coords Coordinates to start heuristic expansion at
    */
   static void resetObstacleHeuristic(
+    ObstacleHeuristicTable & table,
     std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros,
     const unsigned int & start_x, const unsigned int & start_y,
     const unsigned int & goal_x, const unsigned int & goal_y)
   {
     // State Lattice and Hybrid-A* share this heuristics
-    NodeHybrid::resetObstacleHeuristic(costmap_ros, start_x, start_y, goal_x, goal_y);
+    NodeHybrid::resetObstacleHeuristic(table, costmap_ros, start_x, start_y, goal_x, goal_y);
   }
 
   /**
    * @brief Compute the Obstacle heuristic
+   * @param table Obstacle heuristic table to expand
    * @param node_coords Coordinates to get heuristic at
    * @param goal_coords Coordinates to compute heuristic to
    * @return heuristic Heuristic value
    */
   static float getObstacleHeuristic(
+    ObstacleHeuristicTable & table,
     const Coordinates & node_coords,
     const Coordinates & goal_coords,
     const double & cost_penalty)
   {
-    return NodeHybrid::getObstacleHeuristic(node_coords, goal_coords, cost_penalty);
+    return NodeHybrid::getObstacleHeuristic(table, node_coords, goal_coords, cost_penalty);
   }
 
   /**
    * @brief Compute the Distance heuristic
+   * @param context Search context to use
    * @param node_coords Coordinates to get heuristic at
    * @param goal_coords Coordinates to compute heuristic to
    * @param obstacle_heuristic Value of the obstacle heuristic to compute
@@ -383,6 +421,7 @@ public:
    * @return heuristic Heuristic value
    */
   static float getDistanceHeuristic(
+    SearchContext & context,
     const Coordinates & node_coords,
     const Coordinates & goal_coords,
     const float & obstacle_heuristic);
@@ -416,12 +455,9 @@ public:
 
   NodeLattice * parent;
   Coordinates pose;
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static LatticeMotionTable motion_table;
-  // Dubin / Reeds-Shepp lookup and size for dereferencing
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static LookupTable dist_heuristic_lookup_table;
-  NAV2_SMAC_PLANNER_COMMON_EXPORT static float size_lookup;
 
 private:
+  SearchContext * _search_context;
   float _cell_cost;
   float _accumulated_cost;
   uint64_t _index;
@@ -0,0 +1,172 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_SMAC_PLANNER__RADIX_HEAP_HPP_
+#define NAV2_SMAC_PLANNER__RADIX_HEAP_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace nav2_smac_planner
+{
+
+/**
+ * @class nav2_smac_planner::RadixHeap
+ * @brief A monotone priority queue on non-negative float keys. Elements are kept in
+ * buckets by the highest bit in which their key differs from the last popped key, so that
+ * pushing is constant time and each element is only moved a bounded number of times before
+ * being popped. Keys pushed below the last popped key, as with inconsistent heuristics,
+ * are clamped to it and popped next, which is where a binary heap would place them as well.
+ * Elements of equal keys are popped in LIFO order.
+ */
+template<typename T>
+class RadixHeap
+{
+public:
+  /**
+   * @brief A constructor for nav2_smac_planner::RadixHeap
+   */
+  RadixHeap()
+  : _last(0),
+    _size(0)
+  {
+  }
+
+  /**
+   * @brief Add an element to the heap
+   * @param key Priority of the element, lowest first
+   * @param value Element to add
+   */
+  inline void emplace(const float & key, const T & value)
+  {
+    const uint32_t bits = std::max(toBits(key), _last);
+    _buckets[getBucket(bits)].emplace_back(bits, value);
+    _size++;
+  }
+
+  /**
+   * @brief Get the element with the lowest key, the heap must not be empty
+   * @return Element with the lowest key
+   */
+  inline T & top()
+  {
+    refill();
+    return _buckets[0].back().second;
+  }
+
+  /**
+   * @brief Remove the element with the lowest key, the heap must not be empty
+   */
+  inline void pop()
+  {
+    refill();
+    _buckets[0].pop_back();
+    _size--;
+  }
+
+  /**
+   * @brief Get if the heap is empty
+   * @return If empty
+   */
+  inline bool empty() const
+  {
+    return _size == 0;
+  }
+
+  /**
+   * @brief Get the number of elements in the heap
+   * @return Number of elements
+   */
+  inline std::size_t size() const
+  {
+    return _size;
+  }
+
+  /**
+   * @brief Remove all elements, keeping the memory of the buckets for reuse
+   */
+  void clear()
+  {
+    for (auto & bucket : _buckets) {
+      bucket.clear();
+    }
+    _last = 0;
+    _size = 0;
+  }
+
+protected:
+  /**
+   * @brief Get the bit pattern of a key, which sorts as the key does for non-negative floats
+   * @param key Key to convert
+   * @return Bits of the key, with negative and NaN keys mapped to 0
+   */
+  static inline uint32_t toBits(const float & key)
+  {
+    if (!(key > 0.0f)) {
+      return 0;
+    }
+    uint32_t bits;
+    std::memcpy(&bits, &key, sizeof(bits));
+    return bits;
+  }
+
+  /**
+   * @brief Get the bucket of a key relative to the last popped key
+   * @param bits Bits of the key, not lower than the last popped key
+   * @return Bucket index
+   */
+  inline std::size_t getBucket(const uint32_t & bits) const
+  {
+    return bits == _last ? 0 : 32 - __builtin_clz(bits ^ _last);
+  }
+
+  /**
+   * @brief Move the elements of the lowest non-empty bucket into lower buckets
+   * relative to the lowest key among them, once the first bucket ran empty
+   */
+  inline void refill()
+  {
+    if (!_buckets[0].empty()) {
+      return;
+    }
+
+    std::size_t i = 1;
+    while (_buckets[i].empty()) {
+      i++;
+    }
+
+    auto & bucket = _buckets[i];
+    _last = std::min_element(
+      bucket.begin(), bucket.end(),
+      [](const Element & a, const Element & b) {return a.first < b.first;})->first;
+    for (auto & element : bucket) {
+      _buckets[getBucket(element.first)].push_back(std::move(element));
+    }
+    bucket.clear();
+  }
+
+  typedef std::pair<uint32_t, T> Element;
+
+  std::array<std::vector<Element>, 33> _buckets;
+  uint32_t _last;
+  std::size_t _size;
+};
+
+}  // namespace nav2_smac_planner
+
+#endif  // NAV2_SMAC_PLANNER__RADIX_HEAP_HPP_
@@ -113,6 +113,7 @@ protected:
   double _angle_bin_size;
   unsigned int _angle_quantizations;
   bool _allow_unknown;
+  bool _use_footprint_circles;
   int _max_iterations;
   int _max_on_approach_iterations;
   int _terminal_checking_interval;
@@ -108,6 +108,7 @@ protected:
   std::string _global_frame, _name;
   SearchInfo _search_info;
   bool _allow_unknown;
+  bool _use_footprint_circles;
   int _max_iterations;
   int _max_on_approach_iterations;
   int _terminal_checking_interval;
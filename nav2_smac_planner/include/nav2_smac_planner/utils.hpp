@@ -16,6 +16,8 @@
 #ifndef NAV2_SMAC_PLANNER__UTILS_HPP_
 #define NAV2_SMAC_PLANNER__UTILS_HPP_
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 #include <memory>
 #include <string>
@@ -24,6 +26,7 @@
 #include "geometry_msgs/msg/quaternion.hpp"
 #include "geometry_msgs/msg/pose.hpp"
 #include "tf2/utils.hpp"
+#include "nav2_costmap_2d/cost_values.hpp"
 #include "nav2_costmap_2d/costmap_2d_ros.hpp"
 #include "nav2_costmap_2d/inflation_layer.hpp"
 #include "visualization_msgs/msg/marker_array.hpp"
@@ -109,6 +112,61 @@ inline double findCircumscribedCost(std::shared_ptr<nav2_costmap_2d::Costmap2DRO
   return result;
 }
 
+/**
+* @brief Find the least distance to a lethal obstacle that a cell of each cost can be at,
+* as the inflation decay function gives a cell at least the cost of its distance. This is an
+* obstacle distance field read from the costs of the costmap, without computing one.
+* @param costmap Costmap2DROS to get the inflation layer of
+* @return distances in meters indexed by cost, or empty if there is no inflation layer or
+* lethal cells may not be inflated, as by layers after it or costmap filters
+*/
+inline std::vector<float> findObstacleDistances(
+  std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap)
+{
+  std::vector<float> distances;
+  const auto inflation_layer = nav2_costmap_2d::InflationLayer::getInflationLayer(costmap);
+  if (inflation_layer == nullptr) {
+    return distances;
+  }
+
+  // Layers after the inflation layer and filters, such as keepout zones, may set lethal
+  // costs next to cells with costs of any distance
+  const auto layered_costmap = costmap->getLayeredCostmap();
+  if (layered_costmap->getPlugins()->back() != inflation_layer ||
+    !layered_costmap->getFilters()->empty())
+  {
+    return distances;
+  }
+
+  // Cells further than the inflation radius from any obstacle may have any cost
+  const double resolution = costmap->getCostmap()->getResolution();
+  const double inflation_radius = inflation_layer->getInflationRadius();
+  const double cell_inflation_radius = inflation_radius / resolution;
+  distances.assign(
+    static_cast<unsigned int>(nav2_costmap_2d::NO_INFORMATION) + 1u,
+    static_cast<float>(inflation_radius));
+
+  // Cells are inflated by the distance between the centers of theirs and an obstacle's
+  const int max_offset = static_cast<int>(cell_inflation_radius);
+  for (int i = 0; i <= max_offset; i++) {
+    for (int j = 0; j <= i; j++) {
+      const double distance = std::hypot(i, j);
+      if (distance > cell_inflation_radius) {
+        break;
+      }
+      const unsigned char cost = inflation_layer->computeCost(distance);
+      distances[cost] = std::min(distances[cost], static_cast<float>(distance * resolution));
+    }
+  }
+
+  // Other layers may only raise costs, so a cell may be as close as for any lower cost
+  for (unsigned int cost = 1; cost < distances.size(); cost++) {
+    distances[cost] = std::min(distances[cost], distances[cost - 1]);
+  }
+
+  return distances;
+}
+
 /**
  * @brief convert json to lattice metadata
  * @param[in] json json object
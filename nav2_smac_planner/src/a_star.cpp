@@ -45,9 +45,9 @@ AStarAlgorithm<NodeT>::AStarAlgorithm(
   _search_info(search_info),
   _start(nullptr),
   _goal_manager(GoalManagerT()),
+  _graph(&_search_context),
   _motion_model(motion_model)
 {
-  _graph.reserve(100000);
 }
 
 template<typename NodeT>
@@ -71,7 +71,8 @@ void AStarAlgorithm<NodeT>::initialize(
   _terminal_checking_interval = terminal_checking_interval;
   _max_planning_time = max_planning_time;
   if (!_is_initialized) {
-    NodeT::precomputeDistanceHeuristic(lookup_table_size, _motion_model, dim_3_size, _search_info);
+    NodeT::precomputeDistanceHeuristic(
+      _search_context, lookup_table_size, _motion_model, dim_3_size, _search_info);
   }
   _is_initialized = true;
   _dim3_size = dim_3_size;
@@ -116,7 +117,8 @@ void AStarAlgorithm<NodeT>::setCollisionChecker(GridCollisionChecker * collision
   if (getSizeX() != x_size || getSizeY() != y_size) {
     _x_size = x_size;
     _y_size = y_size;
-    NodeT::initMotionModel(_motion_model, _x_size, _y_size, _dim3_size, _search_info);
+    NodeT::initMotionModel(
+      _search_context, _motion_model, _x_size, _y_size, _dim3_size, _search_info);
   }
   _expander->setCollisionChecker(_collision_checker);
 }
@@ -125,12 +127,7 @@ template<typename NodeT>
 typename AStarAlgorithm<NodeT>::NodePtr AStarAlgorithm<NodeT>::addToGraph(
   const uint64_t & index)
 {
-  auto iter = _graph.find(index);
-  if (iter != _graph.end()) {
-    return &(iter->second);
-  }
-
-  return &(_graph.emplace(index, NodeT(index)).first->second);
+  return _graph.add(index);
 }
 
 template<>
@@ -157,6 +154,7 @@ void AStarAlgorithm<NodeT>::setStart(
 {
   _start = addToGraph(
     NodeT::getIndex(
+      _search_context,
       static_cast<unsigned int>(mx),
       static_cast<unsigned int>(my),
       dim_3));
@@ -184,7 +182,7 @@ void AStarAlgorithm<NodeT>::populateExpansionsLog(
   expansions_log->emplace_back(
     _costmap->getOriginX() + ((coords.x + 0.5) * _costmap->getResolution()),
     _costmap->getOriginY() + ((coords.y + 0.5) * _costmap->getResolution()),
-    NodeT::motion_table.getAngleFromBin(coords.theta));
+    _search_context.motion_table.getAngleFromBin(coords.theta));
 }
 
 template<>
@@ -225,6 +223,9 @@ void AStarAlgorithm<NodeT>::setGoal(
   _goal_manager.clear();
   Coordinates ref_goal_coord(mx, my, static_cast<float>(dim_3));
 
+  // Expand the obstacle heuristic, also when cached, on the costmap being planned on
+  _search_context.obstacle_heuristic.costmap = _collision_checker->getSourceCostmap();
+
   if (!_search_info.cache_obstacle_heuristic ||
     _goal_manager.hasGoalChanged(ref_goal_coord))
   {
@@ -233,18 +234,20 @@ void AStarAlgorithm<NodeT>::setGoal(
     }
 
     NodeT::resetObstacleHeuristic(
-      _collision_checker->getCostmapROS(), _start->pose.x, _start->pose.y, mx, my);
+      _search_context.obstacle_heuristic, _collision_checker->getCostmapROS(),
+      _start->pose.x, _start->pose.y, mx, my);
   }
 
   _goal_manager.setRefGoalCoordinates(ref_goal_coord);
 
-  unsigned int num_bins = NodeT::motion_table.num_angle_quantization;
+  unsigned int num_bins = _search_context.motion_table.num_angle_quantization;
   // set goal based on heading mode
   switch (goal_heading_mode) {
     case GoalHeadingMode::DEFAULT: {
         // add a single goal node with single heading
         auto goal = addToGraph(
           NodeT::getIndex(
+            _search_context,
             static_cast<unsigned int>(mx),
             static_cast<unsigned int>(my),
             dim_3));
@@ -258,6 +261,7 @@ void AStarAlgorithm<NodeT>::setGoal(
         // add goal in original direction
         auto goal = addToGraph(
           NodeT::getIndex(
+            _search_context,
             static_cast<unsigned int>(mx),
             static_cast<unsigned int>(my),
             dim_3));
@@ -268,6 +272,7 @@ void AStarAlgorithm<NodeT>::setGoal(
         unsigned int opposite_heading = (dim_3 + (num_bins / 2)) % num_bins;
         auto opposite_goal = addToGraph(
           NodeT::getIndex(
+            _search_context,
             static_cast<unsigned int>(mx),
             static_cast<unsigned int>(my),
             opposite_heading));
@@ -285,6 +290,7 @@ void AStarAlgorithm<NodeT>::setGoal(
         for (unsigned int i = 0; i < num_bins; ++i) {
           auto goal = addToGraph(
             NodeT::getIndex(
+              _search_context,
               static_cast<unsigned int>(mx),
               static_cast<unsigned int>(my),
               i));
@@ -373,7 +379,7 @@ bool AStarAlgorithm<NodeT>::createPath(
       return true;
     };
 
-  while (iterations < getMaxIterations() && !_queue.empty()) {
+  while (iterations < getMaxIterations() && !isQueueEmpty()) {
     // Check for planning timeout and cancel only on every Nth iteration
     if (iterations % _terminal_checking_interval == 0) {
       if (cancel_checker()) {
@@ -422,7 +428,7 @@ bool AStarAlgorithm<NodeT>::createPath(
       // Optimization: Let us find when in tolerance and refine within reason
       approach_iterations++;
       if (approach_iterations >= getOnApproachMaxIterations()) {
-        return _graph.at(_best_heuristic_node.second).backtracePath(path);
+        return _graph.find(_best_heuristic_node.second)->backtracePath(path);
       }
     }
 
@@ -451,7 +457,7 @@ bool AStarAlgorithm<NodeT>::createPath(
 
   if (_best_heuristic_node.first < getToleranceHeuristic()) {
     // If we run out of search options, return the path that is closest, if within tolerance.
-    return _graph.at(_best_heuristic_node.second).backtracePath(path);
+    return _graph.find(_best_heuristic_node.second)->backtracePath(path);
   }
 
   return false;
@@ -466,8 +472,14 @@ typename AStarAlgorithm<NodeT>::NodePtr & AStarAlgorithm<NodeT>::getStart()
 template<typename NodeT>
 typename AStarAlgorithm<NodeT>::NodePtr AStarAlgorithm<NodeT>::getNextNode()
 {
-  NodeBasic<NodeT> node = _queue.top().second;
-  _queue.pop();
+  NodeBasic<NodeT> node(0);
+  if (_search_info.open_set_type == OpenSetType::RADIX_HEAP) {
+    node = _radix_queue.top();
+    _radix_queue.pop();
+  } else {
+    node = _queue.top().second;
+    _queue.pop();
+  }
   node.processSearchNode();
   return node.graph_node_ptr;
 }
@@ -477,7 +489,11 @@ void AStarAlgorithm<NodeT>::addNode(const float & cost, NodePtr & node)
 {
   NodeBasic<NodeT> queued_node(node->getIndex());
   queued_node.populateSearchNode(node);
-  _queue.emplace(cost, queued_node);
+  if (_search_info.open_set_type == OpenSetType::RADIX_HEAP) {
+    _radix_queue.emplace(cost, queued_node);
+  } else {
+    _queue.emplace(cost, queued_node);
+  }
 }
 
 template<typename NodeT>
@@ -485,7 +501,8 @@ float AStarAlgorithm<NodeT>::getHeuristicCost(const NodePtr & node)
 {
   const Coordinates node_coords =
     NodeT::getCoords(node->getIndex(), getSizeX(), getSizeDim3());
-  float heuristic = NodeT::getHeuristicCost(node_coords, _goal_manager.getGoalsCoordinates());
+  float heuristic = NodeT::getHeuristicCost(
+    _search_context, node_coords, _goal_manager.getGoalsCoordinates());
   if (heuristic < _best_heuristic_node.first) {
     _best_heuristic_node = {heuristic, node->getIndex()};
   }
@@ -504,14 +521,22 @@ void AStarAlgorithm<NodeT>::clearQueue()
 {
   NodeQueue q;
   std::swap(_queue, q);
+  _radix_queue.clear();
+}
+
+template<typename NodeT>
+bool AStarAlgorithm<NodeT>::isQueueEmpty()
+{
+  if (_search_info.open_set_type == OpenSetType::RADIX_HEAP) {
+    return _radix_queue.empty();
+  }
+  return _queue.empty();
 }
 
 template<typename NodeT>
 void AStarAlgorithm<NodeT>::clearGraph()
 {
-  Graph g;
-  std::swap(_graph, g);
-  _graph.reserve(100000);
+  _graph.clear();
 }
 
 template<typename NodeT>
@@ -562,6 +587,12 @@ typename AStarAlgorithm<NodeT>::GoalManagerT AStarAlgorithm<NodeT>::getGoalManag
   return _goal_manager;
 }
 
+template<typename NodeT>
+typename NodeT::SearchContext & AStarAlgorithm<NodeT>::getSearchContext()
+{
+  return _search_context;
+}
+
 // Instantiate algorithm for the supported template types
 template class AStarAlgorithm<Node2D>;
 template class AStarAlgorithm<NodeHybrid>;
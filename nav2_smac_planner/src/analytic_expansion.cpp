@@ -67,7 +67,8 @@ typename AnalyticExpansion<NodeT>::NodePtr AnalyticExpansion<NodeT>::tryAnalytic
 
     closest_distance = std::min(
       closest_distance,
-      static_cast<int>(NodeT::getHeuristicCost(node_coords, goals_coords)));
+      static_cast<int>(NodeT::getHeuristicCost(
+        *current_node->getSearchContext(), node_coords, goals_coords)));
     // We want to expand at a rate of d/expansion_ratio,
     // but check to see if we are so close that we would be expanding every iteration
     // If so, limit it to the expansion ratio (rounded up)
@@ -91,7 +92,7 @@ typename AnalyticExpansion<NodeT>::NodePtr AnalyticExpansion<NodeT>::tryAnalytic
         AnalyticExpansionNodes analytic_nodes =
           getAnalyticPath(
           current_node, current_goal_node, getter,
-          current_node->motion_table.state_space);
+          current_node->getSearchContext()->motion_table.state_space);
         if (!analytic_nodes.nodes.empty()) {
           found_valid_expansion = true;
           NodePtr node = current_node;
@@ -113,7 +114,7 @@ typename AnalyticExpansion<NodeT>::NodePtr AnalyticExpansion<NodeT>::tryAnalytic
           AnalyticExpansionNodes analytic_nodes =
             getAnalyticPath(
             current_node, current_goal_node, getter,
-            current_node->motion_table.state_space);
+            current_node->getSearchContext()->motion_table.state_space);
           if (!analytic_nodes.nodes.empty()) {
             NodePtr node = current_node;
             float score = refineAnalyticPath(
@@ -171,13 +172,13 @@ typename AnalyticExpansion<NodeT>::AnalyticExpansionNodes AnalyticExpansion<Node
   const NodeGetter & node_getter,
   const ompl::base::StateSpacePtr & state_space)
 {
-  static ompl::base::ScopedState<> from(state_space), to(state_space), s(state_space);
+  ompl::base::ScopedState<> from(state_space), to(state_space), s(state_space);
   from[0] = node->pose.x;
   from[1] = node->pose.y;
-  from[2] = node->motion_table.getAngleFromBin(node->pose.theta);
+  from[2] = node->getSearchContext()->motion_table.getAngleFromBin(node->pose.theta);
   to[0] = goal->pose.x;
   to[1] = goal->pose.y;
-  to[2] = node->motion_table.getAngleFromBin(goal->pose.theta);
+  to[2] = node->getSearchContext()->motion_table.getAngleFromBin(goal->pose.theta);
 
   float d = state_space->distance(from(), to());
 
@@ -224,10 +225,11 @@ typename AnalyticExpansion<NodeT>::AnalyticExpansionNodes AnalyticExpansion<Node
     // Make sure in range [0, 2PI)
     theta = (reals[2] < 0.0) ? (reals[2] + 2.0 * M_PI) : reals[2];
     theta = (theta > 2.0 * M_PI) ? (theta - 2.0 * M_PI) : theta;
-    angle = node->motion_table.getAngle(theta);
+    angle = node->getSearchContext()->motion_table.getAngle(theta);
 
     // Turn the pose into a node, and check if it is valid
     index = NodeT::getIndex(
+      *node->getSearchContext(),
       static_cast<unsigned int>(reals[0]),
       static_cast<unsigned int>(reals[1]),
       static_cast<unsigned int>(angle));
@@ -278,7 +280,7 @@ typename AnalyticExpansion<NodeT>::AnalyticExpansionNodes AnalyticExpansion<Node
       // (3) Handle exception: there may be no other option close to goal
       // if max cost is set too low (optional)
       if (failure) {
-        if (d < 2.0f * M_PI * goal->motion_table.min_turning_radius &&
+        if (d < 2.0f * M_PI * goal->getSearchContext()->motion_table.min_turning_radius &&
           _search_info.analytic_expansion_max_cost_override)
         {
           failure = false;
@@ -323,7 +325,7 @@ float AnalyticExpansion<NodeT>::refineAnalyticPath(
       refined_analytic_nodes =
         getAnalyticPath(
         test_node, goal_node, getter,
-        test_node->motion_table.state_space);
+        test_node->getSearchContext()->motion_table.state_space);
       if (refined_analytic_nodes.nodes.empty()) {
         break;
       }
@@ -353,7 +355,7 @@ float AnalyticExpansion<NodeT>::refineAnalyticPath(
       const float distance = hypotf(
       expansion.nodes[1].proposed_coords.x - expansion.nodes[0].proposed_coords.x,
       expansion.nodes[1].proposed_coords.y - expansion.nodes[0].proposed_coords.y);
-      const float & weight = expansion.nodes[0].node->motion_table.cost_penalty;
+      const float & weight = expansion.nodes[0].node->getSearchContext()->motion_table.cost_penalty;
       for (auto iter = expansion.nodes.begin(); iter != expansion.nodes.end(); ++iter) {
         normalized_cost = iter->node->getCost() / 252.0f;
         // Search's Traversal Cost Function
@@ -365,12 +367,12 @@ float AnalyticExpansion<NodeT>::refineAnalyticPath(
   float original_score = scoringFn(analytic_nodes);
   float best_score = original_score;
   float score = std::numeric_limits<float>::max();
-  float min_turn_rad = node->motion_table.min_turning_radius;
+  float min_turn_rad = node->getSearchContext()->motion_table.min_turning_radius;
   const float max_min_turn_rad = 4.0 * min_turn_rad;  // Up to 4x the turning radius
   while (min_turn_rad < max_min_turn_rad) {
     min_turn_rad += 0.5;  // In Grid Coords, 1/2 cell steps
     ompl::base::StateSpacePtr state_space;
-    if (node->motion_table.motion_model == MotionModel::DUBIN) {
+    if (node->getSearchContext()->motion_table.motion_model == MotionModel::DUBIN) {
       state_space = std::make_shared<ompl::base::DubinsStateSpace>(min_turn_rad);
     } else {
       state_space = std::make_shared<ompl::base::ReedsSheppStateSpace>(min_turn_rad);
@@ -414,7 +416,7 @@ typename AnalyticExpansion<NodeT>::NodePtr AnalyticExpansion<NodeT>::setAnalytic
     cleanNode(n);
     if (n->getIndex() != goal_node->getIndex()) {
       if (n->wasVisited()) {
-        _detached_nodes.push_back(std::make_unique<NodeT>(-1));
+        _detached_nodes.push_back(std::make_unique<NodeT>(-1, n->getSearchContext()));
         n = _detached_nodes.back().get();
       }
       n->parent = prev;
@@ -12,6 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License. Reserved.
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include "nav2_smac_planner/collision_checker.hpp"
 
 namespace nav2_smac_planner
@@ -40,6 +46,17 @@ GridCollisionChecker::GridCollisionChecker(
   }
 }
 
+void GridCollisionChecker::setCostmapSnapshot(
+  std::shared_ptr<const nav2_costmap_2d::Costmap2D> snapshot)
+{
+  snapshot_ = std::move(snapshot);
+  if (snapshot_) {
+    setCostmap(snapshot_.get());
+  } else if (costmap_ros_) {
+    setCostmap(costmap_ros_->getCostmap());
+  }
+}
+
 // GridCollisionChecker::GridCollisionChecker(
 //   nav2_costmap_2d::Costmap2D * costmap,
 //   std::vector<float> & angles)
@@ -51,7 +68,8 @@ GridCollisionChecker::GridCollisionChecker(
 void GridCollisionChecker::setFootprint(
   const nav2_costmap_2d::Footprint & footprint,
   const bool & radius,
-  const double & possible_collision_cost)
+  const double & possible_collision_cost,
+  const std::vector<float> & obstacle_distances)
 {
   possible_collision_cost_ = static_cast<float>(possible_collision_cost);
   if (possible_collision_cost_ <= 0.0f) {
@@ -66,6 +84,13 @@ void GridCollisionChecker::setFootprint(
 
   footprint_is_radius_ = radius;
 
+  // Indexed by cost, so only used if one is given for each
+  if (obstacle_distances.size() == static_cast<std::size_t>(UNKNOWN_COST) + 1u) {
+    obstacle_distances_ = obstacle_distances;
+  } else {
+    obstacle_distances_.clear();
+  }
+
   // Use radius, no caching required
   if (radius) {
     return;
@@ -78,10 +103,20 @@ void GridCollisionChecker::setFootprint(
 
   oriented_footprints_.clear();
   oriented_footprints_.reserve(angles_.size());
+  oriented_circles_.clear();
   double sin_th, cos_th;
   geometry_msgs::msg::Point new_pt;
   const unsigned int footprint_size = footprint.size();
 
+  const std::vector<FootprintCircle> circles = decomposeFootprint(footprint);
+  circles_extent_ = 0.0f;
+  for (const auto & circle : circles) {
+    circles_extent_ = std::max(circles_extent_, std::hypot(circle.x, circle.y) + circle.radius);
+  }
+  if (!circles.empty()) {
+    oriented_circles_.reserve(angles_.size());
+  }
+
   // Precompute the orientation bins for checking to use
   for (unsigned int i = 0; i != angles_.size(); i++) {
     sin_th = sin(angles_[i]);
@@ -96,6 +131,16 @@ void GridCollisionChecker::setFootprint(
     }
 
     oriented_footprints_.push_back(oriented_footprint);
+
+    if (!circles.empty()) {
+      std::vector<FootprintCircle> oriented_circles = circles;
+      for (auto & circle : oriented_circles) {
+        const float circle_x = circle.x;
+        circle.x = static_cast<float>(circle_x * cos_th - circle.y * sin_th);
+        circle.y = static_cast<float>(circle_x * sin_th + circle.y * cos_th);
+      }
+      oriented_circles_.push_back(oriented_circles);
+    }
   }
 
   unoriented_footprint_ = footprint;
@@ -135,6 +180,15 @@ bool GridCollisionChecker::inCollision(
       return true;
     }
 
+    // if possible inscribed, the circles of the footprint may still tell if it is clear
+    // of obstacles from a few costs, without checking the full footprint. Unknown space
+    // is not inflated, so is only known to be clear of it if it may be traversed.
+    if (traverse_unknown && !oriented_circles_.empty() && !obstacle_distances_.empty() &&
+      footprintCirclesClear(x, y, angle_bin))
+    {
+      return false;
+    }
+
     // if possible inscribed, need to check actual footprint pose.
     // Use precomputed oriented footprints are done on initialization,
     // offset by translation value to collision check
@@ -150,6 +204,21 @@ bool GridCollisionChecker::inCollision(
       current_footprint.push_back(new_pt);
     }
 
+    // The cells of the footprint's points are on its outline, and are where it most often
+    // meets obstacles the circles could not tell apart, such as racks beside an aisle
+    if (!obstacle_distances_.empty()) {
+      unsigned int mx, my;
+      for (const auto & point : current_footprint) {
+        if (!costmap_->worldToMap(point.x, point.y, mx, my)) {
+          return true;
+        }
+        const unsigned char cost = costmap_->getCost(mx, my);
+        if (cost == OCCUPIED_COST || (cost == UNKNOWN_COST && !traverse_unknown)) {
+          return true;
+        }
+      }
+    }
+
     float footprint_cost = static_cast<float>(footprintCost(current_footprint));
 
     if (footprint_cost == UNKNOWN_COST && traverse_unknown) {
@@ -169,6 +238,135 @@ bool GridCollisionChecker::inCollision(
   }
 }
 
+std::vector<GridCollisionChecker::FootprintCircle> GridCollisionChecker::decomposeFootprint(
+  const nav2_costmap_2d::Footprint & footprint)
+{
+  std::vector<FootprintCircle> circles;
+  if (footprint.size() < 3) {
+    return circles;
+  }
+
+  // Slice along the longest side of the bounding box, as u, and across it, as v
+  double min_x = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double min_y = min_x, max_y = max_x;
+  for (const auto & point : footprint) {
+    min_x = std::min(min_x, point.x);
+    max_x = std::max(max_x, point.x);
+    min_y = std::min(min_y, point.y);
+    max_y = std::max(max_y, point.y);
+  }
+  const bool along_x = max_x - min_x >= max_y - min_y;
+  const double min_u = along_x ? min_x : min_y;
+  const double length = along_x ? max_x - min_x : max_y - min_y;
+  const double width = along_x ? max_y - min_y : max_x - min_x;
+  if (width <= 0.0) {
+    return circles;
+  }
+
+  const unsigned int num_slices =
+    std::max(1u, static_cast<unsigned int>(std::ceil(2.0 * length / width - 1e-6)));
+  const double slice_length = length / num_slices;
+  std::vector<std::pair<double, double>> points;
+  for (unsigned int i = 0; i != num_slices; i++) {
+    const double u0 = min_u + i * slice_length;
+    const double u1 = u0 + slice_length;
+
+    // The part of the footprint in the slice is furthest from any point at the ends of
+    // the parts of its edges in the slice
+    points.clear();
+    for (std::size_t j = 0; j < footprint.size(); ++j) {
+      const auto & a = footprint[j];
+      const auto & b = footprint[(j + 1) % footprint.size()];
+      double ua = along_x ? a.x : a.y, va = along_x ? a.y : a.x;
+      double ub = along_x ? b.x : b.y, vb = along_x ? b.y : b.x;
+      if (ua > ub) {
+        std::swap(ua, ub);
+        std::swap(va, vb);
+      }
+      if (ub < u0 || ua > u1) {
+        continue;
+      }
+      if (ub - ua <= 0.0) {
+        points.emplace_back(ua, va);
+        points.emplace_back(ub, vb);
+        continue;
+      }
+      const double start = std::max(ua, u0);
+      const double end = std::min(ub, u1);
+      points.emplace_back(start, va + (vb - va) * (start - ua) / (ub - ua));
+      points.emplace_back(end, va + (vb - va) * (end - ua) / (ub - ua));
+    }
+    if (points.empty()) {
+      continue;
+    }
+
+    double min_v = std::numeric_limits<double>::max();
+    double max_v = std::numeric_limits<double>::lowest();
+    for (const auto & point : points) {
+      min_v = std::min(min_v, point.second);
+      max_v = std::max(max_v, point.second);
+    }
+    const double center_u = 0.5 * (u0 + u1);
+    const double center_v = 0.5 * (min_v + max_v);
+    double radius = 0.0;
+    for (const auto & point : points) {
+      radius = std::max(radius, std::hypot(point.first - center_u, point.second - center_v));
+    }
+
+    FootprintCircle circle;
+    circle.x = static_cast<float>(along_x ? center_u : center_v);
+    circle.y = static_cast<float>(along_x ? center_v : center_u);
+    circle.radius = static_cast<float>(radius);
+    circles.push_back(circle);
+  }
+
+  return circles;
+}
+
+bool GridCollisionChecker::footprintCirclesClear(
+  const float & x,
+  const float & y,
+  const float & angle_bin)
+{
+  // The full footprint is in collision off of the map, which the circles cannot tell
+  const float resolution = static_cast<float>(costmap_->getResolution());
+  const float inv_resolution = 1.0f / resolution;
+  const float extent = circles_extent_ * inv_resolution;
+  if (x + 0.5f < extent || y + 0.5f < extent ||
+    x + 0.5f + extent >= static_cast<float>(costmap_->getSizeInCellsX()) ||
+    y + 0.5f + extent >= static_cast<float>(costmap_->getSizeInCellsY()))
+  {
+    return false;
+  }
+
+  // Cells of the footprint as rasterised are within 0.5 + sqrt(2) / 2 cells of its outline,
+  // and a circle's center is offset from the center of the cell whose cost is looked up.
+  // If the costmap is downsampled, the obstacle and the cell giving the cost of a cell may
+  // each be up to sqrt(2) / 2 of the difference in resolution further away within it.
+  const nav2_costmap_2d::Costmap2D * source = getSourceCostmap();
+  const float source_resolution =
+    source ? static_cast<float>(source->getResolution()) : resolution;
+  const float margin = static_cast<float>(
+    (0.5 + M_SQRT1_2) * resolution + M_SQRT2 * std::max(0.0f, resolution - source_resolution));
+
+  const unsigned char * char_map = costmap_->getCharMap();
+  const unsigned int size_x = costmap_->getSizeInCellsX();
+  for (const auto & circle : oriented_circles_[static_cast<unsigned int>(angle_bin)]) {
+    const float cx = x + circle.x * inv_resolution + 0.5f;
+    const float cy = y + circle.y * inv_resolution + 0.5f;
+    const unsigned int mx = static_cast<unsigned int>(cx);
+    const unsigned int my = static_cast<unsigned int>(cy);
+    const unsigned char cost = char_map[my * size_x + mx];
+    const float offset = std::hypot(cx - mx - 0.5f, cy - my - 0.5f) * resolution;
+    if (obstacle_distances_[cost] <= circle.radius + margin + offset) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 bool GridCollisionChecker::inCollision(
   const unsigned int & i,
   const bool & traverse_unknown)
@@ -37,7 +37,7 @@ void CostmapDownsampler::on_configure(
   const nav2::LifecycleNode::WeakPtr & node,
   const std::string & global_frame,
   const std::string & topic_name,
-  nav2_costmap_2d::Costmap2D * const costmap,
+  const nav2_costmap_2d::Costmap2D * costmap,
   const unsigned int & downsampling_factor,
   const bool & use_min_cost_neighbor)
 {
@@ -21,12 +21,9 @@
 namespace nav2_smac_planner
 {
 
-// defining static member for all instance to share
-std::vector<int> Node2D::_neighbors_grid_offsets;
-float Node2D::cost_travel_multiplier = 2.0;
-
-Node2D::Node2D(const uint64_t index)
+Node2D::Node2D(const uint64_t index, SearchContext * search_context)
 : parent(nullptr),
+  _search_context(search_context),
   _cell_cost(std::numeric_limits<float>::quiet_NaN()),
   _accumulated_cost(std::numeric_limits<float>::max()),
   _index(index),
@@ -73,6 +70,7 @@ float Node2D::getTraversalCost(const NodePtr & child)
   const float & dx = A.x - B.x;
   const float & dy = A.y - B.y;
   static float sqrt_2 = sqrt(2);
+  const float & cost_travel_multiplier = _search_context->cost_travel_multiplier;
 
   // If a diagonal move, travel cost is sqrt(2) not 1.0.
   if ((dx * dx + dy * dy) > 1.05) {
@@ -84,6 +82,7 @@ float Node2D::getTraversalCost(const NodePtr & child)
 }
 
 float Node2D::getHeuristicCost(
+  SearchContext & /*context*/,
   const Coordinates & node_coords,
   const CoordinateVector & goals_coords)
 {
@@ -95,6 +94,7 @@ float Node2D::getHeuristicCost(
 }
 
 void Node2D::initMotionModel(
+  SearchContext & context,
   const MotionModel & motion_model,
   unsigned int & x_size_uint,
   unsigned int & /*size_y*/,
@@ -106,9 +106,10 @@ void Node2D::initMotionModel(
   }
 
   int x_size = static_cast<int>(x_size_uint);
-  cost_travel_multiplier = search_info.cost_penalty;
-  _neighbors_grid_offsets = {-1, +1, -x_size, +x_size, -x_size - 1,
+  context.cost_travel_multiplier = search_info.cost_penalty;
+  context.neighbors_grid_offsets = {-1, +1, -x_size, +x_size, -x_size - 1,
     -x_size + 1, +x_size - 1, +x_size + 1};
+  context.size_x = x_size_uint;
 }
 
 void Node2D::getNeighbors(
@@ -135,8 +136,9 @@ void Node2D::getNeighbors(
   const Coordinates coord_parent = getCoords(this->getIndex());
   Coordinates child;
 
-  for (unsigned int i = 0; i != _neighbors_grid_offsets.size(); ++i) {
-    index = node_i + _neighbors_grid_offsets[i];
+  const std::vector<int> & neighbors_grid_offsets = _search_context->neighbors_grid_offsets;
+  for (unsigned int i = 0; i != neighbors_grid_offsets.size(); ++i) {
+    index = node_i + neighbors_grid_offsets[i];
 
     // Check for wrap around conditions
     child = getCoords(index);
@@ -162,12 +164,12 @@ bool Node2D::backtracePath(CoordinateVector & path)
 
   while (current_node->parent) {
     path.push_back(
-      Node2D::getCoords(current_node->getIndex()));
+      getCoords(current_node->getIndex()));
     current_node = current_node->parent;
   }
 
   // add the start pose
-  path.push_back(Node2D::getCoords(current_node->getIndex()));
+  path.push_back(getCoords(current_node->getIndex()));
 
   return true;
 }
@@ -34,16 +34,6 @@ using namespace std::chrono;  // NOLINT
 namespace nav2_smac_planner
 {
 
-// defining static member for all instance to share
-LookupTable NodeHybrid::obstacle_heuristic_lookup_table;
-float NodeHybrid::travel_distance_cost = sqrtf(2.0f);
-HybridMotionTable NodeHybrid::motion_table;
-float NodeHybrid::size_lookup = 25;
-LookupTable NodeHybrid::dist_heuristic_lookup_table;
-std::shared_ptr<nav2_costmap_2d::Costmap2DROS> NodeHybrid::costmap_ros = nullptr;
-
-ObstacleHeuristicQueue NodeHybrid::obstacle_heuristic_queue;
-
 // Each of these tables are the projected motion models through
 // time and space applied to the search on the current node in
 // continuous map-coordinates (e.g. not meters but partial map cells)
@@ -343,9 +333,10 @@ double HybridMotionTable::getAngle(const double & theta)
   return theta / bin_size;
 }
 
-NodeHybrid::NodeHybrid(const uint64_t index)
+NodeHybrid::NodeHybrid(const uint64_t index, SearchContext * search_context)
 : parent(nullptr),
   pose(0.0f, 0.0f, 0.0f),
+  _search_context(search_context),
   _cell_cost(std::numeric_limits<float>::quiet_NaN()),
   _accumulated_cost(std::numeric_limits<float>::max()),
   _index(index),
@@ -399,9 +390,10 @@ float NodeHybrid::getTraversalCost(const NodePtr & child)
 
   // this is the first node
   if (getMotionPrimitiveIndex() == std::numeric_limits<unsigned int>::max()) {
-    return NodeHybrid::travel_distance_cost;
+    return _search_context->travel_distance_cost;
   }
 
+  const HybridMotionTable & motion_table = _search_context->motion_table;
   const TurnDirection & child_turn_dir = child->getTurnDirection();
   float travel_cost_raw = motion_table.travel_costs[child->getMotionPrimitiveIndex()];
   float travel_cost = 0.0;
@@ -441,28 +433,32 @@ float NodeHybrid::getTraversalCost(const NodePtr & child)
 }
 
 float NodeHybrid::getHeuristicCost(
+  SearchContext & context,
   const Coordinates & node_coords,
   const CoordinateVector & goals_coords)
 {
   // obstacle heuristic does not depend on goal heading
-  const float obstacle_heuristic =
-    getObstacleHeuristic(node_coords, goals_coords[0], motion_table.cost_penalty);
+  const float obstacle_heuristic = getObstacleHeuristic(
+    context.obstacle_heuristic, node_coords, goals_coords[0],
+    context.motion_table.cost_penalty);
   float distance_heuristic = std::numeric_limits<float>::max();
   for (unsigned int i = 0; i < goals_coords.size(); i++) {
     distance_heuristic = std::min(
       distance_heuristic,
-      getDistanceHeuristic(node_coords, goals_coords[i], obstacle_heuristic));
+      getDistanceHeuristic(context, node_coords, goals_coords[i], obstacle_heuristic));
   }
   return std::max(obstacle_heuristic, distance_heuristic);
 }
 
 void NodeHybrid::initMotionModel(
+  SearchContext & context,
   const MotionModel & motion_model,
   unsigned int & size_x,
   unsigned int & size_y,
   unsigned int & num_angle_quantization,
   SearchInfo & search_info)
 {
+  HybridMotionTable & motion_table = context.motion_table;
   // find the motion model selected
   switch (motion_model) {
     case MotionModel::DUBIN:
@@ -478,7 +474,9 @@ void NodeHybrid::initMotionModel(
               " Reeds-Shepp (Ackermann forward and back).");
   }
 
-  travel_distance_cost = motion_table.projections[0]._x;
+  context.travel_distance_cost = motion_table.projections[0]._x;
+  context.obstacle_heuristic.downsample = motion_table.downsample_obstacle_heuristic;
+  context.obstacle_heuristic.use_quadratic_cost_penalty = motion_table.use_quadratic_cost_penalty;
 }
 
 inline float distanceHeuristic2D(
@@ -491,6 +489,7 @@ inline float distanceHeuristic2D(
 }
 
 void NodeHybrid::resetObstacleHeuristic(
+  ObstacleHeuristicTable & table,
   std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros_i,
   const unsigned int & start_x, const unsigned int & start_y,
   const unsigned int & goal_x, const unsigned int & goal_y)
@@ -499,13 +498,16 @@ void NodeHybrid::resetObstacleHeuristic(
   // the planner considerably to search through 75% less cells with no detectable
   // erosion of path quality after even modest smoothing. The error would be no more
   // than 0.05 * normalized cost. Since this is just a search prior, there's no loss in generality
-  costmap_ros = costmap_ros_i;
-  auto costmap = costmap_ros->getCostmap();
+  table.costmap_ros = costmap_ros_i;
+  const nav2_costmap_2d::Costmap2D * costmap =
+    table.costmap ? table.costmap : table.costmap_ros->getCostmap();
+  LookupTable & obstacle_heuristic_lookup_table = table.lookup_table;
+  ObstacleHeuristicQueue & obstacle_heuristic_queue = table.queue;
 
   // Clear lookup table
   unsigned int size = 0u;
   unsigned int size_x = 0u;
-  if (motion_table.downsample_obstacle_heuristic) {
+  if (table.downsample) {
     size_x = ceil(static_cast<float>(costmap->getSizeInCellsX()) / 2.0f);
     size = size_x *
       ceil(static_cast<float>(costmap->getSizeInCellsY()) / 2.0f);
@@ -532,7 +534,7 @@ void NodeHybrid::resetObstacleHeuristic(
 
   // Set initial goal point to queue from. Divided by 2 due to downsampled costmap.
   unsigned int goal_index;
-  if (motion_table.downsample_obstacle_heuristic) {
+  if (table.downsample) {
     goal_index = floor(goal_y / 2.0f) * size_x + floor(goal_x / 2.0f);
   } else {
     goal_index = floor(goal_y) * size_x + floor(goal_x);
@@ -547,15 +549,19 @@ void NodeHybrid::resetObstacleHeuristic(
 }
 
 float NodeHybrid::getObstacleHeuristic(
+  ObstacleHeuristicTable & table,
   const Coordinates & node_coords,
   const Coordinates &,
   const float & cost_penalty)
 {
   // If already expanded, return the cost
-  auto costmap = costmap_ros->getCostmap();
+  const nav2_costmap_2d::Costmap2D * costmap =
+    table.costmap ? table.costmap : table.costmap_ros->getCostmap();
+  LookupTable & obstacle_heuristic_lookup_table = table.lookup_table;
+  ObstacleHeuristicQueue & obstacle_heuristic_queue = table.queue;
   unsigned int size_x = 0u;
   unsigned int size_y = 0u;
-  if (motion_table.downsample_obstacle_heuristic) {
+  if (table.downsample) {
     size_x = ceil(static_cast<float>(costmap->getSizeInCellsX()) / 2.0f);
     size_y = ceil(static_cast<float>(costmap->getSizeInCellsY()) / 2.0f);
   } else {
@@ -565,7 +571,7 @@ float NodeHybrid::getObstacleHeuristic(
 
   // Divided by 2 due to downsampled costmap.
   unsigned int start_y, start_x;
-  const bool & downsample_H = motion_table.downsample_obstacle_heuristic;
+  const bool & downsample_H = table.downsample;
   if (downsample_H) {
     start_y = floor(node_coords.y / 2.0f);
     start_x = floor(node_coords.x / 2.0f);
@@ -670,7 +676,7 @@ float NodeHybrid::getObstacleHeuristic(
 
         existing_cost = obstacle_heuristic_lookup_table[new_idx];
         if (existing_cost <= 0.0f) {
-          if (motion_table.use_quadratic_cost_penalty) {
+          if (table.use_quadratic_cost_penalty) {
             travel_cost =
               (i <= 3 ? 1.0f : sqrt2) * (1.0f + (cost_penalty * cost * cost / 63504.0f));  // 252^2
           } else {
@@ -720,10 +726,14 @@ float NodeHybrid::getObstacleHeuristic(
 }
 
 float NodeHybrid::getDistanceHeuristic(
+  const SearchContext & context,
   const Coordinates & node_coords,
   const Coordinates & goal_coords,
   const float & obstacle_heuristic)
 {
+  const HybridMotionTable & motion_table = context.motion_table;
+  const float & size_lookup = context.size_lookup;
+
   // rotate and translate node_coords such that goal_coords relative is (0,0,0)
   // Due to the rounding involved in exact cell increments for caching,
   // this is not an exact replica of a live heuristic, but has bounded error.
@@ -771,11 +781,11 @@ float NodeHybrid::getDistanceHeuristic(
       x_pos * ceiling_size * motion_table.num_angle_quantization +
       y_pos * motion_table.num_angle_quantization +
       theta_pos;
-    motion_heuristic = dist_heuristic_lookup_table[index];
+    motion_heuristic = context.dist_heuristic_lookup_table[index];
   } else if (obstacle_heuristic <= 0.0) {
     // If no obstacle heuristic value, must have some H to use
     // In nominal situations, this should never be called.
-    static ompl::base::ScopedState<> from(motion_table.state_space), to(motion_table.state_space);
+    ompl::base::ScopedState<> from(motion_table.state_space), to(motion_table.state_space);
     to[0] = goal_coords.x;
     to[1] = goal_coords.y;
     to[2] = goal_coords.theta * motion_table.num_angle_quantization;
@@ -789,11 +799,16 @@ float NodeHybrid::getDistanceHeuristic(
 }
 
 void NodeHybrid::precomputeDistanceHeuristic(
+  SearchContext & context,
   const float & lookup_table_dim,
   const MotionModel & motion_model,
   const unsigned int & dim_3_size,
   const SearchInfo & search_info)
 {
+  HybridMotionTable & motion_table = context.motion_table;
+  LookupTable & dist_heuristic_lookup_table = context.dist_heuristic_lookup_table;
+  float & size_lookup = context.size_lookup;
+
   // Dubin or Reeds-Shepp shortest distances
   if (motion_model == MotionModel::DUBIN) {
     motion_table.state_space = std::make_shared<ompl::base::DubinsStateSpace>(
@@ -847,6 +862,7 @@ void NodeHybrid::getNeighbors(
   uint64_t index = 0;
   NodePtr neighbor = nullptr;
   Coordinates initial_node_coords;
+  HybridMotionTable & motion_table = _search_context->motion_table;
   const MotionPoses motion_projections = motion_table.getProjections(this);
 
   for (unsigned int i = 0; i != motion_projections.size(); i++) {
@@ -886,14 +902,14 @@ bool NodeHybrid::backtracePath(CoordinateVector & path)
   while (current_node->parent) {
     path.push_back(current_node->pose);
     // Convert angle to radians
-    path.back().theta = NodeHybrid::motion_table.getAngleFromBin(path.back().theta);
+    path.back().theta = _search_context->motion_table.getAngleFromBin(path.back().theta);
     current_node = current_node->parent;
   }
 
   // add the start pose
   path.push_back(current_node->pose);
   // Convert angle to radians
-  path.back().theta = NodeHybrid::motion_table.getAngleFromBin(path.back().theta);
+  path.back().theta = _search_context->motion_table.getAngleFromBin(path.back().theta);
 
   return true;
 }
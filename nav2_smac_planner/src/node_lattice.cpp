@@ -35,11 +35,6 @@ using namespace std::chrono;  // NOLINT
 namespace nav2_smac_planner
 {
 
-// defining static member for all instance to share
-LatticeMotionTable NodeLattice::motion_table;
-float NodeLattice::size_lookup = 25;
-LookupTable NodeLattice::dist_heuristic_lookup_table;
-
 // Each of these tables are the projected motion models through
 // time and space applied to the search on the current node in
 // continuous map-coordinates (e.g. not meters but partial map cells)
@@ -186,9 +181,10 @@ double LatticeMotionTable::getAngle(const double & theta)
   return getClosestAngularBin(theta);
 }
 
-NodeLattice::NodeLattice(const uint64_t index)
+NodeLattice::NodeLattice(const uint64_t index, SearchContext * search_context)
 : parent(nullptr),
   pose(0.0f, 0.0f, 0.0f),
+  _search_context(search_context),
   _cell_cost(std::numeric_limits<float>::quiet_NaN()),
   _accumulated_cost(std::numeric_limits<float>::max()),
   _index(index),
@@ -231,7 +227,8 @@ bool NodeLattice::isNodeValid(
 
   // Check primitive end pose
   // Convert grid quantization of primitives to radians, then collision checker quantization
-  static const double bin_size = 2.0 * M_PI / collision_checker->getPrecomputedAngles().size();
+  LatticeMotionTable & motion_table = _search_context->motion_table;
+  const double bin_size = 2.0 * M_PI / collision_checker->getPrecomputedAngles().size();
   const double & angle = motion_table.getAngleFromBin(this->pose.theta) / bin_size;
   if (collision_checker->inCollision(
       this->pose.x, this->pose.y, angle /*bin in collision checker*/, traverse_unknown))
@@ -295,6 +292,7 @@ bool NodeLattice::isNodeValid(
 
 float NodeLattice::getTraversalCost(const NodePtr & child)
 {
+  const LatticeMotionTable & motion_table = _search_context->motion_table;
   const float normalized_cost = child->getCost() / 252.0;
   if (std::isnan(normalized_cost)) {
     throw std::runtime_error(
@@ -344,23 +342,26 @@ float NodeLattice::getTraversalCost(const NodePtr & child)
 }
 
 float NodeLattice::getHeuristicCost(
+  SearchContext & context,
   const Coordinates & node_coords,
   const CoordinateVector & goals_coords)
 {
   // get obstacle heuristic value
   // obstacle heuristic does not depend on goal heading
   const float obstacle_heuristic = getObstacleHeuristic(
-    node_coords, goals_coords[0], motion_table.cost_penalty);
+    context.obstacle_heuristic, node_coords, goals_coords[0],
+    context.motion_table.cost_penalty);
   float distance_heuristic = std::numeric_limits<float>::max();
   for (unsigned int i = 0; i < goals_coords.size(); i++) {
     distance_heuristic = std::min(
       distance_heuristic,
-      getDistanceHeuristic(node_coords, goals_coords[i], obstacle_heuristic));
+      getDistanceHeuristic(context, node_coords, goals_coords[i], obstacle_heuristic));
   }
   return std::max(obstacle_heuristic, distance_heuristic);
 }
 
 void NodeLattice::initMotionModel(
+  SearchContext & context,
   const MotionModel & motion_model,
   unsigned int & size_x,
   unsigned int & /*size_y*/,
@@ -373,14 +374,17 @@ void NodeLattice::initMotionModel(
             " STATE_LATTICE and provide a valid lattice file.");
   }
 
-  motion_table.initMotionModel(size_x, search_info);
+  context.motion_table.initMotionModel(size_x, search_info);
 }
 
 float NodeLattice::getDistanceHeuristic(
+  SearchContext & context,
   const Coordinates & node_coords,
   const Coordinates & goal_coords,
   const float & obstacle_heuristic)
 {
+  LatticeMotionTable & motion_table = context.motion_table;
+  const float & size_lookup = context.size_lookup;
   // rotate and translate node_coords such that goal_coords relative is (0,0,0)
   // Due to the rounding involved in exact cell increments for caching,
   // this is not an exact replica of a live heuristic, but has bounded error.
@@ -428,9 +432,9 @@ float NodeLattice::getDistanceHeuristic(
       x_pos * ceiling_size * motion_table.num_angle_quantization +
       y_pos * motion_table.num_angle_quantization +
       theta_pos;
-    motion_heuristic = dist_heuristic_lookup_table[index];
+    motion_heuristic = context.dist_heuristic_lookup_table[index];
   } else if (obstacle_heuristic == 0.0) {
-    static ompl::base::ScopedState<> from(motion_table.state_space), to(motion_table.state_space);
+    ompl::base::ScopedState<> from(motion_table.state_space), to(motion_table.state_space);
     to[0] = goal_coords.x;
     to[1] = goal_coords.y;
     to[2] = motion_table.getAngleFromBin(goal_coords.theta);
@@ -444,11 +448,15 @@ float NodeLattice::getDistanceHeuristic(
 }
 
 void NodeLattice::precomputeDistanceHeuristic(
+  SearchContext & context,
   const float & lookup_table_dim,
   const MotionModel & /*motion_model*/,
   const unsigned int & dim_3_size,
   const SearchInfo & search_info)
 {
+  LatticeMotionTable & motion_table = context.motion_table;
+  LookupTable & dist_heuristic_lookup_table = context.dist_heuristic_lookup_table;
+  float & size_lookup = context.size_lookup;
   // Dubin or Reeds-Shepp shortest distances
   if (!search_info.allow_reverse_expansion) {
     motion_table.state_space = std::make_shared<ompl::base::DubinsStateSpace>(
@@ -503,6 +511,7 @@ void NodeLattice::getNeighbors(
   NodePtr neighbor = nullptr;
   Coordinates initial_node_coords, motion_projection;
   unsigned int direction_change_index = 0;
+  LatticeMotionTable & motion_table = _search_context->motion_table;
   MotionPrimitivePtrs motion_primitives = motion_table.getMotionPrimitives(
     this,
     direction_change_index);
@@ -533,6 +542,7 @@ void NodeLattice::getNeighbors(
     }
 
     index = NodeLattice::getIndex(
+      *_search_context,
       static_cast<unsigned int>(motion_projection.x),
       static_cast<unsigned int>(motion_projection.y),
       static_cast<unsigned int>(motion_projection.theta));
@@ -589,14 +599,15 @@ void NodeLattice::addNodeToPath(
 {
   Coordinates initial_pose, prim_pose;
   MotionPrimitive * prim = nullptr;
-  const float & grid_resolution = NodeLattice::motion_table.lattice_metadata.grid_resolution;
+  LatticeMotionTable & motion_table = _search_context->motion_table;
+  const float & grid_resolution = motion_table.lattice_metadata.grid_resolution;
   prim = current_node->getMotionPrimitive();
   // if motion primitive is valid, then was searched (rather than analytically expanded),
   // include dense path of subpoints making up the primitive at grid resolution
   if (prim) {
     initial_pose.x = current_node->pose.x - (prim->poses.back()._x / grid_resolution);
     initial_pose.y = current_node->pose.y - (prim->poses.back()._y / grid_resolution);
-    initial_pose.theta = NodeLattice::motion_table.getAngleFromBin(prim->start_angle);
+    initial_pose.theta = motion_table.getAngleFromBin(prim->start_angle);
 
     for (auto it = prim->poses.crbegin(); it != prim->poses.crend(); ++it) {
       // Convert primitive pose into grid space if it should be checked
@@ -614,7 +625,7 @@ void NodeLattice::addNodeToPath(
   } else {
     // For analytic expansion nodes where there is no valid motion primitive
     path.push_back(current_node->pose);
-    path.back().theta = NodeLattice::motion_table.getAngleFromBin(path.back().theta);
+    path.back().theta = motion_table.getAngleFromBin(path.back().theta);
   }
 }
 
@@ -86,6 +86,18 @@ void SmacPlanner2D::configure(
   nav2::declare_parameter_if_not_declared(
     node, name + ".terminal_checking_interval", rclcpp::ParameterValue(5000));
   node->get_parameter(name + ".terminal_checking_interval", _terminal_checking_interval);
+
+  std::string open_set_type;
+  nav2::declare_parameter_if_not_declared(
+    node, name + ".open_set_type", rclcpp::ParameterValue("BINARY_HEAP"));
+  node->get_parameter(name + ".open_set_type", open_set_type);
+  _search_info.open_set_type = fromStringToOST(open_set_type);
+  if (_search_info.open_set_type == OpenSetType::UNKNOWN) {
+    std::string error_msg = "Unable to get OpenSetType type. Given '" + open_set_type + "' "
+      "Valid options are BINARY_HEAP, RADIX_HEAP. ";
+    throw nav2_core::PlannerException(error_msg);
+  }
+
   nav2::declare_parameter_if_not_declared(
     node, name + ".use_final_approach_orientation", rclcpp::ParameterValue(false));
   node->get_parameter(name + ".use_final_approach_orientation", _use_final_approach_orientation);
@@ -209,11 +221,20 @@ nav_msgs::msg::Path SmacPlanner2D::createPlan(
   std::lock_guard<std::mutex> lock_reinit(_mutex);
   steady_clock::time_point a = steady_clock::now();
 
-  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(*(_costmap->getMutex()));
+  // Plan against a snapshot of the costmap when available, which does not block costmap
+  // updates for the duration of the search, or lock the costmap otherwise
+  auto snapshot = _costmap_ros->getCostmapSnapshot();
+  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(
+    *(_costmap->getMutex()), std::defer_lock);
+  if (!snapshot) {
+    lock.lock();
+  }
+  _collision_checker.setCostmapSnapshot(snapshot);
 
   // Downsample costmap, if required
-  nav2_costmap_2d::Costmap2D * costmap = _costmap;
+  const nav2_costmap_2d::Costmap2D * costmap = _collision_checker.getSourceCostmap();
   if (_downsample_costmap && _downsampling_factor > 1) {
+    _costmap_downsampler->setCostmap(costmap);
     costmap = _costmap_downsampler->downsample(_downsampling_factor);
     _collision_checker.setCostmap(costmap);
   }
@@ -411,6 +432,20 @@ SmacPlanner2D::dynamicParametersCallback(std::vector<rclcpp::Parameter> paramete
         reinit_a_star = true;
         _terminal_checking_interval = parameter.as_int();
       }
+    } else if (param_type == ParameterType::PARAMETER_STRING) {
+      if (param_name == _name + ".open_set_type") {
+        OpenSetType open_set_type = fromStringToOST(parameter.as_string());
+        if (open_set_type == OpenSetType::UNKNOWN) {
+          RCLCPP_WARN(
+            _logger,
+            "Unable to get OpenSetType type. Given '%s', "
+            "valid options are BINARY_HEAP, RADIX_HEAP.",
+            parameter.as_string().c_str());
+        } else {
+          reinit_a_star = true;
+          _search_info.open_set_type = open_set_type;
+        }
+      }
     }
   }
 
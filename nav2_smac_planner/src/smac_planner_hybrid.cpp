@@ -87,6 +87,9 @@ void SmacPlannerHybrid::configure(
   nav2::declare_parameter_if_not_declared(
     node, name + ".allow_unknown", rclcpp::ParameterValue(true));
   node->get_parameter(name + ".allow_unknown", _allow_unknown);
+  nav2::declare_parameter_if_not_declared(
+    node, name + ".use_footprint_circles", rclcpp::ParameterValue(false));
+  node->get_parameter(name + ".use_footprint_circles", _use_footprint_circles);
   nav2::declare_parameter_if_not_declared(
     node, name + ".max_iterations", rclcpp::ParameterValue(1000000));
   node->get_parameter(name + ".max_iterations", _max_iterations);
@@ -96,6 +99,18 @@ void SmacPlannerHybrid::configure(
   nav2::declare_parameter_if_not_declared(
     node, name + ".terminal_checking_interval", rclcpp::ParameterValue(5000));
   node->get_parameter(name + ".terminal_checking_interval", _terminal_checking_interval);
+
+  std::string open_set_type;
+  nav2::declare_parameter_if_not_declared(
+    node, name + ".open_set_type", rclcpp::ParameterValue("BINARY_HEAP"));
+  node->get_parameter(name + ".open_set_type", open_set_type);
+  _search_info.open_set_type = fromStringToOST(open_set_type);
+  if (_search_info.open_set_type == OpenSetType::UNKNOWN) {
+    std::string error_msg = "Unable to get OpenSetType type. Given '" + open_set_type + "' "
+      "Valid options are BINARY_HEAP, RADIX_HEAP. ";
+    throw nav2_core::PlannerException(error_msg);
+  }
+
   nav2::declare_parameter_if_not_declared(
     node, name + ".smooth_path", rclcpp::ParameterValue(true));
   node->get_parameter(name + ".smooth_path", smooth_path);
@@ -362,7 +377,6 @@ void SmacPlannerHybrid::cleanup()
   RCLCPP_INFO(
     _logger, "Cleaning up plugin %s of type SmacPlannerHybrid",
     _name.c_str());
-  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
   _a_star.reset();
   _smoother.reset();
   if (_costmap_downsampler) {
@@ -385,11 +399,20 @@ nav_msgs::msg::Path SmacPlannerHybrid::createPlan(
   std::lock_guard<std::mutex> lock_reinit(_mutex);
   steady_clock::time_point a = steady_clock::now();
 
-  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(*(_costmap->getMutex()));
+  // Plan against a snapshot of the costmap when available, which does not block costmap
+  // updates for the duration of the search, or lock the costmap otherwise
+  auto snapshot = _costmap_ros->getCostmapSnapshot();
+  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(
+    *(_costmap->getMutex()), std::defer_lock);
+  if (!snapshot) {
+    lock.lock();
+  }
+  _collision_checker.setCostmapSnapshot(snapshot);
 
   // Downsample costmap, if required
-  nav2_costmap_2d::Costmap2D * costmap = _costmap;
+  const nav2_costmap_2d::Costmap2D * costmap = _collision_checker.getSourceCostmap();
   if (_downsample_costmap && _downsampling_factor > 1) {
+    _costmap_downsampler->setCostmap(costmap);
     costmap = _costmap_downsampler->downsample(_downsampling_factor);
     _collision_checker.setCostmap(costmap);
   }
@@ -398,7 +421,8 @@ nav_msgs::msg::Path SmacPlannerHybrid::createPlan(
   _collision_checker.setFootprint(
     _costmap_ros->getRobotFootprint(),
     _costmap_ros->getUseRadius(),
-    findCircumscribedCost(_costmap_ros));
+    findCircumscribedCost(_costmap_ros),
+    _use_footprint_circles ? findObstacleDistances(_costmap_ros) : std::vector<float>());
   _a_star->setCollisionChecker(&_collision_checker);
 
   // Set starting point, in A* bin search coordinates
@@ -683,6 +707,8 @@ SmacPlannerHybrid::dynamicParametersCallback(std::vector<rclcpp::Parameter> para
       } else if (param_name == _name + ".allow_unknown") {
         reinit_a_star = true;
         _allow_unknown = parameter.as_bool();
+      } else if (param_name == _name + ".use_footprint_circles") {
+        _use_footprint_circles = parameter.as_bool();
       } else if (param_name == _name + ".cache_obstacle_heuristic") {
         reinit_a_star = true;
         _search_info.cache_obstacle_heuristic = parameter.as_bool();
@@ -758,7 +784,19 @@ SmacPlannerHybrid::dynamicParametersCallback(std::vector<rclcpp::Parameter> para
         }
       }
     } else if (param_type == ParameterType::PARAMETER_STRING) {
-      if (param_name == _name + ".motion_model_for_search") {
+      if (param_name == _name + ".open_set_type") {
+        OpenSetType open_set_type = fromStringToOST(parameter.as_string());
+        if (open_set_type == OpenSetType::UNKNOWN) {
+          RCLCPP_WARN(
+            _logger,
+            "Unable to get OpenSetType type. Given '%s', "
+            "valid options are BINARY_HEAP, RADIX_HEAP.",
+            parameter.as_string().c_str());
+        } else {
+          reinit_a_star = true;
+          _search_info.open_set_type = open_set_type;
+        }
+      } else if (param_name == _name + ".motion_model_for_search") {
         reinit_a_star = true;
         _motion_model = fromString(parameter.as_string());
         if (_motion_model == MotionModel::UNKNOWN) {
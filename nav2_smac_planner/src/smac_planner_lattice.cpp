@@ -69,6 +69,9 @@ void SmacPlannerLattice::configure(
   nav2::declare_parameter_if_not_declared(
     node, name + ".allow_unknown", rclcpp::ParameterValue(true));
   node->get_parameter(name + ".allow_unknown", _allow_unknown);
+  nav2::declare_parameter_if_not_declared(
+    node, name + ".use_footprint_circles", rclcpp::ParameterValue(false));
+  node->get_parameter(name + ".use_footprint_circles", _use_footprint_circles);
   nav2::declare_parameter_if_not_declared(
     node, name + ".max_iterations", rclcpp::ParameterValue(1000000));
   node->get_parameter(name + ".max_iterations", _max_iterations);
@@ -78,6 +81,18 @@ void SmacPlannerLattice::configure(
   nav2::declare_parameter_if_not_declared(
     node, name + ".terminal_checking_interval", rclcpp::ParameterValue(5000));
   node->get_parameter(name + ".terminal_checking_interval", _terminal_checking_interval);
+
+  std::string open_set_type;
+  nav2::declare_parameter_if_not_declared(
+    node, name + ".open_set_type", rclcpp::ParameterValue("BINARY_HEAP"));
+  node->get_parameter(name + ".open_set_type", open_set_type);
+  _search_info.open_set_type = fromStringToOST(open_set_type);
+  if (_search_info.open_set_type == OpenSetType::UNKNOWN) {
+    std::string error_msg = "Unable to get OpenSetType type. Given '" + open_set_type + "' "
+      "Valid options are BINARY_HEAP, RADIX_HEAP. ";
+    throw nav2_core::PlannerException(error_msg);
+  }
+
   nav2::declare_parameter_if_not_declared(
     node, name + ".smooth_path", rclcpp::ParameterValue(true));
   node->get_parameter(name + ".smooth_path", smooth_path);
@@ -298,7 +313,6 @@ void SmacPlannerLattice::cleanup()
   RCLCPP_INFO(
     _logger, "Cleaning up plugin %s of type SmacPlannerLattice",
     _name.c_str());
-  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
   _a_star.reset();
   _smoother.reset();
   _raw_plan_publisher.reset();
@@ -317,18 +331,28 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
   std::lock_guard<std::mutex> lock_reinit(_mutex);
   steady_clock::time_point a = steady_clock::now();
 
-  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(*(_costmap->getMutex()));
+  // Plan against a snapshot of the costmap when available, which does not block costmap
+  // updates for the duration of the search, or lock the costmap otherwise
+  auto snapshot = _costmap_ros->getCostmapSnapshot();
+  std::unique_lock<nav2_costmap_2d::Costmap2D::mutex_t> lock(
+    *(_costmap->getMutex()), std::defer_lock);
+  if (!snapshot) {
+    lock.lock();
+  }
+  _collision_checker.setCostmapSnapshot(snapshot);
+  const nav2_costmap_2d::Costmap2D * costmap = _collision_checker.getSourceCostmap();
 
   // Set collision checker and costmap information
   _collision_checker.setFootprint(
     _costmap_ros->getRobotFootprint(),
     _costmap_ros->getUseRadius(),
-    findCircumscribedCost(_costmap_ros));
+    findCircumscribedCost(_costmap_ros),
+    _use_footprint_circles ? findObstacleDistances(_costmap_ros) : std::vector<float>());
   _a_star->setCollisionChecker(&_collision_checker);
 
   // Set starting point, in A* bin search coordinates
   float mx_start, my_start, mx_goal, my_goal;
-  if (!_costmap->worldToMapContinuous(
+  if (!costmap->worldToMapContinuous(
     start.pose.position.x,
     start.pose.position.y,
     mx_start,
@@ -338,12 +362,12 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
             "Start Coordinates of(" + std::to_string(start.pose.position.x) + ", " +
             std::to_string(start.pose.position.y) + ") was outside bounds");
   }
-  _a_star->setStart(
-    mx_start, my_start,
-    NodeLattice::motion_table.getClosestAngularBin(tf2::getYaw(start.pose.orientation)));
+  auto & motion_table = _a_star->getSearchContext().motion_table;
+  unsigned int start_bin = motion_table.getClosestAngularBin(tf2::getYaw(start.pose.orientation));
+  _a_star->setStart(mx_start, my_start, start_bin);
 
   // Set goal point, in A* bin search coordinates
-  if (!_costmap->worldToMapContinuous(
+  if (!costmap->worldToMapContinuous(
     goal.pose.position.x,
     goal.pose.position.y,
     mx_goal,
@@ -353,10 +377,10 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
             "Goal Coordinates of(" + std::to_string(goal.pose.position.x) + ", " +
             std::to_string(goal.pose.position.y) + ") was outside bounds");
   }
+  unsigned int goal_bin = motion_table.getClosestAngularBin(tf2::getYaw(goal.pose.orientation));
   _a_star->setGoal(
-    mx_goal, my_goal,
-    NodeLattice::motion_table.getClosestAngularBin(tf2::getYaw(goal.pose.orientation)),
-      _goal_heading_mode, _coarse_search_resolution);
+    mx_goal, my_goal, goal_bin,
+    _goal_heading_mode, _coarse_search_resolution);
 
   // Setup message
   nav_msgs::msg::Path plan;
@@ -398,7 +422,7 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
   // Note: All exceptions thrown are handled by the planner server and returned to the action
   if (!_a_star->createPath(
       path, num_iterations,
-      _tolerance / static_cast<float>(_costmap->getResolution()), cancel_checker, expansions.get()))
+      _tolerance / static_cast<float>(costmap->getResolution()), cancel_checker, expansions.get()))
   {
     if (_debug_visualizations) {
       auto now = _clock->now();
@@ -431,7 +455,7 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
   plan.poses.reserve(path.size());
   geometry_msgs::msg::PoseStamped last_pose = pose;
   for (int i = path.size() - 1; i >= 0; --i) {
-    pose.pose = getWorldCoords(path[i].x, path[i].y, _costmap);
+    pose.pose = getWorldCoords(path[i].x, path[i].y, costmap);
     pose.pose.orientation = getWorldOrientation(path[i].theta);
     if (fabs(pose.pose.position.x - last_pose.pose.position.x) < 1e-4 &&
       fabs(pose.pose.position.y - last_pose.pose.position.y) < 1e-4 &&
@@ -498,7 +522,7 @@ nav_msgs::msg::Path SmacPlannerLattice::createPlan(
 
   // Smooth plan
   if (_smoother && num_iterations > 1) {
-    _smoother->smooth(plan, _costmap, time_remaining);
+    _smoother->smooth(plan, costmap, time_remaining);
   }
 
 #ifdef BENCHMARK_TESTING
@@ -586,6 +610,8 @@ SmacPlannerLattice::dynamicParametersCallback(std::vector<rclcpp::Parameter> par
       if (param_name == _name + ".allow_unknown") {
         reinit_a_star = true;
         _allow_unknown = parameter.as_bool();
+      } else if (param_name == _name + ".use_footprint_circles") {
+        _use_footprint_circles = parameter.as_bool();
       } else if (param_name == _name + ".cache_obstacle_heuristic") {
         reinit_a_star = true;
         _search_info.cache_obstacle_heuristic = parameter.as_bool();
@@ -643,7 +669,19 @@ SmacPlannerLattice::dynamicParametersCallback(std::vector<rclcpp::Parameter> par
         }
       }
     } else if (param_type == ParameterType::PARAMETER_STRING) {
-      if (param_name == _name + ".lattice_filepath") {
+      if (param_name == _name + ".open_set_type") {
+        OpenSetType open_set_type = fromStringToOST(parameter.as_string());
+        if (open_set_type == OpenSetType::UNKNOWN) {
+          RCLCPP_WARN(
+            _logger,
+            "Unable to get OpenSetType type. Given '%s', "
+            "valid options are BINARY_HEAP, RADIX_HEAP.",
+            parameter.as_string().c_str());
+        } else {
+          reinit_a_star = true;
+          _search_info.open_set_type = open_set_type;
+        }
+      } else if (param_name == _name + ".lattice_filepath") {
         reinit_a_star = true;
         if (_smoother) {
           reinit_smoother = true;
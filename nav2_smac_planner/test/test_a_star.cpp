@@ -226,7 +226,96 @@ TEST(AStarTest, test_a_star_se2)
   EXPECT_GT(expansions->size(), 5u);
 
   delete costmapA;
-  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
+}
+
+TEST(AStarTest, test_a_star_radix_heap)
+{
+  auto lnode = std::make_shared<nav2::LifecycleNode>("test");
+  nav2_smac_planner::SearchInfo info;
+  info.open_set_type = nav2_smac_planner::OpenSetType::RADIX_HEAP;
+  info.change_penalty = 0.1;
+  info.non_straight_penalty = 1.1;
+  info.reverse_penalty = 2.0;
+  info.minimum_turning_radius = 8;  // in grid coordinates
+  info.retrospective_penalty = 0.015;
+  info.analytic_expansion_max_length = 20.0;  // in grid coordinates
+  info.analytic_expansion_ratio = 3.5;
+  info.cost_penalty = 1.7;
+  unsigned int size_theta = 72;
+  int max_iterations = 10000;
+  int it_on_approach = 10;
+  int terminal_checking_interval = 5000;
+  double max_planning_time = 120.0;
+
+  nav2_costmap_2d::Costmap2D * costmapA =
+    new nav2_costmap_2d::Costmap2D(100, 100, 0.1, 0.0, 0.0, 0);
+  // island in the middle of lethal cost to cross
+  for (unsigned int i = 40; i <= 60; ++i) {
+    for (unsigned int j = 40; j <= 60; ++j) {
+      costmapA->setCost(i, j, 254);
+    }
+  }
+
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  auto costmap = costmap_ros->getCostmap();
+  *costmap = *costmapA;
+
+  auto dummy_cancel_checker = []() {
+      return false;
+    };
+
+  // 2D search finds a path of about the same length as with the binary heap,
+  // which may differ in the order ties are broken
+  nav2_smac_planner::AStarAlgorithm<nav2_smac_planner::Node2D> a_star_2d(
+    nav2_smac_planner::MotionModel::TWOD, info);
+  a_star_2d.initialize(
+    false, max_iterations, it_on_approach, terminal_checking_interval,
+    max_planning_time, 0.0, 1);
+  std::unique_ptr<nav2_smac_planner::GridCollisionChecker> checker_2d =
+    std::make_unique<nav2_smac_planner::GridCollisionChecker>(costmap_ros, 1, lnode);
+  checker_2d->setFootprint(nav2_costmap_2d::Footprint(), true, 0.0);
+  a_star_2d.setCollisionChecker(checker_2d.get());
+  a_star_2d.setStart(20u, 20u, 0);
+  a_star_2d.setGoal(80u, 80u, 0);
+  nav2_smac_planner::Node2D::CoordinateVector path_2d;
+  int num_it = 0;
+  EXPECT_TRUE(a_star_2d.createPath(path_2d, num_it, 0.0, dummy_cancel_checker));
+  EXPECT_NEAR(path_2d.size(), 82u, 2u);
+  for (unsigned int i = 0; i != path_2d.size(); i++) {
+    EXPECT_EQ(costmapA->getCost(path_2d[i].x, path_2d[i].y), 0);
+  }
+
+  // Planning again reuses the graph and open set of the previous search
+  a_star_2d.setCollisionChecker(checker_2d.get());
+  a_star_2d.setStart(20u, 20u, 0);
+  a_star_2d.setGoal(80u, 80u, 0);
+  path_2d.clear();
+  num_it = 0;
+  EXPECT_TRUE(a_star_2d.createPath(path_2d, num_it, 0.0, dummy_cancel_checker));
+  EXPECT_NEAR(path_2d.size(), 82u, 2u);
+
+  // Hybrid-A* search
+  nav2_smac_planner::AStarAlgorithm<nav2_smac_planner::NodeHybrid> a_star_se2(
+    nav2_smac_planner::MotionModel::DUBIN, info);
+  a_star_se2.initialize(
+    false, max_iterations, it_on_approach, terminal_checking_interval,
+    max_planning_time, 401, size_theta);
+  std::unique_ptr<nav2_smac_planner::GridCollisionChecker> checker_se2 =
+    std::make_unique<nav2_smac_planner::GridCollisionChecker>(costmap_ros, size_theta, lnode);
+  checker_se2->setFootprint(nav2_costmap_2d::Footprint(), true, 0.0);
+  a_star_se2.setCollisionChecker(checker_se2.get());
+  a_star_se2.setStart(10u, 10u, 0u);
+  a_star_se2.setGoal(80u, 80u, 40u);
+  nav2_smac_planner::NodeHybrid::CoordinateVector path_se2;
+  num_it = 0;
+  EXPECT_TRUE(a_star_se2.createPath(path_se2, num_it, 10.0, dummy_cancel_checker));
+  EXPECT_NEAR(path_se2.size(), 63u, 4u);
+  for (unsigned int i = 0; i != path_se2.size(); i++) {
+    EXPECT_EQ(costmapA->getCost(path_se2[i].x, path_se2[i].y), 0);
+  }
+
+  delete costmapA;
 }
 
 TEST(AStarTest, test_a_star_analytic_expansion)
@@ -288,7 +377,6 @@ TEST(AStarTest, test_a_star_analytic_expansion)
   }
 
   delete costmapA;
-  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
 }
 
 TEST(AStarTest, test_a_star_lattice)
@@ -363,7 +451,6 @@ TEST(AStarTest, test_a_star_lattice)
   }
 
   delete costmapA;
-  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
 }
 
 TEST(AStarTest, test_se2_single_pose_path)
@@ -429,7 +516,6 @@ TEST(AStarTest, test_se2_single_pose_path)
   EXPECT_GE(path.size(), 1u);
 
   delete costmapA;
-  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
 }
 
 TEST(AStarTest, test_goal_heading_mode)
@@ -502,7 +588,7 @@ TEST(AStarTest, test_goal_heading_mode)
     coarse_search_resolution);
   EXPECT_TRUE(a_star.getCoarseSearchResolution() == coarse_search_resolution);
 
-  unsigned int num_bins = nav2_smac_planner::NodeHybrid::motion_table.num_angle_quantization;
+  unsigned int num_bins = a_star.getSearchContext().motion_table.num_angle_quantization;
 
   // get number of valid goal states
   unsigned int num_valid_goals = 0;
@@ -568,6 +654,18 @@ TEST(AStarTest, test_constants)
       "ALL_DIRECTION"), nav2_smac_planner::GoalHeadingMode::ALL_DIRECTION);
   EXPECT_EQ(
     nav2_smac_planner::fromStringToGH("NONE"), nav2_smac_planner::GoalHeadingMode::UNKNOWN);
+
+  EXPECT_EQ(
+    nav2_smac_planner::toString(
+      nav2_smac_planner::OpenSetType::RADIX_HEAP), std::string("RADIX_HEAP"));
+  EXPECT_EQ(
+    nav2_smac_planner::fromStringToOST(
+      "BINARY_HEAP"), nav2_smac_planner::OpenSetType::BINARY_HEAP);
+  EXPECT_EQ(
+    nav2_smac_planner::fromStringToOST(
+      "RADIX_HEAP"), nav2_smac_planner::OpenSetType::RADIX_HEAP);
+  EXPECT_EQ(
+    nav2_smac_planner::fromStringToOST("NONE"), nav2_smac_planner::OpenSetType::UNKNOWN);
 }
 
 int main(int argc, char **argv)
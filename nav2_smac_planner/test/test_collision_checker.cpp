@@ -13,12 +13,19 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 #include <memory>
 
 #include "gtest/gtest.h"
+#include "nav2_costmap_2d/inflation_layer.hpp"
+#include "nav2_costmap_2d/layer.hpp"
 #include "nav2_smac_planner/collision_checker.hpp"
+#include "nav2_smac_planner/utils.hpp"
 
 using namespace nav2_costmap_2d;  // NOLINT
 
@@ -215,6 +222,220 @@ TEST(collision_footprint, test_point_and_line_cost)
   delete costmap_;
 }
 
+class GridCollisionCheckerWrapper : public nav2_smac_planner::GridCollisionChecker
+{
+public:
+  using GridCollisionChecker::GridCollisionChecker;
+  using GridCollisionChecker::decomposeFootprint;
+
+  bool circlesClear(const float & x, const float & y, const float & angle_bin)
+  {
+    return footprintCirclesClear(x, y, angle_bin);
+  }
+};
+
+class LayerWrapper : public nav2_costmap_2d::Layer
+{
+  void reset() {}
+  void updateBounds(double, double, double, double *, double *, double *, double *) {}
+  void updateCosts(nav2_costmap_2d::Costmap2D &, int, int, int, int) {}
+  bool isClearable() {return false;}
+};
+
+// 1.2m wide aisles between 0.4m deep racks at 5cm resolution, inflated as by the inflation layer
+void makeNarrowAisles(std::shared_ptr<nav2_costmap_2d::Costmap2DROS> costmap_ros)
+{
+  auto inflation_layer = nav2_costmap_2d::InflationLayer::getInflationLayer(costmap_ros);
+  ASSERT_NE(inflation_layer, nullptr);
+  const int size = 120;
+  const int cell_inflation_radius = static_cast<int>(inflation_layer->getInflationRadius() / 0.05);
+  auto is_rack = [](int y) {return y % 32 < 8;};
+
+  nav2_costmap_2d::Costmap2D narrow_aisles(size, size, 0.05, 0.0, 0.0, 0);
+  for (int y = 0; y < size; ++y) {
+    for (int x = 0; x < size; ++x) {
+      double distance = std::numeric_limits<double>::max();
+      for (int oy = std::max(0, y - cell_inflation_radius);
+        oy <= std::min(size - 1, y + cell_inflation_radius); ++oy)
+      {
+        if (is_rack(oy)) {
+          distance = std::min(distance, static_cast<double>(std::abs(oy - y)));
+        }
+      }
+      if (distance <= cell_inflation_radius) {
+        narrow_aisles.setCost(x, y, inflation_layer->computeCost(distance));
+      }
+    }
+  }
+  *costmap_ros->getCostmap() = narrow_aisles;
+}
+
+nav2_costmap_2d::Footprint makeRectangle(double min_x, double max_x, double min_y, double max_y)
+{
+  nav2_costmap_2d::Footprint footprint(4);
+  footprint[0].x = min_x;
+  footprint[0].y = max_y;
+  footprint[1].x = max_x;
+  footprint[1].y = max_y;
+  footprint[2].x = max_x;
+  footprint[2].y = min_y;
+  footprint[3].x = min_x;
+  footprint[3].y = min_y;
+  return footprint;
+}
+
+TEST(collision_footprint, test_find_obstacle_distances)
+{
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  auto inflation_layer = nav2_costmap_2d::InflationLayer::getInflationLayer(costmap_ros);
+  ASSERT_NE(inflation_layer, nullptr);
+
+  std::vector<float> distances = nav2_smac_planner::findObstacleDistances(costmap_ros);
+  ASSERT_EQ(distances.size(), 256u);
+  EXPECT_EQ(distances[nav2_costmap_2d::LETHAL_OBSTACLE], 0.0f);
+  EXPECT_EQ(distances[nav2_costmap_2d::NO_INFORMATION], 0.0f);
+  EXPECT_NEAR(distances[0], inflation_layer->getInflationRadius(), 0.1);
+  for (unsigned int cost = 1; cost < distances.size(); ++cost) {
+    EXPECT_LE(distances[cost], distances[cost - 1]);
+  }
+
+  // A cell at a distance from an obstacle has at least its inflated cost
+  const double resolution = costmap_ros->getCostmap()->getResolution();
+  for (double distance = 1.0; distance * resolution <= inflation_layer->getInflationRadius();
+    distance += 1.0)
+  {
+    EXPECT_LE(distances[inflation_layer->computeCost(distance)], distance * resolution + 1e-6);
+  }
+
+  // Layers after the inflation layer may set lethal costs that are not inflated
+  costmap_ros->getLayeredCostmap()->addPlugin(std::make_shared<LayerWrapper>());
+  EXPECT_TRUE(nav2_smac_planner::findObstacleDistances(costmap_ros).empty());
+}
+
+TEST(collision_footprint, test_decompose_footprint)
+{
+  // Slices along the longest side are no longer than half of the width
+  const std::vector<std::pair<nav2_costmap_2d::Footprint, std::size_t>> footprints = {
+    {makeRectangle(-0.3, 0.6, -0.25, 0.25), 4u},
+    {makeRectangle(-0.2, 0.2, -0.5, 0.5), 5u},
+    {makeRectangle(-0.3, 0.3, -0.3, 0.3), 2u}};
+  for (const auto & [footprint, num_circles] : footprints) {
+    auto circles = GridCollisionCheckerWrapper::decomposeFootprint(footprint);
+    EXPECT_EQ(circles.size(), num_circles);
+
+    // The circles cover the outline of the footprint
+    for (std::size_t i = 0; i < footprint.size(); ++i) {
+      const auto & a = footprint[i];
+      const auto & b = footprint[(i + 1) % footprint.size()];
+      for (double t = 0.0; t <= 1.0; t += 0.01) {
+        const double x = a.x + t * (b.x - a.x);
+        const double y = a.y + t * (b.y - a.y);
+        bool covered = false;
+        for (const auto & circle : circles) {
+          covered |= std::hypot(x - circle.x, y - circle.y) <= circle.radius + 1e-5;
+        }
+        EXPECT_TRUE(covered);
+      }
+    }
+  }
+
+  EXPECT_TRUE(GridCollisionCheckerWrapper::decomposeFootprint(
+      nav2_costmap_2d::Footprint()).empty());
+}
+
+TEST(collision_footprint, test_footprint_circles_match_footprint_cost)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("testF");
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->set_parameter({"resolution", 0.05});
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  makeNarrowAisles(costmap_ros);
+  const std::vector<float> distances = nav2_smac_planner::findObstacleDistances(costmap_ros);
+
+  // Footprint further forward than back, with the circumscribed cost check disabled
+  // so that all poses not settled by their center cost are checked by their circles
+  nav2_costmap_2d::Footprint footprint = makeRectangle(-0.3, 0.6, -0.25, 0.25);
+  GridCollisionCheckerWrapper exact_checker(costmap_ros, 72, node);
+  exact_checker.setFootprint(footprint, false, 0.0);
+  GridCollisionCheckerWrapper circles_checker(costmap_ros, 72, node);
+  circles_checker.setFootprint(footprint, false, 0.0, distances);
+
+  for (float y = 0.0f; y < 119.0f; y += 0.5f) {
+    for (float x = 0.0f; x < 119.0f; x += 2.5f) {
+      for (unsigned int bin = 0; bin < 72; bin += 3) {
+        const float angle_bin = static_cast<float>(bin);
+        for (const bool traverse_unknown : {true, false}) {
+          ASSERT_EQ(
+            circles_checker.inCollision(x, y, angle_bin, traverse_unknown),
+            exact_checker.inCollision(x, y, angle_bin, traverse_unknown)) <<
+            x << " " << y << " " << bin << " " << traverse_unknown;
+          EXPECT_EQ(circles_checker.getCost(), exact_checker.getCost());
+        }
+      }
+    }
+  }
+
+  // Along the middle of an aisle, a few costs show the footprint is clear
+  EXPECT_TRUE(circles_checker.circlesClear(60.0f, 20.0f, 0.0f));
+  EXPECT_FALSE(circles_checker.inCollision(60.0f, 20.0f, 0.0f, true));
+
+  // Across it, with the footprint's front over a rack, or near a rack, they cannot tell
+  EXPECT_FALSE(circles_checker.circlesClear(60.0f, 24.0f, 18.0f));
+  EXPECT_TRUE(circles_checker.inCollision(60.0f, 24.0f, 18.0f, true));
+  EXPECT_FALSE(circles_checker.circlesClear(60.0f, 14.0f, 0.0f));
+
+  // Nor when the footprint may leave the map
+  EXPECT_FALSE(circles_checker.circlesClear(2.0f, 20.0f, 0.0f));
+  EXPECT_TRUE(circles_checker.inCollision(2.0f, 20.0f, 36.0f, true));
+
+  // Without obstacle distances, only the full footprint is checked
+  circles_checker.setFootprint(footprint, false, 0.0);
+  EXPECT_FALSE(circles_checker.inCollision(60.0f, 20.0f, 0.0f, false));
+}
+
+TEST(collision_footprint, test_footprint_circles_uninflated_obstacle)
+{
+  auto node = std::make_shared<nav2::LifecycleNode>("testG");
+  auto costmap_ros = std::make_shared<nav2_costmap_2d::Costmap2DROS>();
+  costmap_ros->set_parameter({"resolution", 0.05});
+  costmap_ros->on_configure(rclcpp_lifecycle::State());
+  makeNarrowAisles(costmap_ros);
+  const std::vector<float> inflated_distances =
+    nav2_smac_planner::findObstacleDistances(costmap_ros);
+  ASSERT_FALSE(inflated_distances.empty());
+
+  // A lethal cell set by a filter after the layers, such as a keepout zone, is not inflated.
+  // This one is under the front of the footprint in the middle of an aisle.
+  costmap_ros->getLayeredCostmap()->addFilter(std::make_shared<LayerWrapper>());
+  costmap_ros->getCostmap()->setCost(72, 20, nav2_costmap_2d::LETHAL_OBSTACLE);
+  const std::vector<float> distances = nav2_smac_planner::findObstacleDistances(costmap_ros);
+  EXPECT_TRUE(distances.empty());
+
+  nav2_costmap_2d::Footprint footprint = makeRectangle(-0.3, 0.6, -0.25, 0.25);
+  GridCollisionCheckerWrapper exact_checker(costmap_ros, 72, node);
+  exact_checker.setFootprint(footprint, false, 0.0);
+  GridCollisionCheckerWrapper circles_checker(costmap_ros, 72, node);
+  circles_checker.setFootprint(footprint, false, 0.0, distances);
+  EXPECT_TRUE(exact_checker.inCollision(60.0f, 20.0f, 0.0f, true));
+
+  // Distances that assume every lethal cell is inflated would miss it
+  GridCollisionCheckerWrapper inflated_checker(costmap_ros, 72, node);
+  inflated_checker.setFootprint(footprint, false, 0.0, inflated_distances);
+  EXPECT_TRUE(inflated_checker.circlesClear(60.0f, 20.0f, 0.0f));
+
+  for (float y = 10.0f; y < 30.0f; y += 0.5f) {
+    for (float x = 50.0f; x < 80.0f; x += 0.5f) {
+      for (unsigned int bin = 0; bin < 72; bin += 3) {
+        const float angle_bin = static_cast<float>(bin);
+        ASSERT_EQ(
+          circles_checker.inCollision(x, y, angle_bin, true),
+          exact_checker.inCollision(x, y, angle_bin, true)) << x << " " << y << " " << bin;
+      }
+    }
+  }
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
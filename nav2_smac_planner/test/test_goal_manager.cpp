@@ -55,14 +55,15 @@ TEST(GoalManagerTest, test_goal_manager)
   checker->setFootprint(nav2_costmap_2d::Footprint(), true, 0.0);
 
   GoalManagerHybrid goal_manager;
+  NodeHybrid::SearchContext context;
   float tolerance = 20.0f;
   bool allow_unknow = false;
 
   EXPECT_TRUE(goal_manager.goalsIsEmpty());
 
   // Create two valid goals
-  NodePtr pose_a = new NodeHybrid(48);
-  NodePtr pose_b = new NodeHybrid(49);
+  NodePtr pose_a = new NodeHybrid(48, &context);
+  NodePtr pose_b = new NodeHybrid(49, &context);
   pose_a->setPose(NodeHybrid::Coordinates(0, 0, 0));
   pose_b->setPose(NodeHybrid::Coordinates(0, 0, 10));
 
@@ -94,7 +95,7 @@ TEST(GoalManagerTest, test_goal_manager)
   EXPECT_EQ(goal_manager.getGoalsCoordinates().size(), 0);
 
   // Add invalid goal
-  NodePtr pose_c = new NodeHybrid(50);
+  NodePtr pose_c = new NodeHybrid(50, &context);
   pose_c->setPose(NodeHybrid::Coordinates(50, 50, 0));  // inside lethal zone
 
   goal_manager.addGoal(pose_c);
@@ -136,7 +137,7 @@ TEST(GoalManagerTest, test_goal_manager)
   unsigned int test_goal_size = 16;
 
   for (unsigned int i = 0; i < test_goal_size; ++i) {
-    NodePtr goal = new NodeHybrid(i);
+    NodePtr goal = new NodeHybrid(i, &context);
     goal->setPose(NodeHybrid::Coordinates(i, i, 0));
     goal_manager.addGoal(goal);
   }
@@ -168,7 +169,6 @@ TEST(GoalManagerTest, test_goal_manager)
   );
 
   delete costmapA;
-  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
 }
 
 
@@ -41,16 +41,17 @@ TEST(Node2DTest, test_node_2d)
 
   // test construction
   unsigned char cost = static_cast<unsigned char>(1);
-  nav2_smac_planner::Node2D testA(1);
+  nav2_smac_planner::Node2D::SearchContext context;
+  nav2_smac_planner::Node2D testA(1, &context);
   testA.setCost(cost);
-  nav2_smac_planner::Node2D testB(1);
+  nav2_smac_planner::Node2D testB(1, &context);
   testB.setCost(cost);
   EXPECT_EQ(testA.getCost(), 1.0f);
   nav2_smac_planner::SearchInfo info;
   info.cost_penalty = 1.0;
   unsigned int size = 10;
   nav2_smac_planner::Node2D::initMotionModel(
-    nav2_smac_planner::MotionModel::TWOD, size, size, size, info);
+    context, nav2_smac_planner::MotionModel::TWOD, size, size, size, info);
 
   // test reset
   testA.reset();
@@ -70,11 +71,11 @@ TEST(Node2DTest, test_node_2d)
   nav2_smac_planner::Node2D::CoordinateVector B_vec;
   nav2_smac_planner::Node2D::Coordinates B(10.0, 5.0);
   B_vec.push_back(B);
-  EXPECT_NEAR(testB.getHeuristicCost(A, B_vec), 11.18, 0.02);
+  EXPECT_NEAR(testB.getHeuristicCost(context, A, B_vec), 11.18, 0.02);
 
   // check operator== works on index
   unsigned char costC = '2';
-  nav2_smac_planner::Node2D testC(1);
+  nav2_smac_planner::Node2D testC(1, &context);
   testC.setCost(costC);
   EXPECT_TRUE(testA == testC);
 
@@ -110,18 +111,19 @@ TEST(Node2DTest, test_node_2d_neighbors)
   unsigned int quant = 0u;
   // test neighborhood computation
   size_x = 100u;
+  nav2_smac_planner::Node2D::SearchContext context;
   nav2_smac_planner::Node2D::initMotionModel(
-    nav2_smac_planner::MotionModel::TWOD, size_x, size_y,
+    context, nav2_smac_planner::MotionModel::TWOD, size_x, size_y,
     quant, info);
-  EXPECT_EQ(nav2_smac_planner::Node2D::_neighbors_grid_offsets.size(), 8u);
-  EXPECT_EQ(nav2_smac_planner::Node2D::_neighbors_grid_offsets[0], -1);
-  EXPECT_EQ(nav2_smac_planner::Node2D::_neighbors_grid_offsets[1], 1);
-  EXPECT_EQ(nav2_smac_planner::Node2D::_neighbors_grid_offsets[2], -100);
-  EXPECT_EQ(nav2_smac_planner::Node2D::_neighbors_grid_offsets[3], 100);
-  EXPECT_EQ(nav2_smac_planner::Node2D::_neighbors_grid_offsets[4], -101);
-  EXPECT_EQ(nav2_smac_planner::Node2D::_neighbors_grid_offsets[5], -99);
-  EXPECT_EQ(nav2_smac_planner::Node2D::_neighbors_grid_offsets[6], 99);
-  EXPECT_EQ(nav2_smac_planner::Node2D::_neighbors_grid_offsets[7], 101);
+  EXPECT_EQ(context.neighbors_grid_offsets.size(), 8u);
+  EXPECT_EQ(context.neighbors_grid_offsets[0], -1);
+  EXPECT_EQ(context.neighbors_grid_offsets[1], 1);
+  EXPECT_EQ(context.neighbors_grid_offsets[2], -100);
+  EXPECT_EQ(context.neighbors_grid_offsets[3], 100);
+  EXPECT_EQ(context.neighbors_grid_offsets[4], -101);
+  EXPECT_EQ(context.neighbors_grid_offsets[5], -99);
+  EXPECT_EQ(context.neighbors_grid_offsets[6], 99);
+  EXPECT_EQ(context.neighbors_grid_offsets[7], 101);
 
   nav2_costmap_2d::Costmap2D costmapA(10, 10, 0.05, 0.0, 0.0, 0);
 
@@ -134,7 +136,7 @@ TEST(Node2DTest, test_node_2d_neighbors)
   std::unique_ptr<nav2_smac_planner::GridCollisionChecker> checker =
     std::make_unique<nav2_smac_planner::GridCollisionChecker>(costmap_ros, 72, lnode);
   unsigned char cost = static_cast<unsigned int>(1);
-  nav2_smac_planner::Node2D * node = new nav2_smac_planner::Node2D(1);
+  nav2_smac_planner::Node2D * node = new nav2_smac_planner::Node2D(1, &context);
   node->setCost(cost);
   std::function<bool(const uint64_t &, nav2_smac_planner::Node2D * &)> neighborGetter =
     [](const uint64_t &, nav2_smac_planner::Node2D * &) -> bool
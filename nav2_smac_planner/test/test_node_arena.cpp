@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <limits>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_smac_planner/node_2d.hpp"
+#include "nav2_smac_planner/node_arena.hpp"
+
+TEST(NodeArenaTest, test_add_and_find)
+{
+  nav2_smac_planner::Node2D::SearchContext context;
+  nav2_smac_planner::NodeArena<nav2_smac_planner::Node2D> arena(&context);
+  EXPECT_TRUE(arena.empty());
+  EXPECT_EQ(arena.find(10), nullptr);
+
+  nav2_smac_planner::Node2D * node = arena.add(10);
+  EXPECT_EQ(node->getIndex(), 10u);
+  EXPECT_EQ(node->getSearchContext(), &context);
+  EXPECT_EQ(arena.add(10), node);
+  EXPECT_EQ(arena.find(10), node);
+  EXPECT_EQ(arena.find(11), nullptr);
+  EXPECT_EQ(arena.size(), 1u);
+
+  // Far apart indices land on different pages
+  nav2_smac_planner::Node2D * far_node = arena.add(5000000);
+  EXPECT_EQ(far_node->getIndex(), 5000000u);
+  EXPECT_EQ(arena.find(5000000), far_node);
+  EXPECT_EQ(arena.find(10), node);
+  EXPECT_EQ(arena.size(), 2u);
+}
+
+TEST(NodeArenaTest, test_pointers_stable)
+{
+  nav2_smac_planner::Node2D::SearchContext context;
+  nav2_smac_planner::NodeArena<nav2_smac_planner::Node2D> arena(&context);
+  std::vector<nav2_smac_planner::Node2D *> nodes;
+  for (uint64_t i = 0; i != 100000; i++) {
+    nodes.push_back(arena.add(i * 3));
+  }
+  for (uint64_t i = 0; i != 100000; i++) {
+    EXPECT_EQ(arena.find(i * 3), nodes[i]);
+    EXPECT_EQ(nodes[i]->getIndex(), i * 3);
+  }
+}
+
+TEST(NodeArenaTest, test_clear_resets_nodes)
+{
+  nav2_smac_planner::Node2D::SearchContext context;
+  nav2_smac_planner::NodeArena<nav2_smac_planner::Node2D> arena(&context);
+  nav2_smac_planner::Node2D * node = arena.add(42);
+  node->visited();
+  node->setAccumulatedCost(5.0f);
+  arena.add(43);
+
+  arena.clear();
+  EXPECT_TRUE(arena.empty());
+  EXPECT_EQ(arena.find(42), nullptr);
+  EXPECT_EQ(arena.find(43), nullptr);
+
+  // Memory of the previous search is reused, but its state is not
+  nav2_smac_planner::Node2D * reused = arena.add(7);
+  EXPECT_EQ(reused, node);
+  EXPECT_EQ(reused->getIndex(), 7u);
+  EXPECT_FALSE(reused->wasVisited());
+  EXPECT_EQ(reused->getAccumulatedCost(), std::numeric_limits<float>::max());
+  EXPECT_EQ(arena.size(), 1u);
+}
@@ -42,11 +42,13 @@ TEST(NodeHybridTest, test_node_hybrid)
   unsigned int size_theta = 72;
 
   // Check defaulted constants
-  nav2_smac_planner::NodeHybrid testA(49);
-  EXPECT_EQ(testA.travel_distance_cost, sqrtf(2));
+  nav2_smac_planner::NodeHybrid::SearchContext context;
+  nav2_smac_planner::NodeHybrid testA(49, &context);
+  EXPECT_EQ(context.travel_distance_cost, sqrtf(2));
+  EXPECT_EQ(testA.getSearchContext(), &context);
 
   nav2_smac_planner::NodeHybrid::initMotionModel(
-    nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
+    context, nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
 
   nav2_costmap_2d::Costmap2D * costmapA = new nav2_costmap_2d::Costmap2D(
     10, 10, 0.05, 0.0, 0.0, 0);
@@ -62,7 +64,7 @@ TEST(NodeHybridTest, test_node_hybrid)
   checker->setFootprint(nav2_costmap_2d::Footprint(), true, 0.0);
 
   // test construction
-  nav2_smac_planner::NodeHybrid testB(49);
+  nav2_smac_planner::NodeHybrid testB(49, &context);
   EXPECT_TRUE(std::isnan(testA.getCost()));
 
   // test node valid and cost
@@ -78,7 +80,7 @@ TEST(NodeHybridTest, test_node_hybrid)
   EXPECT_TRUE(std::isnan(testA.getCost()));
 
   // Check motion-specific constants
-  EXPECT_NEAR(testA.travel_distance_cost, 2.08842, 0.1);
+  EXPECT_NEAR(context.travel_distance_cost, 2.08842, 0.1);
 
   // check collision checking
   EXPECT_EQ(testA.isNodeValid(false, checker.get()), true);
@@ -111,7 +113,7 @@ TEST(NodeHybridTest, test_node_hybrid)
   EXPECT_EQ(testA.getMotionPrimitiveIndex(), 2u);
 
   // check operator== works on index
-  nav2_smac_planner::NodeHybrid testC(49);
+  nav2_smac_planner::NodeHybrid testC(49, &context);
   EXPECT_TRUE(testA == testC);
 
   // check accumulated costs are set
@@ -154,9 +156,10 @@ TEST(NodeHybridTest, test_obstacle_heuristic)
   unsigned int size_x = 100;
   unsigned int size_y = 100;
   unsigned int size_theta = 72;
+  nav2_smac_planner::NodeHybrid::SearchContext context;
 
   nav2_smac_planner::NodeHybrid::initMotionModel(
-    nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
+    context, nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
 
   nav2_costmap_2d::Costmap2D * costmapA = new nav2_costmap_2d::Costmap2D(
     100, 100, 0.1, 0.0, 0.0, 0);
@@ -188,12 +191,12 @@ TEST(NodeHybridTest, test_obstacle_heuristic)
     std::make_unique<nav2_smac_planner::GridCollisionChecker>(costmap_ros, 72, node);
   checker->setFootprint(nav2_costmap_2d::Footprint(), true, 0.0);
 
-  nav2_smac_planner::NodeHybrid testA(0);
+  nav2_smac_planner::NodeHybrid testA(0, &context);
   testA.pose.x = 10;
   testA.pose.y = 50;
   testA.pose.theta = 0;
 
-  nav2_smac_planner::NodeHybrid testB(1);
+  nav2_smac_planner::NodeHybrid testB(1, &context);
   testB.pose.x = 90;
   testB.pose.y = 51;  // goal is a bit closer to the high-cost passage
   testB.pose.theta = 0;
@@ -203,8 +206,10 @@ TEST(NodeHybridTest, test_obstacle_heuristic)
     costmap->setCost(50, j, 254);
   }
   nav2_smac_planner::NodeHybrid::resetObstacleHeuristic(
-    costmap_ros, testA.pose.x, testA.pose.y, testB.pose.x, testB.pose.y);
+    context.obstacle_heuristic, costmap_ros,
+    testA.pose.x, testA.pose.y, testB.pose.x, testB.pose.y);
   float wide_passage_cost = nav2_smac_planner::NodeHybrid::getObstacleHeuristic(
+    context.obstacle_heuristic,
     testA.pose,
     testB.pose,
     info.cost_penalty);
@@ -218,9 +223,10 @@ TEST(NodeHybridTest, test_obstacle_heuristic)
     costmap->setCost(50, j, 250);
   }
   nav2_smac_planner::NodeHybrid::resetObstacleHeuristic(
-    costmap_ros,
+    context.obstacle_heuristic, costmap_ros,
     testA.pose.x, testA.pose.y, testB.pose.x, testB.pose.y);
   float two_passages_cost = nav2_smac_planner::NodeHybrid::getObstacleHeuristic(
+    context.obstacle_heuristic,
     testA.pose,
     testB.pose,
     info.cost_penalty);
@@ -228,7 +234,6 @@ TEST(NodeHybridTest, test_obstacle_heuristic)
   EXPECT_EQ(wide_passage_cost, two_passages_cost);
 
   delete costmapA;
-  nav2_smac_planner::NodeHybrid::destroyStaticAssets();
 }
 
 TEST(NodeHybridTest, test_node_debin_neighbors)
@@ -242,22 +247,23 @@ TEST(NodeHybridTest, test_node_debin_neighbors)
   unsigned int size_x = 100;
   unsigned int size_y = 100;
   unsigned int size_theta = 72;
+  nav2_smac_planner::NodeHybrid::SearchContext context;
   nav2_smac_planner::NodeHybrid::initMotionModel(
-    nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
+    context, nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
 
   // test neighborhood computation
-  EXPECT_EQ(nav2_smac_planner::NodeHybrid::motion_table.projections.size(), 3u);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[0]._x, 1.731517, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[0]._y, 0, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[0]._theta, 0, 0.01);
-
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[1]._x, 1.69047, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[1]._y, 0.3747, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[1]._theta, 5, 0.01);
-
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[2]._x, 1.69047, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[2]._y, -0.3747, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[2]._theta, -5, 0.01);
+  EXPECT_EQ(context.motion_table.projections.size(), 3u);
+  EXPECT_NEAR(context.motion_table.projections[0]._x, 1.731517, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[0]._y, 0, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[0]._theta, 0, 0.01);
+
+  EXPECT_NEAR(context.motion_table.projections[1]._x, 1.69047, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[1]._y, 0.3747, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[1]._theta, 5, 0.01);
+
+  EXPECT_NEAR(context.motion_table.projections[2]._x, 1.69047, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[2]._y, -0.3747, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[2]._theta, -5, 0.01);
 }
 
 TEST(NodeHybridTest, test_interpolation_prims)
@@ -265,6 +271,7 @@ TEST(NodeHybridTest, test_interpolation_prims)
   unsigned int size_x = 100;
   unsigned int size_y = 100;
   unsigned int size_theta = 64;
+  nav2_smac_planner::NodeHybrid::SearchContext context;
 
   nav2_smac_planner::SearchInfo info;
   info.change_penalty = 1.2;
@@ -276,9 +283,9 @@ TEST(NodeHybridTest, test_interpolation_prims)
   // Test to make sure the right num. of prims are generated when interpolation is on
   info.allow_primitive_interpolation = true;
   nav2_smac_planner::NodeHybrid::initMotionModel(
-    nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
+    context, nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
 
-  EXPECT_EQ(nav2_smac_planner::NodeHybrid::motion_table.projections.size(), 5u);
+  EXPECT_EQ(context.motion_table.projections.size(), 5u);
 }
 
 TEST(NodeHybridTest, test_interpolation_prims2)
@@ -286,6 +293,7 @@ TEST(NodeHybridTest, test_interpolation_prims2)
   unsigned int size_x = 100;
   unsigned int size_y = 100;
   unsigned int size_theta = 72;
+  nav2_smac_planner::NodeHybrid::SearchContext context;
 
   nav2_smac_planner::SearchInfo info;
   info.change_penalty = 1.2;
@@ -297,9 +305,9 @@ TEST(NodeHybridTest, test_interpolation_prims2)
   // Test to make sure the right num. of prims are generated when interpolation is on
   info.allow_primitive_interpolation = true;
   nav2_smac_planner::NodeHybrid::initMotionModel(
-    nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
+    context, nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
 
-  EXPECT_EQ(nav2_smac_planner::NodeHybrid::motion_table.projections.size(), 7u);
+  EXPECT_EQ(context.motion_table.projections.size(), 7u);
 }
 
 TEST(NodeHybridTest, test_node_reeds_neighbors)
@@ -314,33 +322,34 @@ TEST(NodeHybridTest, test_node_reeds_neighbors)
   unsigned int size_x = 100;
   unsigned int size_y = 100;
   unsigned int size_theta = 72;
+  nav2_smac_planner::NodeHybrid::SearchContext context;
   nav2_smac_planner::NodeHybrid::initMotionModel(
-    nav2_smac_planner::MotionModel::REEDS_SHEPP, size_x, size_y, size_theta, info);
+    context, nav2_smac_planner::MotionModel::REEDS_SHEPP, size_x, size_y, size_theta, info);
 
-  EXPECT_EQ(nav2_smac_planner::NodeHybrid::motion_table.projections.size(), 6u);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[0]._x, 2.088, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[0]._y, 0, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[0]._theta, 0, 0.01);
+  EXPECT_EQ(context.motion_table.projections.size(), 6u);
+  EXPECT_NEAR(context.motion_table.projections[0]._x, 2.088, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[0]._y, 0, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[0]._theta, 0, 0.01);
 
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[1]._x, 2.070, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[1]._y, 0.272, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[1]._theta, 3, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[1]._x, 2.070, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[1]._y, 0.272, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[1]._theta, 3, 0.01);
 
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[2]._x, 2.070, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[2]._y, -0.272, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[2]._theta, -3, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[2]._x, 2.070, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[2]._y, -0.272, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[2]._theta, -3, 0.01);
 
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[3]._x, -2.088, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[3]._y, 0, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[3]._theta, 0, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[3]._x, -2.088, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[3]._y, 0, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[3]._theta, 0, 0.01);
 
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[4]._x, -2.07, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[4]._y, 0.272, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[4]._theta, -3, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[4]._x, -2.07, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[4]._y, 0.272, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[4]._theta, -3, 0.01);
 
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[5]._x, -2.07, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[5]._y, -0.272, 0.01);
-  EXPECT_NEAR(nav2_smac_planner::NodeHybrid::motion_table.projections[5]._theta, 3, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[5]._x, -2.07, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[5]._y, -0.272, 0.01);
+  EXPECT_NEAR(context.motion_table.projections[5]._theta, 3, 0.01);
 
   nav2_costmap_2d::Costmap2D costmapA(100, 100, 0.05, 0.0, 0.0, 0);
 
@@ -353,7 +362,7 @@ TEST(NodeHybridTest, test_node_reeds_neighbors)
   std::unique_ptr<nav2_smac_planner::GridCollisionChecker> checker =
     std::make_unique<nav2_smac_planner::GridCollisionChecker>(costmap_ros, 72, lnode);
   checker->setFootprint(nav2_costmap_2d::Footprint(), true, 0.0);
-  nav2_smac_planner::NodeHybrid * node = new nav2_smac_planner::NodeHybrid(49);
+  nav2_smac_planner::NodeHybrid * node = new nav2_smac_planner::NodeHybrid(49, &context);
   std::function<bool(const uint64_t &, nav2_smac_planner::NodeHybrid * &)> neighborGetter =
     [](const uint64_t &, nav2_smac_planner::NodeHybrid * &) -> bool
     {
@@ -411,6 +420,45 @@ TEST(NodeHybridTest, basic_get_closest_angular_bin_test)
   }
 }
 
+TEST(NodeHybridTest, test_independent_search_contexts)
+{
+  unsigned int size_x = 100;
+  unsigned int size_y = 100;
+  unsigned int size_theta = 72;
+
+  nav2_smac_planner::SearchInfo info;
+  info.change_penalty = 1.2;
+  info.non_straight_penalty = 1.4;
+  info.reverse_penalty = 2.1;
+  info.retrospective_penalty = 0.0;
+
+  // Two planners with different motion models must not share their tables
+  nav2_smac_planner::NodeHybrid::SearchContext dubin_context;
+  info.minimum_turning_radius = 4;
+  nav2_smac_planner::NodeHybrid::initMotionModel(
+    dubin_context, nav2_smac_planner::MotionModel::DUBIN, size_x, size_y, size_theta, info);
+
+  nav2_smac_planner::NodeHybrid::SearchContext reeds_context;
+  info.minimum_turning_radius = 8;
+  nav2_smac_planner::NodeHybrid::initMotionModel(
+    reeds_context, nav2_smac_planner::MotionModel::REEDS_SHEPP, size_x, size_y, size_theta, info);
+
+  EXPECT_EQ(dubin_context.motion_table.projections.size(), 3u);
+  EXPECT_NEAR(dubin_context.motion_table.projections[0]._x, 1.731517, 0.01);
+  EXPECT_NEAR(dubin_context.travel_distance_cost, 1.731517, 0.01);
+  EXPECT_EQ(reeds_context.motion_table.projections.size(), 6u);
+  EXPECT_NEAR(reeds_context.motion_table.projections[0]._x, 2.088, 0.01);
+  EXPECT_NEAR(reeds_context.travel_distance_cost, 2.088, 0.01);
+
+  // Graph dimensions are also per planner
+  unsigned int small_size_x = 10;
+  nav2_smac_planner::NodeHybrid::SearchContext small_context;
+  nav2_smac_planner::NodeHybrid::initMotionModel(
+    small_context, nav2_smac_planner::MotionModel::DUBIN, small_size_x, size_y, size_theta, info);
+  EXPECT_EQ(nav2_smac_planner::NodeHybrid::getIndex(small_context, 1u, 1u, 4u), 796u);
+  EXPECT_EQ(nav2_smac_planner::NodeHybrid::getIndex(dubin_context, 1u, 1u, 4u), 7276u);
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc, argv);
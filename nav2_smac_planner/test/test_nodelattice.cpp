@@ -108,14 +108,15 @@ TEST(NodeLatticeTest, test_node_lattice_neighbors_and_parsing)
   unsigned int y = 100;
   unsigned int angle_quantization = 16;
 
+  nav2_smac_planner::NodeLattice::SearchContext context;
   nav2_smac_planner::NodeLattice::initMotionModel(
-    nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
+    context, nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
 
-  nav2_smac_planner::NodeLattice aNode(0);
+  nav2_smac_planner::NodeLattice aNode(0, &context);
   unsigned int direction_change_index = 0;
   aNode.setPose(nav2_smac_planner::NodeHybrid::Coordinates(0, 0, 0));
   nav2_smac_planner::MotionPrimitivePtrs projections =
-    nav2_smac_planner::NodeLattice::motion_table.getMotionPrimitives(
+    context.motion_table.getMotionPrimitives(
     &aNode,
     direction_change_index);
 
@@ -124,7 +125,7 @@ TEST(NodeLatticeTest, test_node_lattice_neighbors_and_parsing)
   EXPECT_NEAR(projections[0]->poses.back()._theta, 5.176, 0.01);
 
   EXPECT_NEAR(
-    nav2_smac_planner::NodeLattice::motion_table.getLatticeMetadata(
+    context.motion_table.getLatticeMetadata(
       filePath)
     .grid_resolution,
     0.05, 0.005);
@@ -153,19 +154,20 @@ TEST(NodeLatticeTest, test_node_lattice_conversions)
   unsigned int y = 100;
   unsigned int angle_quantization = 16;
 
+  nav2_smac_planner::NodeLattice::SearchContext context;
   nav2_smac_planner::NodeLattice::initMotionModel(
-    nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
+    context, nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
 
-  nav2_smac_planner::NodeLattice aNode(0);
+  nav2_smac_planner::NodeLattice aNode(0, &context);
   aNode.setPose(nav2_smac_planner::NodeHybrid::Coordinates(0, 0, 0));
 
-  EXPECT_NEAR(aNode.motion_table.getAngleFromBin(0u), 0.0, 0.005);
-  EXPECT_NEAR(aNode.motion_table.getAngleFromBin(1u), 0.46364, 0.005);
-  EXPECT_NEAR(aNode.motion_table.getAngleFromBin(2u), 0.78539, 0.005);
+  EXPECT_NEAR(context.motion_table.getAngleFromBin(0u), 0.0, 0.005);
+  EXPECT_NEAR(context.motion_table.getAngleFromBin(1u), 0.46364, 0.005);
+  EXPECT_NEAR(context.motion_table.getAngleFromBin(2u), 0.78539, 0.005);
 
-  EXPECT_EQ(aNode.motion_table.getClosestAngularBin(0.0), 0u);
-  EXPECT_EQ(aNode.motion_table.getClosestAngularBin(0.5), 1u);
-  EXPECT_EQ(aNode.motion_table.getClosestAngularBin(1.5), 4u);
+  EXPECT_EQ(context.motion_table.getClosestAngularBin(0.0), 0u);
+  EXPECT_EQ(context.motion_table.getClosestAngularBin(0.5), 1u);
+  EXPECT_EQ(context.motion_table.getClosestAngularBin(1.5), 4u);
 }
 
 TEST(NodeLatticeTest, test_node_lattice)
@@ -193,12 +195,13 @@ TEST(NodeLatticeTest, test_node_lattice)
   unsigned int y = 100;
   unsigned int angle_quantization = 16;
 
+  nav2_smac_planner::NodeLattice::SearchContext context;
   nav2_smac_planner::NodeLattice::initMotionModel(
-    nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
+    context, nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
 
   // Check defaults
-  nav2_smac_planner::NodeLattice aNode(0);
-  nav2_smac_planner::NodeLattice testA(49);
+  nav2_smac_planner::NodeLattice aNode(0, &context);
+  nav2_smac_planner::NodeLattice testA(49, &context);
   EXPECT_EQ(testA.getIndex(), 49u);
   EXPECT_EQ(testA.getAccumulatedCost(), std::numeric_limits<float>::max());
   EXPECT_TRUE(std::isnan(testA.getCost()));
@@ -236,7 +239,7 @@ TEST(NodeLatticeTest, test_node_lattice)
   EXPECT_EQ(testA.isNodeValid(false, checker.get()), true);
 
   // check operator== works on index
-  nav2_smac_planner::NodeLattice testC(49);
+  nav2_smac_planner::NodeLattice testC(49, &context);
   EXPECT_TRUE(testA == testC);
 
   // check accumulated costs are set
@@ -277,10 +280,11 @@ TEST(NodeLatticeTest, test_get_neighbors)
   unsigned int y = 100;
   unsigned int angle_quantization = 16;
 
+  nav2_smac_planner::NodeLattice::SearchContext context;
   nav2_smac_planner::NodeLattice::initMotionModel(
-    nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
+    context, nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
 
-  nav2_smac_planner::NodeLattice node(49);
+  nav2_smac_planner::NodeLattice node(49, &context);
 
   nav2_costmap_2d::Costmap2D * costmapA = new nav2_costmap_2d::Costmap2D(
     10, 10, 0.05, 0.0, 0.0, 0);
@@ -335,10 +339,11 @@ TEST(NodeLatticeTest, test_node_lattice_custom_footprint)
   unsigned int y = 100;
   unsigned int angle_quantization = 16;
 
+  nav2_smac_planner::NodeLattice::SearchContext context;
   nav2_smac_planner::NodeLattice::initMotionModel(
-    nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
+    context, nav2_smac_planner::MotionModel::STATE_LATTICE, x, y, angle_quantization, info);
 
-  nav2_smac_planner::NodeLattice node(49);
+  nav2_smac_planner::NodeLattice node(49, &context);
 
   nav2_costmap_2d::Costmap2D * costmap = new nav2_costmap_2d::Costmap2D(
     40, 40, 0.05, 0.0, 0.0, 0);
@@ -378,7 +383,7 @@ TEST(NodeLatticeTest, test_node_lattice_custom_footprint)
   unsigned int direction_change_index = 0;
   // Test that the node is valid though all motion primitives poses for custom footprint
   nav2_smac_planner::MotionPrimitivePtrs motion_primitives =
-    nav2_smac_planner::NodeLattice::motion_table.getMotionPrimitives(&node, direction_change_index);
+    context.motion_table.getMotionPrimitives(&node, direction_change_index);
   EXPECT_GT(motion_primitives.size(), 0u);
   for (unsigned int i = 0; i < motion_primitives.size(); i++) {
     EXPECT_EQ(node.isNodeValid(true, checker.get(), motion_primitives[i], false), true);
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "nav2_smac_planner/radix_heap.hpp"
+
+TEST(RadixHeapTest, test_ordering)
+{
+  nav2_smac_planner::RadixHeap<int> heap;
+  EXPECT_TRUE(heap.empty());
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> key(0.0f, 1000.0f);
+  std::vector<float> keys;
+  for (int i = 0; i != 1000; i++) {
+    keys.push_back(key(generator));
+    heap.emplace(keys.back(), i);
+  }
+  EXPECT_EQ(heap.size(), 1000u);
+
+  // Popped in the order of their keys
+  std::vector<float> popped;
+  while (!heap.empty()) {
+    popped.push_back(keys[heap.top()]);
+    heap.pop();
+  }
+  std::sort(keys.begin(), keys.end());
+  EXPECT_EQ(popped, keys);
+}
+
+TEST(RadixHeapTest, test_monotone_pushes)
+{
+  // Pushing while popping as a search does, with keys never below the last popped
+  nav2_smac_planner::RadixHeap<float> heap;
+  heap.emplace(0.0f, 0.0f);
+  float last = 0.0f;
+  int pops = 0;
+  while (!heap.empty() && pops < 10000) {
+    const float current = heap.top();
+    heap.pop();
+    EXPECT_GE(current, last);
+    last = current;
+    pops++;
+    heap.emplace(current + 1.5f, current + 1.5f);
+    heap.emplace(current + 0.25f, current + 0.25f);
+  }
+  EXPECT_EQ(pops, 10000);
+}
+
+TEST(RadixHeapTest, test_non_monotone_pushes)
+{
+  nav2_smac_planner::RadixHeap<int> heap;
+  heap.emplace(10.0f, 0);
+  heap.emplace(20.0f, 1);
+  EXPECT_EQ(heap.top(), 0);
+  heap.pop();
+
+  // Below the last popped key, so it is clamped and popped next
+  heap.emplace(5.0f, 2);
+  heap.emplace(15.0f, 3);
+  EXPECT_EQ(heap.top(), 2);
+  heap.pop();
+  EXPECT_EQ(heap.top(), 3);
+  heap.pop();
+  EXPECT_EQ(heap.top(), 1);
+  heap.pop();
+  EXPECT_TRUE(heap.empty());
+
+  // Negative keys are treated as zero
+  heap.clear();
+  heap.emplace(1.0f, 4);
+  heap.emplace(-1.0f, 5);
+  EXPECT_EQ(heap.top(), 5);
+}
+
+TEST(RadixHeapTest, test_clear)
+{
+  nav2_smac_planner::RadixHeap<int> heap;
+  heap.emplace(100.0f, 0);
+  heap.emplace(200.0f, 1);
+  heap.pop();
+  heap.clear();
+  EXPECT_TRUE(heap.empty());
+  EXPECT_EQ(heap.size(), 0u);
+
+  // After clearing, keys below those of before are valid again
+  heap.emplace(50.0f, 2);
+  heap.emplace(1.0f, 3);
+  EXPECT_EQ(heap.top(), 3);
+  heap.pop();
+  EXPECT_EQ(heap.top(), 2);
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_UTIL__DISTANCE_TRANSFORM_HPP_
+#define NAV2_UTIL__DISTANCE_TRANSFORM_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "nav2_util/thread_pool.hpp"
+
+namespace nav2_util
+{
+
+/**
+ * @class SquaredDistanceTransform
+ * @brief Exact Euclidean distance transform of a grid in linear time, using the separable
+ * lower envelope of parabolas method of Felzenszwalb & Huttenlocher. Distances are
+ * computed in cells and returned squared, so that they stay integral.
+ * Keeps its scratch buffers between calls to avoid reallocating on every update.
+ */
+class SquaredDistanceTransform
+{
+public:
+  /**
+   * @brief Compute the squared distance of every cell to the nearest obstacle cell
+   * @param obstacles Row-major grid of size_x * size_y cells, non-zero for obstacles
+   * @param size_x Number of cells in a row
+   * @param size_y Number of rows
+   * @param max_sq_distance Results are clamped to this value. Clamping at the largest
+   * distance of interest bounds the work and keeps results within narrow types.
+   * @param sq_distances Output row-major grid of size_x * size_y squared distances
+   * @param pool Optional thread pool to process columns and rows on
+   */
+  void compute(
+    const uint8_t * obstacles, unsigned int size_x, unsigned int size_y,
+    uint32_t max_sq_distance, uint32_t * sq_distances, ThreadPool * pool = nullptr);
+
+protected:
+  /**
+   * @brief 1D squared distance transform of a sampled function
+   * @param f Input function of n samples
+   * @param n Number of samples
+   * @param d Output lower envelope of n samples
+   * @param v Scratch for the locations of the parabolas, n entries
+   * @param z Scratch for the boundaries between parabolas, n + 1 entries
+   */
+  static void transform1D(
+    const uint32_t * f, unsigned int n, uint32_t * d, unsigned int * v, double * z);
+
+  std::vector<uint32_t> column_distances_;
+};
+
+}  // namespace nav2_util
+
+#endif  // NAV2_UTIL__DISTANCE_TRANSFORM_HPP_
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_UTIL__THREAD_POOL_HPP_
+#define NAV2_UTIL__THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace nav2_util
+{
+
+/**
+ * @class ThreadPool
+ * @brief A fixed-size pool of worker threads for data-parallel work in servers and plugins.
+ * The thread calling parallelFor() participates in the work, so a pool of N threads
+ * uses N - 1 background workers and a pool of size 1 runs everything inline.
+ */
+class ThreadPool
+{
+public:
+  /**
+   * @brief Constructor
+   * @param num_threads Total number of threads to process work with, including the
+   * calling thread. 0 selects std::thread::hardware_concurrency().
+   */
+  explicit ThreadPool(unsigned int num_threads);
+
+  /**
+   * @brief Destructor, finishes queued tasks and joins workers
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool & operator=(const ThreadPool &) = delete;
+
+  /**
+   * @brief Get the number of threads work is processed with, including the caller
+   * @return Number of threads
+   */
+  unsigned int size() const
+  {
+    return static_cast<unsigned int>(workers_.size()) + 1u;
+  }
+
+  /**
+   * @brief Run fn(i) for every i in [0, count) across the pool and block until all
+   * have completed. Indices are claimed dynamically, so fn must not depend on which
+   * thread runs it. The first exception thrown by fn is rethrown on the caller.
+   * @param count Number of indices to process
+   * @param fn Function to process one index
+   */
+  void parallelFor(std::size_t count, const std::function<void(std::size_t)> & fn);
+
+  /**
+   * @brief Queue a single task for asynchronous execution on a background worker.
+   * Runs inline if the pool has no background workers.
+   * @param fn Callable to run
+   * @return Future to the result of fn
+   */
+  template<typename FunctorT>
+  auto submit(FunctorT && fn) -> std::future<std::invoke_result_t<std::decay_t<FunctorT>>>
+  {
+    using ResultT = std::invoke_result_t<std::decay_t<FunctorT>>;
+    auto task = std::make_shared<std::packaged_task<ResultT()>>(std::forward<FunctorT>(fn));
+    std::future<ResultT> future = task->get_future();
+    if (workers_.empty()) {
+      (*task)();
+      return future;
+    }
+    enqueue([task]() {(*task)();});
+    return future;
+  }
+
+protected:
+  /**
+   * @brief Add a task to the queue and wake a worker
+   * @param task Task to add
+   */
+  void enqueue(std::function<void()> && task);
+
+  /**
+   * @brief Worker thread main loop
+   */
+  void workerLoop();
+
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool stop_{false};
+};
+
+}  // namespace nav2_util
+
+#endif  // NAV2_UTIL__THREAD_POOL_HPP_
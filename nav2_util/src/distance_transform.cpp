@@ -0,0 +1,142 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_util/distance_transform.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace nav2_util
+{
+
+namespace
+{
+
+// Number of columns or rows handed to a thread at once
+constexpr unsigned int kBlockSize = 64;
+
+}  // namespace
+
+void SquaredDistanceTransform::compute(
+  const uint8_t * obstacles, unsigned int size_x, unsigned int size_y,
+  uint32_t max_sq_distance, uint32_t * sq_distances, ThreadPool * pool)
+{
+  if (size_x == 0 || size_y == 0) {
+    return;
+  }
+
+  // Vertical distances beyond max_cells can only produce clamped results
+  uint32_t max_cells = static_cast<uint32_t>(std::ceil(std::sqrt(double(max_sq_distance))));
+  const std::size_t size = static_cast<std::size_t>(size_x) * size_y;
+  column_distances_.resize(size);
+  uint32_t * g = column_distances_.data();
+
+  // 1) Distance to the nearest obstacle along each column. Each pass walks the grid
+  // row by row and updates a contiguous block of columns, so it vectorizes well.
+  auto column_pass = [&](std::size_t block) {
+      const unsigned int x0 = static_cast<unsigned int>(block) * kBlockSize;
+      const unsigned int xn = std::min(x0 + kBlockSize, size_x);
+      for (unsigned int x = x0; x < xn; ++x) {
+        g[x] = obstacles[x] ? 0u : max_cells;
+      }
+      for (unsigned int y = 1; y < size_y; ++y) {
+        const std::size_t row = static_cast<std::size_t>(y) * size_x;
+        for (unsigned int x = x0; x < xn; ++x) {
+          g[row + x] = obstacles[row + x] ? 0u : std::min(g[row - size_x + x] + 1u, max_cells);
+        }
+      }
+      for (unsigned int y = size_y - 1; y-- > 0; ) {
+        const std::size_t row = static_cast<std::size_t>(y) * size_x;
+        for (unsigned int x = x0; x < xn; ++x) {
+          g[row + x] = std::min(g[row + x], g[row + size_x + x] + 1u);
+        }
+      }
+      for (unsigned int y = 0; y < size_y; ++y) {
+        const std::size_t row = static_cast<std::size_t>(y) * size_x;
+        for (unsigned int x = x0; x < xn; ++x) {
+          const uint64_t sq = static_cast<uint64_t>(g[row + x]) * g[row + x];
+          g[row + x] = static_cast<uint32_t>(std::min<uint64_t>(sq, max_sq_distance));
+        }
+      }
+    };
+
+  // 2) Lower envelope of the column distances along each row
+  auto row_pass = [&](std::size_t block) {
+      const unsigned int y0 = static_cast<unsigned int>(block) * kBlockSize;
+      const unsigned int yn = std::min(y0 + kBlockSize, size_y);
+      std::vector<unsigned int> v(size_x);
+      std::vector<double> z(size_x + 1);
+      for (unsigned int y = y0; y < yn; ++y) {
+        const std::size_t row = static_cast<std::size_t>(y) * size_x;
+        transform1D(g + row, size_x, sq_distances + row, v.data(), z.data());
+        for (unsigned int x = 0; x < size_x; ++x) {
+          sq_distances[row + x] = std::min(sq_distances[row + x], max_sq_distance);
+        }
+      }
+    };
+
+  const std::size_t column_blocks = (size_x + kBlockSize - 1) / kBlockSize;
+  const std::size_t row_blocks = (size_y + kBlockSize - 1) / kBlockSize;
+  if (pool) {
+    pool->parallelFor(column_blocks, column_pass);
+    pool->parallelFor(row_blocks, row_pass);
+  } else {
+    for (std::size_t block = 0; block < column_blocks; ++block) {
+      column_pass(block);
+    }
+    for (std::size_t block = 0; block < row_blocks; ++block) {
+      row_pass(block);
+    }
+  }
+}
+
+void SquaredDistanceTransform::transform1D(
+  const uint32_t * f, unsigned int n, uint32_t * d, unsigned int * v, double * z)
+{
+  int k = 0;
+  v[0] = 0;
+  z[0] = -std::numeric_limits<double>::infinity();
+  z[1] = std::numeric_limits<double>::infinity();
+  for (unsigned int q = 1; q < n; ++q) {
+    const double fq = static_cast<double>(f[q]) + static_cast<double>(q) * q;
+    double s;
+    while (true) {
+      const unsigned int p = v[k];
+      s = (fq - (static_cast<double>(f[p]) + static_cast<double>(p) * p)) /
+        (2.0 * (static_cast<double>(q) - p));
+      if (s > z[k]) {
+        break;
+      }
+      --k;
+    }
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = std::numeric_limits<double>::infinity();
+  }
+
+  k = 0;
+  for (unsigned int q = 0; q < n; ++q) {
+    while (z[k + 1] < q) {
+      ++k;
+    }
+    const uint64_t dq = q > v[k] ? q - v[k] : v[k] - q;
+    d[q] = static_cast<uint32_t>(
+      std::min<uint64_t>(dq * dq + f[v[k]], std::numeric_limits<uint32_t>::max()));
+  }
+}
+
+}  // namespace nav2_util
@@ -0,0 +1,152 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_util/thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace nav2_util
+{
+
+namespace
+{
+
+// Shared state of one parallelFor() call. Held by shared_ptr so helper tasks which only
+// get scheduled after all indices were consumed can still safely find nothing to do.
+struct ParallelForJob
+{
+  std::size_t count{0};
+  const std::function<void(std::size_t)> * fn{nullptr};
+  std::atomic<std::size_t> next{0};
+  std::size_t done{0};
+  std::exception_ptr error;
+  std::mutex mutex;
+  std::condition_variable cv;
+
+  void run()
+  {
+    std::size_t processed = 0;
+    std::size_t i;
+    while ((i = next.fetch_add(1, std::memory_order_relaxed)) < count) {
+      try {
+        (*fn)(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+      processed++;
+    }
+
+    if (processed > 0) {
+      std::lock_guard<std::mutex> lock(mutex);
+      done += processed;
+      if (done == count) {
+        cv.notify_all();
+      }
+    }
+  }
+};
+
+}  // namespace
+
+ThreadPool::ThreadPool(unsigned int num_threads)
+{
+  if (num_threads == 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  workers_.reserve(num_threads - 1);
+  for (unsigned int i = 1; i < num_threads; ++i) {
+    workers_.emplace_back(&ThreadPool::workerLoop, this);
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  cv_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+}
+
+void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)> & fn)
+{
+  if (count == 0) {
+    return;
+  }
+
+  if (workers_.empty() || count == 1) {
+    for (std::size_t i = 0; i < count; ++i) {
+      fn(i);
+    }
+    return;
+  }
+
+  auto job = std::make_shared<ParallelForJob>();
+  job->count = count;
+  job->fn = &fn;
+
+  const std::size_t helpers = std::min(workers_.size(), count - 1);
+  for (std::size_t i = 0; i < helpers; ++i) {
+    enqueue([job]() {job->run();});
+  }
+
+  // The caller works too, so nested or saturated pools still make progress
+  job->run();
+
+  std::unique_lock<std::mutex> lock(job->mutex);
+  job->cv.wait(lock, [&job]() {return job->done == job->count;});
+
+  if (job->error) {
+    std::rethrow_exception(job->error);
+  }
+}
+
+void ThreadPool::enqueue(std::function<void()> && task)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  cv_.notify_one();
+}
+
+void ThreadPool::workerLoop()
+{
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this]() {return stop_ || !tasks_.empty();});
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+}  // namespace nav2_util
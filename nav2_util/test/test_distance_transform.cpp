@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "nav2_util/distance_transform.hpp"
+#include "nav2_util/thread_pool.hpp"
+#include "gtest/gtest.h"
+
+using nav2_util::SquaredDistanceTransform;
+
+std::vector<uint32_t> bruteForce(
+  const std::vector<uint8_t> & obstacles, unsigned int size_x, unsigned int size_y,
+  uint32_t max_sq_distance)
+{
+  std::vector<uint32_t> result(obstacles.size(), max_sq_distance);
+  for (unsigned int y = 0; y < size_y; ++y) {
+    for (unsigned int x = 0; x < size_x; ++x) {
+      for (unsigned int oy = 0; oy < size_y; ++oy) {
+        for (unsigned int ox = 0; ox < size_x; ++ox) {
+          if (obstacles[oy * size_x + ox]) {
+            const int dx = static_cast<int>(x) - static_cast<int>(ox);
+            const int dy = static_cast<int>(y) - static_cast<int>(oy);
+            result[y * size_x + x] = std::min(
+              result[y * size_x + x], static_cast<uint32_t>(dx * dx + dy * dy));
+          }
+        }
+      }
+    }
+  }
+  return result;
+}
+
+TEST(DistanceTransform, MatchesBruteForce)
+{
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> occupancy(0.0, 1.0);
+  nav2_util::ThreadPool pool(3);
+  SquaredDistanceTransform transform;
+
+  for (unsigned int size_x : {1u, 17u, 70u}) {
+    for (unsigned int size_y : {1u, 23u, 130u}) {
+      for (double density : {0.0, 0.01, 0.2}) {
+        std::vector<uint8_t> obstacles(size_x * size_y);
+        for (auto & cell : obstacles) {
+          cell = occupancy(generator) < density;
+        }
+        for (uint32_t max_sq_distance : {25u, std::numeric_limits<uint32_t>::max()}) {
+          const auto expected = bruteForce(obstacles, size_x, size_y, max_sq_distance);
+          std::vector<uint32_t> serial(obstacles.size()), parallel(obstacles.size());
+          transform.compute(
+            obstacles.data(), size_x, size_y, max_sq_distance, serial.data());
+          transform.compute(
+            obstacles.data(), size_x, size_y, max_sq_distance, parallel.data(), &pool);
+          EXPECT_EQ(serial, expected);
+          EXPECT_EQ(parallel, expected);
+        }
+      }
+    }
+  }
+}
+
+TEST(DistanceTransform, SingleObstacle)
+{
+  SquaredDistanceTransform transform;
+  std::vector<uint8_t> obstacles(10 * 10, 0);
+  obstacles[3 * 10 + 4] = 1;
+  std::vector<uint32_t> result(obstacles.size());
+  transform.compute(obstacles.data(), 10, 10, 1000, result.data());
+  EXPECT_EQ(result[3 * 10 + 4], 0u);
+  EXPECT_EQ(result[3 * 10 + 5], 1u);
+  EXPECT_EQ(result[4 * 10 + 5], 2u);
+  EXPECT_EQ(result[9 * 10 + 9], 36u + 25u);
+
+  transform.compute(obstacles.data(), 10, 10, 10, result.data());
+  EXPECT_EQ(result[9 * 10 + 9], 10u);
+}
@@ -0,0 +1,90 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "nav2_util/thread_pool.hpp"
+#include "gtest/gtest.h"
+
+using nav2_util::ThreadPool;
+
+TEST(ThreadPool, Size)
+{
+  ThreadPool single(1);
+  EXPECT_EQ(single.size(), 1u);
+  ThreadPool quad(4);
+  EXPECT_EQ(quad.size(), 4u);
+  ThreadPool automatic(0);
+  EXPECT_GE(automatic.size(), 1u);
+}
+
+TEST(ThreadPool, ParallelForVisitsEveryIndexOnce)
+{
+  for (unsigned int threads : {1u, 2u, 8u}) {
+    ThreadPool pool(threads);
+    std::vector<std::atomic<int>> visits(1000);
+    pool.parallelFor(visits.size(), [&](std::size_t i) {visits[i]++;});
+    for (auto & v : visits) {
+      EXPECT_EQ(v.load(), 1);
+    }
+  }
+
+  ThreadPool pool(4);
+  bool called = false;
+  pool.parallelFor(0, [&](std::size_t) {called = true;});
+  EXPECT_FALSE(called);
+}
+
+TEST(ThreadPool, ParallelForNested)
+{
+  ThreadPool pool(3);
+  std::atomic<int> total{0};
+  pool.parallelFor(
+    8, [&](std::size_t) {
+      pool.parallelFor(8, [&](std::size_t) {total++;});
+    });
+  EXPECT_EQ(total.load(), 64);
+}
+
+TEST(ThreadPool, ParallelForRethrows)
+{
+  ThreadPool pool(4);
+  std::atomic<int> ran{0};
+  EXPECT_THROW(
+    pool.parallelFor(
+      100, [&](std::size_t i) {
+        ran++;
+        if (i == 42) {
+          throw std::runtime_error("Failure");
+        }
+      }), std::runtime_error);
+  // All other indices still complete before rethrowing
+  EXPECT_EQ(ran.load(), 100);
+}
+
+TEST(ThreadPool, Submit)
+{
+  ThreadPool pool(2);
+  auto a = pool.submit([]() {return 21 * 2;});
+  auto b = pool.submit([]() {throw std::runtime_error("Failure");});
+  EXPECT_EQ(a.get(), 42);
+  EXPECT_THROW(b.get(), std::runtime_error);
+
+  ThreadPool inline_pool(1);
+  auto c = inline_pool.submit([]() {return 7;});
+  EXPECT_EQ(c.get(), 7);
+}
@@ -0,0 +1,196 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef NAV2_VOXEL_GRID__SPARSE_VOXEL_GRID_HPP_
+#define NAV2_VOXEL_GRID__SPARSE_VOXEL_GRID_HPP_
+
+#include <stdint.h>
+#include <limits.h>
+
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+#include "nav2_voxel_grid/voxel_grid.hpp"
+
+namespace nav2_voxel_grid
+{
+
+/**
+ * @class SparseVoxelGrid
+ * @brief A 3D grid structure storing voxels in blocks of columns, which are only allocated
+ *        once a voxel in them is known. Columns have two 64 bit masks, using the encoding of
+ *        VoxelGrid, giving a limit of 64 vertical cells. Untouched parts of large grids use
+ *        no memory.
+ */
+class SparseVoxelGrid
+{
+public:
+  /// @brief Maximum number of vertical cells
+  static constexpr unsigned int MAX_SIZE_Z = 64;
+  /// @brief Side length of the square blocks of columns, in cells
+  static constexpr unsigned int BLOCK_SIZE = 16;
+
+  /**
+   * @struct Column
+   * @brief The voxels of a column. Bits set in both masks are marked, set only in the low
+   * mask are unknown and clear in both are free, as in VoxelGrid. Bits above the size of
+   * the grid are unknown.
+   */
+  struct Column
+  {
+    uint64_t low{~static_cast<uint64_t>(0)};
+    uint64_t high{0};
+
+    inline bool isUnknown() const
+    {
+      return low == ~static_cast<uint64_t>(0) && high == 0;
+    }
+  };
+
+  /**
+   * @brief  Constructor for a sparse voxel grid
+   * @param size_x The x size of the grid
+   * @param size_y The y size of the grid
+   * @param size_z The z size of the grid, only sizes <= 64 are supported
+   */
+  SparseVoxelGrid(unsigned int size_x, unsigned int size_y, unsigned int size_z);
+
+  /**
+   * @brief  Resizes a sparse voxel grid to the desired size, making all voxels unknown
+   * @param size_x The x size of the grid
+   * @param size_y The y size of the grid
+   * @param size_z The z size of the grid, only sizes <= 64 are supported
+   */
+  void resize(unsigned int size_x, unsigned int size_y, unsigned int size_z);
+
+  /**
+   * @brief  Makes all voxels unknown, releasing the memory of all blocks
+   */
+  void reset();
+
+  /**
+   * @brief  Shifts the contents of the grid, for rolling windows. The voxels at (x, y) are
+   * moved to (x - shift_x, y - shift_y) and voxels shifted in are unknown.
+   * @param shift_x Number of cells to shift by in x
+   * @param shift_y Number of cells to shift by in y
+   */
+  void shift(int shift_x, int shift_y);
+
+  unsigned int sizeX() const {return size_x_;}
+  unsigned int sizeY() const {return size_y_;}
+  unsigned int sizeZ() const {return size_z_;}
+
+  /**
+   * @brief  Get the number of allocated blocks of columns
+   */
+  unsigned int numBlocks() const;
+
+  inline bool markVoxelInMap(
+    unsigned int x, unsigned int y, unsigned int z,
+    unsigned int marked_threshold)
+  {
+    if (x >= size_x_ || y >= size_y_ || z >= size_z_) {
+      return false;
+    }
+
+    Column & col = getColumn(x, y);
+    const uint64_t mask = static_cast<uint64_t>(1) << z;
+    col.low |= mask;  // clear unknown and mark cell
+    col.high |= mask;
+
+    // make sure the number of bits in each is below our thresholds
+    return !bitsBelowThreshold(col.high, marked_threshold);
+  }
+
+  VoxelStatus getVoxel(unsigned int x, unsigned int y, unsigned int z) const;
+
+  // Are there any obstacles at that (x, y) location in the grid?
+  VoxelStatus getVoxelColumn(
+    unsigned int x, unsigned int y,
+    unsigned int unknown_threshold = 0, unsigned int marked_threshold = 0) const;
+
+  /**
+   * @brief  Clears the voxels of a line, or of it in a range of x cells, updating the 2D map
+   * as VoxelGrid::clearVoxelLineInMap(). Lines may be cleared concurrently over disjoint
+   * ranges aligned to BLOCK_SIZE.
+   * @param min_x The first x cell of the range
+   * @param max_x The x cell past the end of the range
+   */
+  void clearVoxelLineInMap(
+    double x0, double y0, double z0, double x1, double y1, double z1, unsigned char * map_2d,
+    unsigned int unknown_threshold, unsigned int mark_threshold,
+    unsigned char free_cost = 0, unsigned char unknown_cost = 255,
+    unsigned int max_length = UINT_MAX, unsigned int min_length = 0,
+    unsigned int min_x = 0, unsigned int max_x = UINT_MAX);
+
+  /**
+   * @brief  Copy the lowest 16 vertical cells into the dense format of VoxelGrid
+   * @param data Array of sizeX() * sizeY() columns to fill
+   */
+  void getDenseData(uint32_t * data) const;
+
+  static inline bool bitsBelowThreshold(uint64_t n, unsigned int bit_threshold)
+  {
+    return std::bitset<64>(n).count() <= bit_threshold;
+  }
+
+protected:
+  struct Block
+  {
+    Column columns[BLOCK_SIZE * BLOCK_SIZE];
+  };
+
+  inline unsigned int blockIndex(unsigned int x, unsigned int y) const
+  {
+    return (y / BLOCK_SIZE) * blocks_x_ + x / BLOCK_SIZE;
+  }
+
+  inline unsigned int columnIndex(unsigned int x, unsigned int y) const
+  {
+    return (y % BLOCK_SIZE) * BLOCK_SIZE + x % BLOCK_SIZE;
+  }
+
+  /**
+   * @brief  Get a column for writing, allocating its block if needed
+   */
+  inline Column & getColumn(unsigned int x, unsigned int y)
+  {
+    std::unique_ptr<Block> & block = blocks_[blockIndex(x, y)];
+    if (!block) {
+      block = std::make_unique<Block>();
+    }
+    return block->columns[columnIndex(x, y)];
+  }
+
+  /**
+   * @brief  Get a column for reading, or nullptr if unknown
+   */
+  inline const Column * findColumn(unsigned int x, unsigned int y) const
+  {
+    const std::unique_ptr<Block> & block = blocks_[blockIndex(x, y)];
+    return block ? &block->columns[columnIndex(x, y)] : nullptr;
+  }
+
+  unsigned int size_x_, size_y_, size_z_;
+  unsigned int blocks_x_, blocks_y_;
+  std::vector<std::unique_ptr<Block>> blocks_;
+};
+
+}  // namespace nav2_voxel_grid
+
+#endif  // NAV2_VOXEL_GRID__SPARSE_VOXEL_GRID_HPP_
@@ -209,6 +209,20 @@ public:
     unsigned char free_cost = 0, unsigned char unknown_cost = 255,
     unsigned int max_length = UINT_MAX, unsigned int min_length = 0);
 
+  /**
+   * @brief  Clears the voxels of a line that are in a range of x cells, updating the 2D map.
+   * Clearing a line over disjoint ranges clears the same voxels as clearVoxelLineInMap(),
+   * so lines may be cleared concurrently over disjoint ranges.
+   * @param min_x The first x cell of the range
+   * @param max_x The x cell past the end of the range
+   */
+  void clearVoxelLineInMapRange(
+    double x0, double y0, double z0, double x1, double y1, double z1, unsigned char * map_2d,
+    unsigned int unknown_threshold, unsigned int mark_threshold,
+    unsigned char free_cost, unsigned char unknown_cost,
+    unsigned int max_length, unsigned int min_length,
+    unsigned int min_x, unsigned int max_x);
+
   VoxelStatus getVoxel(unsigned int x, unsigned int y, unsigned int z);
 
   // Are there any obstacles at that (x, y) location in the grid?
@@ -222,11 +236,16 @@ public:
   unsigned int sizeY();
   unsigned int sizeZ();
 
+  /**
+   * @brief  Applies an action to the voxels of a line, or to those of them in a range of x cells
+   * @param min_x The first x cell of the range
+   * @param max_x The x cell past the end of the range
+   */
   template<class ActionType>
   inline void raytraceLine(
     ActionType at, double x0, double y0, double z0,
     double x1, double y1, double z1, unsigned int max_length = UINT_MAX,
-    unsigned int min_length = 0)
+    unsigned int min_length = 0, unsigned int min_x = 0, unsigned int max_x = UINT_MAX)
   {
     // we need to chose how much to scale our dominant dimension, based on the
     // maximum length of the line
@@ -269,6 +288,17 @@ public:
     GridOffset grid_off(offset);
     ZOffset z_off(z_mask);
 
+    // the range of x cells, as a range of the number of steps taken along x
+    int start_x = static_cast<int>(min_x0);
+    int64_t x_steps_begin, x_steps_end;
+    if (dx > 0) {
+      x_steps_begin = static_cast<int64_t>(min_x) - start_x;
+      x_steps_end = static_cast<int64_t>(max_x) - start_x;
+    } else {
+      x_steps_begin = static_cast<int64_t>(start_x) - max_x + 1;
+      x_steps_end = static_cast<int64_t>(start_x) - min_x + 1;
+    }
+
     // is x dominant
     if (abs_dx >= max(abs_dy, abs_dz)) {
       int error_y = abs_dx / 2;
@@ -276,7 +306,8 @@ public:
 
       bresenham3D(
         at, grid_off, grid_off, z_off, abs_dx, abs_dy, abs_dz, error_y, error_z,
-        offset_dx, offset_dy, offset_dz, offset, z_mask, (unsigned int)(scale * abs_dx));
+        offset_dx, offset_dy, offset_dz, offset, z_mask, (unsigned int)(scale * abs_dx),
+        firstStep(x_steps_begin, 0, abs_dx, abs_dx), firstStep(x_steps_end, 0, abs_dx, abs_dx));
       return;
     }
 
@@ -287,7 +318,9 @@ public:
 
       bresenham3D(
         at, grid_off, grid_off, z_off, abs_dy, abs_dx, abs_dz, error_x, error_z,
-        offset_dy, offset_dx, offset_dz, offset, z_mask, (unsigned int)(scale * abs_dy));
+        offset_dy, offset_dx, offset_dz, offset, z_mask, (unsigned int)(scale * abs_dy),
+        firstStep(x_steps_begin, error_x, abs_dx, abs_dy),
+        firstStep(x_steps_end, error_x, abs_dx, abs_dy));
       return;
     }
 
@@ -297,19 +330,70 @@ public:
 
     bresenham3D(
       at, z_off, grid_off, grid_off, abs_dz, abs_dx, abs_dy, error_x, error_y, offset_dz,
-      offset_dx, offset_dy, offset, z_mask, (unsigned int)(scale * abs_dz));
+      offset_dx, offset_dy, offset, z_mask, (unsigned int)(scale * abs_dz),
+      firstStep(x_steps_begin, error_x, abs_dx, abs_dz),
+      firstStep(x_steps_end, error_x, abs_dx, abs_dz));
   }
 
 private:
+  /**
+   * @brief  Get the first step of a line at which an axis has taken a number of steps,
+   * given that the axis has taken floor((error + step * abs_db) / abs_da) steps at each step
+   */
+  static inline unsigned int firstStep(
+    int64_t axis_steps, int error, unsigned int abs_db, unsigned int abs_da)
+  {
+    if (axis_steps <= 0) {
+      return 0;
+    }
+    if (abs_db == 0) {
+      return UINT_MAX;
+    }
+    return static_cast<unsigned int>(
+      std::min<int64_t>(
+        UINT_MAX, (axis_steps * abs_da - error + abs_db - 1) / abs_db));
+  }
+
   // the real work is done here... 3D bresenham implementation
   template<class ActionType, class OffA, class OffB, class OffC>
   inline void bresenham3D(
     ActionType at, OffA off_a, OffB off_b, OffC off_c,
     unsigned int abs_da, unsigned int abs_db, unsigned int abs_dc,
     int error_b, int error_c, int offset_a, int offset_b, int offset_c, unsigned int & offset,
-    unsigned int & z_mask, unsigned int max_length = UINT_MAX)
+    unsigned int & z_mask, unsigned int max_length = UINT_MAX,
+    unsigned int step_begin = 0, unsigned int step_end = UINT_MAX)
   {
     unsigned int end = std::min(max_length, abs_da);
+    if (step_begin > 0 || step_end <= end) {
+      // only visit the voxels of steps [step_begin, step_end), jumping to the first of them
+      step_end = std::min(step_end, end + 1);
+      if (step_begin >= step_end) {
+        return;
+      }
+      const uint64_t total_b = error_b + static_cast<uint64_t>(step_begin) * abs_db;
+      const uint64_t total_c = error_c + static_cast<uint64_t>(step_begin) * abs_dc;
+      off_a.advance(offset_a, step_begin);
+      off_b.advance(offset_b, static_cast<unsigned int>(total_b / abs_da));
+      off_c.advance(offset_c, static_cast<unsigned int>(total_c / abs_da));
+      error_b = static_cast<int>(total_b % abs_da);
+      error_c = static_cast<int>(total_c % abs_da);
+      for (unsigned int i = step_begin; i < step_end; ++i) {
+        at(offset, z_mask);
+        off_a(offset_a);
+        error_b += abs_db;
+        error_c += abs_dc;
+        if ((unsigned int)error_b >= abs_da) {
+          off_b(offset_b);
+          error_b -= abs_da;
+        }
+        if ((unsigned int)error_c >= abs_da) {
+          off_c(offset_c);
+          error_c -= abs_da;
+        }
+      }
+      return;
+    }
+
     for (unsigned int i = 0; i < end; ++i) {
       at(offset, z_mask);
       off_a(offset_a);
@@ -433,6 +517,10 @@ public:
     {
       offset_ += offset_val;
     }
+    inline void advance(int offset_val, unsigned int count)
+    {
+      offset_ += offset_val * static_cast<int>(count);
+    }
 
 private:
     unsigned int & offset_;
@@ -447,6 +535,10 @@ public:
     {
       offset_val > 0 ? z_mask_ <<= 1 : z_mask_ >>= 1;
     }
+    inline void advance(int offset_val, unsigned int count)
+    {
+      offset_val > 0 ? z_mask_ <<= count : z_mask_ >>= count;
+    }
 
 private:
     unsigned int & z_mask_;
@@ -0,0 +1,291 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "nav2_voxel_grid/sparse_voxel_grid.hpp"
+
+#include <utility>
+
+#include <rclcpp/logger.hpp>
+#include <rclcpp/logging.hpp>
+
+namespace nav2_voxel_grid
+{
+
+namespace
+{
+
+/**
+ * @brief Get the first step of a line at which an axis has taken a number of steps,
+ * given that the axis has taken floor((error + step * abs_db) / abs_da) steps at each step
+ */
+inline unsigned int firstStep(
+  int64_t axis_steps, int error, unsigned int abs_db, unsigned int abs_da)
+{
+  if (axis_steps <= 0) {
+    return 0;
+  }
+  if (abs_db == 0) {
+    return UINT_MAX;
+  }
+  return static_cast<unsigned int>(
+    std::min<int64_t>(UINT_MAX, (axis_steps * abs_da - error + abs_db - 1) / abs_db));
+}
+
+}  // namespace
+
+SparseVoxelGrid::SparseVoxelGrid(unsigned int size_x, unsigned int size_y, unsigned int size_z)
+: size_x_(0), size_y_(0), size_z_(0), blocks_x_(0), blocks_y_(0)
+{
+  resize(size_x, size_y, size_z);
+}
+
+void SparseVoxelGrid::resize(unsigned int size_x, unsigned int size_y, unsigned int size_z)
+{
+  if (size_z > MAX_SIZE_Z) {
+    RCLCPP_INFO(
+      rclcpp::get_logger("voxel_grid"),
+      "Error, this implementation can only support up to %u z values (%u)", MAX_SIZE_Z, size_z);
+    size_z = MAX_SIZE_Z;
+  }
+
+  size_x_ = size_x;
+  size_y_ = size_y;
+  size_z_ = size_z;
+  blocks_x_ = (size_x_ + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  blocks_y_ = (size_y_ + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  blocks_.clear();
+  blocks_.resize(static_cast<size_t>(blocks_x_) * blocks_y_);
+}
+
+void SparseVoxelGrid::reset()
+{
+  for (auto & block : blocks_) {
+    block.reset();
+  }
+}
+
+void SparseVoxelGrid::shift(int shift_x, int shift_y)
+{
+  std::vector<std::unique_ptr<Block>> old_blocks(blocks_.size());
+  old_blocks.swap(blocks_);
+
+  // copy over the known columns that stay within the grid
+  for (unsigned int block_y = 0; block_y < blocks_y_; ++block_y) {
+    for (unsigned int block_x = 0; block_x < blocks_x_; ++block_x) {
+      const std::unique_ptr<Block> & block = old_blocks[block_y * blocks_x_ + block_x];
+      if (!block) {
+        continue;
+      }
+      for (unsigned int i = 0; i < BLOCK_SIZE * BLOCK_SIZE; ++i) {
+        const Column & col = block->columns[i];
+        const int x = static_cast<int>(block_x * BLOCK_SIZE + i % BLOCK_SIZE) - shift_x;
+        const int y = static_cast<int>(block_y * BLOCK_SIZE + i / BLOCK_SIZE) - shift_y;
+        if (col.isUnknown() || x < 0 || y < 0 ||
+          x >= static_cast<int>(size_x_) || y >= static_cast<int>(size_y_))
+        {
+          continue;
+        }
+        getColumn(x, y) = col;
+      }
+    }
+  }
+}
+
+unsigned int SparseVoxelGrid::numBlocks() const
+{
+  return static_cast<unsigned int>(
+    std::count_if(
+      blocks_.begin(), blocks_.end(),
+      [](const std::unique_ptr<Block> & block) {return block != nullptr;}));
+}
+
+VoxelStatus SparseVoxelGrid::getVoxel(unsigned int x, unsigned int y, unsigned int z) const
+{
+  if (x >= size_x_ || y >= size_y_ || z >= size_z_) {
+    return UNKNOWN;
+  }
+  const Column * col = findColumn(x, y);
+  if (!col) {
+    return UNKNOWN;
+  }
+
+  // known marked: 11 = 2 bits, unknown: 01 = 1 bit, known free: 00 = 0 bits
+  unsigned int bits = ((col->low >> z) & 1) + ((col->high >> z) & 1);
+  if (bits < 2) {
+    if (bits < 1) {
+      return FREE;
+    }
+    return UNKNOWN;
+  }
+  return MARKED;
+}
+
+VoxelStatus SparseVoxelGrid::getVoxelColumn(
+  unsigned int x, unsigned int y,
+  unsigned int unknown_threshold, unsigned int marked_threshold) const
+{
+  if (x >= size_x_ || y >= size_y_) {
+    return UNKNOWN;
+  }
+
+  const Column unknown_col;
+  const Column * col = findColumn(x, y);
+  if (!col) {
+    col = &unknown_col;
+  }
+
+  // check if the number of marked bits qualifies the col as marked
+  if (!bitsBelowThreshold(col->high, marked_threshold)) {
+    return MARKED;
+  }
+
+  // check if the number of unknown bits qualifies the col as unknown
+  if (!bitsBelowThreshold(col->low ^ col->high, unknown_threshold)) {
+    return UNKNOWN;
+  }
+
+  return FREE;
+}
+
+void SparseVoxelGrid::clearVoxelLineInMap(
+  double x0, double y0, double z0, double x1, double y1, double z1, unsigned char * map_2d,
+  unsigned int unknown_threshold, unsigned int mark_threshold, unsigned char free_cost,
+  unsigned char unknown_cost, unsigned int max_length, unsigned int min_length,
+  unsigned int min_x, unsigned int max_x)
+{
+  if (x0 >= size_x_ || y0 >= size_y_ || z0 >= size_z_ || x1 >= size_x_ || y1 >= size_y_ ||
+    z1 >= size_z_)
+  {
+    RCLCPP_DEBUG(
+      rclcpp::get_logger("voxel_grid"),
+      "Error, line endpoint out of bounds. "
+      "(%.2f, %.2f, %.2f) to (%.2f, %.2f, %.2f),  size: (%d, %d, %d)",
+      x0, y0, z0, x1, y1, z1, size_x_, size_y_, size_z_);
+    return;
+  }
+
+  // we need to chose how much to scale our dominant dimension, based on the
+  // maximum length of the line, tracing the same voxels as VoxelGrid::raytraceLine()
+  double dist = sqrt((x0 - x1) * (x0 - x1) + (y0 - y1) * (y0 - y1) + (z0 - z1) * (z0 - z1));
+  if ((unsigned int)(dist) < min_length) {
+    return;
+  }
+  double scale = 1.0;
+  double start[3] = {x0, y0, z0};
+  if (dist > 0.0) {
+    scale = std::min(1.0, max_length / dist);
+
+    // Updating starting point to the point at distance min_length from the initial point
+    start[0] = x0 + (x1 - x0) / dist * min_length;
+    start[1] = y0 + (y1 - y0) / dist * min_length;
+    start[2] = z0 + (z1 - z0) / dist * min_length;
+  }
+
+  int pos[3] = {
+    static_cast<int>(start[0]), static_cast<int>(start[1]), static_cast<int>(start[2])};
+  const int delta[3] = {
+    static_cast<int>(x1) - pos[0], static_cast<int>(y1) - pos[1], static_cast<int>(z1) - pos[2]};
+  const unsigned int abs_delta[3] = {
+    static_cast<unsigned int>(std::abs(delta[0])), static_cast<unsigned int>(std::abs(delta[1])),
+    static_cast<unsigned int>(std::abs(delta[2]))};
+  const int step[3] = {delta[0] > 0 ? 1 : -1, delta[1] > 0 ? 1 : -1, delta[2] > 0 ? 1 : -1};
+
+  // the dominant axis a is stepped along every step, axes b and c when their error overflows
+  unsigned int a = 2, b = 0, c = 1;
+  if (abs_delta[0] >= std::max(abs_delta[1], abs_delta[2])) {
+    a = 0;
+    b = 1;
+    c = 2;
+  } else if (abs_delta[1] >= abs_delta[2]) {
+    a = 1;
+    b = 0;
+    c = 2;
+  }
+  const unsigned int abs_da = abs_delta[a], abs_db = abs_delta[b], abs_dc = abs_delta[c];
+  int error_b = abs_da / 2;
+  int error_c = abs_da / 2;
+  const unsigned int end = std::min(static_cast<unsigned int>(scale * abs_da), abs_da);
+
+  // the range of steps within the range of x cells
+  int64_t x_steps_begin, x_steps_end;
+  if (delta[0] > 0) {
+    x_steps_begin = static_cast<int64_t>(min_x) - pos[0];
+    x_steps_end = static_cast<int64_t>(max_x) - pos[0];
+  } else {
+    x_steps_begin = static_cast<int64_t>(pos[0]) - max_x + 1;
+    x_steps_end = static_cast<int64_t>(pos[0]) - min_x + 1;
+  }
+  const int x_error = a == 0 ? 0 : abs_da / 2;
+  unsigned int step_begin = firstStep(x_steps_begin, x_error, abs_delta[0], abs_da);
+  unsigned int step_end = std::min(firstStep(x_steps_end, x_error, abs_delta[0], abs_da), end + 1);
+  if (step_begin >= step_end) {
+    return;
+  }
+
+  // jump to the first step
+  if (step_begin > 0) {
+    const uint64_t total_b = error_b + static_cast<uint64_t>(step_begin) * abs_db;
+    const uint64_t total_c = error_c + static_cast<uint64_t>(step_begin) * abs_dc;
+    pos[a] += step[a] * static_cast<int>(step_begin);
+    pos[b] += step[b] * static_cast<int>(total_b / abs_da);
+    pos[c] += step[c] * static_cast<int>(total_c / abs_da);
+    error_b = static_cast<int>(total_b % abs_da);
+    error_c = static_cast<int>(total_c % abs_da);
+  }
+
+  for (unsigned int i = step_begin; i < step_end; ++i) {
+    const unsigned int x = pos[0], y = pos[1], z = pos[2];
+    if (x < size_x_ && y < size_y_ && z < size_z_) {
+      Column & col = getColumn(x, y);
+      const uint64_t mask = static_cast<uint64_t>(1) << z;
+      col.low &= ~mask;  // clear unknown and clear cell
+      col.high &= ~mask;
+
+      // make sure the number of bits in each is below our thresholds
+      if (map_2d && bitsBelowThreshold(col.high, mark_threshold)) {
+        if (bitsBelowThreshold(col.low ^ col.high, unknown_threshold)) {
+          map_2d[y * size_x_ + x] = free_cost;
+        } else {
+          map_2d[y * size_x_ + x] = unknown_cost;
+        }
+      }
+    }
+
+    pos[a] += step[a];
+    error_b += abs_db;
+    error_c += abs_dc;
+    if ((unsigned int)error_b >= abs_da) {
+      pos[b] += step[b];
+      error_b -= abs_da;
+    }
+    if ((unsigned int)error_c >= abs_da) {
+      pos[c] += step[c];
+      error_c -= abs_da;
+    }
+  }
+}
+
+void SparseVoxelGrid::getDenseData(uint32_t * data) const
+{
+  const uint32_t unknown_col = ~((uint32_t)0) >> 16;
+  for (unsigned int y = 0; y < size_y_; ++y) {
+    for (unsigned int x = 0; x < size_x_; ++x) {
+      const Column * col = findColumn(x, y);
+      data[y * size_x_ + x] = col ?
+        static_cast<uint32_t>((col->high & 0xFFFF) << 16 | (col->low & 0xFFFF)) : unknown_col;
+    }
+  }
+}
+
+}  // namespace nav2_voxel_grid
@@ -172,6 +172,27 @@ void VoxelGrid::clearVoxelLineInMap(
   raytraceLine(cvm, x0, y0, z0, x1, y1, z1, max_length, min_length);
 }
 
+void VoxelGrid::clearVoxelLineInMapRange(
+  double x0, double y0, double z0, double x1, double y1, double z1, unsigned char * map_2d,
+  unsigned int unknown_threshold, unsigned int mark_threshold, unsigned char free_cost,
+  unsigned char unknown_cost, unsigned int max_length, unsigned int min_length,
+  unsigned int min_x, unsigned int max_x)
+{
+  if (x0 >= size_x_ || y0 >= size_y_ || z0 >= size_z_ || x1 >= size_x_ || y1 >= size_y_ ||
+    z1 >= size_z_)
+  {
+    RCLCPP_DEBUG(
+      logger,
+      "Error, line endpoint out of bounds. "
+      "(%.2f, %.2f, %.2f) to (%.2f, %.2f, %.2f),  size: (%d, %d, %d)",
+      x0, y0, z0, x1, y1, z1, size_x_, size_y_, size_z_);
+    return;
+  }
+
+  ClearVoxelInMap cvm(data_, map_2d, unknown_threshold, mark_threshold, free_cost, unknown_cost);
+  raytraceLine(cvm, x0, y0, z0, x1, y1, z1, max_length, min_length, min_x, max_x);
+}
+
 VoxelStatus VoxelGrid::getVoxel(unsigned int x, unsigned int y, unsigned int z)
 {
   if (x >= size_x_ || y >= size_y_ || z >= size_z_) {
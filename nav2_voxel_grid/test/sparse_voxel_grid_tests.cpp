@@ -0,0 +1,152 @@
+// Copyright (c) 2025 Open Navigation LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <random>
+#include <vector>
+
+#include "nav2_voxel_grid/sparse_voxel_grid.hpp"
+#include "nav2_voxel_grid/voxel_grid.hpp"
+
+using nav2_voxel_grid::SparseVoxelGrid;
+using nav2_voxel_grid::VoxelGrid;
+
+TEST(sparse_voxel_grid, MarkAndClear) {
+  SparseVoxelGrid vg(100, 100, 40);
+  EXPECT_EQ(vg.numBlocks(), 0u);
+  EXPECT_EQ(vg.getVoxel(5, 5, 35), nav2_voxel_grid::UNKNOWN);
+
+  // Voxels above the 16 levels of the dense grid are supported
+  EXPECT_TRUE(vg.markVoxelInMap(5, 5, 35, 0));
+  EXPECT_EQ(vg.getVoxel(5, 5, 35), nav2_voxel_grid::MARKED);
+  EXPECT_EQ(vg.getVoxelColumn(5, 5), nav2_voxel_grid::MARKED);
+  EXPECT_EQ(vg.numBlocks(), 1u);
+
+  unsigned char map_2d[100 * 100] = {0};
+  map_2d[5 * 100 + 5] = 254;
+  vg.clearVoxelLineInMap(5, 5, 0, 5, 5, 39, map_2d, 64, 0);
+  EXPECT_EQ(vg.getVoxel(5, 5, 35), nav2_voxel_grid::FREE);
+  EXPECT_EQ(map_2d[5 * 100 + 5], 0);
+
+  vg.reset();
+  EXPECT_EQ(vg.numBlocks(), 0u);
+  EXPECT_EQ(vg.getVoxel(5, 5, 35), nav2_voxel_grid::UNKNOWN);
+}
+
+TEST(sparse_voxel_grid, InvalidSize) {
+  SparseVoxelGrid vg(10, 10, 100);
+  EXPECT_EQ(vg.sizeZ(), SparseVoxelGrid::MAX_SIZE_Z);
+  EXPECT_FALSE(vg.markVoxelInMap(10, 0, 0, 0));
+  EXPECT_EQ(vg.getVoxel(0, 10, 0), nav2_voxel_grid::UNKNOWN);
+}
+
+TEST(sparse_voxel_grid, MatchesDenseGrid) {
+  const unsigned int size_x = 70, size_y = 50, size_z = 12;
+  VoxelGrid dense(size_x, size_y, size_z);
+  SparseVoxelGrid sparse(size_x, size_y, size_z), sparse_ranges(size_x, size_y, size_z);
+  std::vector<unsigned char> dense_map(size_x * size_y, 100);
+  std::vector<unsigned char> sparse_map(dense_map), sparse_ranges_map(dense_map);
+
+  std::mt19937 generator(42);
+  for (int i = 0; i < 300; ++i) {
+    unsigned int x = generator() % size_x, y = generator() % size_y, z = generator() % size_z;
+    dense.markVoxelInMap(x, y, z, 0);
+    sparse.markVoxelInMap(x, y, z, 0);
+    sparse_ranges.markVoxelInMap(x, y, z, 0);
+  }
+
+  // The unknown bits above the height of the grid count towards the unknown threshold
+  const unsigned int dense_unknown_threshold = 2 + 16 - size_z;
+  const unsigned int sparse_unknown_threshold = 2 + SparseVoxelGrid::MAX_SIZE_Z - size_z;
+  std::uniform_real_distribution<double> ux(0.0, size_x - 0.01), uy(0.0, size_y - 0.01);
+  std::uniform_real_distribution<double> uz(0.0, size_z - 0.01);
+  std::vector<std::array<double, 3>> ends;
+  for (int i = 0; i < 200; ++i) {
+    ends.push_back({ux(generator), uy(generator), uz(generator)});
+  }
+  for (const auto & end : ends) {
+    dense.clearVoxelLineInMap(
+      35.5, 25.5, 6.5, end[0], end[1], end[2], dense_map.data(), dense_unknown_threshold, 0,
+      0, 255, 30, 2);
+    sparse.clearVoxelLineInMap(
+      35.5, 25.5, 6.5, end[0], end[1], end[2], sparse_map.data(), sparse_unknown_threshold, 0,
+      0, 255, 30, 2);
+  }
+
+  // Clearing over ranges of x cells, as when clearing in parallel, is the same
+  for (unsigned int min_x = 0; min_x < size_x; min_x += SparseVoxelGrid::BLOCK_SIZE) {
+    for (const auto & end : ends) {
+      sparse_ranges.clearVoxelLineInMap(
+        35.5, 25.5, 6.5, end[0], end[1], end[2], sparse_ranges_map.data(),
+        sparse_unknown_threshold, 0, 0, 255, 30, 2, min_x, min_x + SparseVoxelGrid::BLOCK_SIZE);
+    }
+  }
+
+  EXPECT_EQ(dense_map, sparse_map);
+  EXPECT_EQ(sparse_map, sparse_ranges_map);
+  std::vector<uint32_t> sparse_data(size_x * size_y);
+  sparse.getDenseData(sparse_data.data());
+  EXPECT_EQ(std::vector<uint32_t>(dense.getData(), dense.getData() + size_x * size_y), sparse_data);
+}
+
+TEST(sparse_voxel_grid, Shift) {
+  SparseVoxelGrid vg(40, 40, 20);
+  vg.markVoxelInMap(20, 20, 18, 0);
+  vg.markVoxelInMap(2, 2, 3, 0);
+
+  vg.shift(5, -3);
+  EXPECT_EQ(vg.getVoxel(15, 23, 18), nav2_voxel_grid::MARKED);
+  EXPECT_EQ(vg.getVoxel(20, 20, 18), nav2_voxel_grid::UNKNOWN);
+  EXPECT_EQ(vg.numBlocks(), 1u);
+}
+
+TEST(voxel_grid, clearVoxelLineInMapRange) {
+  const unsigned int size_x = 60, size_y = 60, size_z = 16;
+  VoxelGrid full(size_x, size_y, size_z), ranges(size_x, size_y, size_z);
+  std::vector<unsigned char> full_map(size_x * size_y, 100), ranges_map(full_map);
+
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> uxy(0.0, size_x - 0.01), uz(0.0, size_z - 0.01);
+  std::vector<std::array<double, 3>> ends;
+  for (int i = 0; i < 200; ++i) {
+    ends.push_back({uxy(generator), uxy(generator), uz(generator)});
+  }
+  for (const auto & end : ends) {
+    full.clearVoxelLineInMap(10.5, 40.5, 1.5, end[0], end[1], end[2], full_map.data(), 16, 0);
+  }
+
+  // Clearing over disjoint ranges in any order clears the same voxels
+  for (int min_x = size_x - 7; min_x > -7; min_x -= 7) {
+    for (const auto & end : ends) {
+      ranges.clearVoxelLineInMapRange(
+        10.5, 40.5, 1.5, end[0], end[1], end[2], ranges_map.data(), 16, 0, 0, 255,
+        UINT_MAX, 0, std::max(min_x, 0), min_x + 7);
+    }
+  }
+
+  EXPECT_EQ(full_map, ranges_map);
+  EXPECT_EQ(
+    std::vector<uint32_t>(full.getData(), full.getData() + size_x * size_y),
+    std::vector<uint32_t>(ranges.getData(), ranges.getData() + size_x * size_y));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}